@@ -0,0 +1,303 @@
+//
+// Benchmark of the search engines on the standard sets of instances.
+//
+// Usage:
+//    bench-instances [--engine NAME] [--time SECONDS] [--max-expanded N] [--json PATH] FILE
+//
+//    NAME - astar (default), epea, idastar, idastar-basic, idastar-tt-M, bfhs, extastar-M,
+//           wastar-W (Weighted A* with integer weight W) or alstar-K (A* with lookahead of depth K), see EngineRegistry.h
+//    FILE - text or binary file with instances, e.g. bench/data/korf100.txt for the board 4x4
+//           or bench/data/graded24.txt for the board 5x5
+//
+// For each instance the following values are reported:
+//    the length of the solution, number of expanded nodes, nodes per second,
+//    peak resident memory and wall time.
+// Each instance is solved by the fresh engine, hence the results do not depend on
+// the order of instances. The limits are applied to each instance separately.
+//
+// With option "--json" the results are written in JSON format as well ("-" is standard output).
+// The JSON file holds the results (and the metrics) of each instance, the summary and the results
+// aggregated by the length of solution. Hence, the files written by different commits
+// can be compared directly.
+//
+
+#include "EngineRegistry.h"
+#include "InstanceReader.h"
+#include "BinaryFormat.h"
+#include "Limits.h"
+#include <sys/resource.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// Result of single instance
+struct Result
+{
+    size_t m_id = 0;
+    bool m_solved = false;
+    size_t m_length = 0;
+    size_t m_expandedNo = 0;
+    double m_seconds = 0;
+    long m_peakKb = 0;
+
+    // Metrics of the engine in JSON format, empty if not available
+    std::string m_metrics;
+
+    double NodesPerSec( ) const { return m_seconds > 0 ? m_expandedNo / m_seconds : 0; }
+};
+
+//
+// Resets the peak resident memory of the process to the current resident memory.
+// Returns "false", if the kernel does not support it.
+//
+bool ResetPeakMemory( )
+{
+    FILE* f = fopen( "/proc/self/clear_refs", "w" );
+    if( !f )
+        return false;
+
+    const bool ok = ( fputs( "5", f ) >= 0 );
+    return ( fclose( f ) == 0 ) && ok;
+}
+
+//
+// Returns the peak resident memory of the process in kilobytes
+//
+long PeakMemory( )
+{
+    FILE* f = fopen( "/proc/self/status", "r" );
+    if( f )
+    {
+        char line[ 256 ];
+        long kb = -1;
+        while( fgets( line, sizeof( line ), f ) )
+        {
+            if( strncmp( line, "VmHWM:", 6 ) == 0 )
+            {
+                kb = atol( line + 6 );
+                break;
+            }
+        }
+        fclose( f );
+        if( kb >= 0 )
+            return kb;
+    }
+
+    // Fallback: peak of the whole process
+    struct rusage ru;
+    getrusage( RUSAGE_SELF, &ru );
+    return ru.ru_maxrss;
+}
+
+//
+// Passes all instances from file "path" to "solve"
+//
+template< typename F >
+void ForEachInstance( const std::string& path, F solve )
+{
+    if( BinaryFile::IsBinary( path ) )
+    {
+        BinaryReader in( path );
+        in.ForEach( solve );
+    }
+    else
+    {
+        InstanceReader in( path );
+        in.ForEach( solve );
+    }
+}
+
+//
+// Writes results in JSON format
+//
+void WriteJson( const std::vector< Result >& res, const std::string& engine, const std::string& input, const std::string& path )
+{
+    FILE* out = ( path == "-" ) ? stdout : fopen( path.c_str(), "w" );
+    if( !out )
+        throw std::invalid_argument( "Cannot open file.\nPath = " + path );
+
+    fprintf( out, "{\n" );
+    fprintf( out, "  \"width\": %u,\n", State::WIDTH );
+    fprintf( out, "  \"engine\": \"%s\",\n", engine.c_str() );
+    fprintf( out, "  \"input\": \"%s\",\n", input.c_str() );
+
+    // Results of instances
+    fprintf( out, "  \"instances\": [\n" );
+    for( size_t i = 0; i < res.size(); i++ )
+    {
+        const Result& r = res[ i ];
+        fprintf( out, "    { \"id\": %zu, \"solved\": %s, \"length\": %zu, \"expanded\": %zu, "
+            "\"seconds\": %.6f, \"nodes_per_sec\": %.0f, \"peak_rss_kb\": %ld%s%s }%s\n",
+            r.m_id, r.m_solved ? "true" : "false", r.m_length, r.m_expandedNo,
+            r.m_seconds, r.NodesPerSec(), r.m_peakKb,
+            r.m_metrics.empty() ? "" : ", \"metrics\": ", r.m_metrics.c_str(),
+            ( i + 1 < res.size() ) ? "," : "" );
+    }
+    fprintf( out, "  ],\n" );
+
+    // Summary
+    size_t solvedNo = 0;
+    size_t expandedNo = 0;
+    double seconds = 0;
+    long peakKb = 0;
+    for( const Result& r : res )
+    {
+        solvedNo += r.m_solved;
+        expandedNo += r.m_expandedNo;
+        seconds += r.m_seconds;
+        peakKb = std::max( peakKb, r.m_peakKb );
+    }
+
+    fprintf( out, "  \"summary\": { \"instances\": %zu, \"solved\": %zu, \"expanded\": %zu, "
+        "\"seconds\": %.6f, \"nodes_per_sec\": %.0f, \"max_peak_rss_kb\": %ld },\n",
+        res.size(), solvedNo, expandedNo, seconds, seconds > 0 ? expandedNo / seconds : 0.0, peakKb );
+
+    // Aggregation by the length of solution shows how the cost grows with the depth
+    struct Group
+    {
+        size_t m_no = 0;
+        size_t m_expandedNo = 0;
+        double m_seconds = 0;
+        long m_peakKb = 0;
+    };
+
+    std::map< size_t, Group > group;
+    for( const Result& r : res )
+    {
+        if( !r.m_solved )
+            continue;
+        Group& g = group[ r.m_length ];
+        g.m_no++;
+        g.m_expandedNo += r.m_expandedNo;
+        g.m_seconds += r.m_seconds;
+        g.m_peakKb = std::max( g.m_peakKb, r.m_peakKb );
+    }
+
+    fprintf( out, "  \"by_length\": [\n" );
+    size_t k = 0;
+    for( const auto& [ length, g ] : group )
+    {
+        fprintf( out, "    { \"length\": %zu, \"instances\": %zu, \"mean_expanded\": %.1f, "
+            "\"mean_seconds\": %.6f, \"max_peak_rss_kb\": %ld }%s\n",
+            length, g.m_no, double( g.m_expandedNo ) / g.m_no, g.m_seconds / g.m_no, g.m_peakKb,
+            ( ++k < group.size() ) ? "," : "" );
+    }
+    fprintf( out, "  ]\n}\n" );
+
+    if( out != stdout )
+        fclose( out );
+}
+
+void Usage( const char* name )
+{
+    fprintf( stderr, "Usage: %s [--engine NAME] [--time SECONDS] [--max-expanded N] [--json PATH] FILE\n", name );
+}
+
+}
+
+int main( int argc, char** argv )
+{
+    std::string engineName = "astar";
+    std::string json;
+    std::string input;
+    Limits limits;
+
+    for( int i = 1; i < argc; i++ )
+    {
+        const std::string arg = argv[ i ];
+        if( arg == "--engine" && i + 1 < argc )
+            engineName = argv[ ++i ];
+        else if( arg == "--time" && i + 1 < argc )
+            limits.m_maxSeconds = atof( argv[ ++i ] );
+        else if( arg == "--max-expanded" && i + 1 < argc )
+            limits.m_maxExpanded = strtoull( argv[ ++i ], nullptr, 10 );
+        else if( arg == "--json" && i + 1 < argc )
+            json = argv[ ++i ];
+        else if( input.empty() && arg.compare( 0, 2, "--" ) != 0 )
+            input = arg;
+        else
+        {
+            Usage( argv[ 0 ] );
+            return 2;
+        }
+    }
+
+    if( input.empty() )
+    {
+        Usage( argv[ 0 ] );
+        return 2;
+    }
+
+    try
+    {
+        EngineRegistry::Params params;
+        EngineRegistry::Find( engineName, "hash", "hash", params );
+    }
+    catch( const std::invalid_argument& e )
+    {
+        fprintf( stderr, "ERROR: %s\n", e.what() );
+        Usage( argv[ 0 ] );
+        return 2;
+    }
+
+    const bool resetPeak = ResetPeakMemory();
+    if( !resetPeak )
+        fprintf( stderr, "WARNING: Peak memory cannot be reset, the peak of the whole process is reported.\n" );
+
+    std::vector< Result > res;
+
+    printf( "BOARD %ux%u, ENGINE %s, INPUT %s\n", State::WIDTH, State::WIDTH, engineName.c_str(), input.c_str() );
+    printf( "   %5s  %6s  %12s  %12s  %10s  %10s\n", "id", "length", "expanded", "nodes/s", "peak[MiB]", "time[s]" );
+
+    try
+    {
+        ForEachInstance( input, [&]( const State& beg )
+        {
+            // Fresh engine, hence the results do not depend on the previous instances
+            std::unique_ptr< Engine > engine = EngineRegistry::Create( engineName );
+            Graph graph;
+
+            if( resetPeak )
+                ResetPeakMemory();
+
+            Limits clock;
+            clock.Start();
+            const std::optional< std::vector< State > > path = engine->Solve( graph, beg, limits );
+
+            Result r;
+            r.m_id = res.size();
+            r.m_seconds = clock.Elapsed();
+            r.m_solved = path.has_value();
+            r.m_length = r.m_solved ? path->size() - 1 : 0;
+            r.m_expandedNo = engine->ExpandedNo();
+            r.m_peakKb = PeakMemory();
+            if( engine->GetMetrics() )
+                r.m_metrics = engine->GetMetrics()->ToJson();
+            res.push_back( r );
+
+            char length[ 16 ];
+            snprintf( length, sizeof( length ), r.m_solved ? "%zu" : "-", r.m_length );
+            printf( "   %5zu  %6s  %12zu  %12.0f  %10.1f  %10.4f\n",
+                r.m_id, length, r.m_expandedNo, r.NodesPerSec(), r.m_peakKb / 1024.0, r.m_seconds );
+            fflush( stdout );
+        } );
+
+        if( !json.empty() )
+            WriteJson( res, engineName, input, json );
+    }
+    catch( const std::invalid_argument& e )
+    {
+        fprintf( stderr, "\nERROR: %s\n", e.what() );
+        return 1;
+    }
+
+    return 0;
+}
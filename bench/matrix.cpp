@@ -0,0 +1,243 @@
+//
+// Benchmark of all combinations of the closed set and the open set of A* (class Astar<CS, OS>).
+//
+// Usage:
+//    bench-matrix [--count N] [--time SECONDS] [--json PATH] FILE
+//
+//    FILE - text or binary file with instances, e.g. bench/data/korf100.txt for the board 4x4
+//           or bench/data/graded24.txt for the board 5x5
+//    N    - only the first N instances are solved
+//
+// Each combination solves the same instances. The limit of time is applied to each instance
+// separately. The combinations must find the solutions of identical (optimal) length.
+// If they do not, the mismatches are reported and the exit code is 1.
+//
+// The table shows, for each combination, the solved instances, the expanded nodes, the time,
+// the nodes per second and the speed-up relative to the default combination
+// (ClosedSetHash, OpenSetHash). With option "--json" the table is written in JSON format as well.
+//
+// New policy is benchmarked after adding one line to function main.
+//
+
+#include "astar.h"
+#include "InstanceReader.h"
+#include "BinaryFormat.h"
+#include "Limits.h"
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// Results of single combination
+struct Row
+{
+    std::string m_name;
+    size_t m_solvedNo = 0;
+    size_t m_expandedNo = 0;
+    double m_seconds = 0;
+
+    // Length of solution of each instance, -1 if not solved
+    std::vector< int > m_length;
+
+    double NodesPerSec( ) const { return m_seconds > 0 ? m_expandedNo / m_seconds : 0; }
+};
+
+//
+// Solves all instances by Astar<CS, OS>
+//
+template< template< typename S > class CS, template< typename S > class OS >
+Row Run( const std::string& name, const std::vector< State >& instances, const Limits& limits )
+{
+    Row row;
+    row.m_name = name;
+
+    // The solver is reused, since its hash tables are large
+    auto as = std::make_unique< Astar< CS, OS > >();
+
+    for( const State& beg : instances )
+    {
+        Graph graph;
+
+        Limits clock;
+        clock.Start();
+        const std::optional< std::vector< State > > path = as->Find( graph, beg, limits );
+
+        row.m_seconds += clock.Elapsed();
+        row.m_expandedNo += as->ExpandedNo();
+        row.m_length.push_back( path.has_value() ? int( path->size() ) - 1 : -1 );
+        row.m_solvedNo += path.has_value();
+    }
+
+    printf( "   %-28s %6zu %12zu %10.3f %12.0f\n", name.c_str(), row.m_solvedNo, row.m_expandedNo, row.m_seconds, row.NodesPerSec() );
+    fflush( stdout );
+    return row;
+}
+
+//
+// Reads all instances from file "path"
+//
+std::vector< State > ReadInstances( const std::string& path, size_t count )
+{
+    std::vector< State > instances;
+    auto add = [&instances, count]( const State& s )
+    {
+        if( instances.size() < count )
+            instances.push_back( s );
+    };
+
+    if( BinaryFile::IsBinary( path ) )
+    {
+        BinaryReader in( path );
+        in.ForEach( add );
+    }
+    else
+    {
+        InstanceReader in( path );
+        in.ForEach( add );
+    }
+    return instances;
+}
+
+//
+// Compares the lengths of solutions found by all combinations.
+// Returns the number of mismatches.
+//
+size_t Verify( const std::vector< Row >& rows, size_t instanceNo )
+{
+    size_t mismatchNo = 0;
+    for( size_t i = 0; i < instanceNo; i++ )
+    {
+        int length = -1;
+        bool ok = true;
+        for( const Row& r : rows )
+        {
+            if( r.m_length[ i ] < 0 )
+                continue;
+            if( length < 0 )
+                length = r.m_length[ i ];
+            ok = ok && ( r.m_length[ i ] == length );
+        }
+
+        if( ok )
+            continue;
+
+        mismatchNo++;
+        fprintf( stderr, "MISMATCH: instance %zu:", i );
+        for( const Row& r : rows )
+            fprintf( stderr, " %s = %d", r.m_name.c_str(), r.m_length[ i ] );
+        fprintf( stderr, "\n" );
+    }
+    return mismatchNo;
+}
+
+//
+// Writes results in JSON format
+//
+void WriteJson( const std::vector< Row >& rows, const std::string& input, size_t mismatchNo, const std::string& path )
+{
+    FILE* out = ( path == "-" ) ? stdout : fopen( path.c_str(), "w" );
+    if( !out )
+        throw std::invalid_argument( "Cannot open file.\nPath = " + path );
+
+    const double base = rows.front().m_seconds;
+
+    fprintf( out, "{\n" );
+    fprintf( out, "  \"width\": %u,\n", State::WIDTH );
+    fprintf( out, "  \"input\": \"%s\",\n", input.c_str() );
+    fprintf( out, "  \"mismatches\": %zu,\n", mismatchNo );
+    fprintf( out, "  \"combinations\": [\n" );
+    for( size_t i = 0; i < rows.size(); i++ )
+    {
+        const Row& r = rows[ i ];
+        fprintf( out, "    { \"name\": \"%s\", \"solved\": %zu, \"expanded\": %zu, \"seconds\": %.6f, "
+            "\"nodes_per_sec\": %.0f, \"speedup\": %.3f, \"lengths\": [",
+            r.m_name.c_str(), r.m_solvedNo, r.m_expandedNo, r.m_seconds, r.NodesPerSec(),
+            r.m_seconds > 0 ? base / r.m_seconds : 0.0 );
+        for( size_t k = 0; k < r.m_length.size(); k++ )
+            fprintf( out, "%s%d", k > 0 ? ", " : " ", r.m_length[ k ] );
+        fprintf( out, " ] }%s\n", ( i + 1 < rows.size() ) ? "," : "" );
+    }
+    fprintf( out, "  ]\n}\n" );
+
+    if( out != stdout )
+        fclose( out );
+}
+
+void Usage( const char* name )
+{
+    fprintf( stderr, "Usage: %s [--count N] [--time SECONDS] [--json PATH] FILE\n", name );
+}
+
+}
+
+int main( int argc, char** argv )
+{
+    std::string json;
+    std::string input;
+    size_t count = std::numeric_limits< size_t >::max();
+    Limits limits;
+
+    for( int i = 1; i < argc; i++ )
+    {
+        const std::string arg = argv[ i ];
+        if( arg == "--count" && i + 1 < argc )
+            count = strtoull( argv[ ++i ], nullptr, 10 );
+        else if( arg == "--time" && i + 1 < argc )
+            limits.m_maxSeconds = atof( argv[ ++i ] );
+        else if( arg == "--json" && i + 1 < argc )
+            json = argv[ ++i ];
+        else if( input.empty() && arg.compare( 0, 2, "--" ) != 0 )
+            input = arg;
+        else
+        {
+            Usage( argv[ 0 ] );
+            return 2;
+        }
+    }
+
+    if( input.empty() )
+    {
+        Usage( argv[ 0 ] );
+        return 2;
+    }
+
+    try
+    {
+        const std::vector< State > instances = ReadInstances( input, count );
+
+        printf( "BOARD %ux%u, INPUT %s, INSTANCES %zu\n", State::WIDTH, State::WIDTH, input.c_str(), instances.size() );
+        printf( "   %-28s %6s %12s %10s %12s\n", "combination", "solved", "expanded", "time[s]", "nodes/s" );
+
+        // The first combination is the reference of speed-up
+        std::vector< Row > rows;
+        rows.push_back( Run< ClosedSetHash, OpenSetHash >( "ClosedSetHash+OpenSetHash", instances, limits ) );
+        rows.push_back( Run< ClosedSetHash, OpenSetBucket >( "ClosedSetHash+OpenSetBucket", instances, limits ) );
+        rows.push_back( Run< ClosedSetHash, OpenSet >( "ClosedSetHash+OpenSet", instances, limits ) );
+        rows.push_back( Run< ClosedSet, OpenSetHash >( "ClosedSet+OpenSetHash", instances, limits ) );
+        rows.push_back( Run< ClosedSet, OpenSetBucket >( "ClosedSet+OpenSetBucket", instances, limits ) );
+        rows.push_back( Run< ClosedSet, OpenSet >( "ClosedSet+OpenSet", instances, limits ) );
+
+        printf( "\n   %-28s %10s\n", "combination", "speed-up" );
+        for( const Row& r : rows )
+            printf( "   %-28s %10.2f\n", r.m_name.c_str(), r.m_seconds > 0 ? rows.front().m_seconds / r.m_seconds : 0.0 );
+
+        const size_t mismatchNo = Verify( rows, instances.size() );
+        printf( "\n%s\n", mismatchNo == 0 ? "All combinations found solutions of identical length." : "ERROR: Lengths of solutions differ." );
+
+        if( !json.empty() )
+            WriteJson( rows, input, mismatchNo, json );
+
+        return mismatchNo == 0 ? 0 : 1;
+    }
+    catch( const std::invalid_argument& e )
+    {
+        fprintf( stderr, "\nERROR: %s\n", e.what() );
+        return 1;
+    }
+}
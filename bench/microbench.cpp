@@ -0,0 +1,331 @@
+//
+// Microbenchmarks of the hot paths of the search:
+//    Graph::GetChildren, Graph::Manhattan, State::operator==, State::operator<,
+//    HashSet::Insert/Find/Erase at various load factors,
+//    OpenSetHash::Add/RemoveBest/Update and MemMgr::New.
+//
+// Usage:
+//    bench [--json PATH] [--min-time SECONDS]
+//
+// The time of single operation in nanoseconds is printed.
+// With option "--json" the results are written in JSON format as well ("-" is standard output).
+//
+
+#include "Graph.h"
+#include "State.h"
+#include "Solution.h"
+#include "hashset.h"
+#include "opensethash.h"
+#include "memmgr.h"
+#include "pathnode.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// Result of single benchmark
+struct Result
+{
+    std::string m_name;
+    double m_nsPerOp;
+    size_t m_opNo;
+};
+
+// Prevents the compiler from removing the benchmarked code
+volatile size_t g_sink;
+
+// Minimal time of each measurement in seconds
+double g_minTime = 0.2;
+
+//
+// Measures the time of "body". The function "body" performs "opNo" operations.
+// The measurement is repeated until "g_minTime" is elapsed, the best time is taken.
+//
+Result Measure( const std::string& name, size_t opNo, const std::function< void() >& body )
+{
+    using Clock = std::chrono::steady_clock;
+
+    double best = 1e300;
+    double total = 0;
+    size_t runNo = 0;
+
+    do
+    {
+        const Clock::time_point t0 = Clock::now();
+        body();
+        const std::chrono::duration< double > d = Clock::now() - t0;
+
+        best = std::min( best, d.count() );
+        total += d.count();
+        runNo++;
+    }
+    while( total < g_minTime || runNo < 3 );
+
+    Result r;
+    r.m_name = name;
+    r.m_nsPerOp = 1e9 * best / opNo;
+    r.m_opNo = opNo;
+
+    printf( "   %-40s %10.2f ns/op\n", name.c_str(), r.m_nsPerOp );
+    fflush( stdout );
+    return r;
+}
+
+//
+// Returns "n" states obtained by random walks from the GOAL state
+//
+std::vector< State > RandomStates( size_t n, unsigned int walk, std::mt19937_64& rng )
+{
+    std::vector< State > tab;
+    tab.reserve( n );
+
+    const std::array< char, State::TILENO > goal = [] {
+        std::array< char, State::TILENO > t;
+        for( uint i = 0; i < State::TILENO; i++ )
+            t[ i ] = static_cast< char >( ( i + 1 ) % State::TILENO );
+        return t;
+    }();
+
+    for( size_t i = 0; i < n; i++ )
+    {
+        State s{ goal };
+        for( unsigned int j = 0; j < walk; j++ )
+            Solution::Apply( s, static_cast< Solution::Move >( rng() % 4 ) );
+        tab.push_back( s );
+    }
+    return tab;
+}
+
+//
+// Returns "n" nodes holding distinct states
+//
+std::vector< PathNode< State > > DistinctNodes( size_t n, std::mt19937_64& rng )
+{
+    std::vector< PathNode< State > > node;
+    node.reserve( n );
+
+    std::vector< State > st = RandomStates( 2 * n, 200, rng );
+    std::sort( st.begin(), st.end() );
+    st.erase( std::unique( st.begin(), st.end() ), st.end() );
+    std::shuffle( st.begin(), st.end(), rng );
+
+    for( size_t i = 0; i < n && i < st.size(); i++ )
+        node.emplace_back( st[ i ], nullptr, static_cast< Cost >( rng() % 100 ), static_cast< Cost >( rng() % 100 ) );
+
+    return node;
+}
+
+void BenchGraph( std::vector< Result >& res, std::mt19937_64& rng )
+{
+    const std::vector< State > st = RandomStates( 4096, 200, rng );
+
+    Graph graph;
+    std::vector< State > child( Graph::MAX_CHILD_NO );
+    std::vector< Cost > cost( Graph::MAX_CHILD_NO );
+    std::vector< Cost > heur( Graph::MAX_CHILD_NO );
+
+    res.push_back( Measure( "Graph::GetChildren", st.size(), [&] {
+        size_t sum = 0;
+        for( const State& s : st )
+            sum += graph.GetChildren( s, child, cost, heur );
+        g_sink = sum;
+    } ) );
+
+    res.push_back( Measure( "Graph::Manhattan", st.size(), [&] {
+        size_t sum = 0;
+        for( const State& s : st )
+            sum += graph.Manhattan( s );
+        g_sink = sum;
+    } ) );
+}
+
+void BenchState( std::vector< Result >& res, std::mt19937_64& rng )
+{
+    const std::vector< State > st = RandomStates( 4096, 200, rng );
+
+    // Pairs of equal states are the worst case of operator==
+    std::vector< State > copy = st;
+
+    res.push_back( Measure( "State::operator== (equal)", st.size(), [&] {
+        size_t sum = 0;
+        for( size_t i = 0; i < st.size(); i++ )
+            sum += ( st[ i ] == copy[ i ] );
+        g_sink = sum;
+    } ) );
+
+    res.push_back( Measure( "State::operator== (random)", st.size() - 1, [&] {
+        size_t sum = 0;
+        for( size_t i = 1; i < st.size(); i++ )
+            sum += ( st[ i ] == st[ i - 1 ] );
+        g_sink = sum;
+    } ) );
+
+    res.push_back( Measure( "State::operator< (random)", st.size() - 1, [&] {
+        size_t sum = 0;
+        for( size_t i = 1; i < st.size(); i++ )
+            sum += ( st[ i ] < st[ i - 1 ] );
+        g_sink = sum;
+    } ) );
+}
+
+void BenchHashSet( std::vector< Result >& res, std::mt19937_64& rng )
+{
+    // The hash table is expanded, when the load factor reaches 0.5
+    const unsigned int tableSize = 1 << 20;
+    const double loads[] = { 0.1, 0.25, 0.45 };
+
+    const size_t maxNo = static_cast< size_t >( 0.45 * tableSize ) + 1024;
+    std::vector< PathNode< State > > node = DistinctNodes( maxNo, rng );
+
+    for( double load : loads )
+    {
+        char name[ 64 ];
+        const size_t n = static_cast< size_t >( load * tableSize );
+        const size_t opNo = 1024;
+
+        HashSet< State > set( tableSize );
+        for( size_t i = 0; i < n; i++ )
+            set.Insert( &node[ i ] );
+
+        snprintf( name, sizeof( name ), "HashSet::Find hit (load %.2f)", load );
+        res.push_back( Measure( name, opNo, [&] {
+            size_t sum = 0;
+            for( size_t i = 0; i < opNo; i++ )
+                sum += ( set.Find( node[ ( i * 7919 ) % n ].m_state ) != nullptr );
+            g_sink = sum;
+        } ) );
+
+        snprintf( name, sizeof( name ), "HashSet::Find miss (load %.2f)", load );
+        res.push_back( Measure( name, opNo, [&] {
+            size_t sum = 0;
+            for( size_t i = 0; i < opNo; i++ )
+                sum += ( set.Find( node[ n + i ].m_state ) != nullptr );
+            g_sink = sum;
+        } ) );
+
+        snprintf( name, sizeof( name ), "HashSet::Insert+Erase (load %.2f)", load );
+        res.push_back( Measure( name, 2 * opNo, [&] {
+            for( size_t i = 0; i < opNo; i++ )
+                set.Insert( &node[ n + i ] );
+            for( size_t i = 0; i < opNo; i++ )
+                set.Erase( &node[ n + i ] );
+            g_sink = set.Count();
+        } ) );
+    }
+}
+
+void BenchOpenSet( std::vector< Result >& res, std::mt19937_64& rng )
+{
+    const size_t n = 100000;
+    std::vector< PathNode< State > > node = DistinctNodes( n, rng );
+    std::vector< PathNode< State > > parent( 1 );
+
+    OpenSetHash< State > os;
+
+    res.push_back( Measure( "OpenSetHash::Add+RemoveBest", 2 * n, [&] {
+        os.Erase();
+        for( size_t i = 0; i < n; i++ )
+            os.Add( &node[ i ] );
+        while( !os.IsEmpty() )
+            os.RemoveBest();
+        g_sink = os.Size();
+    } ) );
+
+    os.Erase();
+    for( size_t i = 0; i < n; i++ )
+        os.Add( &node[ i ] );
+
+    res.push_back( Measure( "OpenSetHash::Search", n, [&] {
+        size_t sum = 0;
+        for( size_t i = 0; i < n; i++ )
+            sum += ( os.Search( node[ i ].m_state ) != nullptr );
+        g_sink = sum;
+    } ) );
+
+    res.push_back( Measure( "OpenSetHash::Update", n, [&] {
+        for( size_t i = 0; i < n; i++ )
+            os.Update( &node[ i ], &parent[ 0 ], node[ i ].m_g ^ 1 );
+        g_sink = os.Size();
+    } ) );
+}
+
+void BenchMemMgr( std::vector< Result >& res )
+{
+    const size_t n = 1000000;
+    MemMgr< PathNode< State > > mem( 10000 );
+
+    res.push_back( Measure( "MemMgr::New", n, [&] {
+        mem.Erase();
+        size_t sum = 0;
+        for( size_t i = 0; i < n; i++ )
+            sum += reinterpret_cast< size_t >( mem.New() );
+        g_sink = sum;
+    } ) );
+}
+
+//
+// Writes results in JSON format
+//
+void WriteJson( const std::vector< Result >& res, const std::string& path )
+{
+    FILE* out = ( path == "-" ) ? stdout : fopen( path.c_str(), "w" );
+    if( !out )
+    {
+        fprintf( stderr, "Cannot open file. Path = %s\n", path.c_str() );
+        exit( 1 );
+    }
+
+    fprintf( out, "{\n  \"width\": %u,\n  \"benchmarks\": [\n", State::WIDTH );
+    for( size_t i = 0; i < res.size(); i++ )
+    {
+        fprintf( out, "    { \"name\": \"%s\", \"ns_per_op\": %.3f, \"ops\": %zu }%s\n",
+            res[ i ].m_name.c_str(), res[ i ].m_nsPerOp, res[ i ].m_opNo, ( i + 1 < res.size() ) ? "," : "" );
+    }
+    fprintf( out, "  ]\n}\n" );
+
+    if( out != stdout )
+        fclose( out );
+}
+
+}
+
+int main( int argc, char** argv )
+{
+    std::string json;
+
+    for( int i = 1; i < argc; i++ )
+    {
+        if( strcmp( argv[ i ], "--json" ) == 0 && i + 1 < argc )
+            json = argv[ ++i ];
+        else if( strcmp( argv[ i ], "--min-time" ) == 0 && i + 1 < argc )
+            g_minTime = atof( argv[ ++i ] );
+        else
+        {
+            fprintf( stderr, "Usage: %s [--json PATH] [--min-time SECONDS]\n", argv[ 0 ] );
+            return 2;
+        }
+    }
+
+    std::mt19937_64 rng( 12345 );
+    std::vector< Result > res;
+
+    printf( "MICROBENCHMARKS:\n" );
+    BenchGraph( res, rng );
+    BenchState( res, rng );
+    BenchHashSet( res, rng );
+    BenchOpenSet( res, rng );
+    BenchMemMgr( res );
+
+    if( !json.empty() )
+        WriteJson( res, json );
+
+    return 0;
+}
@@ -0,0 +1,251 @@
+#include "Bfhs.h"
+#include "radixsort.h"
+#include <limits>
+#include <stdexcept>
+
+//
+// Constructor
+//
+Bfhs::Bfhs( )
+    : m_toGoal( true )
+    , m_target{}
+    , m_expandedNo( 0 )
+    , m_limitReached( false )
+{
+}
+
+//
+// Finds the solution. Returns the empty value, if the limits are exceeded.
+//
+std::optional< std::vector< State > > Bfhs::Solve( Graph& graph, const State& beg, const Limits& limits )
+{
+    m_limits = limits;
+    m_limits.Start();
+
+    m_expandedNo = 0;
+    m_limitReached = false;
+    m_metrics.Reset();
+    m_memory.Reset();
+
+    std::vector< State > path = { beg };
+    if( graph.IsGoal( beg ) )
+        return path;
+
+    Cost bound = graph.CalcH( beg );
+
+    while( true )
+    {
+        PackedState relay;
+        const Cost t = Search( graph, beg, Graph::Goal(), bound, relay );
+
+        if( t == STOPPED || t == std::numeric_limits< Cost >::max() )
+        {
+            m_limitReached = ( t == STOPPED );
+            return {};
+        }
+
+        if( t <= bound )
+        {
+            // The halves of the path are found by the searches from the start state to the relay
+            // and from the relay to the GOAL state
+            const State r = relay.Unpack();
+            if( !Divide( graph, beg, r, t / 2, path ) || !Divide( graph, r, Graph::Goal(), t - t / 2, path ) )
+            {
+                m_limitReached = true;
+                return {};
+            }
+            return path;
+        }
+
+        bound = t;
+    }
+}
+
+//
+// Appends the path from "beg" (excluded) to "target" (included) of the known "length" to "path".
+// Returns "false", if the search is stopped by the limits. Throws the exception, if the path
+// of the known length is not found.
+//
+bool Bfhs::Divide( Graph& graph, const State& beg, const State& target, Cost length, std::vector< State >& path )
+{
+    if( length == 0 )
+        return true;
+
+    if( length == 1 )
+    {
+        path.push_back( target );
+        return true;
+    }
+
+    // The length is known, hence the target is found by the single search
+    PackedState relay;
+    const Cost t = Search( graph, beg, target, length, relay );
+    if( t == STOPPED )
+        return false;
+    if( t != length )
+        throw std::invalid_argument( "The path of the known length is not found between the relay states." );
+
+    const State r = relay.Unpack();
+    return Divide( graph, beg, r, length / 2, path ) && Divide( graph, r, target, length - length / 2, path );
+}
+
+//
+// Breadth-first search from "beg" to "target" bounded by "bound".
+// Returns the depth of "target" and its ancestor in the middle layer "bound / 2" in "relay",
+// or STOPPED, or the smallest "f" exceeding "bound", if "target" is not found.
+//
+Cost Bfhs::Search( Graph& graph, const State& beg, const State& target, Cost bound, PackedState& relay )
+{
+    m_toGoal = graph.IsGoal( target );
+    if( !m_toGoal )
+    {
+        for( uint8_t pos = 0; pos < State::TILENO; pos++ )
+            m_target[ static_cast< unsigned char >( target.Tile( pos ) ) ] = pos;
+    }
+
+    const Cost mid = bound / 2;
+    const PackedState end( target );
+
+    m_prev.clear();
+    m_cur.assign( 1, Node{ PackedState( beg ), PackedState( beg ) } );
+    m_next.clear();
+
+    Cost min = std::numeric_limits< Cost >::max();
+
+    for( Cost g = 1; !m_cur.empty(); g++ )
+    {
+        for( const Node& n : m_cur )
+        {
+            if( m_limits.Exceeded( m_expandedNo ) )
+                return STOPPED;
+
+            m_expandedNo++;
+            m_metrics.Add( Metrics::EXPANDED );
+
+            const State x = n.m_state.Unpack();
+            const uint8_t sp = static_cast< uint8_t >( x.SpaceIdx() );
+            const char movesNo = Graph::MovesNo( sp );
+
+            size_t childNo = 0;
+            for( uint8_t j = 0; j < movesNo; j++ )
+            {
+                State y = x;
+                y.Swap( sp, Graph::Move( sp, j ) );
+
+                const Cost f = g + CalcH( graph, y );
+                if( f > bound )
+                {
+                    min = std::min( min, f );
+                    continue;
+                }
+                childNo++;
+
+                // The states of the middle layer are the relays of their descendants
+                const PackedState s( y );
+                const PackedState r = ( g == mid ) ? s : n.m_relay;
+                if( s == end )
+                {
+                    relay = r;
+                    RecordMemory();
+                    return g;
+                }
+                m_next.push_back( Node{ s, r } );
+            }
+
+            m_metrics.Add( Metrics::GENERATED, childNo );
+            m_metrics.Record( Metrics::BRANCHING, childNo );
+        }
+
+        Deduplicate();
+        RecordMemory();
+        if( m_limits.m_maxBytes > 0 && m_memory.Reserved() > m_limits.m_maxBytes )
+            return STOPPED;
+
+        m_prev.swap( m_cur );
+        m_cur.swap( m_next );
+        m_next.clear();
+    }
+
+    return min;
+}
+
+//
+// Removes the duplicates within the next layer and the states of the previous layer from it.
+// The other neighbours of the current layer are not in the next layer, since the graph is bipartite.
+// The next layer is sorted by the key, the previous layer is sorted already.
+//
+void Bfhs::Deduplicate( )
+{
+    RadixSort( m_next, m_tmp, &Bfhs::Key, KEY_BITS );
+
+    size_t out = 0;
+    size_t j = 0;
+    for( size_t i = 0; i < m_next.size(); )
+    {
+        // Run of equal keys in the next layer and in the previous layer
+        const uint64_t k = Key( m_next[ i ] );
+        size_t end = i + 1;
+        while( end < m_next.size() && Key( m_next[ end ] ) == k )
+            end++;
+
+        while( j < m_prev.size() && Key( m_prev[ j ] ) < k )
+            j++;
+        size_t prevEnd = j;
+        while( prevEnd < m_prev.size() && Key( m_prev[ prevEnd ] ) == k )
+            prevEnd++;
+
+        // The state is kept, if it is neither kept already, nor in the previous layer
+        const size_t first = out;
+        for( ; i < end; i++ )
+        {
+            const PackedState& s = m_next[ i ].m_state;
+            bool duplicate = false;
+            for( size_t q = first; q < out && !duplicate; q++ )
+                duplicate = ( m_next[ q ].m_state == s );
+            for( size_t q = j; q < prevEnd && !duplicate; q++ )
+                duplicate = ( m_prev[ q ].m_state == s );
+
+            if( !duplicate )
+                m_next[ out++ ] = m_next[ i ];
+        }
+        j = prevEnd;
+    }
+    m_next.resize( out );
+}
+
+//
+// Returns the heuristic of "x" to the target of the current search. The heuristic to the GOAL state
+// is given by "graph", otherwise it is Manhattan distance to the target.
+//
+Cost Bfhs::CalcH( Graph& graph, const State& x ) const
+{
+    if( m_toGoal )
+        return graph.CalcH( x );
+
+    Cost h = 0;
+    for( uint8_t pos = 0; pos < State::TILENO; pos++ )
+    {
+        const unsigned char tile = static_cast< unsigned char >( x.Tile( pos ) );
+        if( tile != 0 )
+            h += Graph::Distance( pos, m_target[ tile ] );
+    }
+    return h;
+}
+
+//
+// Records the memory of the layers. The previous layer is reported as the closed set,
+// the current and the next layer as the open set.
+//
+void Bfhs::RecordMemory( )
+{
+    MemoryUsage part[ MemoryStats::PART_NO ];
+
+    part[ MemoryStats::CLOSED_SET ].m_used = m_prev.size() * sizeof( Node );
+    part[ MemoryStats::CLOSED_SET ].m_reserved = m_prev.capacity() * sizeof( Node );
+    part[ MemoryStats::OPEN_SET ].m_used = ( m_cur.size() + m_next.size() ) * sizeof( Node );
+    part[ MemoryStats::OPEN_SET ].m_reserved = ( m_cur.capacity() + m_next.capacity() ) * sizeof( Node );
+    part[ MemoryStats::BUFFERS ].m_used = m_tmp.size() * sizeof( Node );
+    part[ MemoryStats::BUFFERS ].m_reserved = m_tmp.capacity() * sizeof( Node );
+
+    m_memory.Record( m_expandedNo, m_limits.Elapsed(), part );
+}
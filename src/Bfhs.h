@@ -0,0 +1,122 @@
+#ifndef ASTAR_BFHS_H
+#define ASTAR_BFHS_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Represents divide-and-conquer breadth-first heuristic search (DC-BFHS).
+//
+// 2. The search expands the states layer by layer (by "g"), the children with "f = g + h"
+//    greater than the bound are not kept. Since the graph is undirected and bipartite
+//    (each move changes the colour of the cell of SPACE), the neighbours of layer "d"
+//    are in layers "d - 1" and "d + 1". Hence, the duplicates are detected by the previous
+//    layer only and at most three layers are kept in memory. The layers are sorted arrays
+//    of packed states, there is neither closed set, nor pointers to the parents.
+//
+// 3. The duplicates are detected with delay, i.e. once per layer, not for each child.
+//    The children are appended to the next layer, which is sorted by the radix sort
+//    (see radixsort.h) by the KEY_BITS bit key, i.e. the multiplicative hash of the state. Then, the duplicates
+//    within the layer are removed and the layer is merge-joined with the previous layer sorted
+//    the same way. The states of equal keys are compared within the runs of equal keys.
+//    All passes read and write the layers sequentially, there are no random accesses.
+//
+// 4. Each state holds the relay, i.e. its ancestor in the middle layer "bound / 2".
+//    When the target is found, the path is reconstructed by the recursive searches
+//    from the start state to the relay of the target and from the relay to the target.
+//    The lengths of both halves are known, hence each of them is the single search.
+//
+// 5. The bound of the first search is unknown. It is the heuristic of the start state,
+//    and it is increased to the smallest "f" exceeding the bound of the previous search
+//    (breadth-first iterative-deepening A*).
+//
+// 6. The heuristic to the GOAL state is given by the graph. The heuristic to the relay
+//    is Manhattan distance to the relay.
+//
+// 7. Memory is proportional to the widest three layers of the search, not to all expanded states.
+//    The metrics are collected and the memory is recorded after each layer.
+//
+
+#include "Engine.h"
+#include "Cost.h"
+#include "MemoryStats.h"
+#include "PackedState.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+class Bfhs : public Engine
+{
+public:
+    Bfhs( );
+
+    std::string Name( ) const override { return "bfhs"; }
+    bool IsOptimal( ) const override { return true; }
+
+    std::optional< std::vector< State > > Solve( Graph& graph, const State& beg, const Limits& limits ) override;
+
+    size_t ExpandedNo( ) const override { return m_expandedNo; }
+    bool LimitReached( ) const override { return m_limitReached; }
+    const Metrics* GetMetrics( ) const override { return &m_metrics; }
+    const MemoryStats* GetMemory( ) const override { return &m_memory; }
+
+private:
+    // State of the layer and its ancestor in the middle layer
+    struct Node
+    {
+        PackedState m_state;
+        PackedState m_relay;
+    };
+
+private:
+    Cost Search( Graph& graph, const State& beg, const State& target, Cost bound, PackedState& relay );
+    bool Divide( Graph& graph, const State& beg, const State& target, Cost length, std::vector< State >& path );
+    Cost CalcH( Graph& graph, const State& x ) const;
+    void Deduplicate( );
+    void RecordMemory( );
+
+    // Returns the key of the layers' order. The multiplications move the bits of both words
+    // of the state to the high bits, which are the key.
+    static uint64_t Key( const Node& n )
+    {
+        const uint64_t h = n.m_state.m_word[ 0 ] * 0x9e3779b97f4a7c15ULL ^ n.m_state.m_word[ 1 ] * 0xc2b2ae3d27d4eb4fULL;
+        return h >> ( 64 - KEY_BITS );
+    }
+
+private:
+    // Returned by function Search if the search is stopped
+    inline static constexpr Cost STOPPED = -1;
+
+    // Bits of the key of the layers' order. The states of equal keys are rare, hence the key
+    // is shorter than the hash and the radix sort needs fewer passes.
+    inline static constexpr unsigned int KEY_BITS = 44;
+
+    // Previous, current and next layer of the search
+    std::vector< Node > m_prev;
+    std::vector< Node > m_cur;
+    std::vector< Node > m_next;
+
+    // Auxiliary buffer of the radix sort
+    std::vector< Node > m_tmp;
+
+    // The target of the current search is the GOAL state, otherwise the positions of its tiles are given
+    bool m_toGoal;
+    std::array< uint8_t, State::TILENO > m_target;
+
+    // Limits of the current search
+    Limits m_limits;
+
+    // Number of expanded nodes
+    size_t m_expandedNo;
+
+    // Last search was stopped by the limits
+    bool m_limitReached;
+
+    // Metrics of the current search
+    Metrics m_metrics;
+
+    // Memory of the layers, recorded after each layer
+    MemoryStats m_memory;
+};
+
+#endif
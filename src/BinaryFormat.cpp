@@ -0,0 +1,290 @@
+#include "BinaryFormat.h"
+#include <stdexcept>
+#include <cstring>
+
+namespace
+{
+
+//
+// Stores "val" in "buf" as little endian number of "size" bytes
+//
+void PutLE( uint8_t* buf, uint64_t val, size_t size )
+{
+    for( size_t i = 0; i < size; i++ )
+        buf[ i ] = static_cast< uint8_t >( val >> ( 8 * i ) );
+}
+
+//
+// Reads little endian number of "size" bytes from "buf"
+//
+uint64_t GetLE( const uint8_t* buf, size_t size )
+{
+    uint64_t val = 0;
+    for( size_t i = 0; i < size; i++ )
+        val |= static_cast< uint64_t >( buf[ i ] ) << ( 8 * i );
+    return val;
+}
+
+// Size of the packed state in the file
+constexpr size_t STATE_SIZE = 16;
+
+//
+// Returns "true" if the tiles of "s" are a permutation
+//
+bool IsPermutation( const State& s )
+{
+    uint64_t seen = 0;
+    for( uint8_t i = 0; i < State::TILENO; i++ )
+    {
+        const uint t = static_cast< uint >( s.Tile( i ) );
+        if( t >= State::TILENO || ( seen & ( uint64_t( 1 ) << t ) ) )
+            return false;
+        seen |= uint64_t( 1 ) << t;
+    }
+    return true;
+}
+
+}
+
+// ---------------------------------------------------------------------------------
+//   B I N A R Y   F I L E
+// ---------------------------------------------------------------------------------
+
+//
+// Constructor. Opens the file "path" in mode "mode". The buffer is set only for the opened file,
+// the buffer of the standard stream is not replaced, since the stream may be used already
+// and it outlives this object.
+//
+BinaryFile::BinaryFile( const std::string& path, const char* mode )
+    : m_path( path )
+    , m_file( nullptr )
+    , m_buffer( BUFFER_SIZE )
+{
+    if( m_path == "-" )
+    {
+        m_file = ( mode[ 0 ] == 'r' ) ? stdin : stdout;
+        return;
+    }
+
+    m_file = fopen( m_path.c_str(), mode );
+    if( !m_file )
+    {
+        const std::string msg = "Cannot open file. Path = " + m_path;
+        throw std::invalid_argument( msg );
+    }
+
+    setvbuf( m_file, m_buffer.data(), _IOFBF, m_buffer.size() );
+}
+
+//
+// Destructor
+//
+BinaryFile::~BinaryFile( )
+{
+    if( m_file != stdin && m_file != stdout )
+        fclose( m_file );
+    else
+        fflush( m_file );
+}
+
+//
+// Returns "true" if the file "path" starts with the magic number of binary file
+//
+bool BinaryFile::IsBinary( const std::string& path )
+{
+    FILE* f = fopen( path.c_str(), "rb" );
+    if( !f )
+        return false;
+
+    char magic[ 4 ];
+    const bool ok = ( fread( magic, 1, 4, f ) == 4 ) &&
+        ( memcmp( magic, MAGIC[ INSTANCES ], 4 ) == 0 || memcmp( magic, MAGIC[ SOLUTIONS ], 4 ) == 0 );
+
+    fclose( f );
+    return ok;
+}
+
+//
+// Throws exception with error message
+//
+void BinaryFile::Error( const char* what ) const
+{
+    std::string msg = what;
+    msg += "\nPath = " + m_path;
+    throw std::invalid_argument( msg );
+}
+
+// ---------------------------------------------------------------------------------
+//   B I N A R Y   W R I T E R
+// ---------------------------------------------------------------------------------
+
+//
+// Constructor. Creates the file and writes the header.
+//
+BinaryWriter::BinaryWriter( const std::string& path, Kind kind )
+    : BinaryFile( path, "wb" )
+    , m_kind( kind )
+{
+    uint8_t header[ HEADER_SIZE ] = { 0 };
+    memcpy( header, MAGIC[ m_kind ], 4 );
+    header[ 4 ] = static_cast< uint8_t >( State::WIDTH );
+    Put( header, HEADER_SIZE );
+}
+
+//
+// Destructor
+//
+BinaryWriter::~BinaryWriter( )
+{
+    fflush( m_file );
+}
+
+//
+// Writes the instance
+//
+void BinaryWriter::Write( const State& s )
+{
+    assert( m_kind == INSTANCES );
+
+    const PackedState p( s );
+    uint8_t buf[ STATE_SIZE ];
+    PutLE( buf, p.m_word[ 0 ], 8 );
+    PutLE( buf + 8, p.m_word[ 1 ], 8 );
+    Put( buf, STATE_SIZE );
+}
+
+//
+// Writes the solution "sol" of instance "beg"
+//
+void BinaryWriter::Write( const State& beg, const Solution& sol )
+{
+    assert( m_kind == SOLUTIONS );
+
+    const PackedState p( beg );
+    uint8_t buf[ STATE_SIZE + 4 ];
+    PutLE( buf, p.m_word[ 0 ], 8 );
+    PutLE( buf + 8, p.m_word[ 1 ], 8 );
+    PutLE( buf + STATE_SIZE, ( sol.Length() << 1 ) | ( sol.IsOptimal() ? 1 : 0 ), 4 );
+    Put( buf, sizeof( buf ) );
+
+    if( sol.Length() > 0 )
+        Put( sol.Bytes().data(), sol.Bytes().size() );
+}
+
+//
+// Writes buffered data to the file
+//
+void BinaryWriter::Flush( )
+{
+    if( fflush( m_file ) != 0 )
+        Error( "Error during writing file." );
+}
+
+//
+// Writes "size" bytes
+//
+void BinaryWriter::Put( const void* data, size_t size )
+{
+    if( fwrite( data, 1, size, m_file ) != size )
+        Error( "Error during writing file." );
+}
+
+// ---------------------------------------------------------------------------------
+//   B I N A R Y   R E A D E R
+// ---------------------------------------------------------------------------------
+
+//
+// Constructor. Opens the file and checks the header.
+//
+BinaryReader::BinaryReader( const std::string& path )
+    : BinaryFile( path, "rb" )
+    , m_kind( INSTANCES )
+{
+    uint8_t header[ HEADER_SIZE ];
+    if( !Take( header, HEADER_SIZE ) )
+        Error( "Unexpexted end of file." );
+
+    if( memcmp( header, MAGIC[ INSTANCES ], 4 ) == 0 )
+        m_kind = INSTANCES;
+    else if( memcmp( header, MAGIC[ SOLUTIONS ], 4 ) == 0 )
+        m_kind = SOLUTIONS;
+    else
+        Error( "This is not binary file with instances or solutions." );
+
+    if( header[ 4 ] != State::WIDTH )
+        Error( "Width of the board in the file differs from State::WIDTH." );
+}
+
+//
+// Reads the next instance. Returns "false" at the end of file.
+//
+bool BinaryReader::Next( State& s )
+{
+    if( m_kind != INSTANCES )
+        Error( "This is not binary file with instances." );
+
+    uint8_t buf[ STATE_SIZE ];
+    if( !Take( buf, STATE_SIZE ) )
+        return false;
+
+    PackedState p;
+    p.m_word[ 0 ] = GetLE( buf, 8 );
+    p.m_word[ 1 ] = GetLE( buf + 8, 8 );
+    s = p.Unpack();
+    if( !IsPermutation( s ) )
+        Error( "Not allowed state in file." );
+    if( !s.IsSolvable( ) )
+        Error( "The state is not solvable." );
+    return true;
+}
+
+//
+// Reads the next solution "sol" and its initial state "beg".
+// Returns "false" at the end of file.
+//
+bool BinaryReader::Next( State& beg, Solution& sol )
+{
+    if( m_kind != SOLUTIONS )
+        Error( "This is not binary file with solutions." );
+
+    uint8_t buf[ STATE_SIZE + 4 ];
+    if( !Take( buf, sizeof( buf ) ) )
+        return false;
+
+    PackedState p;
+    p.m_word[ 0 ] = GetLE( buf, 8 );
+    p.m_word[ 1 ] = GetLE( buf + 8, 8 );
+    beg = p.Unpack();
+    if( !IsPermutation( beg ) )
+        Error( "Not allowed state in file." );
+    if( !beg.IsSolvable( ) )
+        Error( "The state is not solvable." );
+
+    const uint64_t word = GetLE( buf + STATE_SIZE, 4 );
+    const size_t length = word >> 1;
+
+    m_moves.resize( ( length + 3 ) / 4 );
+    if( !m_moves.empty() && !Take( m_moves.data(), m_moves.size() ) )
+        Error( "Unexpexted end of file." );
+
+    sol.Assign( m_moves.data(), length, word & 1 );
+    return true;
+}
+
+//
+// Reads "size" bytes. Returns "false" if the end of file is reached before the first byte.
+//
+bool BinaryReader::Take( void* data, size_t size )
+{
+    const size_t n = fread( data, 1, size, m_file );
+    if( n == size )
+        return true;
+
+    if( ferror( m_file ) )
+        Error( "Error during reading file." );
+
+    if( n > 0 )
+        Error( "Unexpexted end of file." );
+
+    return false;
+}
@@ -0,0 +1,144 @@
+#ifndef ASTAR_BINARYFORMAT_H
+#define ASTAR_BINARYFORMAT_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Readers and writers of binary files with instances and solutions.
+//
+// 2. Each file starts with the header of 8 bytes:
+//       4 bytes - magic: "SPI1" for instances, "SPS1" for solutions
+//       1 byte  - width of the board (State::WIDTH)
+//       3 bytes - reserved, zeros
+//
+// 3. The instance file is the sequence of PackedState records (16 bytes each).
+//
+// 4. The solution file is the sequence of variable length records:
+//      16 bytes - PackedState, the initial state
+//       4 bytes - little endian: (number of moves) << 1 | (optimality flag)
+//       N bytes - moves, 2 bits per move, N = ceil(number of moves / 4)
+//
+// 5. Files are read and written through large buffers by fread/fwrite. The standard streams ("-")
+//    keep their own buffers.
+//
+// 6. In case of I/O error, malformed file or not solvable state, the exception std::invalid_argument is thrown.
+//
+
+#include "State.h"
+#include "PackedState.h"
+#include "Solution.h"
+#include <string>
+#include <vector>
+#include <cstdio>
+
+//
+// ---------------------------------------------------------------------------------
+//   B I N A R Y   F I L E
+// ---------------------------------------------------------------------------------
+//
+// Common part of binary readers and writers
+//
+class BinaryFile
+{
+public:
+    // Kind of the binary file
+    enum Kind { INSTANCES, SOLUTIONS };
+
+    static bool IsBinary( const std::string& path );
+
+protected:
+    BinaryFile( const std::string& path, const char* mode );
+    ~BinaryFile( );
+
+    BinaryFile( const BinaryFile& ) = delete;
+    BinaryFile& operator=( const BinaryFile& ) = delete;
+
+    [[noreturn]] void Error( const char* what ) const;
+
+protected:
+    // Size of the buffer used by stream
+    inline static constexpr size_t BUFFER_SIZE = 1 << 20;
+
+    // Size of the header
+    inline static constexpr size_t HEADER_SIZE = 8;
+
+    // Magic numbers
+    inline static const char* const MAGIC[ 2 ] = { "SPI1", "SPS1" };
+
+    const std::string m_path;
+    FILE* m_file;
+    std::vector< char > m_buffer;
+};
+
+//
+// ---------------------------------------------------------------------------------
+//   B I N A R Y   W R I T E R
+// ---------------------------------------------------------------------------------
+//
+class BinaryWriter : public BinaryFile
+{
+public:
+    BinaryWriter( const std::string& path, Kind kind );
+    ~BinaryWriter( );
+
+    void Write( const State& s );
+    void Write( const State& beg, const Solution& sol );
+
+    void Flush( );
+
+private:
+    void Put( const void* data, size_t size );
+
+private:
+    const Kind m_kind;
+};
+
+//
+// ---------------------------------------------------------------------------------
+//   B I N A R Y   R E A D E R
+// ---------------------------------------------------------------------------------
+//
+class BinaryReader : public BinaryFile
+{
+public:
+    explicit BinaryReader( const std::string& path );
+
+    Kind GetKind( ) const { return m_kind; }
+
+    bool Next( State& s );
+    bool Next( State& beg, Solution& sol );
+
+    template< typename F >
+    size_t ForEach( F consume );
+
+private:
+    bool Take( void* data, size_t size );
+
+private:
+    Kind m_kind;
+
+    // Auxiliary buffer for moves
+    std::vector< uint8_t > m_moves;
+};
+
+//
+// Passes all instances to "consume". Returns the number of instances.
+// For the file with solutions, the initial states are passed.
+//
+template< typename F >
+size_t BinaryReader::ForEach( F consume )
+{
+    size_t cnt = 0;
+    State s;
+    Solution sol;
+
+    while( ( m_kind == INSTANCES ) ? Next( s ) : Next( s, sol ) )
+    {
+        consume( static_cast< const State& >( s ) );
+        cnt++;
+    }
+    return cnt;
+}
+
+#endif
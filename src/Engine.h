@@ -0,0 +1,98 @@
+#ifndef ASTAR_ENGINE_H
+#define ASTAR_ENGINE_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Common interface of search engines.
+//
+// 2. Engines are used, when the search algorithm is selected at run time,
+//    e.g. by Portfolio.
+//
+// 3. Function Solve returns the solution (path of states), or the empty value,
+//    if the solution is not found within the limits.
+//
+// 4. Function IsOptimal returns "true", if the found solutions are always optimal.
+//
+// 5. The statistics, the profiler, the trace and the progress callback are optional.
+//    The engines, which do not support them, ignore them (the default implementations).
+//
+// 6. Engines are created at run time by name (see class EngineRegistry).
+//
+// 7. The engines supporting the enumeration of all optimal solutions return "true"
+//    from function SetAllOptimal. Then, after function Solve, function OptimalNo returns
+//    the number of optimal solutions and function ForEachOptimal passes them to the visitor.
+//
+// 8. The engines keeping the search on disk write their files to the directory given
+//    by function SetWorkDir.
+//
+
+#include "State.h"
+#include "Graph.h"
+#include "Limits.h"
+#include "Metrics.h"
+#include "SearchProgress.h"
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+#include <string>
+
+class LayerStats;
+class MemoryStats;
+class Profiler;
+class TraceWriter;
+
+class Engine
+{
+public:
+    virtual ~Engine( ) = default;
+
+    virtual std::string Name( ) const = 0;
+    virtual bool IsOptimal( ) const = 0;
+
+    virtual std::optional< std::vector< State > > Solve( Graph& graph, const State& beg, const Limits& limits ) = 0;
+
+    // Number of nodes expanded by the last call of Solve
+    virtual size_t ExpandedNo( ) const = 0;
+
+    // Returns "true", if the last call of Solve was stopped by the limits
+    virtual bool LimitReached( ) const { return false; }
+
+    // Metrics of the last call of Solve, NULL if the engine does not collect them
+    virtual const Metrics* GetMetrics( ) const { return nullptr; }
+
+    // Enables the collection of the metrics, it is enabled by default.
+    // The engines, which cannot disable it, ignore it.
+    virtual void SetMetricsEnabled( bool ) { }
+
+    // Statistics of f-layers and memory of the last call of Solve, NULL if not collected
+    virtual const LayerStats* GetLayers( ) const { return nullptr; }
+    virtual const MemoryStats* GetMemory( ) const { return nullptr; }
+
+    // Profiler of the search phases and the trace of expansions, NULL disables them
+    virtual void SetProfiler( Profiler* ) { }
+    virtual void SetTrace( TraceWriter* ) { }
+
+    // Progress callback called every "period" expansions
+    using Callback = std::function< void( const SearchProgress& ) >;
+    virtual void SetCallback( Callback, size_t ) { }
+
+    // Enumeration of all optimal solutions. Returns "false" if it is not supported.
+    virtual bool SetAllOptimal( bool ) { return false; }
+
+    // Number of optimal solutions of the last call of Solve and the visitor of them.
+    // The enumeration is stopped, when the visitor returns "false".
+    using PathVisitor = std::function< bool( const std::vector< State >& ) >;
+    virtual uint64_t OptimalNo( ) const { return 0; }
+    virtual void ForEachOptimal( const PathVisitor& ) const { }
+
+    // Gives back the memory kept for the next searches
+    virtual void Release( ) { }
+
+    // Directory of the files of the engines keeping the search on disk (see ExternalAstar)
+    virtual void SetWorkDir( const std::string& ) { }
+};
+
+#endif
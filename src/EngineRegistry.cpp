@@ -0,0 +1,201 @@
+#include "EngineRegistry.h"
+#include "astarengine.h"
+#include "Bfhs.h"
+#include "epea.h"
+#include "ExternalAstar.h"
+#include "IDAstar.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+
+//
+// Creates A* with closed set "CS" and open set "OS"
+//
+template< template< typename S > class CS, template< typename S > class OS >
+std::unique_ptr< Engine > CreateAstar( const EngineRegistry::Params& params )
+{
+    return std::make_unique< AstarEngine< CS, OS > >( params.m_weight, params.m_lookahead );
+}
+
+//
+// Creates EPEA* with closed set "CS" and open set "OS"
+//
+template< template< typename S > class CS, template< typename S > class OS >
+std::unique_ptr< Engine > CreateEpea( const EngineRegistry::Params& )
+{
+    return std::make_unique< Epea< CS, OS > >();
+}
+
+//
+// Creates IDA* with or without FSM pruning the duplicate sequences of moves
+//
+template< bool FSM >
+std::unique_ptr< Engine > CreateIDAstar( const EngineRegistry::Params& )
+{
+    return std::make_unique< IDAstar >( FSM );
+}
+
+//
+// Creates IDA* with transposition table
+//
+template< bool FSM >
+std::unique_ptr< Engine > CreateIDAstarTT( const EngineRegistry::Params& params )
+{
+    return std::make_unique< IDAstar >( FSM, size_t( params.m_table ) << 20 );
+}
+
+//
+// Creates divide-and-conquer breadth-first heuristic search
+//
+std::unique_ptr< Engine > CreateBfhs( const EngineRegistry::Params& )
+{
+    return std::make_unique< Bfhs >();
+}
+
+//
+// Creates external-memory A*
+//
+std::unique_ptr< Engine > CreateExternalAstar( const EngineRegistry::Params& params )
+{
+    return std::make_unique< ExternalAstar >( size_t( params.m_sort ) << 20 );
+}
+
+//
+// Returns the number following "prefix" in "name", or zero if "name" does not start with "prefix".
+// Throws the exception, if the number is not in range [1, max].
+//
+unsigned int Parameter( const std::string& name, const char* prefix, long max )
+{
+    const size_t n = strlen( prefix );
+    if( name.compare( 0, n, prefix ) != 0 )
+        return 0;
+
+    char* end = nullptr;
+    const long x = strtol( name.c_str() + n, &end, 10 );
+    if( *end != '\0' || end == name.c_str() + n || x < 1 || x > max )
+        throw std::invalid_argument( "Not allowed parameter of engine: " + name );
+    return static_cast< unsigned int >( x );
+}
+
+}
+
+//
+// Returns the table of engines
+//
+const std::vector< EngineRegistry::Entry >& EngineRegistry::Entries( )
+{
+    static const std::vector< Entry > entries = {
+        { "astar", "hash", "hash", "A* with hash closed set and std::set open set (default)", &CreateAstar< ClosedSetHash, OpenSetHash > },
+        { "astar", "hash", "bucket", "A* with hash closed set and bucket open set", &CreateAstar< ClosedSetHash, OpenSetBucket > },
+        { "astar", "hash", "tree", "A* with hash closed set and std::set/std::map open set", &CreateAstar< ClosedSetHash, OpenSet > },
+        { "astar", "tree", "hash", "A* with std::set closed set and std::set open set", &CreateAstar< ClosedSet, OpenSetHash > },
+        { "astar", "tree", "bucket", "A* with std::set closed set and bucket open set", &CreateAstar< ClosedSet, OpenSetBucket > },
+        { "astar", "tree", "tree", "A* with std::set closed set and std::set/std::map open set", &CreateAstar< ClosedSet, OpenSet > },
+        { "epea", "hash", "hash", "EPEA*, children with f above the node's stored f are not generated", &CreateEpea< ClosedSetHash, OpenSetHash >, true },
+        { "epea", "hash", "bucket", "EPEA* with bucket open set", &CreateEpea< ClosedSetHash, OpenSetBucket >, true },
+        { "idastar", nullptr, nullptr, "IDA*, memory proportional to the length of solution, FSM move pruning", &CreateIDAstar< true > },
+        { "idastar-basic", nullptr, nullptr, "IDA* pruning only the move back to the parent", &CreateIDAstar< false > },
+        { "idastar-tt", nullptr, nullptr, "IDA* with FSM move pruning and transposition table of 64 MiB", &CreateIDAstarTT< true > },
+        { "idastar-basic-tt", nullptr, nullptr, "IDA* with parent pruning and transposition table of 64 MiB", &CreateIDAstarTT< false > },
+        { "bfhs", nullptr, nullptr, "Divide-and-conquer breadth-first heuristic search, three layers, no parents", &CreateBfhs },
+        { "extastar", nullptr, nullptr, "External-memory A*, (g,h) buckets in run files on disk, sorting 256 MiB", &CreateExternalAstar },
+    };
+    return entries;
+}
+
+//
+// Returns the entry of engine "name" with policies "closed" and "open" of closed set and open set.
+// The parameters given by the name are returned in "params".
+//
+const EngineRegistry::Entry& EngineRegistry::Find( const std::string& name, const std::string& closed, const std::string& open, Params& params )
+{
+    // Weighted A* and A* with lookahead are A* with the parameter
+    std::string algorithm = name;
+    params = Params();
+    if( const unsigned int w = Parameter( name, "wastar-", 100 ) )
+    {
+        params.m_weight = static_cast< Cost >( w );
+        algorithm = "astar";
+    }
+    else if( const unsigned int k = Parameter( name, "alstar-", 8 ) )
+    {
+        params.m_lookahead = k;
+        algorithm = "astar";
+    }
+    else if( const unsigned int m = Parameter( name, "idastar-tt-", 65536 ) )
+    {
+        params.m_table = m;
+        algorithm = "idastar-tt";
+    }
+    else if( const unsigned int m = Parameter( name, "idastar-basic-tt-", 65536 ) )
+    {
+        params.m_table = m;
+        algorithm = "idastar-basic-tt";
+    }
+    else if( const unsigned int m = Parameter( name, "extastar-", 65536 ) )
+    {
+        params.m_sort = m;
+        algorithm = "extastar";
+    }
+
+    bool known = false;
+    for( const Entry& e : Entries() )
+    {
+        if( algorithm != e.m_algorithm )
+            continue;
+        known = true;
+
+        if( ( !e.m_closed || closed == e.m_closed ) && ( !e.m_open || open == e.m_open ) )
+            return e;
+    }
+
+    if( !known )
+        throw std::invalid_argument( "Unknown engine: " + name );
+    throw std::invalid_argument( "Engine " + name + " does not support closed set \"" + closed + "\" with open set \"" + open + "\"" );
+}
+
+//
+// Creates the engine "name" with policies "closed" and "open" of closed set and open set
+//
+std::unique_ptr< Engine > EngineRegistry::Create( const std::string& name, const std::string& closed, const std::string& open )
+{
+    Params params;
+    const Entry& e = Find( name, closed, open, params );
+    return e.m_create( params );
+}
+
+//
+// Throws the exception, if the engine of "entry" named "name" requires the incremental heuristic,
+// but it is given the "heuristic" other than Manhattan metric or the "perimeter"
+//
+void EngineRegistry::CheckHeuristic( const Entry& entry, const std::string& name, Graph::Heuristic heuristic, bool perimeter )
+{
+    if( entry.m_incremental && ( heuristic != Graph::MANHATTAN || perimeter ) )
+        throw std::invalid_argument( "Engine " + name + " supports only heuristic manhattan without perimeter" );
+}
+
+//
+// Prints the table of engines
+//
+void EngineRegistry::Print( std::ostream& out )
+{
+    char line[ 256 ];
+    snprintf( line, sizeof( line ), "   %-16s %-8s %-8s %s", "engine", "closed", "open", "description" );
+    out << line << "\n";
+
+    for( const Entry& e : Entries() )
+    {
+        snprintf( line, sizeof( line ), "   %-16s %-8s %-8s %s", e.m_algorithm,
+            e.m_closed ? e.m_closed : "-", e.m_open ? e.m_open : "-", e.m_description );
+        out << line << "\n";
+    }
+    out << "   Weighted A* is selected as \"wastar-W\", where W is the integer weight of heuristic.\n";
+    out << "   A* with lookahead is selected as \"alstar-K\", where K is the depth of lookahead from 1 to 8.\n";
+    out << "   IDA* with transposition table of M MiB is selected as \"idastar-tt-M\" or \"idastar-basic-tt-M\".\n";
+    out << "   External-memory A* sorting chunks of M MiB is selected as \"extastar-M\".\n";
+    out << "   EPEA* supports only heuristic manhattan without perimeter.\n";
+}
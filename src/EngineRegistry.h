@@ -0,0 +1,92 @@
+#ifndef ASTAR_ENGINEREGISTRY_H
+#define ASTAR_ENGINEREGISTRY_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Table of search engines available at run time.
+//
+// 2. Each entry is the fully specialized engine, e.g. AstarEngine<ClosedSetHash, OpenSetBucket>.
+//    Hence, the engine selected by name runs the same code as the engine selected at compile time.
+//
+// 3. The engine is selected by its name and the names of policies of closed set and open set:
+//       name   - "astar", "wastar-W" (Weighted A* with integer weight W),
+//                "alstar-K" (A* with lookahead of depth K up to 8), "epea", "idastar", "idastar-basic",
+//                "idastar-tt-M" or "idastar-basic-tt-M" (IDA* with transposition table of M MiB),
+//                "bfhs" (divide-and-conquer breadth-first heuristic search),
+//                "extastar" or "extastar-M" (external-memory A* sorting chunks of M MiB)
+//       closed - "hash" (ClosedSetHash) or "tree" (ClosedSet)
+//       open   - "hash" (OpenSetHash), "bucket" (OpenSetBucket) or "tree" (OpenSet)
+//    The engines without closed set or open set (e.g. IDA*) accept any policy.
+//
+// 4. New engine is available after adding one entry to the table in EngineRegistry.cpp.
+//
+// 5. Function Find validates the name without creating the engine, which allocates large buffers.
+//
+// 6. If the engine is not found, the exception std::invalid_argument is thrown.
+//
+// 7. Some engines require the incremental heuristic (see Graph::IsIncremental), i.e. Manhattan
+//    metric without the perimeter. Function CheckHeuristic rejects the other heuristics for them.
+//
+
+#include "Engine.h"
+#include "Graph.h"
+#include "Cost.h"
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class EngineRegistry
+{
+public:
+    // Parameters of the engine given by its name
+    struct Params
+    {
+        // Weight of heuristic, "wastar-W"
+        Cost m_weight = 1;
+
+        // Depth of lookahead, "alstar-K"
+        unsigned int m_lookahead = 0;
+
+        // Memory of transposition table in MiB, "idastar-tt-M" and "idastar-basic-tt-M"
+        unsigned int m_table = 64;
+
+        // Memory of the chunk sorted in memory in MiB, "extastar-M"
+        unsigned int m_sort = 256;
+    };
+
+    // Creates the engine with parameters "params"
+    using Factory = std::unique_ptr< Engine > ( * )( const Params& params );
+
+    struct Entry
+    {
+        // Name of algorithm, "astar" covers "wastar-W" and "alstar-K" as well
+        const char* m_algorithm;
+
+        // Names of policies of closed set and open set, NULL if the engine accepts any policy
+        const char* m_closed;
+        const char* m_open;
+
+        const char* m_description;
+        Factory m_create;
+
+        // "true" if the engine requires the incremental heuristic
+        bool m_incremental = false;
+    };
+
+public:
+    static const std::vector< Entry >& Entries( );
+
+    static const Entry& Find( const std::string& name, const std::string& closed, const std::string& open, Params& params );
+
+    static std::unique_ptr< Engine > Create( const std::string& name,
+        const std::string& closed = "hash", const std::string& open = "hash" );
+
+    static void CheckHeuristic( const Entry& entry, const std::string& name, Graph::Heuristic heuristic, bool perimeter );
+
+    static void Print( std::ostream& out );
+};
+
+#endif
@@ -14,6 +14,10 @@ State Examples::Get(size_t id) const
     return at(id);
 }
 
+// The examples are defined for each supported width of the board
+
+#if PUZZLE_WIDTH == 5
+
 State Examples::Ex01()
 {
     const std::array< char, State::TILENO > tab{
@@ -82,3 +86,132 @@ State Examples::Ex05()
 
     return State{ tab };
 }
+
+#elif PUZZLE_WIDTH == 4
+
+State Examples::Ex01()
+{
+    const std::array< char, State::TILENO > tab{
+     5,  1,  3,  4,
+     9,  0,  6,  8,
+    10,  2,  7, 11,
+    13, 14, 15, 12,
+    };
+
+    return State{ tab };
+}
+
+
+State Examples::Ex02()
+{
+    const std::array< char, State::TILENO > tab{
+     1,  2, 11,  8,
+     5,  7,  3,  0,
+     9,  6,  4, 10,
+    13, 14, 15, 12,
+    };
+
+    return State{ tab };
+}
+
+
+State Examples::Ex03()
+{
+    const std::array< char, State::TILENO > tab{
+     2,  3,  8,  7,
+     6,  0,  5,  4,
+     1, 11, 14, 12,
+    13,  9, 15, 10,
+    };
+
+    return State{ tab };
+}
+
+
+State Examples::Ex04()
+{
+    const std::array< char, State::TILENO > tab{
+     0,  8,  6,  4,
+     1,  2,  3, 12,
+     5, 14,  7, 10,
+     9, 13, 11, 15,
+    };
+
+    return State{ tab };
+}
+
+
+State Examples::Ex05()
+{
+    const std::array< char, State::TILENO > tab{
+     4,  8,  6,  7,
+     2,  3, 14,  0,
+     1,  5, 11, 12,
+    13, 15,  9, 10,
+    };
+
+    return State{ tab };
+}
+
+#elif PUZZLE_WIDTH == 3
+
+State Examples::Ex01()
+{
+    const std::array< char, State::TILENO > tab{
+     0,  5,  2,
+     1,  8,  3,
+     4,  7,  6,
+    };
+
+    return State{ tab };
+}
+
+
+State Examples::Ex02()
+{
+    const std::array< char, State::TILENO > tab{
+     2,  7,  5,
+     1,  0,  3,
+     4,  8,  6,
+    };
+
+    return State{ tab };
+}
+
+
+State Examples::Ex03()
+{
+    const std::array< char, State::TILENO > tab{
+     2,  1,  5,
+     3,  7,  6,
+     4,  8,  0,
+    };
+
+    return State{ tab };
+}
+
+
+State Examples::Ex04()
+{
+    const std::array< char, State::TILENO > tab{
+     0,  6,  8,
+     3,  4,  2,
+     1,  5,  7,
+    };
+
+    return State{ tab };
+}
+
+
+State Examples::Ex05()
+{
+    const std::array< char, State::TILENO > tab{
+     2,  3,  0,
+     4,  6,  5,
+     8,  1,  7,
+    };
+
+    return State{ tab };
+}
+
+#endif
@@ -0,0 +1,488 @@
+#include "ExternalAstar.h"
+#include "radixsort.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <unistd.h>
+
+//
+// Constructor. The chunk sorted in memory takes at most "sortBytes" bytes.
+// The work directory is the directory of temporary files.
+//
+ExternalAstar::ExternalAstar( size_t sortBytes )
+    : m_resumable( false )
+    , m_instance( s_instanceNo++ )
+    , m_sortBytes( sortBytes )
+    , m_bufferBytes( 0 )
+    , m_depth( 0 )
+    , m_expandedNo( 0 )
+    , m_limitReached( false )
+{
+    std::error_code ec;
+    m_dir = std::filesystem::temp_directory_path( ec ).string();
+    if( ec )
+        m_dir = ".";
+}
+
+//
+// Finds the solution. Returns the empty value, if the limits are exceeded.
+// The files of the stopped search in the explicit work directory are kept,
+// the next search from "beg" resumes it.
+//
+std::optional< std::vector< State > > ExternalAstar::Solve( Graph& graph, const State& beg, const Limits& limits )
+{
+    m_limits = limits;
+    m_limits.Start();
+
+    m_expandedNo = 0;
+    m_limitReached = false;
+    m_metrics.Reset();
+    m_memory.Reset();
+
+    std::vector< State > path = { beg };
+    if( graph.IsGoal( beg ) )
+        return path;
+
+    const PackedState start( beg );
+    char tag[ 64 ];
+    if( m_resumable )
+        snprintf( tag, sizeof( tag ), "%016llx", static_cast< unsigned long long >( start.Hash() ) );
+    else
+        snprintf( tag, sizeof( tag ), "%016llx_%ld_%u", static_cast< unsigned long long >( start.Hash() ),
+                  static_cast< long >( getpid() ), m_instance );
+    m_tag = tag;
+
+    const std::string checkpoint = Checkpoint( graph, start );
+    if( !m_resumable || !Resume( checkpoint ) )
+        Start( graph, start, checkpoint );
+
+    while( !m_open.empty() )
+    {
+        const Cost f = m_open.begin()->first;
+        const Cost g = m_open.begin()->second;
+
+        const Result r = Expand( graph, g, f - g );
+        RecordMemory();
+
+        if( r == FOUND )
+        {
+            Reconstruct( graph, path );
+            Remove();
+            return path;
+        }
+
+        if( r == STOPPED || ( m_limits.m_maxBytes > 0 && m_memory.Reserved() > m_limits.m_maxBytes ) )
+        {
+            m_limitReached = true;
+            if( !m_resumable )
+                Remove();
+            return {};
+        }
+
+        // Checkpoint: all children of the bucket are written
+        std::filesystem::remove( Path( g, f - g, "open" ) );
+        m_open.erase( m_open.begin() );
+    }
+
+    Remove();
+    return {};
+}
+
+//
+// Returns the content of the checkpoint file: the start state "beg", the heuristic
+// and the perimeter of "graph". The search is resumed only with the same values.
+//
+std::string ExternalAstar::Checkpoint( const Graph& graph, const PackedState& beg )
+{
+    const Perimeter* perimeter = graph.GetPerimeter();
+
+    std::ostringstream out;
+    out << std::hex << beg.m_word[ 0 ] << ' ' << beg.m_word[ 1 ] << std::dec
+        << ' ' << Graph::Name( graph.GetHeuristic() )
+        << ' ' << ( perimeter ? perimeter->Depth() : 0 )
+        << ' ' << ( perimeter ? perimeter->Margin() : 0 ) << '\n';
+    return out.str();
+}
+
+//
+// Finds the open files of the stopped search with the content "checkpoint" of the checkpoint file.
+// Returns "false", if there is no such search. The incomplete state at the end of the open file
+// (the search was killed) is truncated.
+//
+bool ExternalAstar::Resume( const std::string& checkpoint )
+{
+    namespace fs = std::filesystem;
+
+    m_open.clear();
+
+    // The tag is the hash, the start state, the heuristic and the perimeter are compared
+    std::ifstream in( m_dir + "/" + m_tag + ".checkpoint" );
+    std::ostringstream content;
+    content << in.rdbuf();
+    if( !in || content.str() != checkpoint )
+        return false;
+
+    const std::string prefix = m_tag + "-";
+    for( const fs::directory_entry& e : fs::directory_iterator( m_dir ) )
+    {
+        const std::string name = e.path().filename().string();
+        if( name.compare( 0, prefix.size(), prefix ) != 0 )
+            continue;
+
+        Cost g = 0;
+        Cost h = 0;
+        char ext[ 16 ] = "";
+        if( sscanf( name.c_str() + prefix.size(), "%d-%d.%15s", &g, &h, ext ) != 3 || std::string( ext ) != "open" )
+            continue;
+
+        const uintmax_t size = fs::file_size( e.path() );
+        if( size % sizeof( PackedState ) != 0 )
+            fs::resize_file( e.path(), size - size % sizeof( PackedState ) );
+
+        m_open.insert( { g + h, g } );
+    }
+    return !m_open.empty();
+}
+
+//
+// Starts the new search from "beg". The files of the previous search from "beg" are removed.
+//
+void ExternalAstar::Start( Graph& graph, const PackedState& beg, const std::string& checkpoint )
+{
+    Remove();
+
+    const std::string path = m_dir + "/" + m_tag + ".checkpoint";
+    std::ofstream out( path );
+    out << checkpoint;
+    out.close();
+    if( !out )
+        throw std::invalid_argument( "Error during writing file. Path = " + path );
+
+    const Cost h = graph.CalcH( beg.Unpack() );
+    RunWriter open( m_io, Path( 0, h, "open" ), false );
+    open.Write( beg );
+    open.Close();
+
+    m_open.clear();
+    m_open.insert( { h, 0 } );
+}
+
+//
+// Expands bucket ( g, h ). The duplicates are removed from its open file, the remaining states
+// are written to its closed file and expanded.
+//
+ExternalAstar::Result ExternalAstar::Expand( Graph& graph, Cost g, Cost h )
+{
+    namespace fs = std::filesystem;
+
+    // Sorted runs of the open file, the last chunk is kept in memory
+    const std::string open = Path( g, h, "open" );
+    const size_t chunkNo = std::max< size_t >( m_sortBytes / ( 2 * sizeof( PackedState ) ), 1 );
+
+    std::vector< std::string > runs;
+    m_chunk.clear();
+    m_chunk.reserve( std::min< size_t >( chunkNo, fs::file_size( open ) / sizeof( PackedState ) ) );
+    {
+        RunReader in( m_io, open );
+        PackedState s;
+        while( in.Read( s ) )
+        {
+            m_chunk.push_back( s );
+            if( m_chunk.size() == chunkNo )
+            {
+                Sort();
+                runs.push_back( Path( g, h, "run" + std::to_string( runs.size() ) ) );
+                SaveRun( runs.back() );
+                m_chunk.clear();
+            }
+        }
+    }
+    Sort();
+
+    std::vector< std::unique_ptr< RunReader > > readers;
+    for( const std::string& path : runs )
+        readers.push_back( std::make_unique< RunReader >( m_io, path, MERGE_BUFFER_BYTES ) );
+
+    // Heap of the first states of the runs and the chunk (source "readers.size()")
+    using Head = std::pair< PackedState, size_t >;
+    const auto greater = []( const Head& a, const Head& b ) { return Less( b.first, a.first ); };
+    std::priority_queue< Head, std::vector< Head >, decltype( greater ) > heap( greater );
+
+    size_t pos = 0;
+    const auto next = [ & ]( size_t src, PackedState& s ) {
+        if( src < readers.size() )
+            return readers[ src ]->Read( s );
+        if( pos == m_chunk.size() )
+            return false;
+        s = m_chunk[ pos++ ];
+        return true;
+    };
+
+    // Returns the next state of the merged runs. The single chunk is read directly.
+    const auto pop = [ & ]( PackedState& s ) {
+        if( readers.empty() )
+            return next( 0, s );
+        if( heap.empty() )
+            return false;
+
+        const size_t src = heap.top().second;
+        s = heap.top().first;
+        heap.pop();
+
+        PackedState n;
+        if( next( src, n ) )
+            heap.push( { n, src } );
+        return true;
+    };
+
+    for( size_t src = 0; src <= readers.size() && !readers.empty(); src++ )
+    {
+        PackedState s;
+        if( next( src, s ) )
+            heap.push( { s, src } );
+    }
+
+    // Closed file of bucket ( g - 2, h ), which may hold the duplicates
+    std::unique_ptr< RunReader > prev;
+    if( g >= 2 && fs::exists( Path( g - 2, h, "closed" ) ) )
+        prev = std::make_unique< RunReader >( m_io, Path( g - 2, h, "closed" ) );
+
+    PackedState c;
+    bool hasClosed = prev && prev->Read( c );
+
+    RunWriter closed( m_io, Path( g, h, "closed" ), false );
+
+    m_bufferBytes = closed.Bytes() + ( prev ? prev->Bytes() : 0 );
+    for( const std::unique_ptr< RunReader >& r : readers )
+        m_bufferBytes += r->Bytes();
+
+    PackedState last;
+    bool first = true;
+    PackedState s;
+    while( pop( s ) )
+    {
+        if( !first && s == last )
+        {
+            m_metrics.Add( Metrics::DUPLICATE_OPEN );
+            continue;
+        }
+        first = false;
+        last = s;
+
+        while( hasClosed && Less( c, s ) )
+            hasClosed = prev->Read( c );
+        if( hasClosed && c == s )
+        {
+            m_metrics.Add( Metrics::DUPLICATE_CLOSED );
+            continue;
+        }
+
+        if( m_limits.Exceeded( m_expandedNo ) )
+        {
+            m_child.clear();
+            return STOPPED;
+        }
+
+        closed.Write( s );
+        m_expandedNo++;
+        m_metrics.Add( Metrics::EXPANDED );
+
+        const State x = s.Unpack();
+        const uint8_t sp = static_cast< uint8_t >( x.SpaceIdx() );
+        const char movesNo = Graph::MovesNo( sp );
+        for( uint8_t j = 0; j < movesNo; j++ )
+        {
+            State y = x;
+            y.Swap( sp, Graph::Move( sp, j ) );
+
+            if( graph.IsGoal( y ) )
+            {
+                m_goal = PackedState( y );
+                m_parent = s;
+                m_depth = g + 1;
+                m_child.clear();
+                return FOUND;
+            }
+            Child( g + 1, graph.CalcH( y ) ).Write( PackedState( y ) );
+        }
+
+        m_metrics.Add( Metrics::GENERATED, movesNo );
+        m_metrics.Record( Metrics::BRANCHING, movesNo );
+    }
+
+    closed.Close();
+    m_metrics.Add( Metrics::SPILLED, closed.Count() * sizeof( PackedState ) );
+    for( auto& w : m_child )
+    {
+        w.second->Close();
+        m_metrics.Add( Metrics::SPILLED, w.second->Count() * sizeof( PackedState ) );
+    }
+    m_child.clear();
+
+    readers.clear();
+    for( const std::string& path : runs )
+        fs::remove( path );
+
+    return DONE;
+}
+
+//
+// Sorts the chunk in the order of the files and removes its duplicates
+//
+void ExternalAstar::Sort( )
+{
+    RadixSort( m_chunk, m_tmp, &ExternalAstar::Key, KEY_BITS );
+
+    // The states of equal keys are rare, they are sorted by std::sort
+    for( size_t i = 0; i < m_chunk.size(); )
+    {
+        const uint64_t k = Key( m_chunk[ i ] );
+        size_t end = i + 1;
+        while( end < m_chunk.size() && Key( m_chunk[ end ] ) == k )
+            end++;
+        if( end - i > 1 )
+            std::sort( m_chunk.begin() + i, m_chunk.begin() + end );
+        i = end;
+    }
+
+    const auto end = std::unique( m_chunk.begin(), m_chunk.end() );
+    m_metrics.Add( Metrics::DUPLICATE_OPEN, m_chunk.end() - end );
+    m_chunk.erase( end, m_chunk.end() );
+}
+
+//
+// Writes the sorted chunk to the run file "path"
+//
+void ExternalAstar::SaveRun( const std::string& path )
+{
+    RunWriter run( m_io, path, false );
+    for( const PackedState& s : m_chunk )
+        run.Write( s );
+    run.Close();
+
+    m_metrics.Add( Metrics::SPILLED, run.Count() * sizeof( PackedState ) );
+}
+
+//
+// Reconstructs the path from the start state to the GOAL state found by function Expand.
+// The predecessor of each state is its neighbour in the closed files of the previous depth,
+// the neighbours of each heuristic are searched by single pass over the sorted closed file.
+//
+void ExternalAstar::Reconstruct( Graph& graph, std::vector< State >& path )
+{
+    std::vector< State > rev = { m_goal.Unpack(), m_parent.Unpack() };
+
+    for( Cost d = m_depth - 1; d > 0; d-- )
+    {
+        const State x = rev.back();
+        const uint8_t sp = static_cast< uint8_t >( x.SpaceIdx() );
+        const char movesNo = Graph::MovesNo( sp );
+
+        std::map< Cost, std::vector< PackedState > > neighbour;
+        for( uint8_t j = 0; j < movesNo; j++ )
+        {
+            State y = x;
+            y.Swap( sp, Graph::Move( sp, j ) );
+            neighbour[ graph.CalcH( y ) ].push_back( PackedState( y ) );
+        }
+
+        bool found = false;
+        for( auto& n : neighbour )
+        {
+            const std::string p = Path( d - 1, n.first, "closed" );
+            if( !std::filesystem::exists( p ) )
+                continue;
+
+            std::vector< PackedState >& cand = n.second;
+            std::sort( cand.begin(), cand.end(), &ExternalAstar::Less );
+
+            RunReader in( m_io, p );
+            PackedState s;
+            size_t i = 0;
+            while( !found && i < cand.size() && in.Read( s ) )
+            {
+                while( i < cand.size() && Less( cand[ i ], s ) )
+                    i++;
+                if( i < cand.size() && cand[ i ] == s )
+                {
+                    rev.push_back( s.Unpack() );
+                    found = true;
+                }
+            }
+            if( found )
+                break;
+        }
+
+        if( !found )
+            throw std::invalid_argument( "Path is not found in the closed files. Path = " + m_dir + "/" + m_tag );
+    }
+
+    path.assign( rev.rbegin(), rev.rend() );
+}
+
+//
+// Removes all files of the current search
+//
+void ExternalAstar::Remove( ) const
+{
+    namespace fs = std::filesystem;
+
+    const std::string prefix = m_tag + "-";
+    const std::string checkpoint = m_tag + ".checkpoint";
+
+    std::error_code ec;
+    std::vector< fs::path > files;
+    for( const fs::directory_entry& e : fs::directory_iterator( m_dir, ec ) )
+    {
+        const std::string name = e.path().filename().string();
+        if( name.compare( 0, prefix.size(), prefix ) == 0 || name == checkpoint )
+            files.push_back( e.path() );
+    }
+
+    for( const fs::path& p : files )
+        fs::remove( p, ec );
+}
+
+//
+// Records the memory. The chunk is reported as the open set, the auxiliary buffer
+// of the radix sort and the buffers of the files as the buffers. The closed set is on disk.
+//
+void ExternalAstar::RecordMemory( )
+{
+    MemoryUsage part[ MemoryStats::PART_NO ];
+
+    part[ MemoryStats::OPEN_SET ].m_used = m_chunk.size() * sizeof( PackedState );
+    part[ MemoryStats::OPEN_SET ].m_reserved = m_chunk.capacity() * sizeof( PackedState );
+    part[ MemoryStats::BUFFERS ].m_used = m_tmp.size() * sizeof( PackedState ) + m_bufferBytes;
+    part[ MemoryStats::BUFFERS ].m_reserved = m_tmp.capacity() * sizeof( PackedState ) + m_bufferBytes;
+
+    m_memory.Record( m_expandedNo, m_limits.Elapsed(), part );
+}
+
+//
+// Returns the path of the file "ext" of bucket ( g, h )
+//
+std::string ExternalAstar::Path( Cost g, Cost h, const std::string& ext ) const
+{
+    return m_dir + "/" + m_tag + "-" + std::to_string( g ) + "-" + std::to_string( h ) + "." + ext;
+}
+
+//
+// Returns the writer of the open file of bucket ( g, h ) of the children.
+// The file is opened for appending, when the first child is written.
+//
+RunWriter& ExternalAstar::Child( Cost g, Cost h )
+{
+    std::unique_ptr< RunWriter >& w = m_child[ h ];
+    if( !w )
+    {
+        w = std::make_unique< RunWriter >( m_io, Path( g, h, "open" ), true );
+        m_open.insert( { g + h, g } );
+        m_bufferBytes += w->Bytes();
+    }
+    return *w;
+}
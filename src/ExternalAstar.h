@@ -0,0 +1,192 @@
+#ifndef ASTAR_EXTERNALASTAR_H
+#define ASTAR_EXTERNALASTAR_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Represents external-memory A*. The open set and the closed set are kept in the run files
+//    on disk (see RunFile.h), hence the number of nodes is limited by the disk, not by the memory.
+//
+// 2. The nodes are partitioned into buckets by "g" and "h". Each bucket has two files
+//    in the work directory (see function SetWorkDir):
+//       TAG-g-h.open   - the generated states, appended in any order, with duplicates,
+//       TAG-g-h.closed - the expanded states, sorted and without duplicates,
+//    where TAG is the hash of the start state. Unless the work directory is set explicitly,
+//    TAG is followed by the process id and the number of the engine, hence the concurrent
+//    searches of the same state do not share the files.
+//
+// 3. The buckets are expanded in the order of increasing "f = g + h" and increasing "g"
+//    within each "f". The children of bucket (g, h) are appended to buckets (g + 1, h'),
+//    which are expanded later, since "f" never decreases (the heuristic is consistent).
+//
+// 4. The duplicates are detected with delay, once per bucket. The open file is read
+//    in chunks of "sortBytes" bytes, each chunk is sorted by the radix sort (see radixsort.h)
+//    and written to the run file TAG-g-h.runN. The runs are merged, the duplicates are removed
+//    and the result is merge-joined with the closed file of bucket (g - 2, h). The other
+//    buckets cannot hold the state: the graph is undirected and bipartite, the expanded states
+//    have the optimal "g" and each state has the single "h". The remaining states are written
+//    to the closed file of the bucket and expanded. The bucket of single chunk is merged
+//    directly from the memory.
+//
+// 5. All files are read and written sequentially, the buffers are read ahead and written
+//    behind by the background tasks. They are run by the single I/O thread of the engine
+//    (see IoThread). The memory is bounded by "sortBytes" and the buffers of the run files,
+//    it does not depend on the number of nodes.
+//
+// 6. The search is checkpointed after each bucket: the children are written and the open file
+//    of the bucket is removed. Hence, the files are the complete state of the search.
+//    If the work directory is set explicitly and the search is stopped (by the limits, or even
+//    killed), its files are kept and the next search from the same start state resumes it
+//    from the first unfinished bucket. The children of the unfinished bucket, which are written
+//    already, are generated again, and they are removed as the duplicates. The checkpoint file
+//    TAG.checkpoint holds the start state, the heuristic and the perimeter of the search,
+//    the search of other heuristic or perimeter starts again. The files are removed,
+//    when the search is finished, or when it is stopped in the temporary directory.
+//
+// 7. The states are not stored with their parents. The path is reconstructed backwards
+//    from the goal: the predecessor of the state of depth "g" is its neighbour found
+//    in the closed files of depth "g - 1". Each closed file is scanned at most once.
+//
+// 8. The states are stored packed (16 bytes), the files are not compressed further.
+//    The delta coding does not fit: the open files are not sorted, and the other files are
+//    sorted by the hash of the state, whose small differences do not give back the state.
+//    The disk is not the bottleneck either: on 11 instances of 24-puzzle the search writes
+//    1074 MiB and waits for the I/O thread 0.06 s of 16 s (0.4%).
+//
+
+#include "Engine.h"
+#include "Cost.h"
+#include "MemoryStats.h"
+#include "PackedState.h"
+#include "RunFile.h"
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+class ExternalAstar : public Engine
+{
+public:
+    // Default memory of the sorted chunk
+    inline static constexpr size_t SORT_BYTES = size_t( 256 ) << 20;
+
+public:
+    explicit ExternalAstar( size_t sortBytes = SORT_BYTES );
+
+    std::string Name( ) const override { return "extastar"; }
+    bool IsOptimal( ) const override { return true; }
+
+    std::optional< std::vector< State > > Solve( Graph& graph, const State& beg, const Limits& limits ) override;
+
+    size_t ExpandedNo( ) const override { return m_expandedNo; }
+    bool LimitReached( ) const override { return m_limitReached; }
+    const Metrics* GetMetrics( ) const override { return &m_metrics; }
+    const MemoryStats* GetMemory( ) const override { return &m_memory; }
+
+    void SetWorkDir( const std::string& dir ) override { m_dir = dir; m_resumable = true; }
+
+private:
+    // Result of the expansion of the bucket
+    enum Result
+    {
+        DONE,       // Bucket is expanded
+        FOUND,      // GOAL state is generated
+        STOPPED     // Search is stopped by the limits
+    };
+
+private:
+    bool Resume( const std::string& checkpoint );
+    void Start( Graph& graph, const PackedState& beg, const std::string& checkpoint );
+    Result Expand( Graph& graph, Cost g, Cost h );
+    void Sort( );
+    void SaveRun( const std::string& path );
+    void Reconstruct( Graph& graph, std::vector< State >& path );
+    void Remove( ) const;
+    void RecordMemory( );
+
+    std::string Path( Cost g, Cost h, const std::string& ext ) const;
+    static std::string Checkpoint( const Graph& graph, const PackedState& beg );
+    RunWriter& Child( Cost g, Cost h );
+
+    // Returns the key of the order of the files. The multiplications move the bits of both words
+    // of the state to the high bits, which are the key.
+    static uint64_t Key( const PackedState& s )
+    {
+        const uint64_t h = s.m_word[ 0 ] * 0x9e3779b97f4a7c15ULL ^ s.m_word[ 1 ] * 0xc2b2ae3d27d4eb4fULL;
+        return h >> ( 64 - KEY_BITS );
+    }
+
+    // Order of the files, the states of equal keys are ordered by the states
+    static bool Less( const PackedState& a, const PackedState& b )
+    {
+        const uint64_t ka = Key( a );
+        const uint64_t kb = Key( b );
+        return ka < kb || ( ka == kb && a < b );
+    }
+
+private:
+    // Bits of the key of the order of the files
+    inline static constexpr unsigned int KEY_BITS = 44;
+
+    // Size of the buffers of the runs merged at once
+    inline static constexpr size_t MERGE_BUFFER_BYTES = 256 << 10;
+
+    // Number of the engines created by the process
+    inline static std::atomic< unsigned int > s_instanceNo = 0;
+
+    // Work directory and the prefix of the names of the files of the current search
+    std::string m_dir;
+    std::string m_tag;
+
+    // Work directory is set explicitly, the stopped search is resumed
+    bool m_resumable;
+
+    // Number of the engine within the process, it distinguishes the files of the engines
+    const unsigned int m_instance;
+
+    // Memory of the sorted chunk
+    const size_t m_sortBytes;
+
+    // Chunk of the open file and the auxiliary buffer of the radix sort
+    std::vector< PackedState > m_chunk;
+    std::vector< PackedState > m_tmp;
+
+    // Buckets with the open file, as pairs ( f, g )
+    std::set< std::pair< Cost, Cost > > m_open;
+
+    // Thread reading and writing the files, it outlives their readers and writers
+    IoThread m_io;
+
+    // Writers of the children of the current bucket by their "h"
+    std::map< Cost, std::unique_ptr< RunWriter > > m_child;
+
+    // Memory of the buffers of the current bucket
+    size_t m_bufferBytes;
+
+    // GOAL state, its depth and its parent found by function Expand
+    PackedState m_goal;
+    PackedState m_parent;
+    Cost m_depth;
+
+    // Limits of the search
+    Limits m_limits;
+
+    // Number of expanded nodes
+    size_t m_expandedNo;
+
+    // Last search was stopped by the limits
+    bool m_limitReached;
+
+    // Metrics of the current search
+    Metrics m_metrics;
+
+    // Memory of the chunk and the buffers, recorded after each bucket
+    MemoryStats m_memory;
+};
+
+#endif
@@ -0,0 +1,92 @@
+#include "Generator.h"
+#include "Graph.h"
+#include <array>
+
+//
+// Constructor
+// "seed" - the seed, the state of generator is initialized by splitmix64
+//
+Generator::Generator( uint64_t seed )
+{
+    for( uint64_t& s : m_s )
+    {
+        seed += 0x9e3779b97f4a7c15ULL;
+        uint64_t z = seed;
+        z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+        z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebULL;
+        s = z ^ ( z >> 31 );
+    }
+}
+
+//
+// Returns the uniformly random solvable state
+//
+State Generator::Permutation( )
+{
+    // Shuffle starts from the GOAL state: tile "t" on position "t - 1", SPACE on the last position
+    std::array< char, State::TILENO > tab;
+    for( uint i = 0; i < State::TILENO; i++ )
+        tab[ i ] = static_cast< char >( ( i + 1 ) % State::TILENO );
+
+    // Fisher-Yates shuffle.
+    // Each swap of two different positions changes the parity of the permutation.
+    uint parity = 0;
+    for( uint i = State::TILENO - 1; i > 0; i-- )
+    {
+        const uint j = Below( i + 1 );
+        const char tmp = tab[ i ];
+        tab[ i ] = tab[ j ];
+        tab[ j ] = tmp;
+        parity ^= ( i != j );
+    }
+
+    uint sp = 0;
+    while( tab[ sp ] != 0 )
+        sp++;
+
+    const uint dist = ( State::WIDTH - 1 - sp % State::WIDTH ) + ( State::WIDTH - 1 - sp / State::WIDTH );
+
+    if( parity != dist % 2 )
+    {
+        // Swap of two tiles (SPACE excluded) changes the parity
+        const uint a = ( sp == 0 ) ? 1 : 0;
+        const uint b = ( sp <= 1 ) ? 2 : 1;
+        const char tmp = tab[ a ];
+        tab[ a ] = tab[ b ];
+        tab[ b ] = tmp;
+    }
+
+    const State s{ tab };
+    assert( s.IsSolvable() );
+    return s;
+}
+
+//
+// Returns the state obtained by exactly "k" random moves from the GOAL state.
+// The move reverting the previous move is not allowed.
+//
+State Generator::Walk( unsigned int k )
+{
+    State s = Graph::Goal();
+    uint sp = State::TILENO - 1;
+    uint prev = State::TILENO;
+
+    for( unsigned int i = 0; i < k; i++ )
+    {
+        const uint no = Graph::MovesNo( sp );
+
+        // One of the allowed moves is drawn, except the move to the previous position.
+        // If the previous position is drawn, it is replaced by the last allowed move.
+        const uint excl = ( i > 0 );
+        uint j = Below( no - excl );
+        uint np = Graph::Move( sp, j );
+        if( np == prev )
+            np = Graph::Move( sp, no - 1 );
+
+        s.Swap( sp, np );
+        prev = sp;
+        sp = np;
+    }
+
+    return s;
+}
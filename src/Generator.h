@@ -0,0 +1,85 @@
+#ifndef ASTAR_GENERATOR_H
+#define ASTAR_GENERATOR_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Generator of random solvable instances.
+//
+// 2. The sequence of instances is fully determined by the 64-bit seed.
+//    The pseudo-random numbers are generated by xoshiro256**,
+//    its state is initialized by splitmix64.
+//
+// 3. Function Permutation returns the uniformly random permutation of tiles.
+//    If the permutation is not solvable, the first two tiles (SPACE excluded)
+//    are swapped, which changes the parity of the permutation.
+//
+// 4. Function Walk returns the state obtained by exactly "k" random moves
+//    from the GOAL state. The move reverting the previous move is not allowed.
+//    Hence, the length of optimal solution is at most "k".
+//
+// 5. No memory is allocated, so millions of instances per second are generated.
+//
+
+#include "State.h"
+#include <cstdint>
+
+class Generator
+{
+public:
+    explicit Generator( uint64_t seed );
+
+    State Permutation( );
+    State Walk( unsigned int k );
+
+    uint64_t Next( );
+    uint32_t Below( uint32_t n );
+
+private:
+    static uint64_t Rotl( uint64_t x, int k );
+
+private:
+    // State of xoshiro256**
+    uint64_t m_s[ 4 ];
+};
+
+//
+// Rotates "x" left by "k" bits
+//
+inline
+uint64_t Generator::Rotl( uint64_t x, int k )
+{
+    return ( x << k ) | ( x >> ( 64 - k ) );
+}
+
+//
+// Returns the next 64-bit pseudo-random number (xoshiro256**)
+//
+inline
+uint64_t Generator::Next( )
+{
+    const uint64_t result = Rotl( m_s[ 1 ] * 5, 7 ) * 9;
+    const uint64_t t = m_s[ 1 ] << 17;
+
+    m_s[ 2 ] ^= m_s[ 0 ];
+    m_s[ 3 ] ^= m_s[ 1 ];
+    m_s[ 1 ] ^= m_s[ 2 ];
+    m_s[ 0 ] ^= m_s[ 3 ];
+    m_s[ 2 ] ^= t;
+    m_s[ 3 ] = Rotl( m_s[ 3 ], 45 );
+
+    return result;
+}
+
+//
+// Returns the pseudo-random number from the range [0, n).
+// The multiply-shift method is used instead of the slow modulo.
+//
+inline
+uint32_t Generator::Below( uint32_t n )
+{
+    return static_cast< uint32_t >( ( ( Next() >> 32 ) * n ) >> 32 );
+}
+
+#endif
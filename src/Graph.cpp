@@ -7,20 +7,37 @@
 //
 size_t Graph::GetChildren(const State& x, std::vector<State>& child,
     std::vector<Cost>& cost, std::vector<Cost>& heur)
+{
+    assert(child.size() == heur.size());
+
+    const size_t movesNo = GetMoves(x, child, cost);
+
+    for(size_t i = 0;  i < movesNo; i++)
+    {
+        heur[i] = CalcH(child[i]);
+    }
+    
+    return movesNo;
+}
+
+//
+// Generates children for state "x" without evaluating the heuristic.
+// Generated states (children) are stored in "child", "cost" arrays.
+// The heuristic can be evaluated later by function CalcH, only for the children which need it.
+//
+size_t Graph::GetMoves(const State& x, std::vector<State>& child, std::vector<Cost>& cost) const
 {
 const char idx = x.SpaceIdx();
 const char movesNo = MovesNo(idx);
 
     assert(child.size() >= static_cast<size_t>(movesNo));
     assert(child.size() == cost.size());
-    assert(child.size() == heur.size());
 
     for(char i = 0;  i < movesNo; i++)
     {
         child[i] = x;
         child[i].Swap(idx, Move(idx, i));
         cost[i] = 1;
-        heur[i] = CalcH(child[i]);
     }
     
     return movesNo;
@@ -54,3 +71,79 @@ Cost h = 0;
     return h;
 }
 
+
+//
+// Returns the minimal number of tiles, which must be removed from "goal" (of length "n"),
+// so that the remaining values are increasing, i.e. "n" minus the length of
+// the longest increasing subsequence.
+//
+static int ConflictNo(const char* goal, int n)
+{
+int len[State::WIDTH];
+int best = 0;
+
+    for(int i = 0; i < n; i++)
+    {
+        len[i] = 1;
+        for(int j = 0; j < i; j++)
+        {
+            if(goal[j] < goal[i] && len[j] + 1 > len[i])
+                len[i] = len[j] + 1;
+        }
+        if(len[i] > best)
+            best = len[i];
+    }
+    return n - best;
+}
+
+//
+// Calculates heuristic for state "s" as Manhattan distance with linear conflicts.
+// Two tiles are in linear conflict, if they are in their goal row (or column),
+// and they are in reversed order. One of them must leave the row (column),
+// which costs two additional moves. For each row (column) the minimal number of tiles
+// leaving it is added.
+//
+Cost Graph::LinearConflict(const State& s) const
+{
+char row[State::WIDTH], col[State::WIDTH];
+int rowNo, colNo;
+Cost h = Manhattan(s);
+
+    for(uint k = 0; k < State::WIDTH; k++)
+    {
+        rowNo = 0;
+        colNo = 0;
+        for(uint j = 0; j < State::WIDTH; j++)
+        {
+            // Position in row "k" and position in column "k"
+            const uint r = k * State::WIDTH + j;
+            const uint c = j * State::WIDTH + k;
+
+            // The goal column of the tiles, whose goal row is "k"
+            if(!s.IsSpace(r) && uint(s.Y(r)) == k)
+                row[rowNo++] = s.X(r);
+
+            // The goal row of the tiles, whose goal column is "k"
+            if(!s.IsSpace(c) && uint(s.X(c)) == k)
+                col[colNo++] = s.Y(c);
+        }
+
+        h += 2 * (ConflictNo(row, rowNo) + ConflictNo(col, colNo));
+    }
+    return h;
+}
+
+//
+// Returns name of heuristic "h"
+//
+const char* Graph::Name(Heuristic h)
+{
+    switch(h)
+    {
+    case MANHATTAN:
+        return "manhattan";
+    case LINEAR_CONFLICT:
+        return "linear-conflict";
+    }
+    return "unknown";
+}
@@ -11,83 +11,197 @@
 // ---------------------------------------------------------------------------------
 //      D E S C R I P T I O N
 // ---------------------------------------------------------------------------------
-// 1. Represents graph of 25-Puzzle game
+// 1. Represents graph of 25-Puzzle game (or smaller, see State::WIDTH)
 //
 // 2. This is weighted graph of states.
 // 
 // 3. Each state of graph is represented by object of class State.
 //
-// 4. Distance between states is defined by Manhattan metric.
+// 4. Distance between states is estimated by the heuristic selected in the constructor:
+//    Manhattan metric (default), or Manhattan metric with linear conflicts.
+//    Both heuristics are admissible and consistent.
 //
 // 5. There are pre-defined (hard-coded) interesting targed configurations.
 //
+// 6. The goal state, the table of allowed moves, the table of Manhattan distances between
+//    the positions (see function Distance) and the table of changes of Manhattan distance
+//    for each move (see function DeltaH) are generated at compile time for the width of the board.
+//    The other modules measuring the distances of tiles (e.g. Perimeter) use the same table.
+//
+// 7. Optionally, the graph uses the perimeter around the GOAL state (see Perimeter.h).
+//    The heuristic is improved by the perimeter, and the search is finished, when it reaches
+//    the state within the perimeter (function IsSolved). The path is completed by function Complete.
+//
 
 #include <vector>
 #include "State.h"
 #include "Cost.h"
+#include "Perimeter.h"
 
 class Graph
 {
 public:
+    // Heuristic estimating the distance to the GOAL state
+    enum Heuristic
+    {
+        MANHATTAN,       // Sum of Manhattan distances of tiles
+        LINEAR_CONFLICT  // Manhattan distance plus two moves for each tile in linear conflict
+    };
+
+public:
+    explicit Graph(Heuristic heuristic = MANHATTAN) : m_heuristic(heuristic) {}
+
     Cost CalcH(const State& x); 
     bool IsGoal(const State& x) const;
 
     size_t GetChildren(const State& x, std::vector<State>& child, std::vector<Cost>& cost, std::vector<Cost>& heur);
+    size_t GetMoves(const State& x, std::vector<State>& child, std::vector<Cost>& cost) const;
 
-private:
     Cost Manhattan(const State& x) const;
+    Cost LinearConflict(const State& x) const;
+
+    Heuristic GetHeuristic(void) const { return m_heuristic; }
+    static const char* Name(Heuristic h);
+
+    // The heuristic of the child is the heuristic of the parent changed by DeltaH
+    bool IsIncremental(void) const { return m_heuristic == MANHATTAN && !m_perimeter; }
+
+    void SetPerimeter(const Perimeter* perimeter) { m_perimeter = perimeter; }
+    const Perimeter* GetPerimeter(void) const { return m_perimeter; }
+
+    bool IsSolved(const State& x) const;
+    void Complete(std::vector<State>& path) const;
+
+    static const State& Goal( ) { return m_goal; }
 
     static char MovesNo( uint8_t idx );
     static char Move( uint8_t sp, uint8_t j );
+    static char DeltaH( char tile, uint8_t sp, uint8_t j );
+    static uint8_t Distance( uint8_t a, uint8_t b );
 
 public:
     // Maximal number of children for any state in graph (space state)
     inline static constexpr unsigned int MAX_CHILD_NO = 4;
 
 private:
+    static constexpr std::array< char, State::TILENO > MakeGoal( );
+    static constexpr std::array< std::array< char, MAX_CHILD_NO + 1 >, State::TILENO > MakeMoves( );
+    static constexpr std::array< std::array< uint8_t, State::TILENO >, State::TILENO > MakeDistance( );
+    static constexpr std::array< std::array< std::array< char, MAX_CHILD_NO >, State::TILENO >, State::TILENO > MakeDeltaH( );
 
-    // The GOAL state.
+private:
+    // The GOAL state: tiles 1, 2, ... in row-major order, SPACE on the last position.
     // The algorithm works ONLY FOR THIS GOAL STATE.
-    // If you want to modify the goal state, tables State::m_coorX, State::m_coorY must be modyfied as well!
-    inline static const State m_goal{std::array< char, State::TILENO>{
-                                  1,  2,  3,  4,  5,
-                                  6,  7,  8,  9, 10,
-                                 11, 12, 13, 14, 15,
-                                 16, 17, 18, 19, 20,
-                                 21, 22, 23, 24,  0}};
+    // If you want to modify the goal state, function State::GoalCoor must be modyfied as well!
+    static const State m_goal;
 
 
     // Allowed moves collected in tabular form.
     // The first element of each row determines number of allowed moves.
-    inline static const char m_moves[State::TILENO][MAX_CHILD_NO + 1] = {
-        {2, 1, 5},    // 0
-        {3, 0, 2, 6}, // 1
-        {3, 1, 3, 7}, // 2
-        {3, 2, 4, 8}, // 3
-        {2, 3, 9},    // 4
-        {3, 0, 6, 10},    // 5
-        {4, 1, 5, 7, 11}, // 6
-        {4, 2, 6, 8, 12}, // 7
-        {4, 3, 7, 9, 13}, // 8
-        {3, 4, 8, 14},    // 9
-        {3, 5, 11, 15},     // 10
-        {4, 6, 10, 12, 16}, // 11
-        {4, 7, 11, 13, 17}, // 12
-        {4, 8, 12, 14, 18}, // 13
-        {3,  9, 13, 19},    // 14
-        {3, 10, 16, 20},     // 15
-        {4, 11, 15, 17, 21}, // 16
-        {4, 12, 16, 18, 22}, // 17
-        {4, 13, 17, 19, 23}, // 18
-        {3, 14, 18, 24},     // 19
-        {2, 15, 21},     // 20
-        {3, 16, 20, 22}, // 21
-        {3, 17, 21, 23}, // 22
-        {3, 18, 22, 24}, // 23
-        {2, 19, 23}      // 24
-    };
+    // For the board 5x5 the rows are: {2, 1, 5}, {3, 0, 2, 6}, ... {2, 19, 23}
+    static const std::array< std::array< char, MAX_CHILD_NO + 1 >, State::TILENO > m_moves;
+
+    // Manhattan distance between two positions
+    static const std::array< std::array< uint8_t, State::TILENO >, State::TILENO > m_distance;
+
+    // Change of Manhattan distance indexed by the moved tile, the position of SPACE
+    // and the number of move, i.e. m_deltaH[ tile ][ sp ][ j ] is the change, when "tile"
+    // moves from position Move( sp, j ) to position "sp". It is either -1 or +1.
+    static const std::array< std::array< std::array< char, MAX_CHILD_NO >, State::TILENO >, State::TILENO > m_deltaH;
+
+    // Selected heuristic
+    Heuristic m_heuristic;
+
+    // Perimeter around the GOAL state, NULL if it is not used
+    const Perimeter* m_perimeter = nullptr;
 };
 
+//
+// Returns the GOAL state
+//
+constexpr std::array< char, State::TILENO > Graph::MakeGoal( )
+{
+    std::array< char, State::TILENO > tab{};
+    for( unsigned int i = 0; i < State::TILENO; i++ )
+        tab[ i ] = static_cast< char >( ( i + 1 ) % State::TILENO );
+    return tab;
+}
+
+//
+// Returns the table of allowed moves.
+// The positions neighbouring with SPACE are listed in increasing order.
+//
+constexpr std::array< std::array< char, Graph::MAX_CHILD_NO + 1 >, State::TILENO > Graph::MakeMoves( )
+{
+    constexpr unsigned int W = State::WIDTH;
+
+    std::array< std::array< char, MAX_CHILD_NO + 1 >, State::TILENO > tab{};
+    for( unsigned int sp = 0; sp < State::TILENO; sp++ )
+    {
+        char no = 0;
+        if( sp >= W )
+            tab[ sp ][ ++no ] = static_cast< char >( sp - W );
+        if( sp % W > 0 )
+            tab[ sp ][ ++no ] = static_cast< char >( sp - 1 );
+        if( sp % W < W - 1 )
+            tab[ sp ][ ++no ] = static_cast< char >( sp + 1 );
+        if( sp + W < State::TILENO )
+            tab[ sp ][ ++no ] = static_cast< char >( sp + W );
+        tab[ sp ][ 0 ] = no;
+    }
+    return tab;
+}
+
+//
+// Returns the table of Manhattan distances between the positions
+//
+constexpr std::array< std::array< uint8_t, State::TILENO >, State::TILENO > Graph::MakeDistance( )
+{
+    constexpr unsigned int W = State::WIDTH;
+
+    std::array< std::array< uint8_t, State::TILENO >, State::TILENO > tab{};
+    for( unsigned int a = 0; a < State::TILENO; a++ )
+    {
+        for( unsigned int b = 0; b < State::TILENO; b++ )
+        {
+            const int dx = int( a % W ) - int( b % W );
+            const int dy = int( a / W ) - int( b / W );
+            tab[ a ][ b ] = static_cast< uint8_t >( ( dx < 0 ? -dx : dx ) + ( dy < 0 ? -dy : dy ) );
+        }
+    }
+    return tab;
+}
+
+//
+// Returns the table of changes of Manhattan distance for each tile and each move
+//
+constexpr std::array< std::array< std::array< char, Graph::MAX_CHILD_NO >, State::TILENO >, State::TILENO > Graph::MakeDeltaH( )
+{
+    constexpr auto moves = MakeMoves( );
+    constexpr auto dist = MakeDistance( );
+
+    std::array< std::array< std::array< char, MAX_CHILD_NO >, State::TILENO >, State::TILENO > tab{};
+    for( unsigned int tile = 1; tile < State::TILENO; tile++ )
+    {
+        // Tile "t" is located on position "t - 1" in the GOAL state
+        const unsigned int goal = tile - 1;
+        for( unsigned int sp = 0; sp < State::TILENO; sp++ )
+        {
+            for( int j = 0; j < moves[ sp ][ 0 ]; j++ )
+            {
+                const unsigned int from = static_cast< unsigned int >( moves[ sp ][ j + 1 ] );
+                tab[ tile ][ sp ][ j ] = static_cast< char >( int( dist[ sp ][ goal ] ) - int( dist[ from ][ goal ] ) );
+            }
+        }
+    }
+    return tab;
+}
+
+inline const State Graph::m_goal{ Graph::MakeGoal( ) };
+inline const std::array< std::array< char, Graph::MAX_CHILD_NO + 1 >, State::TILENO > Graph::m_moves = Graph::MakeMoves( );
+inline const std::array< std::array< uint8_t, State::TILENO >, State::TILENO > Graph::m_distance = Graph::MakeDistance( );
+inline const std::array< std::array< std::array< char, Graph::MAX_CHILD_NO >, State::TILENO >, State::TILENO > Graph::m_deltaH = Graph::MakeDeltaH( );
+
 //
 // Returns "true" if "x" is the GOAL state
 //
@@ -118,13 +232,57 @@ char Graph::Move( uint8_t sp, uint8_t j )
     return m_moves[ sp ][ j + 1 ];
 }
 
+//
+// Returns the change of Manhattan distance, when "tile" moves from position Move( sp, j )
+// to SPACE located on position "sp"
+//
+inline
+char Graph::DeltaH( char tile, uint8_t sp, uint8_t j )
+{
+    assert( tile > 0 && static_cast< unsigned int >( tile ) < State::TILENO );
+    assert( sp < State::TILENO );
+    assert( j < MAX_CHILD_NO );
+    return m_deltaH[ static_cast< unsigned int >( tile ) ][ sp ][ j ];
+}
+
+//
+// Returns the Manhattan distance between positions "a" and "b"
+//
+inline
+uint8_t Graph::Distance( uint8_t a, uint8_t b )
+{
+    assert( a < State::TILENO );
+    assert( b < State::TILENO );
+    return m_distance[ a ][ b ];
+}
+
 //
 // Returns value of heuristic from "x" to GOAL state
 //
 inline
 Cost Graph::CalcH(const State& x)
 {
-    return Manhattan(x);
+    const Cost h = (m_heuristic == LINEAR_CONFLICT) ? LinearConflict(x) : Manhattan(x);
+    return m_perimeter ? m_perimeter->Estimate(x, h) : h;
+}
+
+//
+// Returns "true" if "x" is the GOAL state, or it is within the perimeter
+//
+inline
+bool Graph::IsSolved(const State& x) const
+{
+    return IsGoal(x) || (m_perimeter && m_perimeter->Distance(x) >= 0);
+}
+
+//
+// Completes the path to the GOAL state, if its last state is within the perimeter
+//
+inline
+void Graph::Complete(std::vector<State>& path) const
+{
+    if(m_perimeter && !path.empty() && !IsGoal(path.back()))
+        m_perimeter->Complete(path);
 }
 
 #endif
@@ -0,0 +1,232 @@
+#include "IDAstar.h"
+#include <limits>
+
+//
+// Constructor
+// "fsm"        - duplicate sequences of moves are pruned by FSM, otherwise the moves to the parent only
+// "tableBytes" - memory budget of the transposition table, zero if it is not used
+//
+IDAstar::IDAstar( bool fsm, size_t tableBytes )
+    : m_fsm( fsm )
+    , m_tableBytes( tableBytes )
+    , m_table( tableBytes > 0 ? std::make_unique< TranspositionTable >( tableBytes ) : nullptr )
+    , m_limits( nullptr )
+    , m_expandedNo( 0 )
+    , m_iterationNo( 0 )
+    , m_limitReached( false )
+{
+}
+
+//
+// Returns the name of engine
+//
+std::string IDAstar::Name( ) const
+{
+    if( m_table )
+        return ( m_fsm ? "idastar-tt-" : "idastar-basic-tt-" ) + std::to_string( m_tableBytes >> 20 );
+    return m_fsm ? "idastar" : "idastar-basic";
+}
+
+//
+// Finds the solution. Returns the empty value, if the limits are exceeded.
+//
+std::optional< std::vector< State > > IDAstar::Solve( Graph& graph, const State& beg, const Limits& limits )
+{
+    Limits lim = limits;
+    lim.Start();
+
+    m_limits = &lim;
+    m_expandedNo = 0;
+    m_iterationNo = 0;
+    m_limitReached = false;
+    m_metrics.Reset();
+    m_memory.Reset();
+
+    m_path.clear();
+    m_path.push_back( beg );
+
+    if( m_table )
+        m_table->Begin();
+
+    const Cost h = graph.CalcH( beg );
+    const uint64_t hash = m_table ? TranspositionTable::Hash( beg ) : 0;
+    Cost bound = h;
+
+    while( true )
+    {
+        const Cost t = Search( graph, 0, 0, h, bound, MoveFsm::START, hash );
+        RecordMemory( lim );
+
+        if( t == FOUND )
+            return m_path;
+
+        if( t == STOPPED || t == std::numeric_limits< Cost >::max() )
+        {
+            m_limitReached = ( t == STOPPED );
+            return {};
+        }
+
+        bound = t;
+        m_iterationNo++;
+
+        if( m_table )
+            m_table->NextIteration();
+    }
+}
+
+//
+// Depth-first search bounded by "bound".
+// Returns FOUND, STOPPED or the smallest "f" exceeding "bound".
+// "depth" - depth of the last state in m_path
+// "g"     - cost from the start state to the last state in m_path
+// "h"     - heuristic of the last state in m_path
+// "state" - state of FSM after the moves of m_path
+// "hash"  - hash of the last state in m_path, if the transposition table is used
+//
+Cost IDAstar::Search( Graph& graph, size_t depth, Cost g, Cost h, Cost bound, int32_t state, uint64_t hash )
+{
+    const Cost f = g + h;
+    if( f > bound )
+        return f;
+
+    const State& x = m_path[ depth ];
+    if( graph.IsGoal( x ) )
+        return FOUND;
+
+    // Within the perimeter the heuristic is exact, hence the path is completed
+    if( graph.GetPerimeter() && h <= static_cast< Cost >( graph.GetPerimeter()->Depth() ) )
+    {
+        graph.Complete( m_path );
+        return FOUND;
+    }
+
+    const uint64_t key = m_table ? TranspositionTable::Key( hash, state ) : 0;
+    if( m_table )
+    {
+        if( const TranspositionTable::Entry* e = m_table->Find( key ) )
+        {
+            // The state is searched already in this iteration with not greater "g", or it is the dead end
+            if( e->m_h == TranspositionTable::DEAD_END || ( m_table->IsCurrent( *e ) && e->m_g <= g ) )
+            {
+                m_metrics.Add( Metrics::TABLE_CUTOFF );
+                return ( e->m_h == TranspositionTable::DEAD_END ) ? std::numeric_limits< Cost >::max() : g + e->m_h;
+            }
+
+            if( e->m_h > h )
+            {
+                m_metrics.Add( Metrics::TABLE_RAISED );
+                h = e->m_h;
+                if( g + h > bound )
+                    return g + h;
+            }
+        }
+    }
+
+    if( m_limits->Exceeded( m_expandedNo ) )
+        return STOPPED;
+
+    m_expandedNo++;
+    m_metrics.Add( Metrics::EXPANDED );
+
+    if( depth == m_level.size() )
+    {
+        m_level.emplace_back();
+        m_level.back().m_child.resize( Graph::MAX_CHILD_NO );
+        m_level.back().m_cost.resize( Graph::MAX_CHILD_NO );
+        m_level.back().m_heur.resize( Graph::MAX_CHILD_NO );
+        m_level.back().m_state.resize( Graph::MAX_CHILD_NO );
+        m_level.back().m_hash.resize( Graph::MAX_CHILD_NO );
+    }
+
+    Level& lev = m_level[ depth ];
+    const size_t moveNo = graph.GetMoves( x, lev.m_child, lev.m_cost );
+    const int sp = x.SpaceIdx();
+
+    // The pruned moves are removed, the heuristic is evaluated for the remaining children only
+    size_t childNo = 0;
+    for( size_t i = 0; i < moveNo; i++ )
+    {
+        const uint8_t from = static_cast< uint8_t >( Graph::Move( sp, i ) );
+        const int32_t next = Next( state, MoveFsm::Move( sp, from ) );
+        if( next == MoveFsm::FORBIDDEN )
+            continue;
+
+        if( childNo != i )
+        {
+            lev.m_child[ childNo ] = lev.m_child[ i ];
+            lev.m_cost[ childNo ] = lev.m_cost[ i ];
+        }
+        lev.m_heur[ childNo ] = graph.CalcH( lev.m_child[ childNo ] );
+        lev.m_state[ childNo ] = next;
+        if( m_table )
+        {
+            lev.m_hash[ childNo ] = TranspositionTable::Move( hash, x.Tile( from ), from, static_cast< uint8_t >( sp ) );
+            m_table->Prefetch( TranspositionTable::Key( lev.m_hash[ childNo ], next ) );
+        }
+        childNo++;
+    }
+
+    m_metrics.Add( Metrics::GENERATED, childNo );
+    m_metrics.Record( Metrics::BRANCHING, childNo );
+
+    Cost min = std::numeric_limits< Cost >::max();
+
+    for( size_t i = 0; i < childNo; i++ )
+    {
+        m_path.push_back( lev.m_child[ i ] );
+
+        const Cost t = Search( graph, depth + 1, g + lev.m_cost[ i ], lev.m_heur[ i ], bound, lev.m_state[ i ], lev.m_hash[ i ] );
+        if( t == FOUND || t == STOPPED )
+            return t;
+
+        m_path.pop_back();
+
+        if( t < min )
+            min = t;
+    }
+
+    if( m_table )
+        m_table->Store( key, g, ( min == std::numeric_limits< Cost >::max() ) ? min : min - g );
+
+    return min;
+}
+
+//
+// Records the memory of the transposition table and the buffers
+//
+void IDAstar::RecordMemory( const Limits& lim )
+{
+    MemoryUsage part[ MemoryStats::PART_NO ];
+
+    if( m_table )
+        part[ MemoryStats::CLOSED_SET ] = m_table->Memory();
+
+    MemoryUsage& buf = part[ MemoryStats::BUFFERS ];
+    buf.m_used = m_path.size() * sizeof( State );
+    buf.m_reserved = m_path.capacity() * sizeof( State );
+    for( const Level& lev : m_level )
+    {
+        const size_t bytes = lev.m_child.capacity() * sizeof( State ) + lev.m_cost.capacity() * sizeof( Cost ) +
+            lev.m_heur.capacity() * sizeof( Cost ) + lev.m_state.capacity() * sizeof( int32_t ) +
+            lev.m_hash.capacity() * sizeof( uint64_t );
+        buf.m_used += bytes;
+        buf.m_reserved += bytes;
+    }
+
+    m_memory.Record( m_expandedNo, lim.Elapsed(), part );
+}
+
+//
+// Returns the state of FSM after the move in direction "dir", or MoveFsm::FORBIDDEN.
+// Without FSM the state is the direction of the last move plus one, zero at the start,
+// and only the reverse of the last move is forbidden.
+//
+int32_t IDAstar::Next( int32_t state, MoveFsm::Direction dir ) const
+{
+    if( m_fsm )
+        return MoveFsm::Next( state, dir );
+
+    if( state > 0 && dir == MoveFsm::Reverse( static_cast< MoveFsm::Direction >( state - 1 ) ) )
+        return MoveFsm::FORBIDDEN;
+    return dir + 1;
+}
@@ -0,0 +1,113 @@
+#ifndef ASTAR_IDASTAR_H
+#define ASTAR_IDASTAR_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Represents IDA* (Iterative Deepening A-STAR) algorithm.
+//
+// 2. It is the sequence of depth-first searches. Each search is bounded by
+//    the threshold of "f = g + h". The next threshold is the smallest value
+//    of "f" exceeding the previous threshold.
+//
+// 3. Memory is proportional to the length of the solution only.
+//
+// 4. The duplicate sequences of moves are pruned by the finite state machine (see MoveFsm.h),
+//    the pruned children are neither generated, nor evaluated. Without FSM ("idastar-basic")
+//    only the move returning to the parent state is not generated.
+//
+// 5. Optionally, the states are kept in the fixed-size transposition table (see TranspositionTable.h).
+//    The state searched already in the iteration with not greater "g" is not expanded again,
+//    and the heuristic of the state is raised to the value backed up by the previous iterations.
+//
+// 6. The metrics are collected: expanded nodes, generated children and the branching.
+//    The memory is recorded after each iteration.
+//
+
+#include "Engine.h"
+#include "Cost.h"
+#include "MemoryStats.h"
+#include "MoveFsm.h"
+#include "TranspositionTable.h"
+#include <memory>
+#include <vector>
+#include <deque>
+
+class IDAstar : public Engine
+{
+public:
+    explicit IDAstar( bool fsm = true, size_t tableBytes = 0 );
+
+    std::string Name( ) const override;
+    bool IsOptimal( ) const override { return true; }
+
+    std::optional< std::vector< State > > Solve( Graph& graph, const State& beg, const Limits& limits ) override;
+
+    size_t ExpandedNo( ) const override { return m_expandedNo; }
+    bool LimitReached( ) const override { return m_limitReached; }
+    const Metrics* GetMetrics( ) const override { return &m_metrics; }
+    const MemoryStats* GetMemory( ) const override { return &m_memory; }
+
+    // Number of finished iterations of the last call of Solve
+    size_t IterationNo( ) const { return m_iterationNo; }
+
+private:
+    Cost Search( Graph& graph, size_t depth, Cost g, Cost h, Cost bound, int32_t state, uint64_t hash );
+    int32_t Next( int32_t state, MoveFsm::Direction dir ) const;
+    void RecordMemory( const Limits& lim );
+
+private:
+    // Auxiliary buffers for children generated on each depth
+    struct Level
+    {
+        std::vector< State > m_child;
+        std::vector< Cost > m_cost;
+        std::vector< Cost > m_heur;
+        std::vector< int32_t > m_state;
+        std::vector< uint64_t > m_hash;
+    };
+
+private:
+    // Returned by function Search if the goal is found
+    inline static constexpr Cost FOUND = -1;
+
+    // Returned by function Search if the search is stopped
+    inline static constexpr Cost STOPPED = -2;
+
+    // Duplicate sequences of moves are pruned by FSM
+    const bool m_fsm;
+
+    // Memory budget of transposition table
+    const size_t m_tableBytes;
+
+    // Transposition table, NULL if it is not used
+    std::unique_ptr< TranspositionTable > m_table;
+
+    // Current path from the start state
+    std::vector< State > m_path;
+
+    // Children buffers indexed by depth.
+    // Deque is used, since references to its elements are not invalidated by growing.
+    std::deque< Level > m_level;
+
+    // Limits of the current search
+    const Limits* m_limits;
+
+    // Number of expanded nodes
+    size_t m_expandedNo;
+
+    // Number of finished iterations
+    size_t m_iterationNo;
+
+    // Last search was stopped by the limits
+    bool m_limitReached;
+
+    // Metrics of the current search
+    Metrics m_metrics;
+
+    // Memory of the transposition table (as closed set) and the buffers, recorded after each iteration
+    MemoryStats m_memory;
+};
+
+#endif
@@ -0,0 +1,210 @@
+#include "InstanceReader.h"
+#include <stdexcept>
+#include <cerrno>
+#include <cstring>
+#include <cctype>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+//
+// Constructor
+// "path" - path to the file with instances, "-" denotes standard input
+//
+InstanceReader::InstanceReader( const std::string& path )
+    : m_path( path )
+    , m_fd( -1 )
+    , m_map( nullptr )
+    , m_mapSize( 0 )
+    , m_cur( nullptr )
+    , m_end( nullptr )
+    , m_line( 1 )
+{
+    if( m_path == "-" )
+    {
+        m_fd = STDIN_FILENO;
+    }
+    else
+    {
+        m_fd = open( m_path.c_str(), O_RDONLY );
+        if( m_fd < 0 )
+        {
+            const std::string msg = "Cannot open file. Path = " + m_path;
+            throw std::invalid_argument( msg );
+        }
+    }
+
+    struct stat st;
+    if( fstat( m_fd, &st ) == 0 && S_ISREG( st.st_mode ) && st.st_size > 0 )
+    {
+        m_mapSize = static_cast< size_t >( st.st_size );
+        m_map = mmap( nullptr, m_mapSize, PROT_READ, MAP_PRIVATE, m_fd, 0 );
+        if( m_map == MAP_FAILED )
+        {
+            m_map = nullptr;
+            m_mapSize = 0;
+        }
+        else
+        {
+            madvise( m_map, m_mapSize, MADV_SEQUENTIAL );
+            m_cur = static_cast< const char* >( m_map );
+            m_end = m_cur + m_mapSize;
+            return;
+        }
+    }
+
+    // Pipes, terminals and files which cannot be mapped are read in blocks
+    m_block.resize( BLOCK_SIZE );
+}
+
+//
+// Destructor
+//
+InstanceReader::~InstanceReader( )
+{
+    if( m_map )
+        munmap( m_map, m_mapSize );
+
+    if( m_fd >= 0 && m_fd != STDIN_FILENO )
+        close( m_fd );
+}
+
+//
+// Reads the next block of data. Returns "false" if there is no more data.
+// For memory mapped file the whole file is available from the beginning.
+//
+bool InstanceReader::Fill( )
+{
+    if( m_map || m_block.empty() )
+        return false;
+
+    ssize_t n;
+    do
+    {
+        n = read( m_fd, m_block.data(), m_block.size() );
+    }
+    while( n < 0 && errno == EINTR );
+
+    if( n < 0 )
+        Error( "Error during reading file." );
+
+    if( n == 0 )
+    {
+        // Further calls must not block on the terminal
+        m_block.clear();
+        return false;
+    }
+
+    m_cur = m_block.data();
+    m_end = m_cur + n;
+    return true;
+}
+
+//
+// Skips white spaces and comments.
+// Returns "false" if the end of input is reached.
+//
+bool InstanceReader::SkipBlanks( )
+{
+    while( true )
+    {
+        const int c = Peek( );
+        if( c == EOF )
+            return false;
+
+        if( c == '#' )
+        {
+            int d;
+            do
+            {
+                d = Get( );
+            }
+            while( d != '\n' && d != EOF );
+
+            if( d == '\n' )
+                m_line++;
+            continue;
+        }
+
+        if( c == '\n' )
+            m_line++;
+        else if( c != ' ' && c != '\t' && c != '\r' && c != '\v' && c != '\f' )
+            return true;
+
+        Get( );
+    }
+}
+
+//
+// Reads one tile. White spaces must be skipped before calling this function.
+//
+uint InstanceReader::ReadTile( )
+{
+    int c = Peek( );
+    if( c < '0' || c > '9' )
+        Error( "Not allowed character in file with state." );
+
+    uint val = 0;
+    do
+    {
+        val = 10 * val + static_cast< uint >( c - '0' );
+        if( val >= State::TILENO )
+            Error( "Not allowed value in file with state." );
+
+        Get( );
+        c = Peek( );
+    }
+    while( c >= '0' && c <= '9' );
+
+    if( c != EOF && c != '#' && !isspace( c ) )
+        Error( "Not allowed character in file with state." );
+
+    return val;
+}
+
+//
+// Reads the next instance into "s".
+// Returns "false" if there are no more instances in the input.
+//
+bool InstanceReader::Next( State& s )
+{
+    std::array< char, State::TILENO > tab;
+    uint32_t seen = 0;
+    static_assert( State::TILENO <= 32, "Bit mask of tiles is too small" );
+
+    for( uint i = 0; i < State::TILENO; i++ )
+    {
+        if( !SkipBlanks( ) )
+        {
+            if( i == 0 )
+                return false;
+            Error( "Unexpexted end of file." );
+        }
+
+        const uint val = ReadTile( );
+        const uint32_t bit = uint32_t( 1 ) << val;
+        if( seen & bit )
+            Error( "Duplicated tile in file with state." );
+
+        seen |= bit;
+        tab[ i ] = static_cast< char >( val );
+    }
+
+    s = State{ tab };
+    if( !s.IsSolvable( ) )
+        Error( "The state is not solvable." );
+
+    return true;
+}
+
+//
+// Throws exception describing the error at the current position
+//
+void InstanceReader::Error( const char* what ) const
+{
+    std::string msg = what;
+    msg += "\nPath = " + m_path;
+    msg += "\nLine = " + std::to_string( m_line );
+    throw std::invalid_argument( msg );
+}
@@ -0,0 +1,128 @@
+#ifndef ASTAR_INSTANCEREADER_H
+#define ASTAR_INSTANCEREADER_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Streaming reader of the puzzle instances.
+//
+// 2. Regular file is mapped into memory (mmap). Standard input (path "-")
+//    is read in large blocks. In both cases the input is parsed in place.
+//
+// 3. The input is a stream of integers. Each consecutive State::TILENO integers
+//    define one instance. Usually each instance is stored in a single line,
+//    however, the line breaks are not significant. Hence, the files with one
+//    board written in State::WIDTH lines are accepted as well.
+//
+// 4. Character '#' starts the comment. The comment ends with the end of line.
+//
+// 5. Each instance is validated: the range of tiles, duplicated tiles and
+//    the solvability (parity of the permutation) are checked.
+//    No memory is allocated while the instances are parsed.
+//
+// 6. Function ForEach is the pipeline stage, which hands the instances
+//    to the consumer (usually the solver) one by one.
+//
+// 7. In case of malformed input, the exception std::invalid_argument is thrown.
+//
+
+#include "State.h"
+#include <string>
+#include <vector>
+#include <cstddef>
+
+class InstanceReader
+{
+public:
+    explicit InstanceReader( const std::string& path );
+    ~InstanceReader( );
+
+    InstanceReader( const InstanceReader& ) = delete;
+    InstanceReader& operator=( const InstanceReader& ) = delete;
+
+    bool Next( State& s );
+
+    template< typename F >
+    size_t ForEach( F consume );
+
+    size_t Line( ) const { return m_line; }
+
+private:
+    int Peek( );
+    int Get( );
+    bool Fill( );
+
+    bool SkipBlanks( );
+    uint ReadTile( );
+
+    [[noreturn]] void Error( const char* what ) const;
+
+private:
+    // Size of the block used for reading the standard input
+    inline static constexpr size_t BLOCK_SIZE = 1 << 20;
+
+    // Path to the file, "-" denotes standard input
+    const std::string m_path;
+
+    // File descriptor
+    int m_fd;
+
+    // Memory mapped file. It is "nullptr" for the standard input.
+    void* m_map;
+    size_t m_mapSize;
+
+    // Buffer for the standard input
+    std::vector< char > m_block;
+
+    // Not yet parsed part of the input
+    const char* m_cur;
+    const char* m_end;
+
+    // Current line number, used in error messages
+    size_t m_line;
+};
+
+//
+// Passes all instances to "consume". Returns the number of instances.
+// "consume" is called as: consume( const State& s )
+//
+template< typename F >
+size_t InstanceReader::ForEach( F consume )
+{
+    size_t cnt = 0;
+    State s;
+
+    while( Next( s ) )
+    {
+        consume( static_cast< const State& >( s ) );
+        cnt++;
+    }
+    return cnt;
+}
+
+//
+// Returns next character or EOF. The character is not consumed.
+//
+inline
+int InstanceReader::Peek( )
+{
+    if( m_cur == m_end && !Fill( ) )
+        return EOF;
+
+    return static_cast< unsigned char >( *m_cur );
+}
+
+//
+// Returns next character or EOF. The character is consumed.
+//
+inline
+int InstanceReader::Get( )
+{
+    if( m_cur == m_end && !Fill( ) )
+        return EOF;
+
+    return static_cast< unsigned char >( *m_cur++ );
+}
+
+#endif
@@ -0,0 +1,305 @@
+#include "LayerStats.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+
+//
+// Constructor
+//
+LayerStats::LayerStats( )
+    : m_current( 0 )
+    , m_running( false )
+{
+}
+
+//
+// Removes all layers and the solution
+//
+void LayerStats::Reset( )
+{
+    m_layer.clear();
+    m_heur.clear();
+    m_current = 0;
+    m_running = false;
+}
+
+//
+// Starts counting the time
+//
+void LayerStats::Resume( )
+{
+    m_since = Clock::now();
+    m_running = true;
+}
+
+//
+// Stops counting the time. The time since the last call of Resume is attributed to the current layer.
+//
+void LayerStats::Pause( )
+{
+    if( m_running && !m_layer.empty() )
+    {
+        const std::chrono::duration< double > d = Clock::now() - m_since;
+        m_layer[ m_current ].m_seconds += d.count();
+    }
+    m_running = false;
+}
+
+//
+// Makes the layer with value "f" current. The layer is created, if it does not exist.
+//
+void LayerStats::Switch( Cost f )
+{
+    const Clock::time_point now = Clock::now();
+    if( m_running && !m_layer.empty() )
+    {
+        const std::chrono::duration< double > d = now - m_since;
+        m_layer[ m_current ].m_seconds += d.count();
+    }
+    m_since = now;
+
+    auto it = std::lower_bound( m_layer.begin(), m_layer.end(), f,
+        []( const Layer& a, Cost b ) { return a.m_f < b; } );
+    if( it == m_layer.end() || it->m_f != f )
+    {
+        Layer x;
+        x.m_f = f;
+        it = m_layer.insert( it, x );
+    }
+    m_current = it - m_layer.begin();
+}
+
+//
+// Sets the heuristic of the nodes on the solution path.
+// "heur[i]" is the heuristic of node, whose distance to the goal is "i".
+//
+void LayerStats::SetSolution( const std::vector< Cost >& heur )
+{
+    m_heur = heur;
+}
+
+//
+// Returns the number of expanded nodes in all layers
+//
+uint64_t LayerStats::ExpandedNo( ) const
+{
+    uint64_t n = 0;
+    for( const Layer& x : m_layer )
+        n += x.m_expandedNo;
+    return n;
+}
+
+//
+// Returns the time of all layers
+//
+double LayerStats::Seconds( ) const
+{
+    double t = 0;
+    for( const Layer& x : m_layer )
+        t += x.m_seconds;
+    return t;
+}
+
+//
+// Returns the difference of f between consecutive layers
+// (e.g. 2 for the sliding puzzle with Manhattan heuristic)
+//
+Cost LayerStats::Step( ) const
+{
+    const size_t n = m_layer.size();
+    if( n < 2 )
+        return 1;
+    return std::max( m_layer[ n - 1 ].m_f - m_layer[ n - 2 ].m_f, 1 );
+}
+
+//
+// Returns the geometric mean of the growth of (at most three) last complete layers.
+// The last layer is not complete, hence it is skipped.
+// Returns 0 if there are not enough layers.
+//
+double LayerStats::GrowthRatio( ) const
+{
+    const size_t n = m_layer.size();
+    if( n < 3 )
+        return 0;
+
+    double logSum = 0;
+    size_t k = 0;
+    for( size_t i = n - 2; i >= 1 && k < 3; i--, k++ )
+    {
+        if( m_layer[ i - 1 ].m_expandedNo == 0 )
+            break;
+        logSum += std::log( double( m_layer[ i ].m_expandedNo ) / m_layer[ i - 1 ].m_expandedNo );
+    }
+
+    return ( k > 0 ) ? std::exp( logSum / k ) : 0;
+}
+
+//
+// Returns b*, which solves N + 1 = 1 + b* + b*^2 + ... + b*^depth,
+// where N is the number of expanded nodes.
+// Returns 0, if it cannot be computed.
+//
+double LayerStats::EffectiveBranching( size_t depth ) const
+{
+    const double n = double( ExpandedNo() ) + 1;
+    if( depth == 0 || n <= depth + 1 )
+        return 0;
+
+    // Sum 1 + b + ... + b^depth, it increases with b
+    auto sum = [depth, n]( double b )
+    {
+        double s = 1, p = 1;
+        for( size_t i = 0; i < depth && s <= n; i++ )
+        {
+            p *= b;
+            s += p;
+        }
+        return s;
+    };
+
+    double lo = 1, hi = n;
+    for( int i = 0; i < 100; i++ )
+    {
+        const double mid = 0.5 * ( lo + hi );
+        ( sum( mid ) < n ? lo : hi ) = mid;
+    }
+    return 0.5 * ( lo + hi );
+}
+
+//
+// Returns the predicted number of expanded nodes in layer "f".
+// For the complete layers the recorded number is returned.
+//
+double LayerStats::PredictExpanded( Cost f ) const
+{
+    const size_t n = m_layer.size();
+    if( n == 0 )
+        return 0;
+
+    // Complete layers
+    for( size_t i = 0; i + 1 < n; i++ )
+    {
+        if( m_layer[ i ].m_f == f )
+            return double( m_layer[ i ].m_expandedNo );
+    }
+
+    const double ratio = GrowthRatio();
+    if( ratio <= 0 )
+        return double( m_layer.back().m_expandedNo );
+
+    // Extrapolation from the last complete layer
+    const Layer& base = m_layer[ n - 2 ];
+    const double k = double( f - base.m_f ) / Step();
+    return std::max( base.m_expandedNo * std::pow( ratio, k ), double( f == m_layer.back().m_f ? m_layer.back().m_expandedNo : 0 ) );
+}
+
+//
+// Returns the predicted time to finish all layers up to (including) layer "f".
+// The time per expansion is taken from the recorded layers.
+//
+double LayerStats::PredictSeconds( Cost f ) const
+{
+    const uint64_t expandedNo = ExpandedNo();
+    if( m_layer.empty() || expandedNo == 0 )
+        return 0;
+
+    const double perNode = Seconds() / expandedNo;
+    const Layer& last = m_layer.back();
+
+    double nodes = 0;
+    for( Cost g = last.m_f; g <= f; g += Step() )
+    {
+        nodes += PredictExpanded( g );
+        if( g == last.m_f )
+            nodes -= last.m_expandedNo;
+    }
+    return std::max( nodes, 0.0 ) * perNode;
+}
+
+//
+// Prints the report of layers
+//
+void LayerStats::Print( std::ostream& out ) const
+{
+    char line[ 256 ];
+
+    out << "LAYERS:\n";
+    snprintf( line, sizeof( line ), "   %6s %12s %12s %12s %10s %8s", "f", "expanded", "generated", "duplicates", "time[s]", "growth" );
+    out << line << "\n";
+
+    for( size_t i = 0; i < m_layer.size(); i++ )
+    {
+        const Layer& x = m_layer[ i ];
+        char growth[ 16 ] = "-";
+        if( i > 0 && m_layer[ i - 1 ].m_expandedNo > 0 )
+            snprintf( growth, sizeof( growth ), "%.2f", double( x.m_expandedNo ) / m_layer[ i - 1 ].m_expandedNo );
+
+        snprintf( line, sizeof( line ), "   %6d %12llu %12llu %12llu %10.4f %8s", x.m_f,
+            static_cast< unsigned long long >( x.m_expandedNo ),
+            static_cast< unsigned long long >( x.m_generatedNo ),
+            static_cast< unsigned long long >( x.m_duplicateNo ),
+            x.m_seconds, growth );
+        out << line << "\n";
+    }
+
+    if( m_layer.empty() )
+        return;
+
+    // Effective branching factor
+    const double ratio = GrowthRatio();
+    if( ratio > 0 )
+    {
+        snprintf( line, sizeof( line ), "   Growth of layers: %.2f per %d of f", ratio, Step() );
+        out << line << "\n";
+    }
+
+    if( !m_heur.empty() )
+    {
+        const size_t depth = m_heur.size() - 1;
+        snprintf( line, sizeof( line ), "   Effective branching factor: b* = %.3f (N = %llu, d = %zu)",
+            EffectiveBranching( depth ), static_cast< unsigned long long >( ExpandedNo() ), depth );
+        out << line << "\n";
+
+        // Heuristic error along the solution path, by the distance to the goal
+        double sum = 0;
+        Cost maxErr = 0;
+        for( size_t i = 0; i <= depth; i++ )
+        {
+            const Cost err = Cost( i ) - m_heur[ i ];
+            sum += err;
+            maxErr = std::max( maxErr, err );
+        }
+
+        snprintf( line, sizeof( line ), "   Heuristic error on solution path: start h = %d, C* = %zu (%.1f%%), mean = %.2f, max = %d",
+            m_heur[ depth ], depth, 100.0 * ( Cost( depth ) - m_heur[ depth ] ) / std::max< size_t >( depth, 1 ),
+            sum / ( depth + 1 ), maxErr );
+        out << line << "\n";
+
+        const size_t width = 10;
+        out << "   Mean error by distance to goal:";
+        for( size_t beg = 0; beg <= depth; beg += width )
+        {
+            const size_t end = std::min( beg + width, depth + 1 );
+            double s = 0;
+            for( size_t i = beg; i < end; i++ )
+                s += Cost( i ) - m_heur[ i ];
+            snprintf( line, sizeof( line ), " [%zu,%zu) %.1f", beg, end, s / ( end - beg ) );
+            out << line;
+        }
+        out << "\n";
+    }
+    else if( ratio > 0 )
+    {
+        // Solution is not known, the next layers are predicted
+        const Cost f = m_layer.back().m_f;
+        for( int k = 0; k < 3; k++ )
+        {
+            const Cost g = f + k * Step();
+            snprintf( line, sizeof( line ), "   Prediction of layer f = %d: expanded ~ %.3g, time to finish ~ %.3g s",
+                g, PredictExpanded( g ), PredictSeconds( g ) );
+            out << line << "\n";
+        }
+    }
+}
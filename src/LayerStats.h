@@ -0,0 +1,126 @@
+#ifndef ASTAR_LAYERSTATS_H
+#define ASTAR_LAYERSTATS_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Statistics of the search for each f-layer, i.e. for the nodes expanded with the
+//    same value f = g + h. For each layer the expanded nodes, generated children,
+//    duplicates and the time are recorded.
+//
+// 2. A* with consistent heuristic expands the layers in increasing order of f.
+//    The time is attributed to the layer of the last expanded node. The time between
+//    calls of Resume and Pause (e.g. between the steps of incremental search) is not counted.
+//
+// 3. The growth of the layers gives the effective branching factor (EBF).
+//    Two values are reported:
+//      - the ratio of the expanded nodes of consecutive layers,
+//      - b*, which solves N = b* + b*^2 + ... + b*^d, where N is the number of expanded
+//        nodes and d is the length of solution.
+//
+// 4. The size and the time of the next layers are predicted by geometric extrapolation
+//    of the last layers. Hence, the time to finish the interrupted search can be estimated.
+//
+// 5. When the solution is known, the error of heuristic along the solution path is
+//    reported, i.e. the difference between the true distance to the goal and the heuristic.
+//
+
+#include "Cost.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+class LayerStats
+{
+public:
+    // Statistics of single f-layer
+    struct Layer
+    {
+        Cost m_f = 0;
+        uint64_t m_expandedNo = 0;
+        uint64_t m_generatedNo = 0;
+        uint64_t m_duplicateNo = 0;
+        double m_seconds = 0;
+    };
+
+public:
+    LayerStats( );
+
+    void Reset( );
+    void Resume( );
+    void Pause( );
+
+    void Expand( Cost f );
+    void Generate( size_t childNo );
+    void Duplicate( );
+
+    void SetSolution( const std::vector< Cost >& heur );
+
+    const std::vector< Layer >& Layers( ) const { return m_layer; }
+    uint64_t ExpandedNo( ) const;
+    double Seconds( ) const;
+
+    double GrowthRatio( ) const;
+    double EffectiveBranching( size_t depth ) const;
+    double PredictExpanded( Cost f ) const;
+    double PredictSeconds( Cost f ) const;
+
+    void Print( std::ostream& out ) const;
+
+private:
+    void Switch( Cost f );
+    Cost Step( ) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // Layers sorted by f
+    std::vector< Layer > m_layer;
+
+    // Layer of the last expanded node, it is valid if m_layer is not empty
+    size_t m_current;
+
+    // Start of the time, which is not yet attributed to the current layer
+    Clock::time_point m_since;
+
+    // "true" between calls of Resume and Pause
+    bool m_running;
+
+    // Heuristic of the nodes on the solution path. Element "i" is the heuristic
+    // of node, whose distance to the goal is "i". Empty, if the solution is not known.
+    std::vector< Cost > m_heur;
+};
+
+//
+// Records the expansion of node with value "f"
+//
+inline
+void LayerStats::Expand( Cost f )
+{
+    if( m_layer.empty() || m_layer[ m_current ].m_f != f )
+        Switch( f );
+    m_layer[ m_current ].m_expandedNo++;
+}
+
+//
+// Records "childNo" children generated by the last expansion
+//
+inline
+void LayerStats::Generate( size_t childNo )
+{
+    m_layer[ m_current ].m_generatedNo += childNo;
+}
+
+//
+// Records the child of the last expanded node, which is already in closed set or open set
+//
+inline
+void LayerStats::Duplicate( )
+{
+    m_layer[ m_current ].m_duplicateNo++;
+}
+
+#endif
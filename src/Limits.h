@@ -0,0 +1,102 @@
+#ifndef ASTAR_LIMITS_H
+#define ASTAR_LIMITS_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Limits of single search: the number of expanded nodes, the wall time,
+//    the memory and the cancellation flag set by other thread.
+//
+// 2. The value zero means "no limit".
+//
+// 3. The time and the cancellation flag are checked every CHECK_PERIOD expansions,
+//    hence checking the limits is cheap.
+//
+// 4. Function Interrupted checks the time and the cancellation flag at once. It serves
+//    the searches running long between the expansions (e.g. the lookahead of A*),
+//    which call it periodically by themselves.
+//
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+class Limits
+{
+public:
+    void Start( );
+    bool Exceeded( size_t expandedNo ) const;
+    bool Interrupted( ) const;
+
+    double Elapsed( ) const;
+
+public:
+    // Maximal number of expanded nodes
+    size_t m_maxExpanded = 0;
+
+    // Maximal wall time in seconds
+    double m_maxSeconds = 0;
+
+    // Maximal memory in bytes reserved by the data structures of the search.
+    // It is checked by the engines measuring their memory (e.g. Astar).
+    size_t m_maxBytes = 0;
+
+    // Search is stopped, when the flag is set
+    const std::atomic< bool >* m_cancel = nullptr;
+
+private:
+    // The time and the cancellation flag are checked every CHECK_PERIOD expansions
+    inline static constexpr size_t CHECK_PERIOD = 1024;
+
+    // Start time of the search
+    std::chrono::steady_clock::time_point m_start;
+};
+
+//
+// Starts measuring the time
+//
+inline
+void Limits::Start( )
+{
+    m_start = std::chrono::steady_clock::now();
+}
+
+//
+// Returns "true" if the search must be stopped
+//
+inline
+bool Limits::Exceeded( size_t expandedNo ) const
+{
+    if( m_maxExpanded > 0 && expandedNo >= m_maxExpanded )
+        return true;
+
+    if( expandedNo % CHECK_PERIOD != 0 )
+        return false;
+
+    return Interrupted();
+}
+
+//
+// Returns "true" if the search is cancelled or its time is over
+//
+inline
+bool Limits::Interrupted( ) const
+{
+    if( m_cancel && m_cancel->load( std::memory_order_relaxed ) )
+        return true;
+
+    return ( m_maxSeconds > 0 && Elapsed() > m_maxSeconds );
+}
+
+//
+// Returns the time in seconds elapsed from calling function Start
+//
+inline
+double Limits::Elapsed( ) const
+{
+    const std::chrono::duration< double > d = std::chrono::steady_clock::now() - m_start;
+    return d.count();
+}
+
+#endif
@@ -0,0 +1,183 @@
+#include "MemoryStats.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+
+//
+// Constructor
+//
+MemoryStats::MemoryStats( )
+{
+    Reset();
+}
+
+//
+// Removes all records
+//
+void MemoryStats::Reset( )
+{
+    for( int p = 0; p < PART_NO; p++ )
+    {
+        m_current[ p ] = MemoryUsage();
+        m_peak[ p ] = MemoryUsage();
+    }
+
+    m_peakUsed = 0;
+    m_peakReserved = 0;
+    m_timeline.clear();
+    m_stride = 1;
+    m_recordNo = 0;
+}
+
+//
+// Records the memory of all structures after "expandedNo" expansions and "seconds" of the search
+//
+void MemoryStats::Record( size_t expandedNo, double seconds, const MemoryUsage ( &part )[ PART_NO ] )
+{
+    for( int p = 0; p < PART_NO; p++ )
+    {
+        m_current[ p ] = part[ p ];
+        m_peak[ p ].m_used = std::max( m_peak[ p ].m_used, part[ p ].m_used );
+        m_peak[ p ].m_reserved = std::max( m_peak[ p ].m_reserved, part[ p ].m_reserved );
+        m_peak[ p ].m_load = std::max( m_peak[ p ].m_load, part[ p ].m_load );
+    }
+
+    const size_t used = Used();
+    const size_t reserved = Reserved();
+    m_peakUsed = std::max( m_peakUsed, used );
+    m_peakReserved = std::max( m_peakReserved, reserved );
+
+    if( m_recordNo++ % m_stride != 0 )
+        return;
+
+    Sample s;
+    s.m_expandedNo = expandedNo;
+    s.m_seconds = seconds;
+    s.m_used = used;
+    s.m_reserved = reserved;
+    s.m_closedLoad = part[ CLOSED_SET ].m_load;
+    s.m_openLoad = part[ OPEN_SET ].m_load;
+    m_timeline.push_back( s );
+
+    if( m_timeline.size() == MAX_SAMPLE_NO )
+    {
+        // Every second sample is removed
+        for( size_t i = 0; 2 * i < m_timeline.size(); i++ )
+            m_timeline[ i ] = m_timeline[ 2 * i ];
+        m_timeline.resize( MAX_SAMPLE_NO / 2 );
+        m_stride *= 2;
+    }
+}
+
+//
+// Returns the bytes used by all structures
+//
+size_t MemoryStats::Used( ) const
+{
+    size_t n = 0;
+    for( const MemoryUsage& m : m_current )
+        n += m.m_used;
+    return n;
+}
+
+//
+// Returns the bytes reserved by all structures
+//
+size_t MemoryStats::Reserved( ) const
+{
+    size_t n = 0;
+    for( const MemoryUsage& m : m_current )
+        n += m.m_reserved;
+    return n;
+}
+
+//
+// Returns name of structure "p"
+//
+const char* MemoryStats::Name( Part p )
+{
+    static const char* const name[ PART_NO ] = {
+        "nodes",
+        "closed_set",
+        "open_set",
+        "buffers" };
+
+    assert( p < PART_NO );
+    return name[ p ];
+}
+
+//
+// Prints the memory of structures, the peaks and the timeline (at most 10 rows)
+//
+void MemoryStats::Print( std::ostream& out ) const
+{
+    const double MiB = 1024.0 * 1024.0;
+    char line[ 256 ];
+
+    out << "MEMORY:\n";
+    snprintf( line, sizeof( line ), "   %-12s %13s %13s %13s %13s %6s", "structure", "used[MiB]", "reserved[MiB]", "peak-used", "peak-resv", "load" );
+    out << line << "\n";
+
+    for( int p = 0; p < PART_NO; p++ )
+    {
+        const MemoryUsage& c = m_current[ p ];
+        const MemoryUsage& k = m_peak[ p ];
+        snprintf( line, sizeof( line ), "   %-12s %13.2f %13.2f %13.2f %13.2f %6.3f", Name( static_cast< Part >( p ) ),
+            c.m_used / MiB, c.m_reserved / MiB, k.m_used / MiB, k.m_reserved / MiB, c.m_load );
+        out << line << "\n";
+    }
+
+    snprintf( line, sizeof( line ), "   %-12s %13.2f %13.2f %13.2f %13.2f", "total",
+        Used() / MiB, Reserved() / MiB, m_peakUsed / MiB, m_peakReserved / MiB );
+    out << line << "\n";
+
+    if( m_timeline.empty() )
+        return;
+
+    out << "   Timeline:\n";
+    snprintf( line, sizeof( line ), "   %13s %10s %13s %13s %8s %8s", "expanded", "time[s]", "used[MiB]", "reserved[MiB]", "closed", "open" );
+    out << line << "\n";
+
+    const size_t step = std::max< size_t >( m_timeline.size() / 10, 1 );
+    for( size_t i = 0; i < m_timeline.size(); i += step )
+    {
+        const Sample& s = m_timeline[ i ];
+        snprintf( line, sizeof( line ), "   %13zu %10.3f %13.2f %13.2f %8.3f %8.3f",
+            s.m_expandedNo, s.m_seconds, s.m_used / MiB, s.m_reserved / MiB, s.m_closedLoad, s.m_openLoad );
+        out << line << "\n";
+    }
+}
+
+//
+// Returns the memory of structures, the peaks and the timeline in JSON format.
+// Each sample of timeline is [expanded, seconds, used, reserved, closed load, open load].
+//
+std::string MemoryStats::ToJson( ) const
+{
+    std::string json = "{ \"parts\": {";
+    char buf[ 256 ];
+
+    for( int p = 0; p < PART_NO; p++ )
+    {
+        const MemoryUsage& c = m_current[ p ];
+        const MemoryUsage& k = m_peak[ p ];
+        snprintf( buf, sizeof( buf ), "%s \"%s\": { \"used\": %zu, \"reserved\": %zu, \"peak_used\": %zu, \"peak_reserved\": %zu, \"load\": %.4f }",
+            p > 0 ? "," : "", Name( static_cast< Part >( p ) ), c.m_used, c.m_reserved, k.m_used, k.m_reserved, c.m_load );
+        json += buf;
+    }
+
+    snprintf( buf, sizeof( buf ), " }, \"used\": %zu, \"reserved\": %zu, \"peak_used\": %zu, \"peak_reserved\": %zu, \"timeline\": [",
+        Used(), Reserved(), m_peakUsed, m_peakReserved );
+    json += buf;
+
+    for( size_t i = 0; i < m_timeline.size(); i++ )
+    {
+        const Sample& s = m_timeline[ i ];
+        snprintf( buf, sizeof( buf ), "%s [ %zu, %.4f, %zu, %zu, %.4f, %.4f ]", i > 0 ? "," : "",
+            s.m_expandedNo, s.m_seconds, s.m_used, s.m_reserved, s.m_closedLoad, s.m_openLoad );
+        json += buf;
+    }
+
+    json += " ] }";
+    return json;
+}
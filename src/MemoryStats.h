@@ -0,0 +1,98 @@
+#ifndef ASTAR_MEMORYSTATS_H
+#define ASTAR_MEMORYSTATS_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Memory of the solver by data structures: the memory manager of nodes,
+//    the closed set, the open set and the auxiliary buffers (see MemoryUsage.h).
+//
+// 2. The solver calls function Record periodically (every given number of expansions)
+//    and at the end of each step of the search. Hence, the current values are available
+//    during the search and after it.
+//
+// 3. The peak of used and reserved bytes is tracked for each structure and for the whole solver.
+//    The peak of the whole solver is the peak of the sum, not the sum of peaks.
+//
+// 4. The timeline holds the samples of memory and the load factors of the hash tables.
+//    It holds at most MAX_SAMPLE_NO samples. When it is full, every second sample is removed
+//    and the next samples are taken twice less frequently. Hence, the timeline
+//    covers the whole search with bounded memory.
+//
+
+#include "MemoryUsage.h"
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class MemoryStats
+{
+public:
+    enum Part
+    {
+        NODES,      // Memory manager of nodes (class MemMgr)
+        CLOSED_SET, // Closed set
+        OPEN_SET,   // Open set
+        BUFFERS,    // Auxiliary buffers of children
+        PART_NO
+    };
+
+    // Single sample of timeline
+    struct Sample
+    {
+        size_t m_expandedNo = 0;
+        double m_seconds = 0;
+        size_t m_used = 0;
+        size_t m_reserved = 0;
+        double m_closedLoad = 0;
+        double m_openLoad = 0;
+    };
+
+    // Maximal number of samples in timeline
+    inline static constexpr size_t MAX_SAMPLE_NO = 1024;
+
+public:
+    MemoryStats( );
+
+    void Reset( );
+    void Record( size_t expandedNo, double seconds, const MemoryUsage ( &part )[ PART_NO ] );
+
+    const MemoryUsage& Current( Part p ) const { return m_current[ p ]; }
+    const MemoryUsage& Peak( Part p ) const { return m_peak[ p ]; }
+
+    size_t Used( ) const;
+    size_t Reserved( ) const;
+    size_t PeakUsed( ) const { return m_peakUsed; }
+    size_t PeakReserved( ) const { return m_peakReserved; }
+
+    const std::vector< Sample >& Timeline( ) const { return m_timeline; }
+
+    void Print( std::ostream& out ) const;
+    std::string ToJson( ) const;
+
+    static const char* Name( Part p );
+
+private:
+    // The last recorded memory of each structure
+    MemoryUsage m_current[ PART_NO ];
+
+    // Peak memory of each structure
+    MemoryUsage m_peak[ PART_NO ];
+
+    // Peak memory of the whole solver
+    size_t m_peakUsed;
+    size_t m_peakReserved;
+
+    // Samples of memory and load factors
+    std::vector< Sample > m_timeline;
+
+    // Every m_stride-th call of Record is added to timeline
+    size_t m_stride;
+
+    // Number of calls of Record
+    size_t m_recordNo;
+};
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef ASTAR_MEMORYUSAGE_H
+#define ASTAR_MEMORYUSAGE_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Memory occupied by single data structure of the solver (memory manager,
+//    closed set, open set, etc.). Each structure returns it by function Memory.
+//
+// 2. "Used" bytes hold the elements. "Reserved" bytes are allocated by the structure,
+//    i.e. used bytes and the free space (e.g. empty slots of hash table, free objects of chunk).
+//
+// 3. The nodes of containers std::set and std::map are not visible. Their size is estimated
+//    as the size of the red-black tree node: colour, three pointers and the value.
+//    The overhead of the allocator is not counted.
+//
+
+#include <cstddef>
+
+struct MemoryUsage
+{
+    // Bytes holding the elements
+    size_t m_used = 0;
+
+    // Bytes allocated by the structure
+    size_t m_reserved = 0;
+
+    // Load factor of the hash table (number of elements / number of slots), 0 if there is no hash table
+    double m_load = 0;
+
+    // Estimated size of the node of std::set (or std::map) holding value of type T
+    template< typename T >
+    static constexpr size_t TreeNodeBytes( ) { return 4 * sizeof( void* ) + sizeof( T ); }
+};
+
+#endif
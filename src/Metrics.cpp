@@ -0,0 +1,104 @@
+#include "Metrics.h"
+#include <cassert>
+
+//
+// Constructor
+//
+Metrics::Metrics( )
+{
+    Reset();
+}
+
+//
+// Sets all counters and histograms to zero
+//
+void Metrics::Reset( )
+{
+    for( Slot& s : m_counter )
+        s.m_value.store( 0, std::memory_order_relaxed );
+
+    for( Buckets& h : m_histogram )
+    {
+        for( std::atomic< uint64_t >& v : h.m_value )
+            v.store( 0, std::memory_order_relaxed );
+    }
+}
+
+//
+// Returns name of counter "c"
+//
+const char* Metrics::Name( Counter c )
+{
+    static const char* const name[ COUNTER_NO ] = {
+        "expanded",
+        "generated",
+        "duplicate_closed",
+        "duplicate_open",
+        "reopened",
+        "open_update",
+        "requeued",
+        "lookahead",
+        "table_cutoff",
+        "table_raised",
+        "hash_insert",
+        "hash_find",
+        "hash_erase",
+        "hash_probe",
+        "hash_resize",
+        "spilled" };
+
+    assert( c < COUNTER_NO );
+    return name[ c ];
+}
+
+//
+// Returns name of histogram "h"
+//
+const char* Metrics::Name( Histogram h )
+{
+    static const char* const name[ HISTOGRAM_NO ] = {
+        "probe_length",
+        "branching" };
+
+    assert( h < HISTOGRAM_NO );
+    return name[ h ];
+}
+
+//
+// Returns all values in JSON format, for example
+//    { "counters": { "expanded": 10, ... }, "histograms": { "probe_length": [ 5, 1, ... ], ... } }
+//
+std::string Metrics::ToJson( ) const
+{
+    std::string txt = "{ \"counters\": { ";
+
+    for( int c = 0; c < COUNTER_NO; c++ )
+    {
+        if( c > 0 )
+            txt += ", ";
+        txt += "\"";
+        txt += Name( static_cast< Counter >( c ) );
+        txt += "\": " + std::to_string( Get( static_cast< Counter >( c ) ) );
+    }
+
+    txt += " }, \"histograms\": { ";
+
+    for( int h = 0; h < HISTOGRAM_NO; h++ )
+    {
+        if( h > 0 )
+            txt += ", ";
+        txt += "\"";
+        txt += Name( static_cast< Histogram >( h ) );
+        txt += "\": [ ";
+        for( size_t b = 0; b < BUCKET_NO; b++ )
+        {
+            if( b > 0 )
+                txt += ", ";
+            txt += std::to_string( Get( static_cast< Histogram >( h ), b ) );
+        }
+        txt += " ]";
+    }
+
+    txt += " } }";
+    return txt;
+}
@@ -0,0 +1,149 @@
+#ifndef ASTAR_METRICS_H
+#define ASTAR_METRICS_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Counters and histograms collected during the search.
+//    They replace the statistics available only with macro ASTAR_STATISTICS.
+//
+// 2. The solver (e.g. Astar) owns the object of class Metrics and passes its address
+//    to the closed set, the open set and the hash tables (function SetMetrics).
+//    If the address is NULL, nothing is collected.
+//
+// 3. The metrics are enabled by default. They are disabled at run time by function SetEnabled.
+//    Astar reads the flag once per expansion: while it is cleared, the solver updates no counter
+//    and passes NULL to the closed set and the open set, hence nothing is checked per probe.
+//    The other solvers ignore the flag.
+//
+// 4. Each counter occupies its own cache line. The values are updated by the single
+//    thread (the thread running the search) by relaxed atomic load and store,
+//    hence no locked instructions are used. Other threads (e.g. monitoring thread)
+//    can read the values at any time.
+//
+// 5. Histogram holds BUCKET_NO buckets. The last bucket counts all values
+//    greater or equal to BUCKET_NO - 1.
+//
+// 6. The values are available by functions Get, and in JSON format by function ToJson.
+//
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+class Metrics
+{
+public:
+    enum Counter
+    {
+        EXPANDED,        // Expanded nodes
+        GENERATED,       // Generated children
+        DUPLICATE_CLOSED,// Children found in closed set
+        DUPLICATE_OPEN,  // Children found in open set, which are not improved
+        REOPENED,        // Children found in closed set, reached by the cheaper path
+        OPEN_UPDATE,     // Nodes of open set with decreased cost (decrease-key)
+        REQUEUED,        // Partially expanded nodes put back into open set (see Epea)
+        LOOKAHEAD,       // Nodes expanded by the lookahead, without open set (see Astar::SetLookahead)
+        TABLE_CUTOFF,    // Nodes not expanded, since they are found in transposition table (see IDAstar)
+        TABLE_RAISED,    // Nodes with heuristic raised by transposition table
+        HASH_INSERT,     // Insertions into hash tables
+        HASH_FIND,       // Searches in hash tables
+        HASH_ERASE,      // Removals from hash tables
+        HASH_PROBE,      // Occupied slots visited by insertions and searches in hash tables
+        HASH_RESIZE,     // Expansions of hash tables
+        SPILLED,         // Bytes written to run files on disk (see ExternalAstar)
+        COUNTER_NO
+    };
+
+    enum Histogram
+    {
+        PROBE_LENGTH,    // Number of occupied slots visited by single insertion or search in hash table
+        BRANCHING,       // Number of children generated by single expansion
+        HISTOGRAM_NO
+    };
+
+    // Number of buckets in each histogram
+    inline static constexpr size_t BUCKET_NO = 16;
+
+public:
+    Metrics( );
+
+    void Add( Counter c, uint64_t n = 1 );
+    void Record( Histogram h, uint64_t value );
+    void Reset( );
+
+    // Enables or disables the collection, the values are kept
+    void SetEnabled( bool enabled ) { m_enabled.store( enabled, std::memory_order_relaxed ); }
+    bool IsEnabled( ) const { return m_enabled.load( std::memory_order_relaxed ); }
+
+    uint64_t Get( Counter c ) const;
+    uint64_t Get( Histogram h, size_t bucket ) const;
+
+    static const char* Name( Counter c );
+    static const char* Name( Histogram h );
+
+    std::string ToJson( ) const;
+
+private:
+    // Counter in its own cache line
+    struct alignas( 64 ) Slot
+    {
+        std::atomic< uint64_t > m_value{ 0 };
+    };
+
+    // Histogram in its own cache lines
+    struct alignas( 64 ) Buckets
+    {
+        std::atomic< uint64_t > m_value[ BUCKET_NO ];
+    };
+
+private:
+    Slot m_counter[ COUNTER_NO ];
+    Buckets m_histogram[ HISTOGRAM_NO ];
+
+    // Collection is enabled, it may be changed by other thread
+    std::atomic< bool > m_enabled{ true };
+};
+
+//
+// Increases counter "c" by "n". Only the thread running the search may call it.
+//
+inline
+void Metrics::Add( Counter c, uint64_t n )
+{
+    std::atomic< uint64_t >& v = m_counter[ c ].m_value;
+    v.store( v.load( std::memory_order_relaxed ) + n, std::memory_order_relaxed );
+}
+
+//
+// Adds "value" to histogram "h". Only the thread running the search may call it.
+//
+inline
+void Metrics::Record( Histogram h, uint64_t value )
+{
+    const size_t b = ( value < BUCKET_NO - 1 ) ? value : BUCKET_NO - 1;
+    std::atomic< uint64_t >& v = m_histogram[ h ].m_value[ b ];
+    v.store( v.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+}
+
+//
+// Returns the value of counter "c"
+//
+inline
+uint64_t Metrics::Get( Counter c ) const
+{
+    return m_counter[ c ].m_value.load( std::memory_order_relaxed );
+}
+
+//
+// Returns the value of bucket "bucket" of histogram "h"
+//
+inline
+uint64_t Metrics::Get( Histogram h, size_t bucket ) const
+{
+    return m_histogram[ h ].m_value[ bucket ].load( std::memory_order_relaxed );
+}
+
+#endif
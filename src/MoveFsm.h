@@ -0,0 +1,86 @@
+#ifndef ASTAR_MOVEFSM_H
+#define ASTAR_MOVEFSM_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Represents the finite state machine (FSM) pruning the duplicate sequences of moves
+//    in the depth-first search (Taylor and Korf). The move is pruned, if the sequence
+//    of moves from the start state ends with the sequence, which reaches the same state
+//    as some shorter, or lexicographically earlier, sequence.
+//
+// 2. The table of transitions is built by program sliding-fsm (see MoveFsmBuilder.h)
+//    and compiled in (MoveFsmTable.h). It does not depend on the width of the board.
+//
+// 3. The search starts in state START. For each move the next state is Next( state, dir ),
+//    where "dir" is the direction of SPACE. If it is FORBIDDEN, the move is pruned.
+//    The move returning to the parent is always pruned.
+//
+// 4. The least sequence of moves reaching each state is never pruned, hence the optimal
+//    solution is found.
+//
+
+#include "MoveFsmTable.h"
+#include "State.h"
+#include <cstdint>
+
+class MoveFsm
+{
+public:
+    // Direction of SPACE, the order is the same as in MoveFsmBuilder
+    enum Direction
+    {
+        UP,
+        LEFT,
+        RIGHT,
+        DOWN
+    };
+
+    // State of FSM at the beginning of the search
+    inline static constexpr int32_t START = 0;
+
+    // Transition for the pruned move
+    inline static constexpr int32_t FORBIDDEN = -1;
+
+public:
+    //
+    // Returns the next state after the move in direction "dir", or FORBIDDEN
+    //
+    static int32_t Next( int32_t state, Direction dir )
+    {
+        return MOVE_FSM_TABLE[ state ][ dir ];
+    }
+
+    //
+    // Returns the direction of SPACE moving from position "sp" to position "to"
+    //
+    static Direction Move( int sp, int to )
+    {
+        if( to + static_cast< int >( State::WIDTH ) == sp )
+            return UP;
+        if( to + 1 == sp )
+            return LEFT;
+        if( to == sp + 1 )
+            return RIGHT;
+        return DOWN;
+    }
+
+    //
+    // Returns the direction returning SPACE back
+    //
+    static Direction Reverse( Direction dir )
+    {
+        return static_cast< Direction >( DOWN - dir );
+    }
+
+    //
+    // Returns the number of states
+    //
+    static size_t StateNo( )
+    {
+        return MOVE_FSM_TABLE.size();
+    }
+};
+
+#endif
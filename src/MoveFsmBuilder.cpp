@@ -0,0 +1,411 @@
+#include "MoveFsmBuilder.h"
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace
+{
+
+// Change of the coordinates of SPACE for each move: UP, LEFT, RIGHT, DOWN
+const int DX[ MoveFsmBuilder::MOVE_NO ] = { 0, -1, 1, 0 };
+const int DY[ MoveFsmBuilder::MOVE_NO ] = { -1, 0, 0, 1 };
+
+// Names of moves used in the comments of the generated table
+const char NAME[ MoveFsmBuilder::MOVE_NO ] = { 'U', 'L', 'R', 'D' };
+
+// Bounding box of positions visited by SPACE, relative to its start position
+struct Box
+{
+    int m_minX = 0;
+    int m_maxX = 0;
+    int m_minY = 0;
+    int m_maxY = 0;
+
+    void Add( int x, int y )
+    {
+        m_minX = std::min( m_minX, x );
+        m_maxX = std::max( m_maxX, x );
+        m_minY = std::min( m_minY, y );
+        m_maxY = std::max( m_maxY, y );
+    }
+
+    bool Inside( const Box& b ) const
+    {
+        return m_minX >= b.m_minX && m_maxX <= b.m_maxX && m_minY >= b.m_minY && m_maxY <= b.m_maxY;
+    }
+};
+
+//
+// Board large enough for the sequences of the given length.
+// Each tile is labeled by its start position.
+//
+class Board
+{
+public:
+    explicit Board( unsigned int length )
+        : m_width( 2 * length + 3 )
+        , m_tile( m_width * m_width )
+    {
+        for( size_t i = 0; i < m_tile.size(); i++ )
+            m_tile[ i ] = static_cast< uint16_t >( i );
+    }
+
+    //
+    // Returns the effect of sequence "seq" and its bounding box in "box".
+    // The effect is the list of positions with changed tiles and their tiles.
+    //
+    std::string Effect( const std::string& seq, Box& box )
+    {
+        const int c = m_width / 2;
+        int x = c, y = c;
+
+        std::vector< int > visited = { y * m_width + x };
+        box = Box();
+
+        for( char m : seq )
+        {
+            const int nx = x + DX[ m - '0' ];
+            const int ny = y + DY[ m - '0' ];
+            std::swap( m_tile[ y * m_width + x ], m_tile[ ny * m_width + nx ] );
+            x = nx;
+            y = ny;
+            box.Add( x - c, y - c );
+            visited.push_back( y * m_width + x );
+        }
+
+        std::sort( visited.begin(), visited.end() );
+        visited.erase( std::unique( visited.begin(), visited.end() ), visited.end() );
+
+        // The position of SPACE is a part of the effect
+        std::string key;
+        key.reserve( 4 * visited.size() + 4 );
+        const int space = y * m_width + x;
+        key.append( reinterpret_cast< const char* >( &space ), sizeof( space ) );
+        for( int pos : visited )
+        {
+            if( m_tile[ pos ] != pos )
+            {
+                const uint16_t cell[ 2 ] = { static_cast< uint16_t >( pos ), m_tile[ pos ] };
+                key.append( reinterpret_cast< const char* >( cell ), sizeof( cell ) );
+            }
+        }
+
+        // Restore the board
+        for( auto it = seq.rbegin(); it != seq.rend(); ++it )
+        {
+            const int px = x - DX[ *it - '0' ];
+            const int py = y - DY[ *it - '0' ];
+            std::swap( m_tile[ y * m_width + x ], m_tile[ py * m_width + px ] );
+            x = px;
+            y = py;
+        }
+
+        return key;
+    }
+
+private:
+    const int m_width;
+    std::vector< uint16_t > m_tile;
+};
+
+}
+
+//
+// Constructor
+// "length" - maximal length of enumerated sequences
+//
+MoveFsmBuilder::MoveFsmBuilder( unsigned int length )
+    : m_length( length )
+{
+    if( length < 2 || length > 32 )
+        throw std::invalid_argument( "Length of sequences must be in range [2, 32]" );
+}
+
+//
+// Builds the FSM
+//
+void MoveFsmBuilder::Build( )
+{
+    FindDuplicates();
+    BuildAutomaton();
+    Minimize();
+}
+
+//
+// Enumerates the sequences and collects the minimal duplicates
+//
+void MoveFsmBuilder::FindDuplicates( )
+{
+    Board board( m_length );
+
+    // Bounding boxes of the sequences, which are not duplicates, for each effect
+    std::unordered_map< std::string, std::vector< Box > > known;
+
+    std::vector< std::string > level = { "" };
+    Box box;
+    known[ board.Effect( "", box ) ].push_back( box );
+
+    // The same duplicates for fast search of suffixes
+    std::unordered_set< std::string > found;
+
+    m_duplicate.clear();
+    m_sequenceNo.assign( 1, 1 );
+
+    for( unsigned int len = 1; len <= m_length; len++ )
+    {
+        // The sequences are extended in lexicographic order
+        std::vector< std::string > next;
+        for( const std::string& s : level )
+        {
+            for( unsigned int m = 0; m < MOVE_NO; m++ )
+            {
+                const std::string seq = s + char( '0' + m );
+
+                // The sequence ending with the known duplicate is not minimal
+                bool pruned = false;
+                for( size_t i = 1; i + 1 < seq.size() && !pruned; i++ )
+                    pruned = found.count( seq.substr( i ) ) > 0;
+                if( pruned )
+                    continue;
+
+                std::vector< Box >& boxes = known[ board.Effect( seq, box ) ];
+
+                const bool duplicate = std::any_of( boxes.begin(), boxes.end(), [&box]( const Box& b ) { return b.Inside( box ); } );
+                if( duplicate )
+                {
+                    m_duplicate.push_back( seq );
+                    found.insert( seq );
+                }
+                else
+                {
+                    boxes.push_back( box );
+                    next.push_back( seq );
+                }
+            }
+        }
+
+        m_sequenceNo.push_back( next.size() );
+        level.swap( next );
+    }
+}
+
+//
+// Builds the Aho-Corasick automaton of the duplicates
+//
+void MoveFsmBuilder::BuildAutomaton( )
+{
+    // Trie of duplicates
+    std::vector< std::array< int32_t, MOVE_NO > > go( 1 );
+    go[ 0 ].fill( FORBIDDEN );
+    std::vector< bool > end( 1, false );
+
+    for( const std::string& d : m_duplicate )
+    {
+        int32_t s = 0;
+        for( char c : d )
+        {
+            const unsigned int m = c - '0';
+            if( go[ s ][ m ] == FORBIDDEN )
+            {
+                go[ s ][ m ] = static_cast< int32_t >( go.size() );
+                go.emplace_back();
+                go.back().fill( FORBIDDEN );
+                end.push_back( false );
+            }
+            s = go[ s ][ m ];
+        }
+        end[ s ] = true;
+    }
+
+    // Failure links in breadth-first order. Missing transitions are replaced
+    // by the transitions of the failure state, hence the automaton is complete.
+    std::vector< int32_t > fail( go.size(), 0 );
+    std::deque< int32_t > queue;
+    for( unsigned int m = 0; m < MOVE_NO; m++ )
+    {
+        if( go[ 0 ][ m ] == FORBIDDEN )
+            go[ 0 ][ m ] = 0;
+        else
+            queue.push_back( go[ 0 ][ m ] );
+    }
+
+    while( !queue.empty() )
+    {
+        const int32_t s = queue.front();
+        queue.pop_front();
+        end[ s ] = end[ s ] || end[ fail[ s ] ];
+
+        for( unsigned int m = 0; m < MOVE_NO; m++ )
+        {
+            const int32_t t = go[ s ][ m ];
+            if( t == FORBIDDEN )
+            {
+                go[ s ][ m ] = go[ fail[ s ] ][ m ];
+            }
+            else
+            {
+                fail[ t ] = go[ fail[ s ] ][ m ];
+                queue.push_back( t );
+            }
+        }
+    }
+
+    // The states ending with a duplicate are removed
+    std::vector< int32_t > id( go.size(), FORBIDDEN );
+    int32_t no = 0;
+    for( size_t s = 0; s < go.size(); s++ )
+    {
+        if( !end[ s ] )
+            id[ s ] = no++;
+    }
+
+    m_next.assign( no, {} );
+    for( size_t s = 0; s < go.size(); s++ )
+    {
+        if( end[ s ] )
+            continue;
+        for( unsigned int m = 0; m < MOVE_NO; m++ )
+            m_next[ id[ s ] ][ m ] = id[ go[ s ][ m ] ];
+    }
+}
+
+//
+// Merges the equivalent states by partition refinement
+//
+void MoveFsmBuilder::Minimize( )
+{
+    const size_t n = m_next.size();
+
+    // Initially all states are equivalent
+    std::vector< int32_t > block( n, 0 );
+    size_t blockNo = 1;
+
+    while( true )
+    {
+        // The states are equivalent, if they are in the same block and their transitions
+        // lead to the same blocks
+        std::map< std::array< int32_t, MOVE_NO + 1 >, int32_t > signature;
+        std::vector< int32_t > next( n );
+
+        for( size_t s = 0; s < n; s++ )
+        {
+            std::array< int32_t, MOVE_NO + 1 > sig;
+            sig[ 0 ] = block[ s ];
+            for( unsigned int m = 0; m < MOVE_NO; m++ )
+                sig[ m + 1 ] = ( m_next[ s ][ m ] == FORBIDDEN ) ? FORBIDDEN : block[ m_next[ s ][ m ] ];
+
+            auto it = signature.emplace( sig, static_cast< int32_t >( signature.size() ) ).first;
+            next[ s ] = it->second;
+        }
+
+        block.swap( next );
+        if( signature.size() == blockNo )
+            break;
+        blockNo = signature.size();
+    }
+
+    // Blocks are renumbered, so that the start state is zero
+    std::vector< int32_t > id( blockNo, FORBIDDEN );
+    std::vector< std::array< int32_t, MOVE_NO > > next( blockNo );
+    int32_t no = 0;
+    id[ block[ 0 ] ] = no++;
+
+    for( size_t s = 0; s < n; s++ )
+    {
+        if( id[ block[ s ] ] == FORBIDDEN )
+            id[ block[ s ] ] = no++;
+    }
+
+    for( size_t s = 0; s < n; s++ )
+    {
+        for( unsigned int m = 0; m < MOVE_NO; m++ )
+            next[ id[ block[ s ] ] ][ m ] = ( m_next[ s ][ m ] == FORBIDDEN ) ? FORBIDDEN : id[ block[ m_next[ s ][ m ] ] ];
+    }
+
+    m_next.swap( next );
+}
+
+//
+// Returns the number of sequences of each length up to "length", which are accepted by FSM.
+// Beyond the length of enumeration it shows the branching factor of the pruned search.
+//
+std::vector< uint64_t > MoveFsmBuilder::AcceptedNo( unsigned int length ) const
+{
+    std::vector< uint64_t > count( m_next.size(), 0 );
+    std::vector< uint64_t > result = { 1 };
+    count[ 0 ] = 1;
+
+    for( unsigned int len = 1; len <= length; len++ )
+    {
+        std::vector< uint64_t > next( m_next.size(), 0 );
+        uint64_t sum = 0;
+        for( size_t s = 0; s < m_next.size(); s++ )
+        {
+            for( unsigned int m = 0; m < MOVE_NO; m++ )
+            {
+                if( m_next[ s ][ m ] != FORBIDDEN )
+                {
+                    next[ m_next[ s ][ m ] ] += count[ s ];
+                    sum += count[ s ];
+                }
+            }
+        }
+        count.swap( next );
+        result.push_back( sum );
+    }
+
+    return result;
+}
+
+//
+// Writes the table of transitions as C++ header
+//
+void MoveFsmBuilder::Write( std::ostream& out ) const
+{
+    out << "#ifndef ASTAR_MOVEFSMTABLE_H\n"
+        << "#define ASTAR_MOVEFSMTABLE_H\n"
+        << "\n"
+        << "//\n"
+        << "// Generated by: sliding-fsm --length " << m_length << "\n"
+        << "// Do not edit, see MoveFsmBuilder.h.\n"
+        << "//\n"
+        << "// Minimal duplicate sequences: " << m_duplicate.size() << "\n"
+        << "// States: " << m_next.size() << "\n"
+        << "// Sequences of each length, which are not pruned on the unbounded board:\n"
+        << "//";
+
+    for( size_t len = 1; len < m_sequenceNo.size(); len++ )
+        out << " " << m_sequenceNo[ len ];
+
+    out << "\n"
+        << "//\n"
+        << "\n"
+        << "#include <array>\n"
+        << "#include <cstdint>\n"
+        << "\n"
+        << "// Transitions for moves ";
+
+    for( unsigned int m = 0; m < MOVE_NO; m++ )
+        out << NAME[ m ] << ( m + 1 < MOVE_NO ? ", " : "" );
+
+    // The smallest type of the table is selected
+    const char* type = ( m_next.size() <= INT16_MAX ) ? "int16_t" : "int32_t";
+
+    out << ", -1 is the pruned move\n"
+        << "inline constexpr std::array< std::array< " << type << ", 4 >, " << m_next.size() << " > MOVE_FSM_TABLE = {{\n";
+
+    for( size_t s = 0; s < m_next.size(); s++ )
+    {
+        out << "    {{ ";
+        for( unsigned int m = 0; m < MOVE_NO; m++ )
+            out << m_next[ s ][ m ] << ( m + 1 < MOVE_NO ? ", " : "" );
+        out << " }}" << ( s + 1 < m_next.size() ? "," : "" ) << "\n";
+    }
+
+    out << "}};\n"
+        << "\n"
+        << "#endif\n";
+}
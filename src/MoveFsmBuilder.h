@@ -0,0 +1,82 @@
+#ifndef ASTAR_MOVEFSMBUILDER_H
+#define ASTAR_MOVEFSMBUILDER_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Builds the finite state machine (FSM) pruning the duplicate sequences of moves
+//    (see class MoveFsm). It is run by program sliding-fsm, which writes the table
+//    of transitions compiled into the solver (MoveFsmTable.h).
+//
+// 2. The moves are the directions of SPACE: UP, LEFT, RIGHT and DOWN, in this order.
+//    The sequences of moves are enumerated in the order of length and then lexicographically,
+//    up to the given length, on the unbounded board. The effect of the sequence is
+//    the final arrangement of tiles around the start position of SPACE.
+//
+// 3. The sequence is duplicate, if the earlier sequence has the same effect and its SPACE
+//    stays within the bounding box of positions of SPACE visited by the sequence.
+//    Hence, the earlier sequence is legal on any board, where the duplicate is legal.
+//    The duplicates and the sequences ending with the duplicate are not extended,
+//    hence only the minimal duplicates are collected.
+//    For example, "UP DOWN" is the duplicate of the empty sequence.
+//
+// 4. The FSM is the Aho-Corasick automaton of the minimal duplicates. The transition
+//    to the state, which ends with a duplicate, is forbidden. The equivalent states
+//    are merged (minimization by partition refinement).
+//
+// 5. Replacing the duplicate by the earlier sequence gives the earlier sequence,
+//    hence the least sequence reaching the state (in the order of length and lexicographic)
+//    contains no duplicate and it is never pruned.
+//
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class MoveFsmBuilder
+{
+public:
+    // Number of moves (directions of SPACE)
+    inline static constexpr unsigned int MOVE_NO = 4;
+
+    // Forbidden transition
+    inline static constexpr int32_t FORBIDDEN = -1;
+
+public:
+    explicit MoveFsmBuilder( unsigned int length );
+
+    void Build( );
+    void Write( std::ostream& out ) const;
+
+    size_t DuplicateNo( ) const { return m_duplicate.size(); }
+    size_t StateNo( ) const { return m_next.size(); }
+
+    // Number of sequences of each length, which are not pruned
+    const std::vector< uint64_t >& SequenceNo( ) const { return m_sequenceNo; }
+
+    // Number of sequences of each length up to "length", which are accepted by FSM
+    std::vector< uint64_t > AcceptedNo( unsigned int length ) const;
+
+private:
+    void FindDuplicates( );
+    void BuildAutomaton( );
+    void Minimize( );
+
+private:
+    // Maximal length of enumerated sequences
+    const unsigned int m_length;
+
+    // Minimal duplicate sequences, each move stored as a character '0' + direction
+    std::vector< std::string > m_duplicate;
+
+    // Number of sequences of each length, which are not duplicates
+    std::vector< uint64_t > m_sequenceNo;
+
+    // Transitions of FSM, FORBIDDEN for the pruned moves. The start state is zero.
+    std::vector< std::array< int32_t, MOVE_NO > > m_next;
+};
+
+#endif
@@ -0,0 +1,8102 @@
+#ifndef ASTAR_MOVEFSMTABLE_H
+#define ASTAR_MOVEFSMTABLE_H
+
+//
+// Generated by: sliding-fsm --length 12
+// Do not edit, see MoveFsmBuilder.h.
+//
+// Minimal duplicate sequences: 2667
+// States: 8081
+// Sequences of each length, which are not pruned on the unbounded board:
+// 4 12 36 108 324 968 2892 8612 25644 76100 225868 668640
+//
+
+#include <array>
+#include <cstdint>
+
+// Transitions for moves U, L, R, D, -1 is the pruned move
+inline constexpr std::array< std::array< int16_t, 4 >, 8081 > MOVE_FSM_TABLE = {{
+    {{ 1, 2, 3, 4 }},
+    {{ 174, 21, 26, -1 }},
+    {{ 5, 49, -1, 55 }},
+    {{ 9, -1, 87, 93 }},
+    {{ -1, 13, 17, 163 }},
+    {{ 31, 36, 6, -1 }},
+    {{ 41, -1, 45, 7 }},
+    {{ -1, 8, 262, 266 }},
+    {{ -1, 406, -1, 410 }},
+    {{ 66, 10, 82, -1 }},
+    {{ 71, 75, -1, 11 }},
+    {{ -1, 79, 12, 276 }},
+    {{ -1, -1, 648, 652 }},
+    {{ 14, 121, -1, 126 }},
+    {{ 107, 111, 15, -1 }},
+    {{ 115, -1, 118, 16 }},
+    {{ -1, -1, 973, 977 }},
+    {{ 18, -1, 149, 154 }},
+    {{ 135, 19, 145, -1 }},
+    {{ 139, 142, -1, 20 }},
+    {{ -1, 79, -1, 1138 }},
+    {{ 187, 198, -1, 22 }},
+    {{ -1, 204, 23, 217 }},
+    {{ 24, -1, 209, 213 }},
+    {{ 63, 25, 1695, -1 }},
+    {{ 139, 2205, -1, -1 }},
+    {{ 222, -1, 233, 27 }},
+    {{ -1, 28, 247, 252 }},
+    {{ 29, 239, -1, 243 }},
+    {{ 96, 99, 30, -1 }},
+    {{ 115, -1, 2209, -1 }},
+    {{ 285, 32, 311, -1 }},
+    {{ 299, 304, -1, 33 }},
+    {{ -1, 2344, 34, 2001 }},
+    {{ 24, -1, 309, 35 }},
+    {{ -1, 1426, -1, 1436 }},
+    {{ 37, 338, -1, 257 }},
+    {{ 326, 331, 38, -1 }},
+    {{ 2498, -1, 2512, 39 }},
+    {{ -1, 8, 336, 40 }},
+    {{ -1, 1575, -1, 1585 }},
+    {{ 360, 369, 42, -1 }},
+    {{ 2708, -1, 374, 43 }},
+    {{ -1, 44, 2744, 2753 }},
+    {{ 4466, -1, -1, 378 }},
+    {{ 46, -1, 390, 401 }},
+    {{ 380, 47, 386, -1 }},
+    {{ 2777, 2788, -1, 48 }},
+    {{ -1, -1, 12, 384 }},
+    {{ 270, 434, -1, 50 }},
+    {{ -1, 451, 51, 465 }},
+    {{ 52, -1, 460, 3218 }},
+    {{ 3173, 19, 53, -1 }},
+    {{ 54, -1, 2132, 2139 }},
+    {{ 456, -1, 458, -1 }},
+    {{ -1, 56, 61, 511 }},
+    {{ 57, 475, -1, 481 }},
+    {{ 3276, 3291, 58, -1 }},
+    {{ 3304, -1, 59, 3317 }},
+    {{ 60, -1, 962, 969 }},
+    {{ 471, -1, 473, -1 }},
+    {{ 62, -1, 3470, 505 }},
+    {{ 63, 19, 145, -1 }},
+    {{ 487, 495, 64, -1 }},
+    {{ 499, -1, 502, 65 }},
+    {{ -1, -1, 3455, 3463 }},
+    {{ 531, 545, 67, -1 }},
+    {{ 565, -1, 570, 68 }},
+    {{ -1, 69, 3912, 2165 }},
+    {{ 29, 575, -1, 70 }},
+    {{ -1, -1, 1503, 1507 }},
+    {{ 577, 72, 592, -1 }},
+    {{ 3974, 586, -1, 73 }},
+    {{ -1, 4011, 74, 4020 }},
+    {{ 2608, -1, -1, 590 }},
+    {{ 76, 607, -1, 618 }},
+    {{ 597, 601, 77, -1 }},
+    {{ 4090, -1, 4101, 78 }},
+    {{ -1, 8, -1, 605 }},
+    {{ 630, 634, -1, 80 }},
+    {{ -1, 642, 81, 645 }},
+    {{ -1, -1, 4250, 4254 }},
+    {{ 83, -1, 667, 280 }},
+    {{ 657, 84, 662, -1 }},
+    {{ 4346, 4360, -1, 85 }},
+    {{ -1, 4369, 12, 86 }},
+    {{ -1, -1, 1806, 1807 }},
+    {{ 694, -1, 725, 88 }},
+    {{ -1, 89, 759, 764 }},
+    {{ 90, 751, -1, 4900 }},
+    {{ 4804, 91, 15, -1 }},
+    {{ 92, 746, -1, 802 }},
+    {{ 742, 744, -1, -1 }},
+    {{ -1, 94, 102, 852 }},
+    {{ 95, 806, -1, 826 }},
+    {{ 96, 99, 15, -1 }},
+    {{ 770, 97, 784, -1 }},
+    {{ 778, 781, -1, 98 }},
+    {{ -1, 5055, -1, 5063 }},
+    {{ 100, 794, -1, 802 }},
+    {{ 788, 791, 101, -1 }},
+    {{ 5100, -1, 5107, -1 }},
+    {{ 103, -1, 839, 845 }},
+    {{ 5302, 104, 5352, -1 }},
+    {{ 5323, 105, -1, 5345 }},
+    {{ 106, 836, -1, 1134 }},
+    {{ 832, 834, -1, -1 }},
+    {{ 876, 108, 897, -1 }},
+    {{ 887, 891, -1, 109 }},
+    {{ -1, 5682, 110, 5697 }},
+    {{ 24, -1, 895, -1 }},
+    {{ 112, 919, -1, 930 }},
+    {{ 909, 913, 113, -1 }},
+    {{ 5778, -1, 5787, 114 }},
+    {{ -1, 8, 917, -1 }},
+    {{ 939, 946, 116, -1 }},
+    {{ 950, -1, 953, 117 }},
+    {{ -1, -1, 5944, 5948 }},
+    {{ 119, -1, 962, 969 }},
+    {{ 956, 120, 959, -1 }},
+    {{ 5962, 5969, -1, -1 }},
+    {{ 981, 999, -1, 122 }},
+    {{ -1, 1013, 123, 1022 }},
+    {{ 124, -1, 1018, 6285 }},
+    {{ 6253, 19, 125, -1 }},
+    {{ -1, -1, 6261, 2139 }},
+    {{ -1, 127, 131, 1058 }},
+    {{ 128, 1027, -1, 1032 }},
+    {{ 6336, 6351, 129, -1 }},
+    {{ 6364, -1, 130, 6376 }},
+    {{ -1, -1, 6372, 969 }},
+    {{ 132, -1, 6488, 1053 }},
+    {{ 133, 6469, 1049, -1 }},
+    {{ 1037, 1042, 134, -1 }},
+    {{ 1045, -1, 1047, -1 }},
+    {{ 1075, 1086, 136, -1 }},
+    {{ 1097, -1, 1101, 137 }},
+    {{ -1, 138, 6745, 6756 }},
+    {{ 29, 1105, -1, -1 }},
+    {{ 1107, 140, 1119, -1 }},
+    {{ 1113, 1116, -1, 141 }},
+    {{ -1, 6798, -1, 6801 }},
+    {{ 143, 1128, -1, 1134 }},
+    {{ 1122, 1125, 144, -1 }},
+    {{ 6816, -1, 6818, -1 }},
+    {{ 146, -1, 1152, 1163 }},
+    {{ 1142, 147, 1148, -1 }},
+    {{ 6878, 6887, -1, 148 }},
+    {{ -1, 1146, 12, -1 }},
+    {{ 1172, -1, 1190, 150 }},
+    {{ -1, 151, 1208, 1213 }},
+    {{ 152, 1204, -1, 7182 }},
+    {{ 7160, 153, 15, -1 }},
+    {{ -1, 746, -1, 802 }},
+    {{ -1, 155, 159, 1245 }},
+    {{ 156, 7319, -1, 1230 }},
+    {{ 157, 7297, 7312, -1 }},
+    {{ 1218, 158, 1227, -1 }},
+    {{ 1223, 1225, -1, -1 }},
+    {{ 160, -1, 1235, 1240 }},
+    {{ 7378, 161, 7406, -1 }},
+    {{ 7393, 162, -1, 7401 }},
+    {{ -1, 836, -1, 1134 }},
+    {{ -1, 164, 169, 1342 }},
+    {{ 165, 1289, -1, 1295 }},
+    {{ 1262, 7599, 166, -1 }},
+    {{ 167, -1, 7652, 16 }},
+    {{ 1277, 1282, 168, -1 }},
+    {{ 1285, -1, 1287, -1 }},
+    {{ 170, -1, 1329, 1335 }},
+    {{ 1302, 171, 7846, -1 }},
+    {{ 172, 7836, -1, 20 }},
+    {{ 1317, 173, 1326, -1 }},
+    {{ 1322, 1324, -1, -1 }},
+    {{ 1364, 175, 181, -1 }},
+    {{ 1393, 1408, -1, 176 }},
+    {{ -1, 204, 177, 1444 }},
+    {{ 24, -1, 1421, 178 }},
+    {{ -1, 1426, 179, 1436 }},
+    {{ 180, -1, 1430, 1433 }},
+    {{ 7378, -1, 7406, -1 }},
+    {{ 1464, -1, 1479, 182 }},
+    {{ -1, 183, 247, 1515 }},
+    {{ 29, 1492, -1, 184 }},
+    {{ -1, 185, 1503, 1507 }},
+    {{ 186, 1497, -1, 1500 }},
+    {{ 5256, 6351, -1, -1 }},
+    {{ 1535, 188, 193, -1 }},
+    {{ 37, 1552, -1, 189 }},
+    {{ -1, 352, 190, 2631 }},
+    {{ 2608, -1, 191, 1560 }},
+    {{ 357, -1, 2021, 192 }},
+    {{ -1, -1, 1419, 1558 }},
+    {{ 1564, -1, 45, 194 }},
+    {{ -1, 8, 1570, 195 }},
+    {{ -1, 1575, 196, 1585 }},
+    {{ 197, -1, 1579, 1582 }},
+    {{ 868, -1, 5527, -1 }},
+    {{ 199, 1616, -1, 1632 }},
+    {{ 1593, 1598, 200, -1 }},
+    {{ 3005, -1, 1603, 201 }},
+    {{ -1, 8, 202, 1612 }},
+    {{ 431, -1, 2101, 203 }},
+    {{ -1, -1, 1608, 1610 }},
+    {{ 1665, 1676, -1, 205 }},
+    {{ -1, 3348, 206, 1690 }},
+    {{ 207, -1, 3365, 1053 }},
+    {{ 208, 3360, 1687, -1 }},
+    {{ 1037, 1042, -1, -1 }},
+    {{ 1700, -1, 1705, 210 }},
+    {{ -1, 211, 1718, 1722 }},
+    {{ 212, 3511, -1, 7182 }},
+    {{ 1716, -1, 15, -1 }},
+    {{ -1, 1726, 214, 1740 }},
+    {{ 215, -1, 1733, 1737 }},
+    {{ 7378, 216, 7406, -1 }},
+    {{ 1731, -1, -1, 7401 }},
+    {{ -1, 218, 1760, 1766 }},
+    {{ 219, 1750, -1, 1755 }},
+    {{ 514, 3551, 220, -1 }},
+    {{ 221, -1, 3558, 16 }},
+    {{ 1277, 1282, -1, -1 }},
+    {{ 1780, 223, 228, -1 }},
+    {{ 1797, 75, -1, 224 }},
+    {{ -1, 79, 12, 225 }},
+    {{ -1, 226, 1806, 1807 }},
+    {{ 227, 1803, -1, 1576 }},
+    {{ 514, 3551, -1, -1 }},
+    {{ 83, -1, 1813, 229 }},
+    {{ -1, 230, 689, 4521 }},
+    {{ 4466, 231, -1, 1821 }},
+    {{ 681, 684, -1, 232 }},
+    {{ -1, 1490, -1, 1819 }},
+    {{ 234, -1, 1850, 1867 }},
+    {{ 1825, 235, 1844, -1 }},
+    {{ 4583, 1831, -1, 236 }},
+    {{ -1, 237, 12, 1840 }},
+    {{ 711, 714, -1, 238 }},
+    {{ -1, 1836, -1, 1838 }},
+    {{ 1900, 1905, -1, 240 }},
+    {{ -1, 822, 241, 1916 }},
+    {{ 242, -1, 5235, 5240 }},
+    {{ 1914, 19, -1, -1 }},
+    {{ -1, 244, 1929, 1934 }},
+    {{ 245, 1922, -1, 1926 }},
+    {{ 5256, 6351, 246, -1 }},
+    {{ 1920, -1, -1, 6376 }},
+    {{ 1944, -1, 1955, 248 }},
+    {{ -1, 249, 5426, 1966 }},
+    {{ 250, 5417, -1, 1230 }},
+    {{ 251, 5406, 5414, -1 }},
+    {{ 1218, -1, 1227, -1 }},
+    {{ -1, 1971, 253, 1987 }},
+    {{ 254, -1, 1977, 1982 }},
+    {{ 868, 255, 5527, -1 }},
+    {{ 256, 5523, -1, 20 }},
+    {{ 1317, -1, 1326, -1 }},
+    {{ -1, 352, 258, 2631 }},
+    {{ 2608, -1, 259, 2625 }},
+    {{ 357, -1, 2021, 260 }},
+    {{ -1, 261, 1656, 2028 }},
+    {{ -1, 3511, -1, 7182 }},
+    {{ 2043, -1, 2048, 263 }},
+    {{ -1, 264, 2948, 2057 }},
+    {{ 265, 5417, -1, 1230 }},
+    {{ -1, 414, 5414, -1 }},
+    {{ -1, 2061, 267, 2074 }},
+    {{ 268, -1, 2066, 2070 }},
+    {{ 868, 269, 5527, -1 }},
+    {{ -1, 415, -1, 20 }},
+    {{ 2085, 416, 271, -1 }},
+    {{ 3005, -1, 422, 272 }},
+    {{ -1, 8, 273, 3056 }},
+    {{ 431, -1, 2101, 274 }},
+    {{ -1, 275, 2109, 2112 }},
+    {{ -1, 5417, -1, 1230 }},
+    {{ -1, 277, 2182, 2187 }},
+    {{ 278, 2174, -1, 2178 }},
+    {{ 514, 3551, 279, -1 }},
+    {{ -1, -1, 656, 16 }},
+    {{ -1, 281, 689, 4521 }},
+    {{ 4466, 282, -1, 4498 }},
+    {{ 681, 684, -1, 283 }},
+    {{ -1, 1880, 284, 2202 }},
+    {{ -1, -1, 5235, 5240 }},
+    {{ 2213, 286, 294, -1 }},
+    {{ 2237, 2243, -1, 287 }},
+    {{ -1, 2256, 288, 291 }},
+    {{ 24, -1, 1421, 289 }},
+    {{ -1, 1426, 2261, 290 }},
+    {{ -1, 1370, -1, 7525 }},
+    {{ -1, 1445, 292, 1459 }},
+    {{ 522, -1, 2264, 293 }},
+    {{ -1, 1762, -1, 7952 }},
+    {{ 2265, -1, 2275, 295 }},
+    {{ -1, 296, 247, 1388 }},
+    {{ 29, 2285, -1, 297 }},
+    {{ -1, 185, 2009, 298 }},
+    {{ -1, 1384, -1, 6608 }},
+    {{ 2289, 2294, 300, -1 }},
+    {{ 1564, -1, 2306, 301 }},
+    {{ -1, 2310, 1570, 302 }},
+    {{ -1, 1575, 2314, 303 }},
+    {{ -1, 1404, -1, 8056 }},
+    {{ 2315, 2328, -1, 305 }},
+    {{ -1, 1633, 306, 2339 }},
+    {{ 2334, -1, 307, 3218 }},
+    {{ 461, -1, 2338, 308 }},
+    {{ -1, 3213, -1, 1213 }},
+    {{ 2356, -1, 2360, 310 }},
+    {{ -1, 261, 1718, 1722 }},
+    {{ 312, -1, 321, 2006 }},
+    {{ 2368, 313, 317, -1 }},
+    {{ 2381, 2386, -1, 314 }},
+    {{ -1, 2394, 12, 315 }},
+    {{ -1, 226, 2033, 316 }},
+    {{ -1, 1469, -1, 8056 }},
+    {{ 83, -1, 2398, 318 }},
+    {{ -1, 319, 689, 4521 }},
+    {{ 4466, 320, -1, 1821 }},
+    {{ 681, 684, -1, -1 }},
+    {{ 322, -1, 2417, 2431 }},
+    {{ 2403, 323, 2412, -1 }},
+    {{ 4583, 2408, -1, 324 }},
+    {{ -1, 325, 12, 1840 }},
+    {{ 711, 714, -1, -1 }},
+    {{ 2450, 2455, 327, -1 }},
+    {{ 312, -1, 2465, 328 }},
+    {{ -1, 2468, 2439, 329 }},
+    {{ -1, 1516, 2472, 330 }},
+    {{ -1, 1988, -1, 8056 }},
+    {{ 2473, 2482, -1, 332 }},
+    {{ -1, 352, 333, 2494 }},
+    {{ 2488, -1, 334, 1560 }},
+    {{ 357, -1, 2491, 335 }},
+    {{ -1, -1, -1, 1558 }},
+    {{ 2518, -1, 2522, 337 }},
+    {{ -1, 275, 2948, 2057 }},
+    {{ 339, 2547, -1, 347 }},
+    {{ 2523, 2534, 340, -1 }},
+    {{ 2539, -1, 341, 344 }},
+    {{ 423, -1, 427, 342 }},
+    {{ -1, 1868, 2543, 343 }},
+    {{ -1, 765, -1, 4999 }},
+    {{ -1, 8, 345, 1612 }},
+    {{ 431, -1, 2544, 346 }},
+    {{ -1, -1, -1, 1610 }},
+    {{ -1, 2570, 348, 2584 }},
+    {{ 349, -1, 2017, 3218 }},
+    {{ 2576, 19, 350, -1 }},
+    {{ 54, -1, 2580, 351 }},
+    {{ -1, 1164, -1, 6989 }},
+    {{ 353, 2602, -1, 205 }},
+    {{ 2590, 1666, 354, -1 }},
+    {{ 2597, -1, 355, 3317 }},
+    {{ 60, -1, 2601, 356 }},
+    {{ -1, 6008, -1, 6022 }},
+    {{ 2617, 3489, 358, -1 }},
+    {{ 2144, -1, 2620, 359 }},
+    {{ -1, -1, 689, 2623 }},
+    {{ 2648, 361, 365, -1 }},
+    {{ 546, 2659, -1, 362 }},
+    {{ -1, 3814, 363, 1787 }},
+    {{ 24, -1, 2664, 364 }},
+    {{ -1, -1, 179, 2667 }},
+    {{ 565, -1, 2668, 366 }},
+    {{ -1, 2676, 2680, 367 }},
+    {{ -1, 368, 3931, 1530 }},
+    {{ 854, -1, -1, 2684 }},
+    {{ 370, 2702, -1, 2031 }},
+    {{ 2686, 72, 371, -1 }},
+    {{ 593, -1, 2691, 372 }},
+    {{ -1, 4046, 2697, 373 }},
+    {{ -1, -1, 196, 2700 }},
+    {{ 2728, -1, 2733, 375 }},
+    {{ -1, 376, 4454, 2740 }},
+    {{ 678, 377, -1, 4900 }},
+    {{ 752, -1, -1, 2738 }},
+    {{ -1, 379, 1929, 1934 }},
+    {{ -1, 1922, -1, 1926 }},
+    {{ 2758, 381, 2769, -1 }},
+    {{ 546, 2762, -1, 382 }},
+    {{ -1, 4558, 2765, 383 }},
+    {{ -1, -1, 1450, 2768 }},
+    {{ -1, 385, 2182, 2187 }},
+    {{ -1, 2174, -1, 2178 }},
+    {{ 2795, -1, 2802, 387 }},
+    {{ -1, 388, 689, 2810 }},
+    {{ 2807, 389, -1, 4686 }},
+    {{ 681, -1, -1, 2809 }},
+    {{ 391, -1, 2837, 397 }},
+    {{ 2814, 392, 2832, -1 }},
+    {{ 2824, 393, -1, 395 }},
+    {{ 697, 4709, -1, 394 }},
+    {{ -1, -1, 1644, 2828 }},
+    {{ -1, 396, 12, 4728 }},
+    {{ 711, -1, -1, 2830 }},
+    {{ -1, 398, 2861, 2866 }},
+    {{ 399, 738, -1, 4778 }},
+    {{ 2856, 400, 15, -1 }},
+    {{ 92, -1, -1, 2859 }},
+    {{ -1, 1868, 402, 2039 }},
+    {{ 403, -1, 2882, 2036 }},
+    {{ 2871, 404, 5352, -1 }},
+    {{ 2877, 405, -1, 4927 }},
+    {{ 106, -1, -1, 2880 }},
+    {{ 2890, 2899, -1, 407 }},
+    {{ -1, 2910, 408, 2914 }},
+    {{ 409, -1, 5235, 5240 }},
+    {{ -1, 19, -1, -1 }},
+    {{ -1, 411, 2926, 2931 }},
+    {{ 412, 2918, -1, 2922 }},
+    {{ 5256, 6351, 413, -1 }},
+    {{ -1, -1, -1, 6376 }},
+    {{ -1, 794, -1, 802 }},
+    {{ -1, 1128, -1, 1134 }},
+    {{ 37, 2981, -1, 417 }},
+    {{ -1, 352, 418, 2995 }},
+    {{ 2608, -1, 419, 2990 }},
+    {{ 357, -1, 420, 260 }},
+    {{ 421, -1, 7111, 2090 }},
+    {{ 2988, -1, 2582, -1 }},
+    {{ 423, -1, 427, 2092 }},
+    {{ 3015, 3024, 424, -1 }},
+    {{ 2795, -1, 3029, 425 }},
+    {{ -1, 426, 689, 2810 }},
+    {{ 2807, -1, -1, 4686 }},
+    {{ 428, -1, 3037, 3044 }},
+    {{ 3033, 429, 2969, -1 }},
+    {{ 2824, 393, -1, 430 }},
+    {{ -1, -1, 12, 4728 }},
+    {{ 3048, 1945, 432, -1 }},
+    {{ 5353, -1, 3052, 433 }},
+    {{ -1, -1, 1168, 3055 }},
+    {{ 435, 3090, -1, 441 }},
+    {{ 3062, 3069, 436, -1 }},
+    {{ 3005, -1, 2115, 437 }},
+    {{ -1, 8, 438, 3086 }},
+    {{ 431, -1, 439, 274 }},
+    {{ 440, -1, 5385, 2120 }},
+    {{ 3084, -1, 2366, -1 }},
+    {{ -1, 3115, 442, 3138 }},
+    {{ 443, -1, 447, 3132 }},
+    {{ 3173, 19, 444, -1 }},
+    {{ 54, -1, 445, 2139 }},
+    {{ 446, -1, 6930, 2122 }},
+    {{ 3121, -1, 2582, -1 }},
+    {{ 448, -1, 3127, 2150 }},
+    {{ 462, 3489, 449, -1 }},
+    {{ 450, -1, 7068, 1186 }},
+    {{ 3123, -1, 3125, -1 }},
+    {{ 452, 3162, -1, 2126 }},
+    {{ 3153, 3291, 453, -1 }},
+    {{ 3304, -1, 454, 3158 }},
+    {{ 60, -1, 455, 969 }},
+    {{ 446, -1, 5995, 2124 }},
+    {{ 3183, 457, 3188, -1 }},
+    {{ 546, 3186, -1, -1 }},
+    {{ 3191, -1, 2620, 459 }},
+    {{ -1, -1, 689, 3195 }},
+    {{ 461, -1, 2147, 2150 }},
+    {{ 462, 3489, 2143, -1 }},
+    {{ 3197, 3203, 463, -1 }},
+    {{ 3207, -1, 3210, 464 }},
+    {{ -1, -1, 3912, 7020 }},
+    {{ -1, 2151, 466, 3269 }},
+    {{ 467, -1, 3259, 3616 }},
+    {{ 468, 3249, 3254, -1 }},
+    {{ 524, 1306, 469, -1 }},
+    {{ 470, -1, 7793, 7799 }},
+    {{ 3245, -1, 3247, -1 }},
+    {{ 3183, 472, 3188, -1 }},
+    {{ 546, 3313, -1, -1 }},
+    {{ 3191, -1, 2620, 474 }},
+    {{ -1, -1, 689, 3315 }},
+    {{ 476, 3332, -1, 3338 }},
+    {{ 3321, 982, 477, -1 }},
+    {{ 6102, -1, 478, 3328 }},
+    {{ 989, -1, 479, 2092 }},
+    {{ 480, -1, 6128, 6134 }},
+    {{ 3326, -1, 2582, -1 }},
+    {{ -1, 3348, 482, 3370 }},
+    {{ 483, -1, 3365, 1053 }},
+    {{ 484, 3360, 3363, -1 }},
+    {{ 1037, 1042, 485, -1 }},
+    {{ 486, -1, 1047, -1 }},
+    {{ 3245, -1, 3358, -1 }},
+    {{ 3376, 488, 491, -1 }},
+    {{ 3390, 3394, -1, 489 }},
+    {{ -1, 204, 490, 3701 }},
+    {{ 24, -1, 3398, -1 }},
+    {{ 3399, -1, 3403, 492 }},
+    {{ -1, 493, 3408, 494 }},
+    {{ 29, 1492, -1, -1 }},
+    {{ -1, -1, 1525, 1530 }},
+    {{ 496, 3420, -1, 6698 }},
+    {{ 3411, 1088, 497, -1 }},
+    {{ 6675, -1, 3415, 498 }},
+    {{ -1, 8, 3419, -1 }},
+    {{ 3425, 500, 3434, -1 }},
+    {{ 1797, 3429, -1, 501 }},
+    {{ -1, 79, 3432, -1 }},
+    {{ 3440, -1, 3446, 503 }},
+    {{ -1, 504, 1883, 3452 }},
+    {{ 3450, -1, -1, 4900 }},
+    {{ -1, 506, 3538, 3544 }},
+    {{ 507, 3528, -1, 1230 }},
+    {{ 508, 3518, 3523, -1 }},
+    {{ 1218, 158, 509, -1 }},
+    {{ 510, -1, 7294, 5742 }},
+    {{ 3516, -1, 3517, -1 }},
+    {{ -1, 512, 521, 3623 }},
+    {{ 513, 3563, -1, 3575 }},
+    {{ 514, 3551, 517, -1 }},
+    {{ 1263, 1266, 515, -1 }},
+    {{ 1271, -1, 516, 5742 }},
+    {{ 421, -1, 7592, 7597 }},
+    {{ 518, -1, 3558, 16 }},
+    {{ 1277, 1282, 519, -1 }},
+    {{ 520, -1, 1287, -1 }},
+    {{ 3123, -1, 3557, -1 }},
+    {{ 522, -1, 3606, 3616 }},
+    {{ 523, 527, 7846, -1 }},
+    {{ 524, 1306, 1313, -1 }},
+    {{ 3581, 3587, 525, -1 }},
+    {{ 3591, -1, 3594, 526 }},
+    {{ -1, -1, 6665, 1084 }},
+    {{ 528, 3601, -1, 20 }},
+    {{ 1317, 173, 529, -1 }},
+    {{ 530, -1, 7832, 2170 }},
+    {{ 3597, -1, 3599, -1 }},
+    {{ 3652, 532, 537, -1 }},
+    {{ 3675, 3686, -1, 533 }},
+    {{ -1, 204, 534, 3701 }},
+    {{ 24, -1, 3696, 535 }},
+    {{ -1, 3700, 179, 536 }},
+    {{ -1, -1, 1372, 7525 }},
+    {{ 3704, -1, 3709, 538 }},
+    {{ -1, 539, 3725, 542 }},
+    {{ 29, 1492, -1, 540 }},
+    {{ -1, 3722, 1503, 541 }},
+    {{ -1, -1, 1386, 6608 }},
+    {{ -1, 543, 1525, 1530 }},
+    {{ 854, 3730, -1, 544 }},
+    {{ -1, -1, 1973, 7758 }},
+    {{ 546, 555, -1, 560 }},
+    {{ 3731, 547, 551, -1 }},
+    {{ 37, 3744, -1, 548 }},
+    {{ -1, 352, 549, 2631 }},
+    {{ 2608, -1, 550, 1560 }},
+    {{ 357, -1, 2021, -1 }},
+    {{ 3749, -1, 3754, 552 }},
+    {{ -1, 8, 3762, 553 }},
+    {{ -1, 3766, 196, 554 }},
+    {{ -1, -1, 1406, 8056 }},
+    {{ 556, 3781, -1, 3795 }},
+    {{ 3767, 3772, 557, -1 }},
+    {{ 3005, -1, 3777, 558 }},
+    {{ -1, 8, 559, 1612 }},
+    {{ 431, -1, 2101, -1 }},
+    {{ -1, 3814, 2157, 561 }},
+    {{ -1, 562, 1450, 2162 }},
+    {{ 3833, 3837, -1, 563 }},
+    {{ -1, 1522, 564, 3843 }},
+    {{ -1, -1, 7748, 1053 }},
+    {{ 3846, 566, 3860, -1 }},
+    {{ 1797, 3851, -1, 567 }},
+    {{ -1, 79, 3855, 568 }},
+    {{ -1, 3859, 1806, 569 }},
+    {{ -1, -1, 1471, 8056 }},
+    {{ 3872, -1, 3885, 571 }},
+    {{ -1, 572, 1883, 3896 }},
+    {{ 3891, 573, -1, 4900 }},
+    {{ 752, 3895, -1, 574 }},
+    {{ -1, -1, 4895, 5245 }},
+    {{ 3901, 3905, -1, 576 }},
+    {{ -1, 3909, 284, 1916 }},
+    {{ 3935, 578, 582, -1 }},
+    {{ 299, 3946, -1, 579 }},
+    {{ -1, 3954, 3958, 580 }},
+    {{ -1, 2361, 581, 1459 }},
+    {{ 522, -1, -1, 3962 }},
+    {{ 312, -1, 3964, 583 }},
+    {{ -1, 584, 2439, 1548 }},
+    {{ 29, 3969, -1, 585 }},
+    {{ -1, 185, -1, 3972 }},
+    {{ 3995, 4000, -1, 587 }},
+    {{ -1, 2570, 588, 4007 }},
+    {{ 349, -1, 589, 3218 }},
+    {{ 461, -1, -1, 4005 }},
+    {{ -1, 3700, 591, 1740 }},
+    {{ -1, -1, 1733, 1737 }},
+    {{ 593, -1, 4040, 2170 }},
+    {{ 4025, 594, 42, -1 }},
+    {{ 370, 4030, -1, 595 }},
+    {{ -1, 4036, 12, 596 }},
+    {{ -1, 226, -1, 4039 }},
+    {{ 4052, 4056, 598, -1 }},
+    {{ 312, -1, 4064, 599 }},
+    {{ -1, 4067, 2976, 600 }},
+    {{ -1, 1516, -1, 4070 }},
+    {{ 4071, 4078, -1, 602 }},
+    {{ -1, 352, 603, 4086 }},
+    {{ 4083, -1, 604, 2990 }},
+    {{ 357, -1, -1, 4085 }},
+    {{ -1, 3766, 606, 2074 }},
+    {{ -1, -1, 2066, 2070 }},
+    {{ 608, 4127, -1, 614 }},
+    {{ 4108, 4116, 609, -1 }},
+    {{ 4121, -1, 610, 612 }},
+    {{ 423, -1, 3074, 611 }},
+    {{ -1, 1868, -1, 4124 }},
+    {{ -1, 8, 613, 3086 }},
+    {{ 431, -1, -1, 4126 }},
+    {{ -1, 4145, 615, 4155 }},
+    {{ 616, -1, 447, 3132 }},
+    {{ 4150, 19, 617, -1 }},
+    {{ 54, -1, -1, 4153 }},
+    {{ -1, 619, 1644, 626 }},
+    {{ 620, 4171, -1, 623 }},
+    {{ 4161, 3816, 621, -1 }},
+    {{ 4166, -1, 622, 3158 }},
+    {{ 60, -1, -1, 4169 }},
+    {{ -1, 3348, 624, 4180 }},
+    {{ 625, -1, 3170, 1053 }},
+    {{ -1, 3360, 3168, -1 }},
+    {{ -1, 627, 4191, 4192 }},
+    {{ 628, 4187, -1, 1446 }},
+    {{ 4184, 3551, 629, -1 }},
+    {{ -1, -1, 3242, 16 }},
+    {{ 4199, 631, 1671, -1 }},
+    {{ 3292, 4204, -1, 632 }},
+    {{ -1, 931, 633, 4209 }},
+    {{ 3299, -1, -1, 4208 }},
+    {{ 635, 4220, -1, 638 }},
+    {{ 4213, 4217, 636, -1 }},
+    {{ 6102, -1, 478, 637 }},
+    {{ -1, 8, -1, 4219 }},
+    {{ -1, 4229, 639, 4233 }},
+    {{ 640, -1, 641, 4230 }},
+    {{ 3341, 19, -1, -1 }},
+    {{ -1, -1, 2147, 6280 }},
+    {{ 643, 1922, -1, 4244 }},
+    {{ 4239, 6351, 644, -1 }},
+    {{ 3355, -1, -1, 4242 }},
+    {{ -1, 4261, 646, 4267 }},
+    {{ 647, -1, 4264, 6602 }},
+    {{ -1, 1942, 7846, -1 }},
+    {{ 4271, -1, 4280, 649 }},
+    {{ -1, 650, 4291, 4295 }},
+    {{ 651, 3511, -1, 7182 }},
+    {{ -1, -1, 15, -1 }},
+    {{ -1, 4299, 653, 4312 }},
+    {{ 654, -1, 4304, 4308 }},
+    {{ 7378, 655, 7406, -1 }},
+    {{ -1, -1, -1, 7401 }},
+    {{ -1, -1, 962, 969 }},
+    {{ 4323, 658, 4336, -1 }},
+    {{ 546, 4328, -1, 659 }},
+    {{ -1, 3814, 4332, 660 }},
+    {{ -1, 562, 1450, 661 }},
+    {{ -1, -1, 1775, 8056 }},
+    {{ 4374, -1, 4383, 663 }},
+    {{ -1, 664, 689, 4392 }},
+    {{ 4389, 665, -1, 1821 }},
+    {{ 681, 684, -1, 666 }},
+    {{ -1, -1, -1, 1819 }},
+    {{ 668, -1, 4419, 676 }},
+    {{ 4396, 669, 4413, -1 }},
+    {{ 4409, 670, -1, 673 }},
+    {{ 697, 701, -1, 671 }},
+    {{ -1, 706, 1644, 672 }},
+    {{ -1, -1, 4191, 4192 }},
+    {{ -1, 674, 12, 1840 }},
+    {{ 711, 714, -1, 675 }},
+    {{ -1, -1, -1, 1838 }},
+    {{ -1, 677, 4454, 4460 }},
+    {{ 678, 2198, -1, 4900 }},
+    {{ 4442, 679, 15, -1 }},
+    {{ 92, 746, -1, 680 }},
+    {{ -1, -1, 935, 5141 }},
+    {{ 4472, 682, 5194, -1 }},
+    {{ 813, 4475, -1, 683 }},
+    {{ -1, 5190, -1, 4477 }},
+    {{ 685, 4485, -1, 687 }},
+    {{ 4479, 4482, 686, -1 }},
+    {{ 3005, -1, 6163, -1 }},
+    {{ -1, 4491, 688, 4495 }},
+    {{ -1, -1, -1, 4494 }},
+    {{ 690, -1, 4516, 248 }},
+    {{ 4507, 691, 1950, -1 }},
+    {{ 4513, 692, -1, 5345 }},
+    {{ 106, 836, -1, 693 }},
+    {{ -1, -1, 6835, 6840 }},
+    {{ 4543, 695, 719, -1 }},
+    {{ 4583, 696, -1, 709 }},
+    {{ 697, 701, -1, 705 }},
+    {{ 4598, 698, 4609, -1 }},
+    {{ 4071, 4606, -1, 699 }},
+    {{ -1, 352, 700, 4086 }},
+    {{ 4083, -1, -1, 2990 }},
+    {{ 702, 4617, -1, 4623 }},
+    {{ 4614, 4547, 703, -1 }},
+    {{ 4121, -1, 610, 704 }},
+    {{ -1, 8, -1, 3086 }},
+    {{ -1, 706, 1644, 626 }},
+    {{ 4631, 4632, -1, 707 }},
+    {{ -1, 4637, 708, 3843 }},
+    {{ -1, -1, 3170, 1053 }},
+    {{ -1, 710, 12, 4664 }},
+    {{ 711, 714, -1, 80 }},
+    {{ 4640, 712, 1671, -1 }},
+    {{ 3292, 4644, -1, 713 }},
+    {{ -1, 931, -1, 4647 }},
+    {{ 715, 4653, -1, 717 }},
+    {{ 4648, 4651, 716, -1 }},
+    {{ 6102, -1, 478, -1 }},
+    {{ -1, 4659, 718, 4661 }},
+    {{ -1, -1, -1, 4660 }},
+    {{ 83, -1, 4673, 720 }},
+    {{ -1, 721, 689, 4691 }},
+    {{ 4466, 722, -1, 4686 }},
+    {{ 681, 723, -1, 283 }},
+    {{ 724, 4683, -1, 687 }},
+    {{ 4680, 4682, -1, -1 }},
+    {{ 726, -1, 4737, 732 }},
+    {{ 4701, 727, 4732, -1 }},
+    {{ 4583, 4708, -1, 728 }},
+    {{ -1, 729, 12, 4728 }},
+    {{ 711, 730, -1, 80 }},
+    {{ 731, 4726, -1, 717 }},
+    {{ 4724, 3924, -1, -1 }},
+    {{ -1, 733, 4784, 4789 }},
+    {{ 734, 738, -1, 4778 }},
+    {{ 4804, 735, 15, -1 }},
+    {{ 92, 736, -1, 802 }},
+    {{ 737, 4683, -1, 749 }},
+    {{ 4761, 4682, -1, -1 }},
+    {{ 739, 4772, -1, 4894 }},
+    {{ 753, 740, 5194, -1 }},
+    {{ 741, 4767, -1, 4878 }},
+    {{ 4763, 4765, -1, -1 }},
+    {{ 4816, 4819, 743, -1 }},
+    {{ 312, -1, 4822, -1 }},
+    {{ 4824, 4828, -1, 745 }},
+    {{ -1, 352, -1, 4831 }},
+    {{ 747, 4839, -1, 749 }},
+    {{ 4833, 4482, 748, -1 }},
+    {{ 4837, -1, -1, -1 }},
+    {{ -1, 4846, 750, 4847 }},
+    {{ -1, -1, 5828, 3218 }},
+    {{ 752, 4882, -1, 4894 }},
+    {{ 753, 756, 5194, -1 }},
+    {{ 4850, 754, 4862, -1 }},
+    {{ 4856, 4859, -1, 755 }},
+    {{ -1, 2344, -1, 6068 }},
+    {{ 757, 4872, -1, 4878 }},
+    {{ 4866, 4869, 758, -1 }},
+    {{ 2498, -1, 2512, -1 }},
+    {{ 760, -1, 4931, 4937 }},
+    {{ 4922, 761, 5352, -1 }},
+    {{ 5323, 762, -1, 4927 }},
+    {{ 106, 763, -1, 1134 }},
+    {{ 737, 4683, -1, 837 }},
+    {{ -1, 765, 4985, 4999 }},
+    {{ 766, 4972, -1, 5511 }},
+    {{ 767, 4959, 4967, -1 }},
+    {{ 856, 768, 1270, -1 }},
+    {{ 769, 4955, -1, 5467 }},
+    {{ 4951, 4953, -1, -1 }},
+    {{ 5006, 771, 775, -1 }},
+    {{ 5014, 5015, -1, 772 }},
+    {{ -1, 5020, 773, 774 }},
+    {{ 24, -1, 1421, -1 }},
+    {{ -1, 1445, -1, 1459 }},
+    {{ 5023, -1, 5024, 776 }},
+    {{ -1, 777, 247, 1388 }},
+    {{ 29, 5027, -1, -1 }},
+    {{ 5029, 5032, 779, -1 }},
+    {{ 1564, -1, 5038, 780 }},
+    {{ -1, 5040, 1570, -1 }},
+    {{ 5042, 5046, -1, 782 }},
+    {{ -1, 1633, 783, 5052 }},
+    {{ 5050, -1, -1, 3218 }},
+    {{ 785, -1, 5076, 5742 }},
+    {{ 5068, 786, 902, -1 }},
+    {{ 5713, 5071, -1, 787 }},
+    {{ -1, 5074, 12, -1 }},
+    {{ 5079, 5083, 789, -1 }},
+    {{ 312, -1, 5087, 790 }},
+    {{ -1, 4604, 2439, -1 }},
+    {{ 5090, 4606, -1, 792 }},
+    {{ -1, 352, 793, 5098 }},
+    {{ 5096, -1, -1, 1560 }},
+    {{ 795, 5119, -1, 799 }},
+    {{ 5110, 4547, 796, -1 }},
+    {{ 5116, -1, 797, 798 }},
+    {{ 423, -1, 427, -1 }},
+    {{ -1, 8, -1, 1612 }},
+    {{ -1, 5127, 800, 5130 }},
+    {{ 801, -1, 5828, 3218 }},
+    {{ 5128, 19, -1, -1 }},
+    {{ -1, 803, 935, 5141 }},
+    {{ 804, 5138, -1, 205 }},
+    {{ 5133, 1666, 805, -1 }},
+    {{ 5136, -1, -1, 3317 }},
+    {{ 807, 816, -1, 821 }},
+    {{ 808, 812, 5194, -1 }},
+    {{ 5144, 809, 5163, -1 }},
+    {{ 5155, 5159, -1, 810 }},
+    {{ -1, 2344, 811, 6068 }},
+    {{ 24, -1, 309, -1 }},
+    {{ 813, 5179, -1, 5189 }},
+    {{ 5172, 5176, 814, -1 }},
+    {{ 2498, -1, 2512, 815 }},
+    {{ -1, 8, 336, -1 }},
+    {{ 5210, 5211, -1, 817 }},
+    {{ -1, 5217, 818, 5218 }},
+    {{ 819, -1, 1010, 6209 }},
+    {{ 3173, 19, 820, -1 }},
+    {{ 54, -1, -1, 2139 }},
+    {{ -1, 822, 5227, 5245 }},
+    {{ 823, 5221, -1, 5224 }},
+    {{ 6227, 3291, 824, -1 }},
+    {{ 3304, -1, 825, 6232 }},
+    {{ 60, -1, -1, 969 }},
+    {{ -1, 5254, 827, 5295 }},
+    {{ 828, -1, 5285, 1053 }},
+    {{ 829, 5272, 5280, -1 }},
+    {{ 1037, 830, 134, -1 }},
+    {{ 831, 5270, -1, 6698 }},
+    {{ 5268, 5269, -1, -1 }},
+    {{ 4816, 4819, 833, -1 }},
+    {{ 312, -1, 5334, -1 }},
+    {{ 4824, 4828, -1, 835 }},
+    {{ -1, 352, -1, 5335 }},
+    {{ 747, 5337, -1, 837 }},
+    {{ -1, 5341, 838, 5342 }},
+    {{ -1, -1, 447, 3132 }},
+    {{ 840, -1, 5385, 5391 }},
+    {{ 5370, 841, 1185, -1 }},
+    {{ 7024, 842, -1, 5380 }},
+    {{ 1175, 843, -1, 705 }},
+    {{ 844, 5377, -1, 7056 }},
+    {{ 5375, 4682, -1, -1 }},
+    {{ -1, 846, 5426, 5436 }},
+    {{ 847, 5417, -1, 1230 }},
+    {{ 848, 5406, 5414, -1 }},
+    {{ 1218, 849, 1227, -1 }},
+    {{ 850, 851, -1, -1 }},
+    {{ 4951, 5402, -1, -1 }},
+    {{ 4956, 5404, -1, -1 }},
+    {{ -1, 853, 866, 5552 }},
+    {{ 854, 5493, -1, 5511 }},
+    {{ 855, 5471, 862, -1 }},
+    {{ 856, 859, 1270, -1 }},
+    {{ 5443, 857, 5453, -1 }},
+    {{ 5449, 5450, -1, 858 }},
+    {{ -1, 5618, -1, 881 }},
+    {{ 860, 5461, -1, 5467 }},
+    {{ 5455, 5458, 861, -1 }},
+    {{ 1564, -1, 5654, -1 }},
+    {{ 863, -1, 5488, 16 }},
+    {{ 1277, 864, 168, -1 }},
+    {{ 865, 5485, -1, 2031 }},
+    {{ 5481, 5483, -1, -1 }},
+    {{ 867, -1, 5533, 5547 }},
+    {{ 868, 871, 5527, -1 }},
+    {{ 1303, 869, 1313, -1 }},
+    {{ 1307, 870, -1, 6698 }},
+    {{ 724, 5519, -1, 7789 }},
+    {{ 872, 5523, -1, 20 }},
+    {{ 1317, 873, 1326, -1 }},
+    {{ 874, 875, -1, -1 }},
+    {{ 4763, 5521, -1, -1 }},
+    {{ 4768, 5522, -1, -1 }},
+    {{ 5584, 877, 883, -1 }},
+    {{ 5603, 5608, -1, 878 }},
+    {{ -1, 5618, 879, 881 }},
+    {{ 24, -1, 1421, 880 }},
+    {{ -1, 1426, 5622, -1 }},
+    {{ -1, 1445, 882, 1459 }},
+    {{ 522, -1, 5624, -1 }},
+    {{ 5625, -1, 5631, 884 }},
+    {{ -1, 885, 247, 1388 }},
+    {{ 29, 5638, -1, 886 }},
+    {{ -1, 185, 1546, -1 }},
+    {{ 5641, 5646, 888, -1 }},
+    {{ 1564, -1, 5654, 889 }},
+    {{ -1, 5658, 1570, 890 }},
+    {{ -1, 1575, 5660, -1 }},
+    {{ 5661, 5669, -1, 892 }},
+    {{ -1, 1633, 893, 5678 }},
+    {{ 5674, -1, 894, 3218 }},
+    {{ 461, -1, 5677, -1 }},
+    {{ 5693, -1, 5694, 896 }},
+    {{ -1, -1, 1718, 1722 }},
+    {{ 898, -1, 905, 5742 }},
+    {{ 5706, 899, 902, -1 }},
+    {{ 5713, 5716, -1, 900 }},
+    {{ -1, 5722, 12, 901 }},
+    {{ -1, 226, 1568, -1 }},
+    {{ 83, -1, 3029, 903 }},
+    {{ -1, 904, 689, 4521 }},
+    {{ 4466, -1, -1, 1821 }},
+    {{ 906, -1, 5731, 5737 }},
+    {{ 5725, 907, 2969, -1 }},
+    {{ 4583, 5728, -1, 908 }},
+    {{ -1, -1, 12, 1840 }},
+    {{ 5748, 5753, 910, -1 }},
+    {{ 312, -1, 5758, 911 }},
+    {{ -1, 3739, 2439, 912 }},
+    {{ -1, 1516, 5761, -1 }},
+    {{ 5762, 3744, -1, 914 }},
+    {{ -1, 352, 915, 5774 }},
+    {{ 5770, -1, 916, 1560 }},
+    {{ 357, -1, 5773, -1 }},
+    {{ 3290, -1, 5795, 918 }},
+    {{ -1, -1, 2948, 2057 }},
+    {{ 920, 5812, -1, 926 }},
+    {{ 5798, 3772, 921, -1 }},
+    {{ 5806, -1, 922, 924 }},
+    {{ 423, -1, 427, 923 }},
+    {{ -1, 1868, 5810, -1 }},
+    {{ -1, 8, 925, 1612 }},
+    {{ 431, -1, 5811, -1 }},
+    {{ -1, 5823, 927, 5832 }},
+    {{ 928, -1, 5828, 3218 }},
+    {{ 5824, 19, 929, -1 }},
+    {{ 54, -1, 5827, -1 }},
+    {{ -1, 931, 935, 5874 }},
+    {{ 932, 5847, -1, 205 }},
+    {{ 5837, 1666, 933, -1 }},
+    {{ 5843, -1, 934, 3317 }},
+    {{ 60, -1, 5846, -1 }},
+    {{ 5852, -1, 936, 5869 }},
+    {{ 937, -1, 5865, 260 }},
+    {{ 5858, 3489, 938, -1 }},
+    {{ 5861, -1, 5863, -1 }},
+    {{ 5889, 940, 942, -1 }},
+    {{ 5899, 5903, -1, 941 }},
+    {{ -1, 3814, 490, 1787 }},
+    {{ 3485, -1, 5906, 943 }},
+    {{ -1, 944, 5912, 945 }},
+    {{ 29, 575, -1, -1 }},
+    {{ -1, -1, 3931, 1530 }},
+    {{ 947, 5919, -1, 2031 }},
+    {{ 5915, 72, 948, -1 }},
+    {{ 593, -1, 5918, 949 }},
+    {{ -1, 4046, 3419, -1 }},
+    {{ 5924, 951, 5929, -1 }},
+    {{ 4346, 5927, -1, 952 }},
+    {{ -1, 4369, 3432, -1 }},
+    {{ 5934, -1, 5936, 954 }},
+    {{ -1, 955, 4454, 5941 }},
+    {{ 5940, -1, -1, 4900 }},
+    {{ 5951, 957, 5958, -1 }},
+    {{ 546, 5955, -1, 958 }},
+    {{ -1, 4558, 3018, -1 }},
+    {{ 5975, -1, 3029, 960 }},
+    {{ -1, 961, 689, 5983 }},
+    {{ 5981, -1, -1, 4686 }},
+    {{ 963, -1, 5995, 966 }},
+    {{ 5986, 964, 2969, -1 }},
+    {{ 5992, 965, -1, 430 }},
+    {{ 697, 4709, -1, -1 }},
+    {{ -1, 967, 3045, 6005 }},
+    {{ 968, 738, -1, 4778 }},
+    {{ 6003, -1, 15, -1 }},
+    {{ -1, 6008, 970, 6022 }},
+    {{ 971, -1, 6019, 2036 }},
+    {{ 6013, 972, 5352, -1 }},
+    {{ 6017, -1, -1, 4927 }},
+    {{ 6025, -1, 6029, 974 }},
+    {{ -1, 975, 6037, 6040 }},
+    {{ 976, 5417, -1, 1230 }},
+    {{ -1, -1, 5414, -1 }},
+    {{ -1, 6043, 978, 6057 }},
+    {{ 979, -1, 6051, 6054 }},
+    {{ 868, 980, 5527, -1 }},
+    {{ -1, -1, -1, 20 }},
+    {{ 6065, 982, 987, -1 }},
+    {{ 37, 6085, -1, 983 }},
+    {{ -1, 352, 984, 6095 }},
+    {{ 2608, -1, 985, 6091 }},
+    {{ 357, -1, 986, 260 }},
+    {{ -1, -1, 7111, 2090 }},
+    {{ 6102, -1, 988, 995 }},
+    {{ 989, -1, 992, 2092 }},
+    {{ 6112, 6118, 990, -1 }},
+    {{ 6122, -1, 2620, 991 }},
+    {{ -1, -1, 689, 2810 }},
+    {{ 993, -1, 6128, 6134 }},
+    {{ 6125, 994, 3076, -1 }},
+    {{ 2824, 393, -1, -1 }},
+    {{ -1, 8, 996, 6148 }},
+    {{ 997, -1, 6144, 274 }},
+    {{ 6138, 1945, 998, -1 }},
+    {{ 6141, -1, 6143, -1 }},
+    {{ 1000, 6176, -1, 1005 }},
+    {{ 6153, 6158, 1001, -1 }},
+    {{ 3005, -1, 6163, 1002 }},
+    {{ -1, 8, 1003, 6173 }},
+    {{ 431, -1, 1004, 274 }},
+    {{ -1, -1, 5385, 2120 }},
+    {{ -1, 6199, 1006, 6214 }},
+    {{ 1007, -1, 1010, 6209 }},
+    {{ 3173, 19, 1008, -1 }},
+    {{ 54, -1, 1009, 2139 }},
+    {{ -1, -1, 6930, 2122 }},
+    {{ 1011, -1, 6205, 2150 }},
+    {{ 462, 3489, 1012, -1 }},
+    {{ -1, -1, 7068, 1186 }},
+    {{ 1014, 6236, -1, 6242 }},
+    {{ 6227, 3291, 1015, -1 }},
+    {{ 3304, -1, 1016, 6232 }},
+    {{ 60, -1, 1017, 969 }},
+    {{ -1, -1, 5995, 2124 }},
+    {{ 1019, -1, 2147, 6280 }},
+    {{ 1020, 3489, 6276, -1 }},
+    {{ 6265, 6269, 1021, -1 }},
+    {{ 6272, -1, 6274, -1 }},
+    {{ -1, 6302, 1023, 6330 }},
+    {{ 1024, -1, 6322, 3616 }},
+    {{ 1025, 6315, 6319, -1 }},
+    {{ 524, 1306, 1026, -1 }},
+    {{ -1, -1, 7793, 7799 }},
+    {{ 1028, 6389, -1, 6395 }},
+    {{ 6380, 982, 1029, -1 }},
+    {{ 6102, -1, 1030, 6385 }},
+    {{ 989, -1, 1031, 2092 }},
+    {{ -1, -1, 6128, 6134 }},
+    {{ -1, 6405, 1033, 6425 }},
+    {{ 1034, -1, 6420, 1053 }},
+    {{ 1035, 6415, 6418, -1 }},
+    {{ 1037, 1042, 1036, -1 }},
+    {{ -1, -1, 1047, -1 }},
+    {{ 6431, 1038, 1040, -1 }},
+    {{ 6437, 6438, -1, 1039 }},
+    {{ -1, 204, -1, 3701 }},
+    {{ 3591, -1, 6441, 1041 }},
+    {{ -1, -1, 6445, -1 }},
+    {{ 1043, 6451, -1, 6698 }},
+    {{ 6447, 1088, 1044, -1 }},
+    {{ 6675, -1, 6449, -1 }},
+    {{ 6454, 1046, 6459, -1 }},
+    {{ 1797, 6457, -1, -1 }},
+    {{ 6462, -1, 6464, 1048 }},
+    {{ -1, -1, 1883, 6467 }},
+    {{ 1050, -1, 1152, 1163 }},
+    {{ 6476, 1051, 6484, -1 }},
+    {{ 6480, 6481, -1, 1052 }},
+    {{ -1, 1146, -1, -1 }},
+    {{ -1, 1054, 6538, 6544 }},
+    {{ 1055, 6530, -1, 1230 }},
+    {{ 1056, 6522, 6526, -1 }},
+    {{ 1218, 158, 1057, -1 }},
+    {{ -1, -1, 7294, 5742 }},
+    {{ -1, 1059, 1067, 6608 }},
+    {{ 1060, 6558, -1, 6570 }},
+    {{ 1061, 6550, 1064, -1 }},
+    {{ 1263, 1266, 1062, -1 }},
+    {{ 1271, -1, 1063, 5742 }},
+    {{ -1, -1, 7592, 7597 }},
+    {{ 1065, -1, 6555, 16 }},
+    {{ 1277, 1282, 1066, -1 }},
+    {{ -1, -1, 1287, -1 }},
+    {{ 1068, -1, 6595, 6602 }},
+    {{ 1069, 1072, 7846, -1 }},
+    {{ 1070, 1306, 6587, -1 }},
+    {{ 6576, 6581, 1071, -1 }},
+    {{ 6583, -1, 6585, -1 }},
+    {{ 1073, 6591, -1, 20 }},
+    {{ 1317, 173, 1074, -1 }},
+    {{ -1, -1, 7832, 2170 }},
+    {{ 6634, 1076, 1080, -1 }},
+    {{ 6643, 6645, -1, 1077 }},
+    {{ -1, 204, 1078, 3701 }},
+    {{ 24, -1, 6650, 1079 }},
+    {{ -1, 6653, 179, -1 }},
+    {{ 6654, -1, 6655, 1081 }},
+    {{ -1, 1082, 6665, 1084 }},
+    {{ 29, 1492, -1, 1083 }},
+    {{ -1, 6663, 1503, -1 }},
+    {{ -1, 1085, 1525, 1530 }},
+    {{ 854, 6669, -1, -1 }},
+    {{ 1087, 1094, -1, 6698 }},
+    {{ 6670, 1088, 1091, -1 }},
+    {{ 37, 4606, -1, 1089 }},
+    {{ -1, 352, 1090, 2631 }},
+    {{ 2608, -1, -1, 1560 }},
+    {{ 6675, -1, 6678, 1092 }},
+    {{ -1, 8, 6682, 1093 }},
+    {{ -1, 6685, 196, -1 }},
+    {{ 1095, 6689, -1, 6695 }},
+    {{ 6686, 4547, 1096, -1 }},
+    {{ 3005, -1, 5663, 798 }},
+    {{ 6705, 1098, 6714, -1 }},
+    {{ 1797, 6708, -1, 1099 }},
+    {{ -1, 79, 6710, 1100 }},
+    {{ -1, 6713, 1806, -1 }},
+    {{ 6722, -1, 6727, 1102 }},
+    {{ -1, 1103, 1883, 6736 }},
+    {{ 6732, 1104, -1, 4900 }},
+    {{ 752, 6735, -1, -1 }},
+    {{ 6740, 6743, -1, 1106 }},
+    {{ -1, 3909, -1, 1916 }},
+    {{ 6765, 1108, 1111, -1 }},
+    {{ 5155, 6771, -1, 1109 }},
+    {{ -1, 6776, 811, 1110 }},
+    {{ -1, 2361, -1, 1459 }},
+    {{ 6779, -1, 6780, 1112 }},
+    {{ -1, 777, 2439, 1548 }},
+    {{ 5172, 6782, 1114, -1 }},
+    {{ 2498, -1, 6787, 1115 }},
+    {{ -1, 5040, 336, -1 }},
+    {{ 6788, 6791, -1, 1117 }},
+    {{ -1, 2570, 1118, 6795 }},
+    {{ 5187, -1, -1, 3218 }},
+    {{ 1120, -1, 6808, 2170 }},
+    {{ 6804, 1121, 42, -1 }},
+    {{ 370, 6807, -1, 787 }},
+    {{ 5079, 5083, 1123, -1 }},
+    {{ 312, -1, 6813, 1124 }},
+    {{ -1, 4604, 2976, -1 }},
+    {{ 5090, 4606, -1, 1126 }},
+    {{ -1, 352, 1127, 6814 }},
+    {{ 5096, -1, -1, 2990 }},
+    {{ 1129, 6824, -1, 1132 }},
+    {{ 5110, 4547, 1130, -1 }},
+    {{ 5116, -1, 1131, 704 }},
+    {{ 423, -1, 3074, -1 }},
+    {{ -1, 6828, 1133, 6829 }},
+    {{ 801, -1, 447, 3132 }},
+    {{ -1, 1135, 6835, 6840 }},
+    {{ 1136, 6832, -1, 623 }},
+    {{ 5133, 3816, 1137, -1 }},
+    {{ 5136, -1, -1, 3158 }},
+    {{ -1, 1139, 6849, 6855 }},
+    {{ 1140, 6843, -1, 6846 }},
+    {{ 514, 3551, 1141, -1 }},
+    {{ -1, -1, -1, 16 }},
+    {{ 6863, 1143, 6873, -1 }},
+    {{ 546, 6868, -1, 1144 }},
+    {{ -1, 3814, 2371, 1145 }},
+    {{ -1, 6872, 1450, -1 }},
+    {{ 6895, 6898, -1, 1147 }},
+    {{ -1, 4371, -1, 645 }},
+    {{ 6900, -1, 2398, 1149 }},
+    {{ -1, 1150, 689, 6912 }},
+    {{ 6908, 1151, -1, 1821 }},
+    {{ 681, 6911, -1, -1 }},
+    {{ 1153, -1, 6930, 1159 }},
+    {{ 6916, 1154, 2412, -1 }},
+    {{ 6924, 1155, -1, 1157 }},
+    {{ 697, 701, -1, 1156 }},
+    {{ -1, 6928, 1644, -1 }},
+    {{ -1, 1158, 12, 1840 }},
+    {{ 711, 6929, -1, -1 }},
+    {{ -1, 1160, 6949, 6950 }},
+    {{ 1161, 6945, -1, 4900 }},
+    {{ 6941, 1162, 15, -1 }},
+    {{ 92, 6944, -1, -1 }},
+    {{ -1, 1164, 1168, 6989 }},
+    {{ 6955, 1165, -1, 6969 }},
+    {{ 1166, 684, -1, 283 }},
+    {{ 6963, 1167, 5194, -1 }},
+    {{ 6966, 6967, -1, -1 }},
+    {{ 1169, -1, 6984, 248 }},
+    {{ 6974, 1170, 1950, -1 }},
+    {{ 6980, 1171, -1, 5345 }},
+    {{ 106, 6983, -1, -1 }},
+    {{ 7004, 1173, 1185, -1 }},
+    {{ 7024, 1174, -1, 1181 }},
+    {{ 1175, 1178, -1, 705 }},
+    {{ 7034, 1176, 7043, -1 }},
+    {{ 7040, 4828, -1, 1177 }},
+    {{ -1, 352, -1, 4086 }},
+    {{ 1179, 7050, -1, 7056 }},
+    {{ 7047, 4482, 1180, -1 }},
+    {{ 4121, -1, 610, -1 }},
+    {{ -1, 1182, 12, 7063 }},
+    {{ 1183, 714, -1, 80 }},
+    {{ 7058, 1184, 1671, -1 }},
+    {{ 4505, 7061, -1, -1 }},
+    {{ 83, -1, 7068, 1186 }},
+    {{ -1, 1187, 689, 7078 }},
+    {{ 4466, 1188, -1, 7074 }},
+    {{ 681, 1189, -1, 283 }},
+    {{ -1, 4683, -1, 687 }},
+    {{ 1191, -1, 7111, 1196 }},
+    {{ 7086, 1192, 7106, -1 }},
+    {{ 4583, 7092, -1, 1193 }},
+    {{ -1, 1194, 12, 7102 }},
+    {{ 711, 1195, -1, 80 }},
+    {{ -1, 4726, -1, 717 }},
+    {{ -1, 1197, 7142, 7147 }},
+    {{ 1198, 1201, -1, 7137 }},
+    {{ 4804, 1199, 15, -1 }},
+    {{ 92, 1200, -1, 802 }},
+    {{ -1, 4683, -1, 749 }},
+    {{ 1202, 7133, -1, 4894 }},
+    {{ 753, 1203, 5194, -1 }},
+    {{ -1, 4767, -1, 4878 }},
+    {{ 1205, 4882, -1, 7177 }},
+    {{ 1206, 756, 5194, -1 }},
+    {{ 7168, 1207, 7174, -1 }},
+    {{ 4979, 7172, -1, -1 }},
+    {{ 1209, -1, 7208, 7214 }},
+    {{ 7199, 1210, 5352, -1 }},
+    {{ 5323, 1211, -1, 7204 }},
+    {{ 106, 1212, -1, 1134 }},
+    {{ -1, 4683, -1, 837 }},
+    {{ -1, 1214, 7242, 7255 }},
+    {{ 1215, 7234, -1, 5511 }},
+    {{ 1216, 7227, 7230, -1 }},
+    {{ 856, 1217, 1270, -1 }},
+    {{ -1, 4955, -1, 5467 }},
+    {{ 7261, 1219, 1221, -1 }},
+    {{ 5449, 7267, -1, 1220 }},
+    {{ -1, 7271, -1, -1 }},
+    {{ 7273, -1, 7274, 1222 }},
+    {{ -1, -1, 247, 1388 }},
+    {{ 5455, 7277, 1224, -1 }},
+    {{ 1564, -1, 7280, -1 }},
+    {{ 7282, 7284, -1, 1226 }},
+    {{ -1, 1633, -1, 7287 }},
+    {{ 1228, -1, 7294, 5742 }},
+    {{ 7289, 1229, 902, -1 }},
+    {{ 5713, 7292, -1, -1 }},
+    {{ -1, 7350, 1231, 7372 }},
+    {{ 1232, -1, 7364, 1053 }},
+    {{ 1233, 7356, 7360, -1 }},
+    {{ 1037, 1234, 134, -1 }},
+    {{ -1, 5270, -1, 6698 }},
+    {{ 1236, -1, 7429, 7435 }},
+    {{ 7420, 1237, 1185, -1 }},
+    {{ 7024, 1238, -1, 7425 }},
+    {{ 1175, 1239, -1, 705 }},
+    {{ -1, 5377, -1, 7056 }},
+    {{ -1, 1241, 7457, 7467 }},
+    {{ 1242, 7451, -1, 1230 }},
+    {{ 1243, 7445, 7448, -1 }},
+    {{ 1218, 1244, 1227, -1 }},
+    {{ -1, 851, -1, -1 }},
+    {{ -1, 1246, 1254, 7525 }},
+    {{ 1247, 7486, -1, 7493 }},
+    {{ 1248, 5471, 1251, -1 }},
+    {{ 1249, 859, 1270, -1 }},
+    {{ 7473, 1250, 7480, -1 }},
+    {{ 5561, 7478, -1, -1 }},
+    {{ 1252, -1, 7482, 16 }},
+    {{ 1277, 1253, 168, -1 }},
+    {{ -1, 5485, -1, 2031 }},
+    {{ 1255, -1, 7507, 7520 }},
+    {{ 1256, 1259, 7502, -1 }},
+    {{ 1303, 1257, 1313, -1 }},
+    {{ 1307, 1258, -1, 6698 }},
+    {{ -1, 5519, -1, 7789 }},
+    {{ 1260, 7499, -1, 20 }},
+    {{ 1317, 1261, 1326, -1 }},
+    {{ -1, 875, -1, -1 }},
+    {{ 1263, 1266, 1270, -1 }},
+    {{ 7550, 1264, 7559, -1 }},
+    {{ 5014, 7556, -1, 1265 }},
+    {{ -1, 5618, 773, 881 }},
+    {{ 1267, 7568, -1, 7574 }},
+    {{ 5029, 7565, 1268, -1 }},
+    {{ 1564, -1, 5654, 1269 }},
+    {{ -1, 5658, 1570, -1 }},
+    {{ 1271, -1, 1274, 5742 }},
+    {{ 7581, 7585, 1272, -1 }},
+    {{ 2144, -1, 2620, 1273 }},
+    {{ -1, -1, 689, 4521 }},
+    {{ 1275, -1, 7592, 7597 }},
+    {{ 7589, 1276, 3076, -1 }},
+    {{ 4583, 5728, -1, -1 }},
+    {{ 7617, 1278, 1280, -1 }},
+    {{ 7623, 7624, -1, 1279 }},
+    {{ -1, 3814, -1, 1787 }},
+    {{ 3207, -1, 7627, 1281 }},
+    {{ -1, -1, 7630, -1 }},
+    {{ 1283, 7635, -1, 2031 }},
+    {{ 7631, 72, 1284, -1 }},
+    {{ 593, -1, 7634, -1 }},
+    {{ 7639, 1286, 7644, -1 }},
+    {{ 4346, 7642, -1, -1 }},
+    {{ 7647, -1, 7649, 1288 }},
+    {{ -1, -1, 4454, 6467 }},
+    {{ 1290, 7703, -1, 7709 }},
+    {{ 7669, 982, 1291, -1 }},
+    {{ 7682, -1, 1292, 7700 }},
+    {{ 1293, -1, 992, 2092 }},
+    {{ 7691, 7695, 1294, -1 }},
+    {{ 7698, -1, 5863, -1 }},
+    {{ -1, 7721, 1296, 7758 }},
+    {{ 1297, -1, 7748, 1053 }},
+    {{ 1298, 7738, 7743, -1 }},
+    {{ 1299, 1042, 134, -1 }},
+    {{ 7732, 1300, 1301, -1 }},
+    {{ 7733, 7734, -1, -1 }},
+    {{ 6583, -1, 7736, -1 }},
+    {{ 1303, 1306, 1313, -1 }},
+    {{ 7764, 7770, 1304, -1 }},
+    {{ 3399, -1, 7776, 1305 }},
+    {{ -1, 493, 6665, 1084 }},
+    {{ 1307, 1310, -1, 6698 }},
+    {{ 7779, 1308, 7783, -1 }},
+    {{ 4888, 4828, -1, 1309 }},
+    {{ -1, 352, -1, 2631 }},
+    {{ 1311, 7786, -1, 7789 }},
+    {{ 4479, 4482, 1312, -1 }},
+    {{ 3005, -1, 5663, -1 }},
+    {{ 1314, -1, 7793, 7799 }},
+    {{ 3425, 1315, 7790, -1 }},
+    {{ 1797, 6708, -1, 1316 }},
+    {{ -1, 79, 6710, -1 }},
+    {{ 7807, 1318, 1320, -1 }},
+    {{ 4856, 7812, -1, 1319 }},
+    {{ -1, 7815, -1, -1 }},
+    {{ 7816, -1, 7817, 1321 }},
+    {{ -1, -1, 2439, 1548 }},
+    {{ 4866, 7819, 1323, -1 }},
+    {{ 2498, -1, 7822, -1 }},
+    {{ 7823, 7825, -1, 1325 }},
+    {{ -1, 2570, -1, 7287 }},
+    {{ 1327, -1, 7832, 2170 }},
+    {{ 7828, 1328, 42, -1 }},
+    {{ 370, 7831, -1, -1 }},
+    {{ 1330, -1, 7899, 7906 }},
+    {{ 7868, 1331, 1185, -1 }},
+    {{ 7877, 1332, -1, 7896 }},
+    {{ 1333, 1178, -1, 705 }},
+    {{ 7886, 1334, 7893, -1 }},
+    {{ 7890, 7892, -1, -1 }},
+    {{ -1, 1336, 7941, 7952 }},
+    {{ 1337, 7931, -1, 1230 }},
+    {{ 1338, 7923, 7927, -1 }},
+    {{ 1339, 158, 1227, -1 }},
+    {{ 7732, 1340, 1341, -1 }},
+    {{ 5561, 7918, -1, -1 }},
+    {{ 7920, -1, 7921, -1 }},
+    {{ -1, 1343, 1353, 8056 }},
+    {{ 1344, 7988, -1, 8002 }},
+    {{ 1345, 7973, 1348, -1 }},
+    {{ 7957, 1266, 1346, -1 }},
+    {{ 1347, -1, 1274, 5742 }},
+    {{ 7968, 7971, 938, -1 }},
+    {{ 1349, -1, 7983, 16 }},
+    {{ 1350, 1282, 168, -1 }},
+    {{ 7979, 1351, 1352, -1 }},
+    {{ 7981, 3186, -1, -1 }},
+    {{ 6272, -1, 7982, -1 }},
+    {{ 1354, -1, 8037, 8051 }},
+    {{ 1355, 1359, 8031, -1 }},
+    {{ 8007, 1356, 1313, -1 }},
+    {{ 1357, 1310, -1, 6698 }},
+    {{ 8018, 1358, 8021, -1 }},
+    {{ 4537, 7892, -1, -1 }},
+    {{ 1360, 8027, -1, 20 }},
+    {{ 1361, 173, 1326, -1 }},
+    {{ 8023, 1362, 1363, -1 }},
+    {{ 4979, 8025, -1, -1 }},
+    {{ 8026, -1, 4822, -1 }},
+    {{ 1364, 1365, 1379, -1 }},
+    {{ 1393, 1408, -1, 1366 }},
+    {{ -1, 204, 1367, 1374 }},
+    {{ 24, -1, 1421, 1368 }},
+    {{ -1, 1426, 179, 1369 }},
+    {{ -1, 1370, 1372, 7525 }},
+    {{ 1371, 7486, -1, 7493 }},
+    {{ 3547, 5471, -1, -1 }},
+    {{ 1373, -1, 7507, 7520 }},
+    {{ -1, -1, 7502, -1 }},
+    {{ -1, 1445, 1375, 1459 }},
+    {{ 522, -1, 1451, 1376 }},
+    {{ -1, 1762, 1377, 7952 }},
+    {{ 1378, -1, 1235, 1240 }},
+    {{ 7943, -1, 7406, -1 }},
+    {{ 1464, -1, 1479, 1380 }},
+    {{ -1, 1381, 247, 1388 }},
+    {{ 29, 1492, -1, 1382 }},
+    {{ -1, 185, 1503, 1383 }},
+    {{ -1, 1384, 1386, 6608 }},
+    {{ 1385, 6558, -1, 6570 }},
+    {{ -1, 6550, -1, -1 }},
+    {{ 1387, -1, 6595, 6602 }},
+    {{ 5298, -1, 7846, -1 }},
+    {{ -1, 1389, 1525, 1530 }},
+    {{ 854, 1517, -1, 1390 }},
+    {{ -1, 1391, 1973, 7758 }},
+    {{ 1392, 1027, -1, 1032 }},
+    {{ 7723, 6351, -1, -1 }},
+    {{ 1535, 1394, 1400, -1 }},
+    {{ 37, 1552, -1, 1395 }},
+    {{ -1, 352, 1396, 2631 }},
+    {{ 2608, -1, 1397, 1560 }},
+    {{ 357, -1, 2021, 1398 }},
+    {{ -1, -1, 1419, 1399 }},
+    {{ -1, -1, 7242, 7255 }},
+    {{ 1564, -1, 45, 1401 }},
+    {{ -1, 8, 1570, 1402 }},
+    {{ -1, 1575, 196, 1403 }},
+    {{ -1, 1404, 1406, 8056 }},
+    {{ 1405, 7988, -1, 8002 }},
+    {{ 5555, 7973, -1, -1 }},
+    {{ 1407, -1, 8037, 8051 }},
+    {{ -1, -1, 8031, -1 }},
+    {{ 1409, 1616, -1, 1415 }},
+    {{ 1593, 1598, 1410, -1 }},
+    {{ 3005, -1, 1603, 1411 }},
+    {{ -1, 8, 1412, 1612 }},
+    {{ 431, -1, 2101, 1413 }},
+    {{ -1, -1, 1608, 1414 }},
+    {{ -1, -1, 1254, 7525 }},
+    {{ -1, 1633, 1416, 1659 }},
+    {{ 1645, -1, 1417, 3218 }},
+    {{ 461, -1, 1651, 1418 }},
+    {{ -1, 3213, 1419, 1213 }},
+    {{ 1420, -1, 7208, 7214 }},
+    {{ 7199, -1, 5352, -1 }},
+    {{ 1700, -1, 1705, 1422 }},
+    {{ -1, 1423, 1718, 1722 }},
+    {{ 1424, 3511, -1, 7182 }},
+    {{ 1716, -1, 1425, -1 }},
+    {{ 115, -1, 118, -1 }},
+    {{ 507, 3528, -1, 1427 }},
+    {{ -1, 7350, 1428, 7372 }},
+    {{ 1429, -1, 7364, 1053 }},
+    {{ -1, 7356, 7360, -1 }},
+    {{ 1431, -1, 7429, 7435 }},
+    {{ 7420, 1432, 1185, -1 }},
+    {{ 7024, -1, -1, 7425 }},
+    {{ -1, 1434, 7457, 7467 }},
+    {{ 1435, 7451, -1, 1230 }},
+    {{ -1, 7445, 7448, -1 }},
+    {{ -1, 1437, 1440, 7525 }},
+    {{ 1438, 7486, -1, 7493 }},
+    {{ 3547, 5471, 1439, -1 }},
+    {{ -1, -1, 7482, 16 }},
+    {{ 1441, -1, 7507, 7520 }},
+    {{ 1442, 1443, 7502, -1 }},
+    {{ 1303, -1, 1313, -1 }},
+    {{ -1, 7499, -1, 20 }},
+    {{ -1, 1445, 1450, 1459 }},
+    {{ 219, 1750, -1, 1446 }},
+    {{ -1, 7721, 1447, 7758 }},
+    {{ 1448, -1, 7748, 1053 }},
+    {{ 1449, 7738, 7743, -1 }},
+    {{ -1, 1042, 134, -1 }},
+    {{ 522, -1, 1451, 1455 }},
+    {{ 3607, -1, 7899, 1452 }},
+    {{ -1, 1453, 1208, 1213 }},
+    {{ 1454, 7913, -1, 7182 }},
+    {{ 7909, -1, 15, -1 }},
+    {{ -1, 1762, 1456, 7952 }},
+    {{ 1457, -1, 1235, 1240 }},
+    {{ 7943, 1458, 7406, -1 }},
+    {{ 7948, -1, -1, 7401 }},
+    {{ -1, 1460, 1775, 8056 }},
+    {{ 1461, 7988, -1, 8002 }},
+    {{ 1769, 7973, 1462, -1 }},
+    {{ 1463, -1, 7983, 16 }},
+    {{ -1, 1282, 168, -1 }},
+    {{ 1780, 1465, 1473, -1 }},
+    {{ 1797, 75, -1, 1466 }},
+    {{ -1, 79, 12, 1467 }},
+    {{ -1, 226, 1806, 1468 }},
+    {{ -1, 1469, 1471, 8056 }},
+    {{ 1470, 7988, -1, 8002 }},
+    {{ -1, 7973, -1, -1 }},
+    {{ 1472, -1, 8037, 8051 }},
+    {{ 3638, -1, 8031, -1 }},
+    {{ 83, -1, 1813, 1474 }},
+    {{ -1, 1475, 689, 4521 }},
+    {{ 4466, 1476, -1, 1821 }},
+    {{ 681, 684, -1, 1477 }},
+    {{ -1, 1490, -1, 1478 }},
+    {{ -1, 5246, -1, 6330 }},
+    {{ 1480, -1, 1850, 1486 }},
+    {{ 1825, 1481, 1844, -1 }},
+    {{ 4583, 1831, -1, 1482 }},
+    {{ -1, 1483, 12, 1840 }},
+    {{ 711, 714, -1, 1484 }},
+    {{ -1, 1836, -1, 1485 }},
+    {{ -1, 4261, -1, 4267 }},
+    {{ -1, 1487, 1883, 1894 }},
+    {{ 1869, 1488, -1, 4900 }},
+    {{ 752, 1875, -1, 1489 }},
+    {{ -1, 1490, 4895, 5245 }},
+    {{ 1491, 5221, -1, 5224 }},
+    {{ 6227, 3291, -1, -1 }},
+    {{ 1900, 1905, -1, 1493 }},
+    {{ -1, 822, 1494, 1916 }},
+    {{ 1495, -1, 5235, 5240 }},
+    {{ 1914, 1496, -1, -1 }},
+    {{ 139, 142, -1, -1 }},
+    {{ 1498, 6389, -1, 6395 }},
+    {{ 6380, 982, 1499, -1 }},
+    {{ 6102, -1, -1, 6385 }},
+    {{ -1, 6405, 1501, 6425 }},
+    {{ 1502, -1, 6420, 1053 }},
+    {{ -1, 6415, 6418, -1 }},
+    {{ 828, -1, 5285, 1504 }},
+    {{ -1, 1505, 6538, 6544 }},
+    {{ 1506, 6530, -1, 1230 }},
+    {{ -1, 6522, 6526, -1 }},
+    {{ -1, 1508, 1512, 6608 }},
+    {{ 1509, 6558, -1, 6570 }},
+    {{ 1510, 6550, 1511, -1 }},
+    {{ 1263, 1266, -1, -1 }},
+    {{ -1, -1, 6555, 16 }},
+    {{ 1513, -1, 6595, 6602 }},
+    {{ 5298, 1514, 7846, -1 }},
+    {{ -1, 6591, -1, 20 }},
+    {{ -1, 1516, 1525, 1530 }},
+    {{ 854, 1517, -1, 1521 }},
+    {{ 5494, 7703, -1, 1518 }},
+    {{ -1, 1013, 1519, 1022 }},
+    {{ 1520, -1, 7716, 6285 }},
+    {{ 7712, 19, -1, -1 }},
+    {{ -1, 1522, 1973, 7758 }},
+    {{ 1523, 1027, -1, 1032 }},
+    {{ 7723, 6351, 1524, -1 }},
+    {{ 7728, -1, -1, 6376 }},
+    {{ 254, -1, 1977, 1526 }},
+    {{ -1, 1527, 7941, 7952 }},
+    {{ 1528, 7931, -1, 1230 }},
+    {{ 1529, 7923, 7927, -1 }},
+    {{ -1, 158, 1227, -1 }},
+    {{ -1, 1988, 1531, 8056 }},
+    {{ 1532, -1, 8037, 8051 }},
+    {{ 1995, 1533, 8031, -1 }},
+    {{ 1534, 8027, -1, 20 }},
+    {{ -1, 173, 1326, -1 }},
+    {{ 285, 1536, 1542, -1 }},
+    {{ 299, 304, -1, 1537 }},
+    {{ -1, 2344, 34, 1538 }},
+    {{ -1, 2361, 1539, 1459 }},
+    {{ 522, -1, 1540, 1455 }},
+    {{ 2365, -1, 7899, 1541 }},
+    {{ -1, -1, 1208, 1213 }},
+    {{ 312, -1, 321, 1543 }},
+    {{ -1, 1544, 2439, 1548 }},
+    {{ 29, 1492, -1, 1545 }},
+    {{ -1, 185, 1546, 1507 }},
+    {{ 828, -1, 5285, 1547 }},
+    {{ -1, -1, 6538, 6544 }},
+    {{ -1, 1516, 2013, 1549 }},
+    {{ -1, 1988, 1550, 8056 }},
+    {{ 1551, -1, 8037, 8051 }},
+    {{ 1995, -1, 8031, -1 }},
+    {{ 339, 2547, -1, 1553 }},
+    {{ -1, 2570, 1554, 2584 }},
+    {{ 349, -1, 1555, 3218 }},
+    {{ 461, -1, 1556, 1655 }},
+    {{ 2581, -1, 7111, 1557 }},
+    {{ -1, -1, 7142, 7147 }},
+    {{ -1, 1559, 7242, 7255 }},
+    {{ -1, 7234, -1, 5511 }},
+    {{ -1, 1726, 1561, 1740 }},
+    {{ 1562, -1, 1733, 1737 }},
+    {{ 2628, 1563, 7406, -1 }},
+    {{ 1731, -1, -1, -1 }},
+    {{ 360, 1565, 42, -1 }},
+    {{ 370, 2702, -1, 1566 }},
+    {{ -1, 79, 12, 1567 }},
+    {{ -1, 226, 1568, 1807 }},
+    {{ 522, -1, 3606, 1569 }},
+    {{ -1, -1, 7941, 7952 }},
+    {{ 2043, -1, 2048, 1571 }},
+    {{ -1, 1572, 2948, 2057 }},
+    {{ 1573, 5417, -1, 1230 }},
+    {{ -1, 414, 1574, -1 }},
+    {{ 5415, -1, 118, -1 }},
+    {{ 854, 5493, -1, 1576 }},
+    {{ -1, 7721, 1577, 7758 }},
+    {{ 1578, -1, 7748, 1053 }},
+    {{ -1, 7738, 7743, -1 }},
+    {{ 1580, -1, 7899, 7906 }},
+    {{ 5535, 1581, 1185, -1 }},
+    {{ 5540, -1, -1, 7896 }},
+    {{ -1, 1583, 7941, 7952 }},
+    {{ 1584, 7931, -1, 1230 }},
+    {{ -1, 7923, 7927, -1 }},
+    {{ -1, 1586, 1589, 8056 }},
+    {{ 1587, 7988, -1, 8002 }},
+    {{ 5555, 7973, 1588, -1 }},
+    {{ -1, -1, 7983, 16 }},
+    {{ 1590, -1, 8037, 8051 }},
+    {{ 1591, 1592, 8031, -1 }},
+    {{ 5576, -1, 1313, -1 }},
+    {{ -1, 8027, -1, 20 }},
+    {{ 285, 2960, 1594, -1 }},
+    {{ 312, -1, 2967, 1595 }},
+    {{ -1, 2007, 2976, 1596 }},
+    {{ -1, 1516, 1597, 2014 }},
+    {{ 2978, -1, 1977, 1569 }},
+    {{ 37, 2981, -1, 1599 }},
+    {{ -1, 352, 1600, 2995 }},
+    {{ 2608, -1, 1601, 2990 }},
+    {{ 357, -1, 1602, 260 }},
+    {{ 421, -1, 7111, 1557 }},
+    {{ 423, -1, 427, 1604 }},
+    {{ -1, 1868, 2093, 1605 }},
+    {{ -1, 765, 1606, 4999 }},
+    {{ 1607, -1, 5533, 5547 }},
+    {{ 2887, -1, 5527, -1 }},
+    {{ 1609, -1, 1235, 1240 }},
+    {{ 5428, -1, 7406, -1 }},
+    {{ -1, 1611, 1254, 7525 }},
+    {{ -1, 7486, -1, 7493 }},
+    {{ -1, 2061, 1613, 2074 }},
+    {{ 1614, -1, 2066, 2070 }},
+    {{ 3059, 1615, 5527, -1 }},
+    {{ -1, 415, -1, -1 }},
+    {{ 1617, 3090, -1, 1626 }},
+    {{ 3062, 3069, 1618, -1 }},
+    {{ 3005, -1, 1619, 1623 }},
+    {{ 423, -1, 3074, 1620 }},
+    {{ -1, 1868, 1621, 2097 }},
+    {{ 3082, -1, 2882, 1622 }},
+    {{ -1, -1, 5426, 5436 }},
+    {{ -1, 8, 1624, 3086 }},
+    {{ 431, -1, 1625, 274 }},
+    {{ 440, -1, 5385, 1541 }},
+    {{ -1, 3115, 1627, 3138 }},
+    {{ 1628, -1, 447, 3132 }},
+    {{ 3173, 19, 1629, -1 }},
+    {{ 54, -1, 1630, 2139 }},
+    {{ 446, -1, 6930, 1631 }},
+    {{ -1, -1, 6949, 6950 }},
+    {{ -1, 1633, 1644, 1659 }},
+    {{ 1634, 3162, -1, 1639 }},
+    {{ 3153, 3291, 1635, -1 }},
+    {{ 3304, -1, 1636, 3158 }},
+    {{ 60, -1, 1637, 969 }},
+    {{ 446, -1, 5995, 1638 }},
+    {{ -1, -1, 3045, 6005 }},
+    {{ -1, 3348, 1640, 3370 }},
+    {{ 1641, -1, 3170, 1053 }},
+    {{ 1642, 3360, 3168, -1 }},
+    {{ 1037, 1042, 1643, -1 }},
+    {{ 486, -1, -1, -1 }},
+    {{ 1645, -1, 1650, 3218 }},
+    {{ 3173, 19, 1646, -1 }},
+    {{ 54, -1, 2132, 1647 }},
+    {{ -1, 1164, 1648, 6989 }},
+    {{ 1649, -1, 6984, 248 }},
+    {{ 6974, -1, 1950, -1 }},
+    {{ 461, -1, 1651, 1655 }},
+    {{ 1191, -1, 7111, 1652 }},
+    {{ -1, 1653, 7142, 7147 }},
+    {{ 1654, 1201, -1, 7137 }},
+    {{ 4804, -1, 15, -1 }},
+    {{ -1, 3213, 1656, 1213 }},
+    {{ 1657, -1, 7208, 7214 }},
+    {{ 7199, 1658, 5352, -1 }},
+    {{ 5323, -1, -1, 7204 }},
+    {{ -1, 1660, 466, 3269 }},
+    {{ 1661, 3563, -1, 3575 }},
+    {{ 3238, 3551, 1662, -1 }},
+    {{ 1663, -1, 3242, 16 }},
+    {{ 1277, 1282, 1664, -1 }},
+    {{ 520, -1, -1, -1 }},
+    {{ 3276, 1666, 1671, -1 }},
+    {{ 3292, 919, -1, 1667 }},
+    {{ -1, 931, 1668, 5874 }},
+    {{ 3299, -1, 1669, 5869 }},
+    {{ 1670, -1, 5865, 260 }},
+    {{ 5858, 3489, -1, -1 }},
+    {{ 3304, -1, 1672, 3317 }},
+    {{ 60, -1, 962, 1673 }},
+    {{ -1, 6008, 1674, 6022 }},
+    {{ 1675, -1, 6019, 2036 }},
+    {{ 6013, -1, 5352, -1 }},
+    {{ 1677, 3332, -1, 1682 }},
+    {{ 3321, 982, 1678, -1 }},
+    {{ 6102, -1, 478, 1679 }},
+    {{ -1, 8, 1680, 6148 }},
+    {{ 1681, -1, 6144, 274 }},
+    {{ 6138, 1945, -1, -1 }},
+    {{ -1, 1013, 1683, 1022 }},
+    {{ 3340, -1, 1684, 6285 }},
+    {{ 1685, -1, 2147, 6280 }},
+    {{ 1686, 3489, 6276, -1 }},
+    {{ 6265, 6269, -1, -1 }},
+    {{ 1688, -1, 1152, 1163 }},
+    {{ 3256, 1689, 6484, -1 }},
+    {{ 6480, 6481, -1, -1 }},
+    {{ -1, 1059, 1691, 6608 }},
+    {{ 1692, -1, 6595, 6602 }},
+    {{ 1693, 1072, 7846, -1 }},
+    {{ 1694, 1306, 6587, -1 }},
+    {{ 6576, 6581, -1, -1 }},
+    {{ 1696, -1, 1152, 1163 }},
+    {{ 1142, 1697, 1148, -1 }},
+    {{ 6878, 6887, -1, 1698 }},
+    {{ -1, 1699, 12, -1 }},
+    {{ 6895, 6898, -1, -1 }},
+    {{ 3472, 3489, 1701, -1 }},
+    {{ 83, -1, 7068, 1702 }},
+    {{ -1, 1703, 689, 7078 }},
+    {{ 4466, 1704, -1, 7074 }},
+    {{ 681, -1, -1, 283 }},
+    {{ 1706, -1, 7111, 1710 }},
+    {{ 7086, 1707, 7106, -1 }},
+    {{ 4583, 7092, -1, 1708 }},
+    {{ -1, 1709, 12, 7102 }},
+    {{ 711, -1, -1, 80 }},
+    {{ -1, 1711, 7142, 7147 }},
+    {{ 1712, 1714, -1, 7137 }},
+    {{ 4804, 1713, 15, -1 }},
+    {{ 92, -1, -1, 802 }},
+    {{ 1715, 7133, -1, 4894 }},
+    {{ 753, -1, 5194, -1 }},
+    {{ 3509, 1717, 784, -1 }},
+    {{ 7162, 7165, -1, -1 }},
+    {{ 1719, -1, 7208, 7214 }},
+    {{ 7199, 1720, 5352, -1 }},
+    {{ 5323, 1721, -1, 7204 }},
+    {{ 106, -1, -1, 1134 }},
+    {{ -1, 1723, 7242, 7255 }},
+    {{ 1724, 7234, -1, 5511 }},
+    {{ 1725, 7227, 7230, -1 }},
+    {{ 856, -1, 1270, -1 }},
+    {{ 507, 3528, -1, 1727 }},
+    {{ -1, 7350, 1728, 7372 }},
+    {{ 1729, -1, 7364, 1053 }},
+    {{ 1730, 7356, 7360, -1 }},
+    {{ 1037, -1, 134, -1 }},
+    {{ 3542, 1732, 1119, -1 }},
+    {{ 7395, 7398, -1, -1 }},
+    {{ 1734, -1, 7429, 7435 }},
+    {{ 7420, 1735, 1185, -1 }},
+    {{ 7024, 1736, -1, 7425 }},
+    {{ 1175, -1, -1, 705 }},
+    {{ -1, 1738, 7457, 7467 }},
+    {{ 1739, 7451, -1, 1230 }},
+    {{ 251, 7445, 7448, -1 }},
+    {{ -1, 1741, 1745, 7525 }},
+    {{ 1742, 7486, -1, 7493 }},
+    {{ 3547, 5471, 1743, -1 }},
+    {{ 1744, -1, 7482, 16 }},
+    {{ 1277, -1, 168, -1 }},
+    {{ 1746, -1, 7507, 7520 }},
+    {{ 1747, 1749, 7502, -1 }},
+    {{ 1303, 1748, 1313, -1 }},
+    {{ 1307, -1, -1, 6698 }},
+    {{ 256, 7499, -1, 20 }},
+    {{ 1751, 7703, -1, 7709 }},
+    {{ 3565, 982, 1752, -1 }},
+    {{ 3570, -1, 1753, 7700 }},
+    {{ 1754, -1, 992, 2092 }},
+    {{ 7691, 7695, -1, -1 }},
+    {{ -1, 7721, 1756, 7758 }},
+    {{ 1757, -1, 7748, 1053 }},
+    {{ 1758, 7738, 7743, -1 }},
+    {{ 1759, 1042, 134, -1 }},
+    {{ 7732, 1300, -1, -1 }},
+    {{ 522, -1, 3606, 1761 }},
+    {{ -1, 1762, 7941, 7952 }},
+    {{ 1763, 7931, -1, 1230 }},
+    {{ 1764, 7923, 7927, -1 }},
+    {{ 1765, 158, 1227, -1 }},
+    {{ 7732, 1340, -1, -1 }},
+    {{ -1, 1767, 1775, 8056 }},
+    {{ 1768, 7988, -1, 8002 }},
+    {{ 1769, 7973, 1772, -1 }},
+    {{ 3627, 1266, 1770, -1 }},
+    {{ 1771, -1, 1274, 5742 }},
+    {{ 7968, 7971, -1, -1 }},
+    {{ 1773, -1, 7983, 16 }},
+    {{ 1774, 1282, 168, -1 }},
+    {{ 7979, 1351, -1, -1 }},
+    {{ 1776, -1, 8037, 8051 }},
+    {{ 3638, 1777, 8031, -1 }},
+    {{ 1778, 8027, -1, 20 }},
+    {{ 1779, 173, 1326, -1 }},
+    {{ 8023, 1362, -1, -1 }},
+    {{ 531, 1781, 1791, -1 }},
+    {{ 546, 555, -1, 1782 }},
+    {{ -1, 3814, 1783, 1787 }},
+    {{ 24, -1, 1421, 1784 }},
+    {{ -1, 1785, 179, 1436 }},
+    {{ 507, 3830, -1, 1786 }},
+    {{ -1, 7350, -1, 7372 }},
+    {{ -1, 562, 1450, 1788 }},
+    {{ -1, 1789, 1775, 8056 }},
+    {{ 1790, 7988, -1, 8002 }},
+    {{ 1769, 7973, -1, -1 }},
+    {{ 565, -1, 570, 1792 }},
+    {{ -1, 69, 3912, 1793 }},
+    {{ -1, 1794, 3931, 1530 }},
+    {{ 854, 1795, -1, 1521 }},
+    {{ 3923, 3926, -1, 1796 }},
+    {{ -1, 1013, -1, 1022 }},
+    {{ 577, 72, 1798, -1 }},
+    {{ 593, -1, 4040, 1799 }},
+    {{ -1, 4046, 1570, 1800 }},
+    {{ -1, 1801, 196, 1585 }},
+    {{ 854, 4049, -1, 1802 }},
+    {{ -1, 7721, -1, 7758 }},
+    {{ 1804, 7703, -1, 7709 }},
+    {{ 3565, 982, 1805, -1 }},
+    {{ 3570, -1, -1, 7700 }},
+    {{ 522, -1, 3606, 1582 }},
+    {{ -1, 1808, 1811, 8056 }},
+    {{ 1809, 7988, -1, 8002 }},
+    {{ 1810, 7973, 1588, -1 }},
+    {{ 3627, 1266, -1, -1 }},
+    {{ 1812, -1, 8037, 8051 }},
+    {{ 3638, 1592, 8031, -1 }},
+    {{ 668, -1, 4419, 1814 }},
+    {{ -1, 1815, 4454, 4460 }},
+    {{ 678, 1816, -1, 4900 }},
+    {{ 752, 1817, -1, 1879 }},
+    {{ 4446, 4449, -1, 1818 }},
+    {{ -1, 4893, -1, 5218 }},
+    {{ -1, 5246, 1820, 6330 }},
+    {{ -1, -1, 6322, 3616 }},
+    {{ -1, 1822, 1929, 1934 }},
+    {{ 1823, 1922, -1, 1926 }},
+    {{ 4501, 4504, 1824, -1 }},
+    {{ 1920, -1, -1, -1 }},
+    {{ 531, 1826, 4576, -1 }},
+    {{ 546, 4545, -1, 1827 }},
+    {{ -1, 4558, 2157, 1828 }},
+    {{ -1, 1829, 1450, 2162 }},
+    {{ 4570, 4573, -1, 1830 }},
+    {{ -1, 1522, -1, 3843 }},
+    {{ 697, 701, -1, 1832 }},
+    {{ -1, 706, 1644, 1833 }},
+    {{ -1, 1834, 4191, 4192 }},
+    {{ 1835, 4187, -1, 1446 }},
+    {{ 4184, 3551, -1, -1 }},
+    {{ 1837, 1922, -1, 4244 }},
+    {{ 4239, 6351, -1, -1 }},
+    {{ -1, 4261, 1839, 4267 }},
+    {{ -1, -1, 4264, 6602 }},
+    {{ -1, 1841, 2182, 2187 }},
+    {{ 1842, 2174, -1, 2178 }},
+    {{ 4667, 4670, 1843, -1 }},
+    {{ -1, -1, 656, -1 }},
+    {{ 83, -1, 4673, 1845 }},
+    {{ -1, 1846, 689, 4691 }},
+    {{ 4466, 1847, -1, 4686 }},
+    {{ 681, 1848, -1, 283 }},
+    {{ 724, 4683, -1, 1849 }},
+    {{ -1, 4491, -1, 4495 }},
+    {{ 1851, -1, 4737, 1861 }},
+    {{ 4701, 1852, 4732, -1 }},
+    {{ 4583, 1853, -1, 1857 }},
+    {{ 697, 4709, -1, 1854 }},
+    {{ -1, 1855, 1644, 626 }},
+    {{ 4719, 4721, -1, 1856 }},
+    {{ -1, 4637, -1, 3843 }},
+    {{ -1, 1858, 12, 4728 }},
+    {{ 711, 1859, -1, 80 }},
+    {{ 731, 4726, -1, 1860 }},
+    {{ -1, 4659, -1, 4661 }},
+    {{ -1, 1862, 4784, 4789 }},
+    {{ 1863, 738, -1, 4778 }},
+    {{ 4804, 1864, 15, -1 }},
+    {{ 92, 1865, -1, 802 }},
+    {{ 737, 4683, -1, 1866 }},
+    {{ -1, 4846, -1, 4847 }},
+    {{ -1, 1868, 1883, 1894 }},
+    {{ 1869, 1874, -1, 4900 }},
+    {{ 4804, 1870, 15, -1 }},
+    {{ 92, 746, -1, 1871 }},
+    {{ -1, 1872, 935, 5141 }},
+    {{ 1873, 5138, -1, 205 }},
+    {{ 5133, 1666, -1, -1 }},
+    {{ 752, 1875, -1, 1879 }},
+    {{ 4883, 4889, -1, 1876 }},
+    {{ -1, 4893, 1877, 5218 }},
+    {{ 1878, -1, 1010, 6209 }},
+    {{ 3173, 19, -1, -1 }},
+    {{ -1, 1880, 4895, 5245 }},
+    {{ 1881, 5221, -1, 5224 }},
+    {{ 6227, 3291, 1882, -1 }},
+    {{ 3304, -1, -1, 6232 }},
+    {{ 1884, -1, 4931, 1889 }},
+    {{ 4922, 1885, 5352, -1 }},
+    {{ 5323, 1886, -1, 4927 }},
+    {{ 106, 1887, -1, 1134 }},
+    {{ 737, 4683, -1, 1888 }},
+    {{ -1, 5341, -1, 5342 }},
+    {{ -1, 1890, 5426, 5436 }},
+    {{ 1891, 4947, -1, 1230 }},
+    {{ 1892, 4944, 5414, -1 }},
+    {{ 1218, 1893, 1227, -1 }},
+    {{ 850, -1, -1, -1 }},
+    {{ -1, 765, 1895, 4999 }},
+    {{ 1896, -1, 5533, 5547 }},
+    {{ 4987, 1897, 5527, -1 }},
+    {{ 1898, 4996, -1, 20 }},
+    {{ 1317, 1899, 1326, -1 }},
+    {{ 874, -1, -1, -1 }},
+    {{ 808, 1901, 5194, -1 }},
+    {{ 813, 5179, -1, 1902 }},
+    {{ -1, 5190, 1903, 6095 }},
+    {{ 2608, -1, 1904, 6091 }},
+    {{ 357, -1, -1, 260 }},
+    {{ 1906, 5211, -1, 1910 }},
+    {{ 6153, 4116, 1907, -1 }},
+    {{ 3005, -1, 6163, 1908 }},
+    {{ -1, 8, 1909, 6173 }},
+    {{ 431, -1, -1, 274 }},
+    {{ -1, 5217, 1911, 5218 }},
+    {{ 819, -1, 1912, 6209 }},
+    {{ 1913, -1, 6205, 2150 }},
+    {{ 462, 3489, -1, -1 }},
+    {{ 5230, 5232, 1915, -1 }},
+    {{ 6255, -1, 6258, -1 }},
+    {{ -1, 5246, 1917, 6330 }},
+    {{ 1918, -1, 6322, 3616 }},
+    {{ 1919, 5251, 6319, -1 }},
+    {{ 524, 1306, -1, -1 }},
+    {{ 5263, 5265, 1921, -1 }},
+    {{ 6366, -1, 6369, -1 }},
+    {{ 1923, 6389, -1, 6395 }},
+    {{ 6380, 982, 1924, -1 }},
+    {{ 6102, -1, 1925, 6385 }},
+    {{ 989, -1, -1, 2092 }},
+    {{ -1, 6405, 1927, 6425 }},
+    {{ 1928, -1, 6420, 1053 }},
+    {{ 208, 6415, 6418, -1 }},
+    {{ 828, -1, 5285, 1930 }},
+    {{ -1, 1931, 6538, 6544 }},
+    {{ 1932, 6530, -1, 1230 }},
+    {{ 1933, 6522, 6526, -1 }},
+    {{ 1218, 158, -1, -1 }},
+    {{ -1, 1935, 1940, 6608 }},
+    {{ 1936, 6558, -1, 6570 }},
+    {{ 1937, 6550, 1939, -1 }},
+    {{ 1263, 1266, 1938, -1 }},
+    {{ 1271, -1, -1, 5742 }},
+    {{ 221, -1, 6555, 16 }},
+    {{ 1941, -1, 6595, 6602 }},
+    {{ 5298, 1942, 7846, -1 }},
+    {{ 1943, 6591, -1, 20 }},
+    {{ 1317, 173, -1, -1 }},
+    {{ 5302, 1945, 1950, -1 }},
+    {{ 5323, 1946, -1, 5345 }},
+    {{ 106, 836, -1, 1947 }},
+    {{ -1, 1948, 6835, 6840 }},
+    {{ 1949, 6832, -1, 623 }},
+    {{ 5133, 3816, -1, -1 }},
+    {{ 5353, -1, 1152, 1951 }},
+    {{ -1, 1952, 1168, 6989 }},
+    {{ 5361, 1953, -1, 6969 }},
+    {{ 1954, 684, -1, 283 }},
+    {{ 6963, -1, 5194, -1 }},
+    {{ 1956, -1, 5385, 1961 }},
+    {{ 5370, 1957, 1185, -1 }},
+    {{ 7024, 842, -1, 1958 }},
+    {{ -1, 1959, 12, 7063 }},
+    {{ 1960, 714, -1, 80 }},
+    {{ 7058, -1, 1671, -1 }},
+    {{ -1, 1962, 1208, 1213 }},
+    {{ 5393, 1963, -1, 7182 }},
+    {{ 1964, 4882, -1, 7177 }},
+    {{ 1965, 756, 5194, -1 }},
+    {{ 7168, -1, 7174, -1 }},
+    {{ -1, 1967, 1254, 7525 }},
+    {{ 1968, 7486, -1, 7493 }},
+    {{ 1969, 5471, 1251, -1 }},
+    {{ 1970, 859, 1270, -1 }},
+    {{ 7473, -1, 7480, -1 }},
+    {{ 854, 5493, -1, 1972 }},
+    {{ -1, 7721, 1973, 7758 }},
+    {{ 1974, -1, 7748, 1053 }},
+    {{ 1975, 7738, 7743, -1 }},
+    {{ 1976, 1042, 134, -1 }},
+    {{ 7732, -1, 1301, -1 }},
+    {{ 1978, -1, 7899, 7906 }},
+    {{ 5535, 1979, 1185, -1 }},
+    {{ 5540, 1980, -1, 7896 }},
+    {{ 1981, 1178, -1, 705 }},
+    {{ 7886, -1, 7893, -1 }},
+    {{ -1, 1983, 7941, 7952 }},
+    {{ 1984, 7931, -1, 1230 }},
+    {{ 1985, 7923, 7927, -1 }},
+    {{ 1986, 158, 1227, -1 }},
+    {{ 7732, -1, 1341, -1 }},
+    {{ -1, 1988, 1993, 8056 }},
+    {{ 1989, 7988, -1, 8002 }},
+    {{ 5555, 7973, 1990, -1 }},
+    {{ 1991, -1, 7983, 16 }},
+    {{ 1992, 1282, 168, -1 }},
+    {{ 7979, -1, 1352, -1 }},
+    {{ 1994, -1, 8037, 8051 }},
+    {{ 1995, 1998, 8031, -1 }},
+    {{ 5576, 1996, 1313, -1 }},
+    {{ 1997, 1310, -1, 6698 }},
+    {{ 8018, -1, 8021, -1 }},
+    {{ 1999, 8027, -1, 20 }},
+    {{ 2000, 173, 1326, -1 }},
+    {{ 8023, -1, 1363, -1 }},
+    {{ -1, 2361, 2002, 1459 }},
+    {{ 522, -1, 2003, 1455 }},
+    {{ 2365, -1, 7899, 2004 }},
+    {{ -1, 2005, 1208, 1213 }},
+    {{ -1, 7913, -1, 7182 }},
+    {{ -1, 2007, 2439, 2012 }},
+    {{ 29, 1492, -1, 2008 }},
+    {{ -1, 185, 2009, 1507 }},
+    {{ 828, -1, 5285, 2010 }},
+    {{ -1, 2011, 6538, 6544 }},
+    {{ -1, 6530, -1, 1230 }},
+    {{ -1, 1516, 2013, 2014 }},
+    {{ 254, -1, 1977, 1582 }},
+    {{ -1, 1988, 2015, 8056 }},
+    {{ 2016, -1, 8037, 8051 }},
+    {{ 1995, 1592, 8031, -1 }},
+    {{ 461, -1, 2018, 1655 }},
+    {{ 2581, -1, 7111, 2019 }},
+    {{ -1, 2020, 7142, 7147 }},
+    {{ -1, 1201, -1, 7137 }},
+    {{ 2022, -1, 7111, 2025 }},
+    {{ 7086, 2023, 7106, -1 }},
+    {{ 4583, 7092, -1, 2024 }},
+    {{ -1, -1, 12, 7102 }},
+    {{ -1, 2026, 7142, 7147 }},
+    {{ 1654, 2027, -1, 7137 }},
+    {{ -1, 7133, -1, 4894 }},
+    {{ -1, 2029, 7242, 7255 }},
+    {{ 2030, 7234, -1, 5511 }},
+    {{ -1, 7227, 7230, -1 }},
+    {{ -1, 79, 12, 2032 }},
+    {{ -1, 226, 2033, 1807 }},
+    {{ 522, -1, 3606, 2034 }},
+    {{ -1, 2035, 7941, 7952 }},
+    {{ -1, 7931, -1, 1230 }},
+    {{ -1, 2037, 5426, 5436 }},
+    {{ 2038, 4947, -1, 1230 }},
+    {{ 251, 4944, 5414, -1 }},
+    {{ -1, 765, 2040, 4999 }},
+    {{ 2041, -1, 5533, 5547 }},
+    {{ 2887, 2042, 5527, -1 }},
+    {{ 256, 4996, -1, 20 }},
+    {{ 5302, 1945, 2044, -1 }},
+    {{ 5353, -1, 1152, 2045 }},
+    {{ -1, 2046, 1168, 6989 }},
+    {{ 5361, 2047, -1, 6969 }},
+    {{ -1, 2942, -1, 283 }},
+    {{ 2049, -1, 5385, 2053 }},
+    {{ 5370, 2050, 1185, -1 }},
+    {{ 7024, 842, -1, 2051 }},
+    {{ -1, 2052, 12, 7063 }},
+    {{ -1, 2943, -1, 80 }},
+    {{ -1, 2054, 1208, 1213 }},
+    {{ 2944, 2055, -1, 7182 }},
+    {{ 2056, 4882, -1, 7177 }},
+    {{ -1, 2947, 5194, -1 }},
+    {{ -1, 2058, 1254, 7525 }},
+    {{ 2059, 7486, -1, 7493 }},
+    {{ 2060, 5471, 1251, -1 }},
+    {{ -1, 2953, 1270, -1 }},
+    {{ 854, 5493, -1, 2062 }},
+    {{ -1, 7721, 2063, 7758 }},
+    {{ 2064, -1, 7748, 1053 }},
+    {{ 2065, 7738, 7743, -1 }},
+    {{ -1, 2954, 134, -1 }},
+    {{ 2067, -1, 7899, 7906 }},
+    {{ 5535, 2068, 1185, -1 }},
+    {{ 5540, 2069, -1, 7896 }},
+    {{ -1, 2955, -1, 705 }},
+    {{ -1, 2071, 7941, 7952 }},
+    {{ 2072, 7931, -1, 1230 }},
+    {{ 2073, 7923, 7927, -1 }},
+    {{ -1, 2956, 1227, -1 }},
+    {{ -1, 2075, 2079, 8056 }},
+    {{ 2076, 7988, -1, 8002 }},
+    {{ 5555, 7973, 2077, -1 }},
+    {{ 2078, -1, 7983, 16 }},
+    {{ -1, 2957, 168, -1 }},
+    {{ 2080, -1, 8037, 8051 }},
+    {{ 2081, 2083, 8031, -1 }},
+    {{ 5576, 2082, 1313, -1 }},
+    {{ -1, 2958, -1, 6698 }},
+    {{ 2084, 8027, -1, 20 }},
+    {{ -1, 2959, 1326, -1 }},
+    {{ 285, 2960, 2086, -1 }},
+    {{ 312, -1, 2967, 2087 }},
+    {{ -1, 2007, 2976, 2088 }},
+    {{ -1, 1516, 2089, 2014 }},
+    {{ 2978, -1, 1977, 2034 }},
+    {{ -1, 2091, 7142, 7147 }},
+    {{ -1, -1, -1, 7137 }},
+    {{ -1, 1868, 2093, 2097 }},
+    {{ 403, -1, 2882, 2094 }},
+    {{ -1, 2095, 5426, 5436 }},
+    {{ 2096, 4947, -1, 1230 }},
+    {{ -1, 4944, 5414, -1 }},
+    {{ -1, 765, 2098, 4999 }},
+    {{ 2099, -1, 5533, 5547 }},
+    {{ 2887, 2100, 5527, -1 }},
+    {{ -1, 4996, -1, 20 }},
+    {{ 2102, -1, 5385, 2105 }},
+    {{ 5370, 2103, 1185, -1 }},
+    {{ 7024, 842, -1, 2104 }},
+    {{ -1, -1, 12, 7063 }},
+    {{ -1, 2106, 1208, 1213 }},
+    {{ 2107, 2108, -1, 7182 }},
+    {{ 5394, -1, 15, -1 }},
+    {{ -1, 4882, -1, 7177 }},
+    {{ 2110, -1, 1235, 1240 }},
+    {{ 5428, 2111, 7406, -1 }},
+    {{ 5433, -1, -1, 7401 }},
+    {{ -1, 2113, 1254, 7525 }},
+    {{ 2114, 7486, -1, 7493 }},
+    {{ -1, 5471, 1251, -1 }},
+    {{ 423, -1, 3074, 2116 }},
+    {{ -1, 1868, 2117, 2097 }},
+    {{ 3082, -1, 2882, 2118 }},
+    {{ -1, 2119, 5426, 5436 }},
+    {{ -1, 4947, -1, 1230 }},
+    {{ -1, 2121, 1208, 1213 }},
+    {{ -1, -1, -1, 7182 }},
+    {{ -1, 2123, 6949, 6950 }},
+    {{ -1, 6945, -1, 4900 }},
+    {{ -1, 2125, 3045, 6005 }},
+    {{ -1, 738, -1, 4778 }},
+    {{ -1, 3348, 2127, 3370 }},
+    {{ 2128, -1, 3170, 1053 }},
+    {{ 2129, 3360, 3168, -1 }},
+    {{ 1037, 1042, 2130, -1 }},
+    {{ 486, -1, 2131, -1 }},
+    {{ 3144, -1, 6464, -1 }},
+    {{ 2133, -1, 6930, 2136 }},
+    {{ 6916, 2134, 2412, -1 }},
+    {{ 6924, 2135, -1, 908 }},
+    {{ 697, 701, -1, -1 }},
+    {{ -1, 2137, 6949, 6950 }},
+    {{ 2138, 6945, -1, 4900 }},
+    {{ 6941, -1, 15, -1 }},
+    {{ -1, 1164, 2140, 6989 }},
+    {{ 2141, -1, 6984, 248 }},
+    {{ 6974, 2142, 1950, -1 }},
+    {{ 6980, -1, -1, 5345 }},
+    {{ 2144, -1, 7068, 1186 }},
+    {{ 657, 2145, 662, -1 }},
+    {{ 4346, 4360, -1, 2146 }},
+    {{ -1, 4369, 12, -1 }},
+    {{ 1191, -1, 7111, 2148 }},
+    {{ -1, 2149, 7142, 7147 }},
+    {{ 1712, 1201, -1, 7137 }},
+    {{ -1, 3213, 1718, 1213 }},
+    {{ 2152, 3563, -1, 3575 }},
+    {{ 3238, 3551, 2153, -1 }},
+    {{ 2154, -1, 3242, 16 }},
+    {{ 1277, 1282, 2155, -1 }},
+    {{ 520, -1, 2156, -1 }},
+    {{ 3111, -1, 7649, -1 }},
+    {{ 24, -1, 1421, 2158 }},
+    {{ -1, 2159, 179, 1436 }},
+    {{ 507, 3830, -1, 2160 }},
+    {{ -1, 7350, 2161, 7372 }},
+    {{ -1, -1, 7364, 1053 }},
+    {{ -1, 2163, 1775, 8056 }},
+    {{ 2164, 7988, -1, 8002 }},
+    {{ 1769, 7973, 1588, -1 }},
+    {{ -1, 2166, 3931, 1530 }},
+    {{ 854, 2167, -1, 1521 }},
+    {{ 3923, 3926, -1, 2168 }},
+    {{ -1, 1013, 2169, 1022 }},
+    {{ -1, -1, 7716, 6285 }},
+    {{ -1, 4046, 1570, 2171 }},
+    {{ -1, 2172, 196, 1585 }},
+    {{ 854, 4049, -1, 2173 }},
+    {{ -1, 7721, 564, 7758 }},
+    {{ 2175, 7703, -1, 7709 }},
+    {{ 3565, 982, 2176, -1 }},
+    {{ 3570, -1, 2177, 7700 }},
+    {{ -1, -1, 1031, 2092 }},
+    {{ -1, 7721, 2179, 7758 }},
+    {{ 2180, -1, 7748, 1053 }},
+    {{ 2181, 7738, 7743, -1 }},
+    {{ -1, 1042, 1036, -1 }},
+    {{ 522, -1, 3606, 2183 }},
+    {{ -1, 2184, 7941, 7952 }},
+    {{ 2185, 7931, -1, 1230 }},
+    {{ 2186, 7923, 7927, -1 }},
+    {{ -1, 158, 1057, -1 }},
+    {{ -1, 2188, 2194, 8056 }},
+    {{ 2189, 7988, -1, 8002 }},
+    {{ 2190, 7973, 2192, -1 }},
+    {{ 3627, 1266, 2191, -1 }},
+    {{ -1, -1, 1063, 5742 }},
+    {{ 2193, -1, 7983, 16 }},
+    {{ -1, 1282, 1066, -1 }},
+    {{ 2195, -1, 8037, 8051 }},
+    {{ 3638, 2196, 8031, -1 }},
+    {{ 2197, 8027, -1, 20 }},
+    {{ -1, 173, 1074, -1 }},
+    {{ 752, 2199, -1, 1879 }},
+    {{ 4446, 4449, -1, 2200 }},
+    {{ -1, 4893, 2201, 5218 }},
+    {{ -1, -1, 1010, 6209 }},
+    {{ -1, 5246, 2203, 6330 }},
+    {{ 2204, -1, 6322, 3616 }},
+    {{ -1, 5251, 6319, -1 }},
+    {{ 143, 1128, -1, 2206 }},
+    {{ -1, 1135, 2207, 6840 }},
+    {{ 2208, -1, 6836, 3218 }},
+    {{ 3173, 1496, 1646, -1 }},
+    {{ 119, -1, 962, 2210 }},
+    {{ -1, 2211, 970, 6022 }},
+    {{ 2212, 6009, -1, 4900 }},
+    {{ 4804, 1870, 1425, -1 }},
+    {{ 1364, 2214, 2227, -1 }},
+    {{ 1393, 1408, -1, 2215 }},
+    {{ -1, 204, 2216, 2220 }},
+    {{ 24, -1, 1421, 2217 }},
+    {{ -1, 1426, 179, 2218 }},
+    {{ -1, 1370, 1372, 2219 }},
+    {{ -1, 7526, -1, 8056 }},
+    {{ -1, 1445, 2221, 2224 }},
+    {{ 522, -1, 1451, 2222 }},
+    {{ -1, 1762, 1377, 2223 }},
+    {{ -1, 7953, -1, 7525 }},
+    {{ -1, 1460, 2225, 8056 }},
+    {{ 1776, -1, 8037, 2226 }},
+    {{ -1, 8052, -1, 7952 }},
+    {{ 1464, -1, 1479, 2228 }},
+    {{ -1, 2229, 247, 2233 }},
+    {{ 29, 1492, -1, 2230 }},
+    {{ -1, 185, 1503, 2231 }},
+    {{ -1, 1384, 1386, 2232 }},
+    {{ -1, 6609, -1, 8056 }},
+    {{ -1, 2234, 1525, 1530 }},
+    {{ 854, 1517, -1, 2235 }},
+    {{ -1, 1391, 1973, 2236 }},
+    {{ -1, 1059, -1, 6608 }},
+    {{ 1535, 1394, 2238, -1 }},
+    {{ 1564, -1, 45, 2239 }},
+    {{ -1, 8, 1570, 2240 }},
+    {{ -1, 1575, 196, 2241 }},
+    {{ -1, 1404, 1406, 2242 }},
+    {{ -1, 8057, -1, 8056 }},
+    {{ 1409, 1616, -1, 2244 }},
+    {{ -1, 1633, 2245, 2252 }},
+    {{ 1645, -1, 2246, 2249 }},
+    {{ 461, -1, 1651, 2247 }},
+    {{ -1, 3213, 1419, 2248 }},
+    {{ -1, 1214, -1, 7255 }},
+    {{ -1, 3219, 2250, 3544 }},
+    {{ 3230, -1, 1235, 2251 }},
+    {{ -1, 1241, -1, 7467 }},
+    {{ -1, 1660, 2253, 3269 }},
+    {{ 467, -1, 2254, 3616 }},
+    {{ 3260, -1, 7899, 2255 }},
+    {{ -1, 7907, -1, 1213 }},
+    {{ 1665, 1676, -1, 2257 }},
+    {{ -1, 3348, 2258, 1690 }},
+    {{ 207, -1, 2259, 1053 }},
+    {{ 3366, -1, 1190, 2260 }},
+    {{ -1, 6513, -1, 1213 }},
+    {{ 180, -1, 1430, 2262 }},
+    {{ -1, 2263, 7457, 7467 }},
+    {{ -1, 7451, -1, 1230 }},
+    {{ 3607, -1, 7899, 2004 }},
+    {{ 1780, 2266, 2270, -1 }},
+    {{ 1797, 75, -1, 2267 }},
+    {{ -1, 79, 12, 2268 }},
+    {{ -1, 226, 1806, 2269 }},
+    {{ -1, 1469, 1471, 2242 }},
+    {{ 83, -1, 1813, 2271 }},
+    {{ -1, 2272, 689, 4521 }},
+    {{ 4466, 2273, -1, 1821 }},
+    {{ 681, 684, -1, 2274 }},
+    {{ -1, 1490, -1, -1 }},
+    {{ 2276, -1, 1850, 2281 }},
+    {{ 1825, 2277, 1844, -1 }},
+    {{ 4583, 1831, -1, 2278 }},
+    {{ -1, 2279, 12, 1840 }},
+    {{ 711, 714, -1, 2280 }},
+    {{ -1, 1836, -1, -1 }},
+    {{ -1, 2282, 1883, 1894 }},
+    {{ 1869, 2283, -1, 4900 }},
+    {{ 752, 1875, -1, 2284 }},
+    {{ -1, 1490, 4895, 1478 }},
+    {{ 1900, 1905, -1, 2286 }},
+    {{ -1, 822, 2287, 1916 }},
+    {{ 1495, -1, 5235, 2288 }},
+    {{ -1, 5241, -1, 3544 }},
+    {{ 285, 1536, 2290, -1 }},
+    {{ 312, -1, 321, 2291 }},
+    {{ -1, 1544, 2439, 2292 }},
+    {{ -1, 1516, 2013, 2293 }},
+    {{ -1, 1988, 1550, 2242 }},
+    {{ 37, 1552, -1, 2295 }},
+    {{ -1, 352, 2296, 2303 }},
+    {{ 2608, -1, 2297, 2300 }},
+    {{ 357, -1, 2021, 2298 }},
+    {{ -1, -1, 1419, 2299 }},
+    {{ -1, -1, -1, 7255 }},
+    {{ -1, 1726, 2301, 1740 }},
+    {{ 1562, -1, 1733, 2302 }},
+    {{ -1, 1738, -1, 7467 }},
+    {{ -1, 2632, 2304, 1766 }},
+    {{ 2639, -1, 2305, 1761 }},
+    {{ 2645, -1, 7899, 2255 }},
+    {{ 46, -1, 390, 2307 }},
+    {{ -1, 2308, 402, 2039 }},
+    {{ 1869, 1874, -1, 2309 }},
+    {{ -1, 4901, 4912, 2236 }},
+    {{ -1, 406, -1, 2311 }},
+    {{ -1, 411, 2312, 2931 }},
+    {{ 828, -1, 5285, 2313 }},
+    {{ -1, 2928, -1, 6544 }},
+    {{ 197, -1, 1579, 2034 }},
+    {{ 1593, 1598, 2316, -1 }},
+    {{ 3005, -1, 2317, 2321 }},
+    {{ 423, -1, 427, 2318 }},
+    {{ -1, 1868, 2093, 2319 }},
+    {{ -1, 765, 1606, 2320 }},
+    {{ -1, 5000, -1, 8056 }},
+    {{ -1, 8, 2322, 2325 }},
+    {{ 431, -1, 2101, 2323 }},
+    {{ -1, -1, 1608, 2324 }},
+    {{ -1, -1, -1, 7525 }},
+    {{ -1, 2061, 2326, 2074 }},
+    {{ 1614, -1, 2066, 2327 }},
+    {{ -1, 2071, -1, 7952 }},
+    {{ 1617, 3090, -1, 2329 }},
+    {{ -1, 3115, 2330, 3138 }},
+    {{ 1628, -1, 2331, 3132 }},
+    {{ 448, -1, 2332, 2150 }},
+    {{ 3128, -1, 7111, 2333 }},
+    {{ -1, 2149, -1, 7147 }},
+    {{ 3173, 19, 2335, -1 }},
+    {{ 54, -1, 2132, 2336 }},
+    {{ -1, 1164, 1648, 2337 }},
+    {{ -1, 6990, -1, 1987 }},
+    {{ 1191, -1, 7111, 2019 }},
+    {{ -1, 1660, 2340, 3269 }},
+    {{ 2341, -1, 3259, 3616 }},
+    {{ 468, 3249, 2342, -1 }},
+    {{ 3255, -1, 1152, 2343 }},
+    {{ -1, 7859, -1, 6989 }},
+    {{ 2345, 1676, -1, 2352 }},
+    {{ 3276, 1666, 2346, -1 }},
+    {{ 3304, -1, 2347, 2349 }},
+    {{ 60, -1, 962, 2348 }},
+    {{ -1, 6008, 1674, 343 }},
+    {{ -1, -1, 2350, 977 }},
+    {{ 3319, -1, 6029, 2351 }},
+    {{ -1, 975, -1, 6040 }},
+    {{ -1, 3348, 2353, 1690 }},
+    {{ 2354, -1, 3365, 1053 }},
+    {{ 208, 3360, 2355, -1 }},
+    {{ 1688, -1, 1152, 351 }},
+    {{ 3472, 3489, 2357, -1 }},
+    {{ 83, -1, 7068, 2358 }},
+    {{ -1, 2359, 689, 7078 }},
+    {{ 4466, -1, -1, 7074 }},
+    {{ 2022, -1, 7111, 1710 }},
+    {{ 2362, 1750, -1, 1446 }},
+    {{ 514, 3551, 2363, -1 }},
+    {{ 221, -1, 2364, 16 }},
+    {{ 3559, -1, 962, 356 }},
+    {{ 7868, 3608, 2366, -1 }},
+    {{ 83, -1, 7068, 2367 }},
+    {{ -1, -1, 689, 7078 }},
+    {{ 531, 2369, 2376, -1 }},
+    {{ 546, 555, -1, 2370 }},
+    {{ -1, 3814, 2371, 2374 }},
+    {{ 24, -1, 1421, 2372 }},
+    {{ -1, 2373, 179, 1436 }},
+    {{ 507, 3830, -1, -1 }},
+    {{ -1, 562, 1450, 2375 }},
+    {{ -1, 1789, 1775, 2242 }},
+    {{ 565, -1, 570, 2377 }},
+    {{ -1, 69, 3912, 2378 }},
+    {{ -1, 2379, 3931, 1530 }},
+    {{ 854, 2380, -1, 1521 }},
+    {{ 3923, 3926, -1, -1 }},
+    {{ 577, 72, 2382, -1 }},
+    {{ 593, -1, 4040, 2383 }},
+    {{ -1, 4046, 1570, 2384 }},
+    {{ -1, 2385, 196, 1585 }},
+    {{ 854, 4049, -1, -1 }},
+    {{ 76, 607, -1, 2387 }},
+    {{ -1, 619, 2388, 2391 }},
+    {{ 1645, -1, 1650, 2389 }},
+    {{ -1, 3219, 3229, 2390 }},
+    {{ -1, 3545, -1, 7525 }},
+    {{ -1, 627, 2392, 4192 }},
+    {{ 467, -1, 3259, 2393 }},
+    {{ -1, 1527, -1, 7952 }},
+    {{ 630, 634, -1, 2395 }},
+    {{ -1, 642, 2396, 645 }},
+    {{ -1, -1, 4250, 2397 }},
+    {{ -1, 4255, -1, 6544 }},
+    {{ 668, -1, 4419, 2399 }},
+    {{ -1, 2400, 4454, 4460 }},
+    {{ 678, 2401, -1, 4900 }},
+    {{ 752, 2402, -1, 1879 }},
+    {{ 4446, 4449, -1, -1 }},
+    {{ 531, 2404, 4576, -1 }},
+    {{ 546, 4545, -1, 2405 }},
+    {{ -1, 4558, 2157, 2406 }},
+    {{ -1, 2407, 1450, 2162 }},
+    {{ 4570, 4573, -1, -1 }},
+    {{ 697, 701, -1, 2409 }},
+    {{ -1, 706, 1644, 2410 }},
+    {{ -1, 1834, 4191, 2411 }},
+    {{ -1, 4193, -1, 8056 }},
+    {{ 83, -1, 4673, 2413 }},
+    {{ -1, 2414, 689, 4691 }},
+    {{ 4466, 2415, -1, 4686 }},
+    {{ 681, 2416, -1, 283 }},
+    {{ 724, 4683, -1, -1 }},
+    {{ 2418, -1, 4737, 2426 }},
+    {{ 4701, 2419, 4732, -1 }},
+    {{ 4583, 2420, -1, 2423 }},
+    {{ 697, 4709, -1, 2421 }},
+    {{ -1, 2422, 1644, 626 }},
+    {{ 4719, 4721, -1, -1 }},
+    {{ -1, 2424, 12, 4728 }},
+    {{ 711, 2425, -1, 80 }},
+    {{ 731, 4726, -1, -1 }},
+    {{ -1, 2427, 4784, 4789 }},
+    {{ 2428, 738, -1, 4778 }},
+    {{ 4804, 2429, 15, -1 }},
+    {{ 92, 2430, -1, 802 }},
+    {{ 737, 4683, -1, -1 }},
+    {{ -1, 1487, 2432, 2436 }},
+    {{ 2433, -1, 4931, 2036 }},
+    {{ 4922, 2434, 5352, -1 }},
+    {{ 5323, 2435, -1, 4927 }},
+    {{ 106, 2430, -1, 1134 }},
+    {{ -1, 765, 2437, 4999 }},
+    {{ 2438, -1, 5533, 5547 }},
+    {{ 4987, 2042, 5527, -1 }},
+    {{ 2440, -1, 2445, 248 }},
+    {{ 5302, 1945, 2441, -1 }},
+    {{ 5353, -1, 1152, 2442 }},
+    {{ -1, 2443, 1168, 6989 }},
+    {{ 5361, 2444, -1, 6969 }},
+    {{ -1, 684, -1, 283 }},
+    {{ 2446, -1, 5385, 1961 }},
+    {{ 5370, 2447, 1185, -1 }},
+    {{ 7024, 842, -1, 2448 }},
+    {{ -1, 2449, 12, 7063 }},
+    {{ -1, 714, -1, 80 }},
+    {{ 2213, 286, 2451, -1 }},
+    {{ 2265, -1, 2275, 2452 }},
+    {{ -1, 296, 247, 2453 }},
+    {{ -1, 1389, 1525, 2454 }},
+    {{ -1, 1988, 1531, 2242 }},
+    {{ 299, 304, -1, 2456 }},
+    {{ -1, 2344, 2457, 2461 }},
+    {{ 24, -1, 2458, 35 }},
+    {{ 2356, -1, 2360, 2459 }},
+    {{ -1, 261, 1718, 2460 }},
+    {{ -1, 1723, -1, 7255 }},
+    {{ -1, 2361, 2462, 1459 }},
+    {{ 522, -1, 2463, 1455 }},
+    {{ 2365, -1, 7899, 2464 }},
+    {{ -1, -1, -1, 1213 }},
+    {{ 322, -1, 2417, 2466 }},
+    {{ -1, 2467, 2432, 2436 }},
+    {{ 1869, 1488, -1, 2309 }},
+    {{ 29, 1492, -1, 2469 }},
+    {{ -1, 185, 2470, 1507 }},
+    {{ 828, -1, 5285, 2471 }},
+    {{ -1, -1, -1, 6544 }},
+    {{ 254, -1, 1977, 2034 }},
+    {{ 326, 331, 2474, -1 }},
+    {{ 2498, -1, 2475, 2478 }},
+    {{ 2513, -1, 390, 2476 }},
+    {{ -1, 1868, 402, 2477 }},
+    {{ -1, 765, 2040, 2320 }},
+    {{ -1, 8, 2479, 40 }},
+    {{ 2518, -1, 2522, 2480 }},
+    {{ -1, 275, 2948, 2481 }},
+    {{ -1, 2058, -1, 7525 }},
+    {{ 339, 2547, -1, 2483 }},
+    {{ -1, 2570, 2484, 2584 }},
+    {{ 349, -1, 2485, 3218 }},
+    {{ 461, -1, 2486, 1655 }},
+    {{ 2581, -1, 7111, 2487 }},
+    {{ -1, -1, -1, 7147 }},
+    {{ 63, 25, 2489, -1 }},
+    {{ 2610, -1, 2614, 2490 }},
+    {{ -1, 1164, 1168, 2337 }},
+    {{ 2022, -1, 7111, 2492 }},
+    {{ -1, 2493, 7142, 7147 }},
+    {{ -1, 2027, -1, 7137 }},
+    {{ -1, 2632, 2495, 1766 }},
+    {{ 2496, -1, 2644, 1761 }},
+    {{ 523, 527, 2497, -1 }},
+    {{ 2641, -1, 1152, 2343 }},
+    {{ 360, 2499, 2507, -1 }},
+    {{ 370, 2702, -1, 2500 }},
+    {{ -1, 79, 2501, 2504 }},
+    {{ -1, -1, 648, 2502 }},
+    {{ -1, 4299, 653, 2503 }},
+    {{ -1, 4313, -1, 7525 }},
+    {{ -1, 226, 2505, 1807 }},
+    {{ 522, -1, 3606, 2506 }},
+    {{ -1, -1, -1, 7952 }},
+    {{ 2708, -1, 374, 2508 }},
+    {{ -1, 2509, 2744, 2753 }},
+    {{ 4466, -1, -1, 2510 }},
+    {{ -1, 379, 1929, 2511 }},
+    {{ -1, 1935, -1, 6608 }},
+    {{ 2513, -1, 390, 401 }},
+    {{ 380, 2514, 386, -1 }},
+    {{ 2777, 2788, -1, 2515 }},
+    {{ -1, -1, 12, 2516 }},
+    {{ -1, 385, 2182, 2517 }},
+    {{ -1, 2188, -1, 8056 }},
+    {{ 5302, 1945, 2519, -1 }},
+    {{ 5353, -1, 1152, 2520 }},
+    {{ -1, 2521, 1168, 6989 }},
+    {{ 5361, -1, -1, 6969 }},
+    {{ 2102, -1, 5385, 2053 }},
+    {{ 285, 2960, 2524, -1 }},
+    {{ 312, -1, 2525, 2528 }},
+    {{ 2968, -1, 2972, 2526 }},
+    {{ -1, 1487, 2432, 2527 }},
+    {{ -1, 765, 2437, 2320 }},
+    {{ -1, 2007, 2529, 2532 }},
+    {{ 2518, -1, 2977, 2530 }},
+    {{ -1, 249, 5426, 2531 }},
+    {{ -1, 1967, -1, 7525 }},
+    {{ -1, 1516, 2533, 2014 }},
+    {{ 2978, -1, 1977, 2506 }},
+    {{ 37, 2981, -1, 2535 }},
+    {{ -1, 352, 2536, 2995 }},
+    {{ 2608, -1, 2537, 2990 }},
+    {{ 357, -1, 2538, 260 }},
+    {{ 421, -1, 7111, 2487 }},
+    {{ 360, 369, 2540, -1 }},
+    {{ 3007, -1, 3011, 2541 }},
+    {{ -1, 44, 2744, 2542 }},
+    {{ -1, 4522, 2754, 330 }},
+    {{ 403, -1, 2882, 2118 }},
+    {{ 2102, -1, 5385, 2545 }},
+    {{ -1, 2546, 1208, 1213 }},
+    {{ -1, 2108, -1, 7182 }},
+    {{ 2548, 3090, -1, 2560 }},
+    {{ 3062, 3069, 2549, -1 }},
+    {{ 3005, -1, 2550, 2557 }},
+    {{ 423, -1, 2551, 2554 }},
+    {{ 3075, -1, 3079, 2552 }},
+    {{ -1, 398, 3045, 2553 }},
+    {{ -1, 2867, -1, 4999 }},
+    {{ -1, 1868, 2555, 2097 }},
+    {{ 3082, -1, 2882, 2556 }},
+    {{ -1, -1, -1, 5436 }},
+    {{ -1, 8, 2558, 3086 }},
+    {{ 431, -1, 2559, 274 }},
+    {{ 440, -1, 5385, 2464 }},
+    {{ -1, 3115, 2561, 3138 }},
+    {{ 2562, -1, 2566, 3132 }},
+    {{ 3173, 19, 2563, -1 }},
+    {{ 54, -1, 2564, 2139 }},
+    {{ 446, -1, 6930, 2565 }},
+    {{ -1, -1, -1, 6950 }},
+    {{ 2567, -1, 3127, 2150 }},
+    {{ 462, 3489, 2568, -1 }},
+    {{ 450, -1, 7068, 2569 }},
+    {{ -1, 1187, -1, 7078 }},
+    {{ 2571, 3162, -1, 1639 }},
+    {{ 3153, 3291, 2572, -1 }},
+    {{ 3304, -1, 2573, 3158 }},
+    {{ 60, -1, 2574, 969 }},
+    {{ 446, -1, 5995, 2575 }},
+    {{ -1, -1, -1, 6005 }},
+    {{ 487, 495, 2577, -1 }},
+    {{ 3175, -1, 3179, 2578 }},
+    {{ -1, -1, 3455, 2579 }},
+    {{ -1, 3464, -1, 1530 }},
+    {{ 2133, -1, 6930, 2122 }},
+    {{ 7086, 1192, 2582, -1 }},
+    {{ 83, -1, 4673, 2583 }},
+    {{ -1, -1, 689, 4691 }},
+    {{ -1, 1660, 2585, 3269 }},
+    {{ 2586, -1, 3259, 3616 }},
+    {{ 2587, 3249, 3254, -1 }},
+    {{ 524, 1306, 2588, -1 }},
+    {{ 470, -1, 7793, 2589 }},
+    {{ -1, 7800, -1, 6756 }},
+    {{ 876, 3277, 2591, -1 }},
+    {{ 898, -1, 2592, 2594 }},
+    {{ 3284, -1, 3285, 2593 }},
+    {{ -1, 1487, 5738, 343 }},
+    {{ -1, 2007, 2595, 2012 }},
+    {{ 3290, -1, 5744, 2596 }},
+    {{ -1, 249, -1, 1966 }},
+    {{ 939, 946, 2598, -1 }},
+    {{ 3306, -1, 3310, 2599 }},
+    {{ -1, -1, 5944, 2600 }},
+    {{ -1, 4522, -1, 1987 }},
+    {{ 963, -1, 5995, 2124 }},
+    {{ 2603, 3332, -1, 1682 }},
+    {{ 3321, 982, 2604, -1 }},
+    {{ 6102, -1, 2605, 1679 }},
+    {{ 989, -1, 2606, 2092 }},
+    {{ 480, -1, 6128, 2607 }},
+    {{ -1, 398, -1, 2866 }},
+    {{ 63, 25, 2609, -1 }},
+    {{ 2610, -1, 2614, 1163 }},
+    {{ 1142, 1697, 2611, -1 }},
+    {{ 6900, -1, 2398, 2612 }},
+    {{ -1, 2613, 689, 6912 }},
+    {{ 6908, -1, -1, 1821 }},
+    {{ 2615, -1, 6930, 1159 }},
+    {{ 6916, 2616, 2412, -1 }},
+    {{ 6924, 1155, -1, 908 }},
+    {{ 3473, 3478, 2618, -1 }},
+    {{ 3485, -1, 570, 2619 }},
+    {{ -1, 944, 3912, 945 }},
+    {{ 668, -1, 4419, 2621 }},
+    {{ -1, 2622, 4454, 4460 }},
+    {{ 678, -1, -1, 4900 }},
+    {{ -1, 2624, 4538, 1987 }},
+    {{ -1, -1, -1, 1972 }},
+    {{ -1, 1726, 2626, 1740 }},
+    {{ 2627, -1, 1733, 1737 }},
+    {{ 2628, 216, 7406, -1 }},
+    {{ 1075, 7379, 2629, -1 }},
+    {{ 1097, -1, 1101, 2630 }},
+    {{ -1, -1, 6745, 6756 }},
+    {{ -1, 2632, 2638, 1766 }},
+    {{ 2633, 1750, -1, 1755 }},
+    {{ 2634, 3551, 220, -1 }},
+    {{ 1263, 1266, 2635, -1 }},
+    {{ 1271, -1, 2636, 5742 }},
+    {{ 421, -1, 7592, 2637 }},
+    {{ -1, 1487, -1, 5739 }},
+    {{ 2639, -1, 2644, 1761 }},
+    {{ 523, 527, 2640, -1 }},
+    {{ 2641, -1, 1152, 7858 }},
+    {{ 1142, 7848, 2642, -1 }},
+    {{ 6900, -1, 2398, 2643 }},
+    {{ -1, -1, 689, 6912 }},
+    {{ 2645, -1, 7899, 7906 }},
+    {{ 2646, 3608, 1185, -1 }},
+    {{ 3473, 7869, 2647, -1 }},
+    {{ 3485, -1, 570, 464 }},
+    {{ 3652, 2649, 2654, -1 }},
+    {{ 3675, 3686, -1, 2650 }},
+    {{ -1, 204, 534, 2651 }},
+    {{ -1, 1445, 2652, 3702 }},
+    {{ 522, -1, 1451, 2653 }},
+    {{ -1, -1, 1377, 7952 }},
+    {{ 3704, -1, 3709, 2655 }},
+    {{ -1, 539, 3725, 2656 }},
+    {{ -1, 543, 1525, 2657 }},
+    {{ -1, 2658, 1531, 8056 }},
+    {{ 1989, -1, -1, 8002 }},
+    {{ 556, 3781, -1, 2660 }},
+    {{ -1, 3796, 2661, 3807 }},
+    {{ 1645, -1, 2662, 3805 }},
+    {{ 461, -1, 1651, 2663 }},
+    {{ -1, -1, 1419, 1213 }},
+    {{ 1700, -1, 1705, 2665 }},
+    {{ -1, 2666, 1718, 1722 }},
+    {{ 1424, -1, -1, 7182 }},
+    {{ -1, 1611, 1440, 7525 }},
+    {{ 3872, -1, 3885, 2669 }},
+    {{ -1, 2670, 1883, 2673 }},
+    {{ 3891, 573, -1, 2671 }},
+    {{ -1, 2672, 4912, 5295 }},
+    {{ 4902, -1, -1, 1032 }},
+    {{ -1, 2674, 1895, 4999 }},
+    {{ 3898, 2675, -1, 5511 }},
+    {{ 4973, -1, -1, 7709 }},
+    {{ 29, 575, -1, 2677 }},
+    {{ -1, -1, 1503, 2678 }},
+    {{ -1, 2679, 1512, 6608 }},
+    {{ -1, 6558, -1, 6570 }},
+    {{ 3913, -1, 1955, 2681 }},
+    {{ -1, 2682, 5426, 1966 }},
+    {{ 3921, 2683, -1, 1230 }},
+    {{ 5418, -1, -1, 7340 }},
+    {{ -1, 2685, 1973, 7758 }},
+    {{ -1, 1027, -1, 1032 }},
+    {{ 3935, 578, 2687, -1 }},
+    {{ 312, -1, 3964, 2688 }},
+    {{ -1, 584, 2439, 2689 }},
+    {{ -1, 1516, 2013, 2690 }},
+    {{ -1, -1, 1550, 8056 }},
+    {{ 4041, -1, 390, 2692 }},
+    {{ -1, 2693, 402, 2695 }},
+    {{ 1869, 1874, -1, 2694 }},
+    {{ -1, -1, 4912, 5295 }},
+    {{ -1, 2696, 2040, 4999 }},
+    {{ 766, -1, -1, 5511 }},
+    {{ 2043, -1, 2048, 2698 }},
+    {{ -1, 2699, 2948, 2057 }},
+    {{ 1573, -1, -1, 1230 }},
+    {{ -1, 2701, 1589, 8056 }},
+    {{ -1, 7988, -1, 8002 }},
+    {{ 2703, 607, -1, 618 }},
+    {{ 597, 601, 2704, -1 }},
+    {{ 4090, -1, 2705, 78 }},
+    {{ 4102, -1, 427, 2706 }},
+    {{ -1, 4107, 2093, 2707 }},
+    {{ -1, -1, 1606, 4999 }},
+    {{ 657, 2709, 2720, -1 }},
+    {{ 4346, 2710, -1, 2714 }},
+    {{ 4361, 607, -1, 2711 }},
+    {{ -1, 619, 2712, 4367 }},
+    {{ 1645, -1, 1650, 2713 }},
+    {{ -1, -1, 3229, 3544 }},
+    {{ -1, 4369, 2715, 2718 }},
+    {{ -1, -1, 648, 2716 }},
+    {{ -1, 2717, 653, 4312 }},
+    {{ 507, -1, -1, 4300 }},
+    {{ -1, -1, 1806, 2719 }},
+    {{ -1, 2701, 1811, 8056 }},
+    {{ 4374, -1, 4383, 2721 }},
+    {{ -1, 2722, 689, 2725 }},
+    {{ 4389, 665, -1, 2723 }},
+    {{ -1, 2724, 1929, 1934 }},
+    {{ 1823, -1, -1, 1926 }},
+    {{ -1, 2726, 4538, 1987 }},
+    {{ 4394, 2727, -1, 1972 }},
+    {{ 4533, -1, -1, 7709 }},
+    {{ 4396, 2729, 4413, -1 }},
+    {{ 4409, 670, -1, 2730 }},
+    {{ -1, 674, 12, 2731 }},
+    {{ -1, 2732, 2182, 2187 }},
+    {{ 1842, -1, -1, 2178 }},
+    {{ 4420, -1, 4737, 2734 }},
+    {{ -1, 2735, 4784, 4789 }},
+    {{ 4434, 2736, -1, 4778 }},
+    {{ 4439, 2737, -1, 4894 }},
+    {{ 4773, -1, -1, 4892 }},
+    {{ -1, 2739, 4895, 5245 }},
+    {{ -1, 5221, -1, 5224 }},
+    {{ -1, 2741, 1895, 4999 }},
+    {{ 2742, 4972, -1, 5511 }},
+    {{ 4463, 2743, 4967, -1 }},
+    {{ 4960, -1, -1, 7609 }},
+    {{ 2745, -1, 4516, 2749 }},
+    {{ 4507, 2746, 1950, -1 }},
+    {{ 4513, 692, -1, 2747 }},
+    {{ -1, 2748, -1, 1138 }},
+    {{ 5347, -1, -1, 80 }},
+    {{ -1, 2750, 5426, 1966 }},
+    {{ 2751, 5417, -1, 1230 }},
+    {{ 251, 2752, 5414, -1 }},
+    {{ 5407, -1, -1, 802 }},
+    {{ -1, 4522, 2754, 1987 }},
+    {{ 2755, -1, 1977, 1982 }},
+    {{ 4540, 2756, 5527, -1 }},
+    {{ 256, 2757, -1, 20 }},
+    {{ 5524, -1, -1, 1134 }},
+    {{ 3652, 2759, 537, -1 }},
+    {{ 3675, 3686, -1, 2760 }},
+    {{ -1, 204, 534, 2761 }},
+    {{ -1, 1445, 1375, 661 }},
+    {{ 4546, 4550, -1, 2763 }},
+    {{ -1, 3796, 2764, 4555 }},
+    {{ 1645, -1, 1417, 2713 }},
+    {{ 24, -1, 1421, 2766 }},
+    {{ -1, 2767, 179, 1436 }},
+    {{ 507, -1, -1, 2160 }},
+    {{ -1, 2701, 1775, 8056 }},
+    {{ 565, -1, 570, 2770 }},
+    {{ -1, 2771, 3912, 2774 }},
+    {{ 29, 2772, -1, 70 }},
+    {{ 3901, 3905, -1, 2773 }},
+    {{ -1, -1, 284, 1916 }},
+    {{ -1, 2775, 3931, 1530 }},
+    {{ 854, 2776, -1, 1521 }},
+    {{ 3923, -1, -1, 2168 }},
+    {{ 577, 2778, 2782, -1 }},
+    {{ 4585, 4590, -1, 2779 }},
+    {{ -1, 4011, 2780, 4596 }},
+    {{ 2608, -1, -1, 2781 }},
+    {{ -1, -1, 591, 1740 }},
+    {{ 593, -1, 4040, 2783 }},
+    {{ -1, 2784, 1570, 2786 }},
+    {{ -1, 406, -1, 2785 }},
+    {{ -1, -1, 2926, 2931 }},
+    {{ -1, 2787, 196, 1585 }},
+    {{ 854, -1, -1, 2173 }},
+    {{ 2789, 701, -1, 2793 }},
+    {{ 4598, 698, 2790, -1 }},
+    {{ 4610, -1, 4101, 2791 }},
+    {{ -1, 8, -1, 2792 }},
+    {{ -1, -1, 606, 2074 }},
+    {{ -1, 706, 2794, 1833 }},
+    {{ 2208, -1, 1650, 3218 }},
+    {{ 657, 2796, 662, -1 }},
+    {{ 4346, 2797, -1, 2799 }},
+    {{ 4361, 607, -1, 2798 }},
+    {{ -1, 619, 1644, 672 }},
+    {{ -1, 2800, 12, 86 }},
+    {{ 630, 634, -1, 2801 }},
+    {{ -1, -1, 81, 645 }},
+    {{ 668, -1, 4419, 2803 }},
+    {{ -1, 2804, 4454, 4460 }},
+    {{ 678, 2805, -1, 4900 }},
+    {{ 752, 2806, -1, 1879 }},
+    {{ 4446, -1, -1, 2200 }},
+    {{ 96, 2808, 30, -1 }},
+    {{ 100, 794, -1, 680 }},
+    {{ -1, 2739, 284, 2202 }},
+    {{ -1, 2811, 4538, 1987 }},
+    {{ 2812, 4697, -1, 1972 }},
+    {{ 855, 2813, 862, -1 }},
+    {{ 4525, -1, -1, 7609 }},
+    {{ 531, 2815, 4576, -1 }},
+    {{ 546, 2816, -1, 2819 }},
+    {{ 4546, 4550, -1, 2817 }},
+    {{ -1, 3796, 3804, 2818 }},
+    {{ -1, -1, 466, 3811 }},
+    {{ -1, 2820, 2157, 2822 }},
+    {{ 4559, 4563, -1, 2821 }},
+    {{ -1, -1, 206, 3827 }},
+    {{ -1, 2823, 1450, 2162 }},
+    {{ 4570, -1, -1, 563 }},
+    {{ 577, 2825, 592, -1 }},
+    {{ 4585, 4590, -1, 2826 }},
+    {{ -1, 4011, 74, 2827 }},
+    {{ -1, -1, 2638, 2162 }},
+    {{ -1, 2829, 4191, 4192 }},
+    {{ -1, 4187, -1, 1446 }},
+    {{ -1, 2831, 81, 645 }},
+    {{ -1, 1922, -1, 4244 }},
+    {{ 83, -1, 4673, 2833 }},
+    {{ -1, 2834, 689, 4691 }},
+    {{ 4466, 2835, -1, 4686 }},
+    {{ 681, 2836, -1, 283 }},
+    {{ 724, -1, -1, 687 }},
+    {{ 2838, -1, 4737, 2848 }},
+    {{ 4701, 2839, 4732, -1 }},
+    {{ 4583, 2840, -1, 2845 }},
+    {{ 697, 2841, -1, 2843 }},
+    {{ 4710, 4711, -1, 2842 }},
+    {{ -1, -1, 615, 4628 }},
+    {{ -1, 2844, 1644, 626 }},
+    {{ 4719, -1, -1, 707 }},
+    {{ -1, 2846, 12, 4728 }},
+    {{ 711, 2847, -1, 80 }},
+    {{ 731, -1, -1, 717 }},
+    {{ -1, 2849, 4784, 4789 }},
+    {{ 2850, 2853, -1, 4778 }},
+    {{ 4804, 2851, 15, -1 }},
+    {{ 92, 2852, -1, 802 }},
+    {{ 737, -1, -1, 749 }},
+    {{ 2854, 4758, -1, 4894 }},
+    {{ 753, 2855, 5194, -1 }},
+    {{ 741, -1, -1, 4878 }},
+    {{ 770, 2857, 784, -1 }},
+    {{ 4806, 4810, -1, 2858 }},
+    {{ -1, -1, -1, 5063 }},
+    {{ -1, 2860, 935, 5141 }},
+    {{ -1, 5138, -1, 205 }},
+    {{ 2862, -1, 4931, 4937 }},
+    {{ 4922, 2863, 5352, -1 }},
+    {{ 5323, 2864, -1, 4927 }},
+    {{ 106, 2865, -1, 1134 }},
+    {{ 737, -1, -1, 837 }},
+    {{ -1, 2867, 4985, 4999 }},
+    {{ 2868, 4799, -1, 5511 }},
+    {{ 2869, 4796, 4967, -1 }},
+    {{ 856, 2870, 1270, -1 }},
+    {{ 769, -1, -1, 5467 }},
+    {{ 1075, 2872, 5317, -1 }},
+    {{ 1087, 2873, -1, 2875 }},
+    {{ 5305, 5306, -1, 2874 }},
+    {{ -1, -1, 3804, 6696 }},
+    {{ -1, 2876, 2157, 561 }},
+    {{ 5312, -1, -1, 6703 }},
+    {{ 1107, 2878, 1119, -1 }},
+    {{ 5325, 5329, -1, 2879 }},
+    {{ -1, -1, -1, 6801 }},
+    {{ -1, 2881, 6835, 6840 }},
+    {{ -1, 6832, -1, 623 }},
+    {{ 2883, -1, 5385, 5391 }},
+    {{ 5370, 2884, 1185, -1 }},
+    {{ 7024, 2885, -1, 5380 }},
+    {{ 1175, 2886, -1, 705 }},
+    {{ 844, -1, -1, 7056 }},
+    {{ 1303, 2888, 1313, -1 }},
+    {{ 1307, 2889, -1, 6698 }},
+    {{ 724, -1, -1, 7789 }},
+    {{ 808, 2891, 2895, -1 }},
+    {{ 813, 5179, -1, 2892 }},
+    {{ -1, 5190, 2893, 6095 }},
+    {{ 2608, -1, 2894, 6091 }},
+    {{ -1, -1, -1, 260 }},
+    {{ 5195, -1, 2896, 995 }},
+    {{ 2897, -1, 992, 2092 }},
+    {{ 6112, 2898, 990, -1 }},
+    {{ 6119, 2788, -1, -1 }},
+    {{ 2900, 5211, -1, 2904 }},
+    {{ 6153, 4116, 2901, -1 }},
+    {{ 3005, -1, 6163, 2902 }},
+    {{ -1, 8, 2903, 6173 }},
+    {{ -1, -1, -1, 274 }},
+    {{ -1, 5217, 2905, 5218 }},
+    {{ 2906, -1, 2908, 6209 }},
+    {{ 3173, 19, 2907, -1 }},
+    {{ -1, -1, -1, 2139 }},
+    {{ 2909, -1, 6205, 2150 }},
+    {{ -1, 3489, -1, -1 }},
+    {{ 2911, 5221, -1, 5224 }},
+    {{ 6227, 3291, 2912, -1 }},
+    {{ 3304, -1, 2913, 6232 }},
+    {{ -1, -1, -1, 969 }},
+    {{ -1, 5246, 2915, 6330 }},
+    {{ 2916, -1, 6322, 3616 }},
+    {{ 2917, 5251, 6319, -1 }},
+    {{ -1, 1306, -1, -1 }},
+    {{ 2919, 6389, -1, 6395 }},
+    {{ 6380, 982, 2920, -1 }},
+    {{ 6102, -1, 2921, 6385 }},
+    {{ -1, -1, -1, 2092 }},
+    {{ -1, 6405, 2923, 6425 }},
+    {{ 2924, -1, 6420, 1053 }},
+    {{ 2925, 6415, 6418, -1 }},
+    {{ -1, 1042, -1, -1 }},
+    {{ 828, -1, 5285, 2927 }},
+    {{ -1, 2928, 6538, 6544 }},
+    {{ 2929, 6530, -1, 1230 }},
+    {{ 2930, 6522, 6526, -1 }},
+    {{ -1, 158, -1, -1 }},
+    {{ -1, 2932, 2938, 6608 }},
+    {{ 2933, 6558, -1, 6570 }},
+    {{ 2934, 6550, 2936, -1 }},
+    {{ 1263, 1266, 2935, -1 }},
+    {{ -1, -1, -1, 5742 }},
+    {{ 2937, -1, 6555, 16 }},
+    {{ -1, 1282, -1, -1 }},
+    {{ 2939, -1, 6595, 6602 }},
+    {{ 5298, 2940, 7846, -1 }},
+    {{ 2941, 6591, -1, 20 }},
+    {{ -1, 173, -1, -1 }},
+    {{ -1, 4485, -1, 687 }},
+    {{ -1, 4653, -1, 717 }},
+    {{ 5394, 2945, 15, -1 }},
+    {{ -1, 2946, -1, 802 }},
+    {{ -1, 4839, -1, 749 }},
+    {{ -1, 4872, -1, 4878 }},
+    {{ 2949, -1, 1235, 1240 }},
+    {{ 5428, 2950, 7406, -1 }},
+    {{ 5433, 2951, -1, 7401 }},
+    {{ -1, 2952, -1, 1134 }},
+    {{ -1, 5337, -1, 837 }},
+    {{ -1, 5461, -1, 5467 }},
+    {{ -1, 6451, -1, 6698 }},
+    {{ -1, 7050, -1, 7056 }},
+    {{ -1, 1225, -1, -1 }},
+    {{ -1, 7635, -1, 2031 }},
+    {{ -1, 7786, -1, 7789 }},
+    {{ -1, 1324, -1, -1 }},
+    {{ 299, 304, -1, 2961 }},
+    {{ -1, 2344, 34, 2962 }},
+    {{ -1, 2361, 2963, 1459 }},
+    {{ 522, -1, 2964, 1455 }},
+    {{ 2365, -1, 2965, 2004 }},
+    {{ 2966, -1, 7111, 1196 }},
+    {{ 7086, -1, 7106, -1 }},
+    {{ 2968, -1, 2972, 2431 }},
+    {{ 2403, 323, 2969, -1 }},
+    {{ 83, -1, 4673, 2970 }},
+    {{ -1, 2971, 689, 4691 }},
+    {{ 4466, 1704, -1, 4686 }},
+    {{ 2973, -1, 4737, 2426 }},
+    {{ 4701, 2974, 4732, -1 }},
+    {{ 4583, 2420, -1, 2975 }},
+    {{ -1, 1709, 12, 4728 }},
+    {{ 2518, -1, 2977, 248 }},
+    {{ 2102, -1, 5385, 1961 }},
+    {{ 868, 255, 2979, -1 }},
+    {{ 5528, -1, 1152, 2980 }},
+    {{ -1, -1, 1168, 6989 }},
+    {{ 339, 2547, -1, 2982 }},
+    {{ -1, 2570, 2983, 2584 }},
+    {{ 349, -1, 2984, 3218 }},
+    {{ 461, -1, 2985, 1655 }},
+    {{ 2581, -1, 2986, 2019 }},
+    {{ 2987, -1, 4737, 7121 }},
+    {{ 4701, -1, 4732, -1 }},
+    {{ 531, 2989, 4576, -1 }},
+    {{ 546, 4545, -1, -1 }},
+    {{ -1, 1726, 2991, 1740 }},
+    {{ 2992, -1, 1733, 1737 }},
+    {{ 2628, 216, 2993, -1 }},
+    {{ 2994, -1, 1152, 7412 }},
+    {{ 1142, -1, 1148, -1 }},
+    {{ -1, 2632, 2996, 1766 }},
+    {{ 2997, -1, 3001, 1761 }},
+    {{ 523, 527, 2998, -1 }},
+    {{ 2641, -1, 2999, 7858 }},
+    {{ 3000, -1, 6930, 1159 }},
+    {{ 6916, -1, 2412, -1 }},
+    {{ 3002, -1, 7899, 7906 }},
+    {{ 2646, 3608, 3003, -1 }},
+    {{ 3004, -1, 7068, 1186 }},
+    {{ 657, -1, 662, -1 }},
+    {{ 360, 369, 3006, -1 }},
+    {{ 3007, -1, 3011, 43 }},
+    {{ 657, 2709, 3008, -1 }},
+    {{ 4374, -1, 4383, 3009 }},
+    {{ -1, 3010, 689, 2725 }},
+    {{ 4389, 320, -1, 2723 }},
+    {{ 3012, -1, 2733, 375 }},
+    {{ 4396, 3013, 4413, -1 }},
+    {{ 4409, 670, -1, 3014 }},
+    {{ -1, 325, 12, 2731 }},
+    {{ 2758, 3016, 3020, -1 }},
+    {{ 546, 2762, -1, 3017 }},
+    {{ -1, 4558, 3018, 383 }},
+    {{ 24, -1, 1421, 3019 }},
+    {{ -1, -1, 179, 1436 }},
+    {{ 565, -1, 570, 3021 }},
+    {{ -1, 2771, 3912, 3022 }},
+    {{ -1, 3023, 3931, 1530 }},
+    {{ 854, -1, -1, 1521 }},
+    {{ 3025, 2788, -1, 48 }},
+    {{ 577, 2778, 3026, -1 }},
+    {{ 593, -1, 4040, 3027 }},
+    {{ -1, 2784, 1570, 3028 }},
+    {{ -1, -1, 196, 1585 }},
+    {{ 668, -1, 4419, 3030 }},
+    {{ -1, 3031, 4454, 4460 }},
+    {{ 678, 3032, -1, 4900 }},
+    {{ 752, -1, -1, 1879 }},
+    {{ 531, 3034, 4576, -1 }},
+    {{ 546, 2816, -1, 3035 }},
+    {{ -1, 2820, 2157, 3036 }},
+    {{ -1, -1, 1450, 2162 }},
+    {{ 3038, -1, 4737, 3042 }},
+    {{ 4701, 3039, 4732, -1 }},
+    {{ 4583, 3040, -1, 2975 }},
+    {{ 697, 2841, -1, 3041 }},
+    {{ -1, -1, 1644, 626 }},
+    {{ -1, 3043, 4784, 4789 }},
+    {{ 1712, 2853, -1, 4778 }},
+    {{ -1, 398, 3045, 2866 }},
+    {{ 3046, -1, 4931, 4937 }},
+    {{ 4922, 3047, 5352, -1 }},
+    {{ 5323, 1721, -1, 4927 }},
+    {{ 1075, 5303, 3049, -1 }},
+    {{ 1097, -1, 1101, 3050 }},
+    {{ -1, 5319, 6745, 3051 }},
+    {{ -1, -1, 6761, 1530 }},
+    {{ 1153, -1, 6930, 3053 }},
+    {{ -1, 3054, 6949, 6950 }},
+    {{ 1161, -1, -1, 4900 }},
+    {{ -1, 2624, 6999, 1987 }},
+    {{ -1, 2061, 3057, 2074 }},
+    {{ 3058, -1, 2066, 2070 }},
+    {{ 3059, 269, 5527, -1 }},
+    {{ 1303, 869, 3060, -1 }},
+    {{ 1314, -1, 7793, 3061 }},
+    {{ -1, -1, 7804, 6756 }},
+    {{ 285, 2960, 3063, -1 }},
+    {{ 312, -1, 2967, 3064 }},
+    {{ -1, 2007, 2976, 3065 }},
+    {{ -1, 1516, 3066, 2014 }},
+    {{ 2978, -1, 3067, 2034 }},
+    {{ 3068, -1, 7899, 7906 }},
+    {{ 5535, -1, 1185, -1 }},
+    {{ 37, 2981, -1, 3070 }},
+    {{ -1, 352, 3071, 2995 }},
+    {{ 2608, -1, 3072, 2990 }},
+    {{ 357, -1, 3073, 260 }},
+    {{ 421, -1, 2986, 2090 }},
+    {{ 3075, -1, 3079, 3044 }},
+    {{ 3033, 429, 3076, -1 }},
+    {{ 83, -1, 4673, 3077 }},
+    {{ -1, 3078, 689, 4691 }},
+    {{ 4466, -1, -1, 4686 }},
+    {{ 3080, -1, 4737, 3042 }},
+    {{ 4701, 3081, 4732, -1 }},
+    {{ 4583, 3040, -1, 430 }},
+    {{ 2871, 404, 3083, -1 }},
+    {{ 5353, -1, 1152, 2980 }},
+    {{ 531, 3085, 7018, -1 }},
+    {{ 546, 7006, -1, -1 }},
+    {{ -1, 2061, 3087, 2074 }},
+    {{ 3088, -1, 2066, 2070 }},
+    {{ 3059, 269, 3089, -1 }},
+    {{ 2994, -1, 1152, 7858 }},
+    {{ 3091, 3090, -1, 3101 }},
+    {{ 3062, 3069, 3092, -1 }},
+    {{ 3005, -1, 3093, 3098 }},
+    {{ 423, -1, 3074, 3094 }},
+    {{ -1, 1868, 3095, 2097 }},
+    {{ 3082, -1, 3096, 2118 }},
+    {{ 3097, -1, 5385, 5391 }},
+    {{ 5370, -1, 1185, -1 }},
+    {{ -1, 8, 3099, 3086 }},
+    {{ 431, -1, 3100, 274 }},
+    {{ 440, -1, 2965, 2120 }},
+    {{ -1, 3115, 3102, 3138 }},
+    {{ 3103, -1, 3107, 3132 }},
+    {{ 3173, 19, 3104, -1 }},
+    {{ 54, -1, 3105, 2139 }},
+    {{ 446, -1, 3106, 2122 }},
+    {{ 2987, -1, 4737, 6936 }},
+    {{ 3108, -1, 3112, 2150 }},
+    {{ 462, 3489, 3109, -1 }},
+    {{ 450, -1, 3110, 1186 }},
+    {{ 3111, -1, 4419, 7069 }},
+    {{ 4396, -1, 4413, -1 }},
+    {{ 3113, -1, 7111, 2148 }},
+    {{ 3129, 1192, 3114, -1 }},
+    {{ 3004, -1, 4673, 7107 }},
+    {{ 3116, 3162, -1, 2126 }},
+    {{ 3153, 3291, 3117, -1 }},
+    {{ 3304, -1, 3118, 3158 }},
+    {{ 60, -1, 3119, 969 }},
+    {{ 446, -1, 3120, 2124 }},
+    {{ 2987, -1, 4737, 6000 }},
+    {{ 531, 3122, 4576, -1 }},
+    {{ 546, -1, -1, -1 }},
+    {{ 4323, 3124, 4336, -1 }},
+    {{ 546, 4328, -1, -1 }},
+    {{ 4374, -1, 4383, 3126 }},
+    {{ -1, -1, 689, 4392 }},
+    {{ 3128, -1, 7111, 2148 }},
+    {{ 3129, 1192, 7106, -1 }},
+    {{ 531, 7087, 3130, -1 }},
+    {{ 565, -1, 570, 3131 }},
+    {{ -1, -1, 3912, 4578 }},
+    {{ -1, 3219, 3133, 3544 }},
+    {{ 3134, -1, 1235, 1240 }},
+    {{ 3135, 3234, 7406, -1 }},
+    {{ 3232, 7379, 3136, -1 }},
+    {{ 3137, -1, 1101, 7389 }},
+    {{ 6705, -1, 6714, -1 }},
+    {{ -1, 2151, 3139, 3269 }},
+    {{ 3140, -1, 3148, 3616 }},
+    {{ 3141, 3249, 3145, -1 }},
+    {{ 524, 1306, 3142, -1 }},
+    {{ 470, -1, 3143, 7799 }},
+    {{ 3144, -1, 6727, 7797 }},
+    {{ 1825, -1, 1844, -1 }},
+    {{ 3146, -1, 1152, 7858 }},
+    {{ 3256, 7848, 3147, -1 }},
+    {{ 3004, -1, 2398, 1149 }},
+    {{ 3149, -1, 7899, 7906 }},
+    {{ 3150, 3265, 1185, -1 }},
+    {{ 3262, 7869, 3151, -1 }},
+    {{ 3152, -1, 570, 7019 }},
+    {{ 3846, -1, 3860, -1 }},
+    {{ 876, 3277, 3154, -1 }},
+    {{ 898, -1, 3283, 3155 }},
+    {{ -1, 2007, 3156, 2012 }},
+    {{ 3290, -1, 3157, 5747 }},
+    {{ 3097, -1, 5385, 5745 }},
+    {{ -1, -1, 3159, 977 }},
+    {{ 3160, -1, 6029, 974 }},
+    {{ 3320, 1945, 3161, -1 }},
+    {{ 2994, -1, 1152, 6027 }},
+    {{ 3163, 3332, -1, 3338 }},
+    {{ 3321, 982, 3164, -1 }},
+    {{ 6102, -1, 3165, 3328 }},
+    {{ 989, -1, 3166, 2092 }},
+    {{ 480, -1, 3167, 6134 }},
+    {{ 2987, -1, 4737, 6132 }},
+    {{ 3169, -1, 1152, 1163 }},
+    {{ 3256, 1051, 3147, -1 }},
+    {{ 3171, -1, 1190, 6512 }},
+    {{ 3172, 3368, 1185, -1 }},
+    {{ 3262, 6494, 3151, -1 }},
+    {{ 487, 495, 3174, -1 }},
+    {{ 3175, -1, 3179, 65 }},
+    {{ 3425, 500, 3176, -1 }},
+    {{ 83, -1, 1813, 3177 }},
+    {{ -1, 3178, 689, 3438 }},
+    {{ 4466, -1, -1, 3437 }},
+    {{ 3180, -1, 3446, 503 }},
+    {{ 1825, 3181, 1844, -1 }},
+    {{ 4583, 3442, -1, 3182 }},
+    {{ -1, -1, 12, 3445 }},
+    {{ 3652, 3184, 537, -1 }},
+    {{ 3675, 3686, -1, 3185 }},
+    {{ -1, 204, 534, -1 }},
+    {{ 556, 3781, -1, 3187 }},
+    {{ -1, 3796, -1, 3807 }},
+    {{ 565, -1, 570, 3189 }},
+    {{ -1, 3190, 3912, 945 }},
+    {{ 29, -1, -1, -1 }},
+    {{ 657, 3192, 662, -1 }},
+    {{ 4346, 3193, -1, 3194 }},
+    {{ 4361, 607, -1, -1 }},
+    {{ -1, -1, 12, -1 }},
+    {{ -1, 3196, 4538, 1987 }},
+    {{ -1, 4532, -1, 1972 }},
+    {{ 3652, 3198, 3201, -1 }},
+    {{ 3675, 3686, -1, 3199 }},
+    {{ -1, 204, 3200, 3701 }},
+    {{ 24, -1, 3696, -1 }},
+    {{ 3704, -1, 3709, 3202 }},
+    {{ -1, 493, 3725, 494 }},
+    {{ 3204, 3481, -1, 7011 }},
+    {{ 3731, 3480, 3205, -1 }},
+    {{ 3749, -1, 3754, 3206 }},
+    {{ -1, 8, 3762, -1 }},
+    {{ 3846, 3208, 3860, -1 }},
+    {{ 1797, 3851, -1, 3209 }},
+    {{ -1, 79, 3855, -1 }},
+    {{ 3872, -1, 3885, 3211 }},
+    {{ -1, 3212, 1883, 3896 }},
+    {{ 3891, -1, -1, 4900 }},
+    {{ 3214, 3511, -1, 7182 }},
+    {{ 3215, 153, 15, -1 }},
+    {{ 3509, 7161, 3216, -1 }},
+    {{ 3217, -1, 5076, 5742 }},
+    {{ 5068, -1, 902, -1 }},
+    {{ -1, 3219, 3229, 3544 }},
+    {{ 3220, 3528, -1, 1230 }},
+    {{ 3221, 3518, 3225, -1 }},
+    {{ 1218, 158, 3222, -1 }},
+    {{ 510, -1, 3223, 5742 }},
+    {{ 3224, -1, 5731, 5737 }},
+    {{ 5725, -1, 2969, -1 }},
+    {{ 3226, -1, 118, 16 }},
+    {{ 3525, 7314, 3227, -1 }},
+    {{ 3228, -1, 953, 117 }},
+    {{ 5924, -1, 5929, -1 }},
+    {{ 3230, -1, 1235, 1240 }},
+    {{ 3231, 3234, 7406, -1 }},
+    {{ 3232, 7379, 7388, -1 }},
+    {{ 6634, 1076, 3233, -1 }},
+    {{ 6654, -1, 6655, 526 }},
+    {{ 3235, 162, -1, 7401 }},
+    {{ 3542, 7394, 3236, -1 }},
+    {{ 3237, -1, 6808, 2170 }},
+    {{ 6804, -1, 42, -1 }},
+    {{ 1263, 1266, 3239, -1 }},
+    {{ 1271, -1, 3240, 5742 }},
+    {{ 421, -1, 3241, 7597 }},
+    {{ 2987, -1, 4737, 7595 }},
+    {{ 3243, -1, 962, 969 }},
+    {{ 3560, 7658, 3244, -1 }},
+    {{ 3004, -1, 3029, 960 }},
+    {{ 531, 3246, 1791, -1 }},
+    {{ 546, 555, -1, -1 }},
+    {{ 83, -1, 1813, 3248 }},
+    {{ -1, -1, 689, 6719 }},
+    {{ 3250, 3601, -1, 20 }},
+    {{ 1317, 173, 3251, -1 }},
+    {{ 530, -1, 3252, 2170 }},
+    {{ 3253, -1, 390, 401 }},
+    {{ 380, -1, 386, -1 }},
+    {{ 3255, -1, 1152, 7858 }},
+    {{ 3256, 7848, 1148, -1 }},
+    {{ 6863, 1143, 3257, -1 }},
+    {{ 565, -1, 570, 3258 }},
+    {{ -1, -1, 3912, 2378 }},
+    {{ 3260, -1, 7899, 7906 }},
+    {{ 3261, 3265, 1185, -1 }},
+    {{ 3262, 7869, 3484, -1 }},
+    {{ 3652, 532, 3263, -1 }},
+    {{ 3704, -1, 3709, 3264 }},
+    {{ -1, -1, 3725, 542 }},
+    {{ 3266, 3612, -1, 7896 }},
+    {{ 3610, 7879, 3267, -1 }},
+    {{ 3268, -1, 4040, 2170 }},
+    {{ 4025, -1, 42, -1 }},
+    {{ -1, 3624, 3270, 8056 }},
+    {{ 3271, -1, 8037, 8051 }},
+    {{ 3272, 3647, 8031, -1 }},
+    {{ 3273, 3643, 1313, -1 }},
+    {{ 3640, 8011, 3274, -1 }},
+    {{ 3275, -1, 7776, 1305 }},
+    {{ 1780, -1, 1473, -1 }},
+    {{ 876, 3277, 3282, -1 }},
+    {{ 887, 891, -1, 3278 }},
+    {{ -1, 5682, 3279, 5697 }},
+    {{ 24, -1, 3280, -1 }},
+    {{ 5693, -1, 3281, 896 }},
+    {{ 2966, -1, 7111, 1710 }},
+    {{ 898, -1, 3283, 3288 }},
+    {{ 3284, -1, 3285, 5737 }},
+    {{ 5725, 907, 3076, -1 }},
+    {{ 3286, -1, 4737, 5735 }},
+    {{ 4701, 3287, 4732, -1 }},
+    {{ 4583, 5734, -1, 430 }},
+    {{ -1, 2007, 3289, 2012 }},
+    {{ 3290, -1, 5744, 5747 }},
+    {{ 5302, 1945, 3083, -1 }},
+    {{ 3292, 919, -1, 3297 }},
+    {{ 909, 913, 3293, -1 }},
+    {{ 5778, -1, 5787, 3294 }},
+    {{ -1, 8, 3295, -1 }},
+    {{ 3290, -1, 3296, 918 }},
+    {{ 3097, -1, 5385, 2053 }},
+    {{ -1, 931, 3298, 5874 }},
+    {{ 3299, -1, 3301, 5869 }},
+    {{ 63, 25, 3300, -1 }},
+    {{ 5854, -1, 2999, 1163 }},
+    {{ 3302, -1, 5865, 260 }},
+    {{ 5858, 3489, 3303, -1 }},
+    {{ 3004, -1, 5863, -1 }},
+    {{ 939, 946, 3305, -1 }},
+    {{ 3306, -1, 3310, 117 }},
+    {{ 5924, 951, 3307, -1 }},
+    {{ 4374, -1, 4383, 3308 }},
+    {{ -1, 3309, 689, 5932 }},
+    {{ 4389, -1, -1, 3437 }},
+    {{ 3311, -1, 5936, 954 }},
+    {{ 4396, 3312, 4413, -1 }},
+    {{ 4409, 3442, -1, 3182 }},
+    {{ 4546, 4550, -1, 3314 }},
+    {{ -1, 3796, -1, 4555 }},
+    {{ -1, 3316, 4538, 1987 }},
+    {{ -1, 4697, -1, 1972 }},
+    {{ -1, -1, 3318, 977 }},
+    {{ 3319, -1, 6029, 974 }},
+    {{ 3320, 1945, 6026, -1 }},
+    {{ 1075, 5303, 2629, -1 }},
+    {{ 285, 6066, 3322, -1 }},
+    {{ 312, -1, 6073, 3323 }},
+    {{ -1, 2007, 3324, 6081 }},
+    {{ 3290, -1, 3325, 248 }},
+    {{ 3097, -1, 5385, 1961 }},
+    {{ 531, 3327, 4576, -1 }},
+    {{ 546, 2816, -1, -1 }},
+    {{ -1, 8, 3329, 6148 }},
+    {{ 3330, -1, 6144, 274 }},
+    {{ 6138, 1945, 3331, -1 }},
+    {{ 2994, -1, 6143, -1 }},
+    {{ 3333, 6176, -1, 1005 }},
+    {{ 6153, 6158, 3334, -1 }},
+    {{ 3005, -1, 3335, 1002 }},
+    {{ 423, -1, 3336, 6169 }},
+    {{ 6165, -1, 3337, 3044 }},
+    {{ 2987, -1, 4737, 3042 }},
+    {{ -1, 1013, 3339, 1022 }},
+    {{ 3340, -1, 3344, 6285 }},
+    {{ 3341, 19, 125, -1 }},
+    {{ 487, 495, 3342, -1 }},
+    {{ 6255, -1, 3343, 65 }},
+    {{ 3144, -1, 3446, 503 }},
+    {{ 3345, -1, 2147, 6280 }},
+    {{ 3346, 3489, 6276, -1 }},
+    {{ 6265, 6269, 3347, -1 }},
+    {{ 3152, -1, 6274, -1 }},
+    {{ 3349, 1027, -1, 1032 }},
+    {{ 3350, 6351, 3354, -1 }},
+    {{ 876, 6337, 3351, -1 }},
+    {{ 898, -1, 3352, 6348 }},
+    {{ 6344, -1, 3353, 5737 }},
+    {{ 2987, -1, 4737, 5735 }},
+    {{ 3355, -1, 130, 6376 }},
+    {{ 939, 946, 3356, -1 }},
+    {{ 6366, -1, 3357, 117 }},
+    {{ 3111, -1, 5936, 954 }},
+    {{ 83, -1, 1813, 3359 }},
+    {{ -1, -1, 689, -1 }},
+    {{ 3361, 142, -1, 20 }},
+    {{ 1107, 140, 3362, -1 }},
+    {{ 6472, -1, 3252, 2170 }},
+    {{ 3364, -1, 1152, 1163 }},
+    {{ 3256, 1051, 6484, -1 }},
+    {{ 3366, -1, 1190, 6512 }},
+    {{ 3367, 3368, 1185, -1 }},
+    {{ 3262, 6494, 6500, -1 }},
+    {{ 3369, 1174, -1, 1181 }},
+    {{ 6503, 6506, 3267, -1 }},
+    {{ -1, 1059, 3371, 6608 }},
+    {{ 3372, -1, 6595, 6602 }},
+    {{ 3373, 1072, 7846, -1 }},
+    {{ 3374, 1306, 6587, -1 }},
+    {{ 6576, 6581, 3375, -1 }},
+    {{ 3275, -1, 6585, -1 }},
+    {{ 1364, 3377, 3383, -1 }},
+    {{ 1393, 1408, -1, 3378 }},
+    {{ -1, 204, 3379, 3381 }},
+    {{ 24, -1, 1421, 3380 }},
+    {{ -1, 1426, 179, -1 }},
+    {{ -1, 1445, 3382, 1459 }},
+    {{ 522, -1, 1451, -1 }},
+    {{ 1464, -1, 1479, 3384 }},
+    {{ -1, 3385, 247, 3387 }},
+    {{ 29, 1492, -1, 3386 }},
+    {{ -1, 185, 1503, -1 }},
+    {{ -1, 3388, 1525, 3389 }},
+    {{ 854, 1517, -1, -1 }},
+    {{ -1, -1, 1531, 8056 }},
+    {{ 1535, 6644, 3391, -1 }},
+    {{ 1564, -1, 45, 3392 }},
+    {{ -1, 8, 1570, 3393 }},
+    {{ -1, 1575, 196, -1 }},
+    {{ 6646, 1616, -1, 3395 }},
+    {{ -1, 1633, 3396, 1659 }},
+    {{ 1645, -1, 3397, 3218 }},
+    {{ 461, -1, 1651, -1 }},
+    {{ 1700, -1, 1705, 896 }},
+    {{ 1780, 3400, 1473, -1 }},
+    {{ 1797, 75, -1, 3401 }},
+    {{ -1, 79, 12, 3402 }},
+    {{ -1, 226, 1806, -1 }},
+    {{ 1480, -1, 1850, 3404 }},
+    {{ -1, 3405, 1883, 3407 }},
+    {{ 1869, 3406, -1, 2694 }},
+    {{ 752, 1875, -1, -1 }},
+    {{ -1, 2696, 1895, 4999 }},
+    {{ 1944, -1, 1955, 3409 }},
+    {{ -1, 3410, 5426, 1966 }},
+    {{ 250, -1, -1, 1230 }},
+    {{ 285, 6671, 3412, -1 }},
+    {{ 312, -1, 321, 3413 }},
+    {{ -1, 4604, 2439, 3414 }},
+    {{ -1, 1516, 2013, -1 }},
+    {{ 46, -1, 390, 3416 }},
+    {{ -1, 3417, 402, 3418 }},
+    {{ 1869, 1874, -1, -1 }},
+    {{ -1, -1, 2040, 4999 }},
+    {{ 2043, -1, 2048, 918 }},
+    {{ 3421, 6689, -1, 6695 }},
+    {{ 6686, 4547, 3422, -1 }},
+    {{ 3005, -1, 3423, 798 }},
+    {{ 423, -1, 427, 3424 }},
+    {{ -1, 1868, 2093, -1 }},
+    {{ 531, 3426, 1791, -1 }},
+    {{ 546, 555, -1, 3427 }},
+    {{ -1, 3814, 1783, 3428 }},
+    {{ -1, 562, 1450, -1 }},
+    {{ 76, 607, -1, 3430 }},
+    {{ -1, 619, 3431, 626 }},
+    {{ 1645, -1, 1650, -1 }},
+    {{ -1, -1, 648, 3433 }},
+    {{ -1, -1, 653, 4312 }},
+    {{ 83, -1, 1813, 3435 }},
+    {{ -1, 3436, 689, 3438 }},
+    {{ 4466, 320, -1, 3437 }},
+    {{ -1, -1, 1929, 1934 }},
+    {{ -1, 3439, 4538, 1987 }},
+    {{ 4523, -1, -1, 1972 }},
+    {{ 1825, 3441, 1844, -1 }},
+    {{ 4583, 3442, -1, 3444 }},
+    {{ 697, 701, -1, 3443 }},
+    {{ -1, 706, 1644, -1 }},
+    {{ -1, 325, 12, 3445 }},
+    {{ -1, -1, 2182, 2187 }},
+    {{ 1851, -1, 4737, 3447 }},
+    {{ -1, 3448, 4784, 4789 }},
+    {{ 1863, 3449, -1, 4778 }},
+    {{ 739, -1, -1, 4894 }},
+    {{ 4804, 3451, 15, -1 }},
+    {{ 92, 746, -1, -1 }},
+    {{ -1, 3453, 1895, 4999 }},
+    {{ 3454, 4972, -1, 5511 }},
+    {{ 767, -1, 4967, -1 }},
+    {{ 3456, -1, 1955, 3460 }},
+    {{ 5302, 3457, 1950, -1 }},
+    {{ 5323, 3458, -1, 3459 }},
+    {{ 106, 836, -1, -1 }},
+    {{ -1, -1, -1, 1138 }},
+    {{ -1, 3461, 5426, 1966 }},
+    {{ 3462, 5417, -1, 1230 }},
+    {{ 251, -1, 5414, -1 }},
+    {{ -1, 3464, 3467, 1530 }},
+    {{ 3465, 6758, -1, 1521 }},
+    {{ 855, 5471, 3466, -1 }},
+    {{ 863, -1, 5488, -1 }},
+    {{ 3468, -1, 1977, 1526 }},
+    {{ 868, 3469, 5527, -1 }},
+    {{ 256, -1, -1, 20 }},
+    {{ 3471, -1, 1190, 3505 }},
+    {{ 3472, 3489, 1185, -1 }},
+    {{ 3473, 3478, 3484, -1 }},
+    {{ 3652, 532, 3474, -1 }},
+    {{ 3704, -1, 3709, 3475 }},
+    {{ -1, 3476, 3725, 542 }},
+    {{ 29, 1492, -1, 3477 }},
+    {{ -1, 3722, 1503, -1 }},
+    {{ 3479, 3481, -1, 7011 }},
+    {{ 3731, 3480, 551, -1 }},
+    {{ 37, 3744, -1, 1089 }},
+    {{ 3482, 7008, -1, 4554 }},
+    {{ 3767, 4482, 3483, -1 }},
+    {{ 3005, -1, 3777, 798 }},
+    {{ 3485, -1, 570, 7019 }},
+    {{ 3846, 3486, 3860, -1 }},
+    {{ 1797, 3851, -1, 3487 }},
+    {{ -1, 79, 3855, 3488 }},
+    {{ -1, 3859, 1806, -1 }},
+    {{ 3490, 1174, -1, 1181 }},
+    {{ 3491, 3497, 3501, -1 }},
+    {{ 3935, 3492, 3494, -1 }},
+    {{ 299, 3946, -1, 3493 }},
+    {{ -1, 3954, 811, 580 }},
+    {{ 312, -1, 3964, 3495 }},
+    {{ -1, 3496, 2439, 1548 }},
+    {{ 29, 3969, -1, -1 }},
+    {{ 3498, 7030, -1, 4595 }},
+    {{ 326, 7027, 3499, -1 }},
+    {{ 2498, -1, 3984, 3500 }},
+    {{ -1, 3989, 336, -1 }},
+    {{ 3502, -1, 4040, 2170 }},
+    {{ 4025, 3503, 42, -1 }},
+    {{ 370, 4030, -1, 3504 }},
+    {{ -1, 4036, 12, -1 }},
+    {{ -1, 3506, 1208, 1213 }},
+    {{ 3507, 3511, -1, 7182 }},
+    {{ 3508, 153, 15, -1 }},
+    {{ 3509, 7161, 784, -1 }},
+    {{ 5006, 771, 3510, -1 }},
+    {{ 5023, -1, 5024, 1222 }},
+    {{ 3512, 4882, -1, 7177 }},
+    {{ 3513, 756, 5194, -1 }},
+    {{ 7168, 1207, 3514, -1 }},
+    {{ 3515, -1, 5169, 6078 }},
+    {{ 2368, -1, 5168, -1 }},
+    {{ 531, 3246, 5711, -1 }},
+    {{ 83, -1, 3029, 1273 }},
+    {{ 3519, 794, -1, 802 }},
+    {{ 7299, 7303, 3520, -1 }},
+    {{ 7308, -1, 3521, -1 }},
+    {{ 3522, -1, 5793, 401 }},
+    {{ 380, -1, 5792, -1 }},
+    {{ 3524, -1, 118, 16 }},
+    {{ 3525, 7314, 116, -1 }},
+    {{ 5889, 940, 3526, -1 }},
+    {{ 3485, -1, 5906, 3527 }},
+    {{ -1, -1, 5912, 945 }},
+    {{ 3529, 816, -1, 7340 }},
+    {{ 3530, 812, 3534, -1 }},
+    {{ 7322, 7325, 3531, -1 }},
+    {{ 7327, -1, 3532, 6078 }},
+    {{ 3533, -1, 6075, 2431 }},
+    {{ 2403, -1, 3076, -1 }},
+    {{ 3535, -1, 988, 995 }},
+    {{ 7334, 5504, 3536, -1 }},
+    {{ 3537, -1, 6108, 43 }},
+    {{ 657, -1, 6105, -1 }},
+    {{ 3539, -1, 1235, 1240 }},
+    {{ 7378, 3540, 7406, -1 }},
+    {{ 3541, 162, -1, 7401 }},
+    {{ 3542, 7394, 1119, -1 }},
+    {{ 6765, 1108, 3543, -1 }},
+    {{ 6779, -1, 6780, 1321 }},
+    {{ -1, 3545, 1254, 7525 }},
+    {{ 3546, 7486, -1, 7493 }},
+    {{ 3547, 5471, 1251, -1 }},
+    {{ 3548, 859, 1270, -1 }},
+    {{ 7473, 1250, 3549, -1 }},
+    {{ 3550, -1, 7562, 884 }},
+    {{ 1780, -1, 7561, -1 }},
+    {{ 3552, 919, -1, 7609 }},
+    {{ 909, 913, 3553, -1 }},
+    {{ 5778, -1, 3554, 7607 }},
+    {{ 7603, -1, 3555, 401 }},
+    {{ 3556, -1, 2837, 397 }},
+    {{ 2814, -1, 2832, -1 }},
+    {{ 4374, -1, 4383, 3359 }},
+    {{ 3559, -1, 962, 969 }},
+    {{ 3560, 7658, 7665, -1 }},
+    {{ 5951, 957, 3561, -1 }},
+    {{ 565, -1, 570, 3562 }},
+    {{ -1, -1, 3912, 3022 }},
+    {{ 3564, 7703, -1, 7709 }},
+    {{ 3565, 982, 3569, -1 }},
+    {{ 7670, 7673, 3566, -1 }},
+    {{ 312, -1, 3567, 7680 }},
+    {{ 7676, -1, 3568, 2431 }},
+    {{ 2987, -1, 4737, 2426 }},
+    {{ 3570, -1, 3573, 7700 }},
+    {{ 7683, 5202, 3571, -1 }},
+    {{ 7685, -1, 3572, 43 }},
+    {{ 3111, -1, 2733, 375 }},
+    {{ 3574, -1, 992, 2092 }},
+    {{ 7691, 7695, 3303, -1 }},
+    {{ -1, 7721, 3576, 7758 }},
+    {{ 3577, -1, 7748, 1053 }},
+    {{ 3578, 7738, 7743, -1 }},
+    {{ 3579, 1042, 134, -1 }},
+    {{ 7732, 1300, 3580, -1 }},
+    {{ 3275, -1, 7736, -1 }},
+    {{ 1364, 3582, 3584, -1 }},
+    {{ 1393, 1408, -1, 3583 }},
+    {{ -1, 204, 773, 6637 }},
+    {{ 1464, -1, 1479, 3585 }},
+    {{ -1, 493, 247, 3586 }},
+    {{ -1, -1, 1525, 6641 }},
+    {{ 3588, 7773, -1, 1077 }},
+    {{ 1535, 7772, 3589, -1 }},
+    {{ 1564, -1, 45, 3590 }},
+    {{ -1, 8, 1570, -1 }},
+    {{ 1780, 3592, 1473, -1 }},
+    {{ 1797, 75, -1, 3593 }},
+    {{ -1, 79, 12, -1 }},
+    {{ 1480, -1, 1850, 3595 }},
+    {{ -1, 3596, 1883, 6660 }},
+    {{ 1869, -1, -1, 6658 }},
+    {{ 2648, 3598, 365, -1 }},
+    {{ 546, 2659, -1, -1 }},
+    {{ 2708, -1, 374, 3600 }},
+    {{ -1, -1, 2744, 2753 }},
+    {{ 3602, 1128, -1, 1134 }},
+    {{ 7838, 7839, 3603, -1 }},
+    {{ 7841, -1, 3604, -1 }},
+    {{ 3605, -1, 427, 6821 }},
+    {{ 3015, -1, 424, -1 }},
+    {{ 3607, -1, 7899, 7906 }},
+    {{ 7868, 3608, 1185, -1 }},
+    {{ 3609, 3612, -1, 7896 }},
+    {{ 3610, 7879, 3501, -1 }},
+    {{ 3935, 578, 3611, -1 }},
+    {{ 312, -1, 3964, 1321 }},
+    {{ 3613, 1178, -1, 705 }},
+    {{ 7886, 1334, 3614, -1 }},
+    {{ 3615, -1, 4101, 78 }},
+    {{ 360, -1, 4097, -1 }},
+    {{ -1, 3617, 7941, 7952 }},
+    {{ 3618, 7931, -1, 1230 }},
+    {{ 3619, 7923, 7927, -1 }},
+    {{ 3620, 158, 1227, -1 }},
+    {{ 7732, 1340, 3621, -1 }},
+    {{ 3622, -1, 7921, -1 }},
+    {{ 1780, -1, 5630, -1 }},
+    {{ -1, 3624, 3636, 8056 }},
+    {{ 3625, 7988, -1, 8002 }},
+    {{ 3626, 7973, 3632, -1 }},
+    {{ 3627, 1266, 3630, -1 }},
+    {{ 7958, 7961, 3628, -1 }},
+    {{ 7963, -1, 3629, 884 }},
+    {{ 3144, -1, 1850, 5634 }},
+    {{ 3631, -1, 1274, 5742 }},
+    {{ 7968, 7971, 3303, -1 }},
+    {{ 3633, -1, 7983, 16 }},
+    {{ 3634, 1282, 168, -1 }},
+    {{ 7979, 1351, 3635, -1 }},
+    {{ 3152, -1, 7982, -1 }},
+    {{ 3637, -1, 8037, 8051 }},
+    {{ 3638, 3647, 8031, -1 }},
+    {{ 3639, 3643, 1313, -1 }},
+    {{ 3640, 8011, 8017, -1 }},
+    {{ 1364, 7765, 3641, -1 }},
+    {{ 1464, -1, 1479, 3642 }},
+    {{ -1, -1, 247, 7769 }},
+    {{ 3644, 1310, -1, 6698 }},
+    {{ 8018, 1358, 3645, -1 }},
+    {{ 3646, -1, 6678, 1092 }},
+    {{ 360, -1, 42, -1 }},
+    {{ 3648, 8027, -1, 20 }},
+    {{ 3649, 173, 1326, -1 }},
+    {{ 8023, 1362, 3650, -1 }},
+    {{ 3651, -1, 4822, -1 }},
+    {{ 2368, -1, 317, -1 }},
+    {{ 1364, 3653, 3662, -1 }},
+    {{ 1393, 1408, -1, 3654 }},
+    {{ -1, 204, 3655, 3659 }},
+    {{ 24, -1, 1421, 3656 }},
+    {{ -1, 1426, 179, 3657 }},
+    {{ -1, 1370, 1372, 3658 }},
+    {{ -1, -1, 7539, 8056 }},
+    {{ -1, 1445, 3660, 1459 }},
+    {{ 522, -1, 1451, 3661 }},
+    {{ -1, 1762, 1377, 1414 }},
+    {{ 1464, -1, 1479, 3663 }},
+    {{ -1, 3664, 247, 3668 }},
+    {{ 29, 1492, -1, 3665 }},
+    {{ -1, 185, 1503, 3666 }},
+    {{ -1, 1384, 1386, 3667 }},
+    {{ -1, -1, 6621, 8056 }},
+    {{ -1, 3669, 1525, 3672 }},
+    {{ 854, 1517, -1, 3670 }},
+    {{ -1, 1391, 1973, 3671 }},
+    {{ -1, -1, 7759, 6608 }},
+    {{ -1, 3673, 1531, 8056 }},
+    {{ 1989, 7988, -1, 3674 }},
+    {{ -1, -1, 8003, 7758 }},
+    {{ 1535, 3676, 3681, -1 }},
+    {{ 37, 1552, -1, 3677 }},
+    {{ -1, 352, 3678, 2631 }},
+    {{ 2608, -1, 3679, 1560 }},
+    {{ 357, -1, 2021, 3680 }},
+    {{ -1, -1, 1419, -1 }},
+    {{ 1564, -1, 45, 3682 }},
+    {{ -1, 8, 1570, 3683 }},
+    {{ -1, 1575, 196, 3684 }},
+    {{ -1, 1404, 1406, 3685 }},
+    {{ -1, -1, 8069, 8056 }},
+    {{ 3687, 1616, -1, 3692 }},
+    {{ 1593, 1598, 3688, -1 }},
+    {{ 3005, -1, 1603, 3689 }},
+    {{ -1, 8, 3690, 1612 }},
+    {{ 431, -1, 2101, 3691 }},
+    {{ -1, -1, 1608, -1 }},
+    {{ -1, 1633, 3693, 1659 }},
+    {{ 1645, -1, 3694, 3218 }},
+    {{ 461, -1, 1651, 3695 }},
+    {{ -1, 3213, 1419, 1399 }},
+    {{ 1700, -1, 1705, 3697 }},
+    {{ -1, 3698, 1718, 1722 }},
+    {{ 1424, 3511, -1, 3699 }},
+    {{ -1, -1, 7191, 5295 }},
+    {{ 507, 3528, -1, 2160 }},
+    {{ -1, 1445, 1375, 3702 }},
+    {{ -1, 3703, 1775, 8056 }},
+    {{ 1461, 7988, -1, 2173 }},
+    {{ 1780, 3705, 1473, -1 }},
+    {{ 1797, 75, -1, 3706 }},
+    {{ -1, 79, 12, 3707 }},
+    {{ -1, 226, 1806, 3708 }},
+    {{ -1, 1469, 1471, 3685 }},
+    {{ 1480, -1, 1850, 3710 }},
+    {{ -1, 3711, 1883, 3718 }},
+    {{ 1869, 3712, -1, 3715 }},
+    {{ 752, 1875, -1, 3713 }},
+    {{ -1, 1490, 4895, 3714 }},
+    {{ -1, -1, 5249, 6330 }},
+    {{ -1, 3716, 4912, 5295 }},
+    {{ 4902, 1027, -1, 3717 }},
+    {{ -1, -1, 1033, 6425 }},
+    {{ -1, 3719, 1895, 4999 }},
+    {{ 766, 3720, -1, 5511 }},
+    {{ 4973, 7703, -1, 3721 }},
+    {{ -1, -1, 7710, 1022 }},
+    {{ 186, 1497, -1, 3723 }},
+    {{ -1, 6405, 3724, 6425 }},
+    {{ -1, -1, 6420, 1053 }},
+    {{ 1944, -1, 1955, 3726 }},
+    {{ -1, 3727, 5426, 1966 }},
+    {{ 250, 3728, -1, 1230 }},
+    {{ 5418, 816, -1, 3729 }},
+    {{ -1, -1, 7341, 5245 }},
+    {{ 5494, 7703, -1, 2168 }},
+    {{ 285, 3732, 3737, -1 }},
+    {{ 299, 304, -1, 3733 }},
+    {{ -1, 2344, 34, 3734 }},
+    {{ -1, 2361, 3735, 1459 }},
+    {{ 522, -1, 3736, 1455 }},
+    {{ 2365, -1, 7899, -1 }},
+    {{ 312, -1, 321, 3738 }},
+    {{ -1, 3739, 2439, 3742 }},
+    {{ 29, 1492, -1, 3740 }},
+    {{ -1, 185, 3741, 1507 }},
+    {{ 828, -1, 5285, -1 }},
+    {{ -1, 1516, 2013, 3743 }},
+    {{ -1, 1988, 1550, 3685 }},
+    {{ 339, 2547, -1, 3745 }},
+    {{ -1, 2570, 3746, 2584 }},
+    {{ 349, -1, 3747, 3218 }},
+    {{ 461, -1, 3748, 1655 }},
+    {{ 2581, -1, 7111, -1 }},
+    {{ 360, 3750, 42, -1 }},
+    {{ 370, 2702, -1, 3751 }},
+    {{ -1, 79, 12, 3752 }},
+    {{ -1, 226, 3753, 1807 }},
+    {{ 522, -1, 3606, -1 }},
+    {{ 46, -1, 390, 3755 }},
+    {{ -1, 3756, 402, 3759 }},
+    {{ 1869, 1874, -1, 3757 }},
+    {{ -1, 4901, 4912, 3758 }},
+    {{ -1, -1, 5296, 6608 }},
+    {{ -1, 3760, 2040, 4999 }},
+    {{ 766, 4972, -1, 3761 }},
+    {{ -1, -1, 5512, 7758 }},
+    {{ 2043, -1, 2048, 3763 }},
+    {{ -1, 3764, 2948, 2057 }},
+    {{ 1573, 5417, -1, 3765 }},
+    {{ -1, -1, 1231, 7372 }},
+    {{ 854, 5493, -1, 2173 }},
+    {{ 285, 2960, 3768, -1 }},
+    {{ 312, -1, 2967, 3769 }},
+    {{ -1, 2007, 2976, 3770 }},
+    {{ -1, 1516, 3771, 2014 }},
+    {{ 2978, -1, 1977, -1 }},
+    {{ 37, 2981, -1, 3773 }},
+    {{ -1, 352, 3774, 2995 }},
+    {{ 2608, -1, 3775, 2990 }},
+    {{ 357, -1, 3776, 260 }},
+    {{ 421, -1, 7111, -1 }},
+    {{ 423, -1, 427, 3778 }},
+    {{ -1, 1868, 2093, 3779 }},
+    {{ -1, 765, 1606, 3780 }},
+    {{ -1, -1, 5573, 8056 }},
+    {{ 3782, 3090, -1, 3790 }},
+    {{ 3062, 3069, 3783, -1 }},
+    {{ 3005, -1, 3784, 3787 }},
+    {{ 423, -1, 3074, 3785 }},
+    {{ -1, 1868, 3786, 2097 }},
+    {{ 3082, -1, 2882, -1 }},
+    {{ -1, 8, 3788, 3086 }},
+    {{ 431, -1, 3789, 274 }},
+    {{ 440, -1, 5385, -1 }},
+    {{ -1, 3115, 3791, 3138 }},
+    {{ 3792, -1, 447, 3132 }},
+    {{ 3173, 19, 3793, -1 }},
+    {{ 54, -1, 3794, 2139 }},
+    {{ 446, -1, 6930, -1 }},
+    {{ -1, 3796, 3804, 3807 }},
+    {{ 3797, 3162, -1, 3801 }},
+    {{ 3153, 3291, 3798, -1 }},
+    {{ 3304, -1, 3799, 3158 }},
+    {{ 60, -1, 3800, 969 }},
+    {{ 446, -1, 5995, -1 }},
+    {{ -1, 3348, 3802, 3370 }},
+    {{ 3803, -1, 3170, 1053 }},
+    {{ 208, 3360, 3168, -1 }},
+    {{ 1645, -1, 1417, 3805 }},
+    {{ -1, 3806, 3229, 3544 }},
+    {{ 3220, 3528, -1, 2160 }},
+    {{ -1, 3808, 466, 3811 }},
+    {{ 3809, 3563, -1, 1576 }},
+    {{ 3238, 3551, 3810, -1 }},
+    {{ 221, -1, 3242, 16 }},
+    {{ -1, 3812, 3270, 8056 }},
+    {{ 3813, 7988, -1, 8002 }},
+    {{ 3626, 7973, 1588, -1 }},
+    {{ 3815, 3820, -1, 3825 }},
+    {{ 3276, 3816, 1671, -1 }},
+    {{ 3292, 919, -1, 3817 }},
+    {{ -1, 931, 3818, 5874 }},
+    {{ 3299, -1, 3819, 5869 }},
+    {{ -1, -1, 5865, 260 }},
+    {{ 3821, 3332, -1, 1682 }},
+    {{ 3321, 982, 3822, -1 }},
+    {{ 6102, -1, 478, 3823 }},
+    {{ -1, 8, 3824, 6148 }},
+    {{ -1, -1, 6144, 274 }},
+    {{ -1, 3826, 206, 3827 }},
+    {{ 3349, 1027, -1, 1500 }},
+    {{ -1, 3828, 1691, 6608 }},
+    {{ 3829, 6558, -1, 6570 }},
+    {{ 1061, 6550, 1511, -1 }},
+    {{ 3529, 816, -1, 3831 }},
+    {{ -1, 822, 3832, 5245 }},
+    {{ -1, -1, -1, 5240 }},
+    {{ 514, 3834, 220, -1 }},
+    {{ 3552, 919, -1, 3835 }},
+    {{ -1, 931, 3836, 5874 }},
+    {{ 7611, -1, -1, 5869 }},
+    {{ 3838, 7703, -1, 3841 }},
+    {{ 3565, 982, 3839, -1 }},
+    {{ 3570, -1, 1753, 3840 }},
+    {{ -1, 8, -1, 6148 }},
+    {{ -1, 1013, 3842, 1022 }},
+    {{ 1520, -1, 641, 6285 }},
+    {{ -1, 1059, 3844, 6608 }},
+    {{ 3845, -1, 6595, 6602 }},
+    {{ -1, 1072, 7846, -1 }},
+    {{ 531, 3847, 1791, -1 }},
+    {{ 546, 555, -1, 3848 }},
+    {{ -1, 3814, 1783, 3849 }},
+    {{ -1, 562, 1450, 3850 }},
+    {{ -1, 1789, 1775, 3685 }},
+    {{ 76, 607, -1, 3852 }},
+    {{ -1, 619, 3853, 626 }},
+    {{ 1645, -1, 1650, 3854 }},
+    {{ -1, 3219, 3229, 1414 }},
+    {{ -1, -1, 648, 3856 }},
+    {{ -1, 3857, 653, 4312 }},
+    {{ 507, 3528, -1, 3858 }},
+    {{ -1, -1, 4301, 7372 }},
+    {{ 227, 1803, -1, 2173 }},
+    {{ 83, -1, 1813, 3861 }},
+    {{ -1, 3862, 689, 3869 }},
+    {{ 4466, 3863, -1, 3866 }},
+    {{ 681, 684, -1, 3864 }},
+    {{ -1, 1490, -1, 3865 }},
+    {{ -1, -1, -1, 6330 }},
+    {{ -1, 3867, 1929, 1934 }},
+    {{ 1823, 1922, -1, 3868 }},
+    {{ -1, -1, 1927, 6425 }},
+    {{ -1, 3870, 4538, 1987 }},
+    {{ 4523, 3871, -1, 1972 }},
+    {{ 4533, 7703, -1, 3721 }},
+    {{ 1825, 3873, 1844, -1 }},
+    {{ 4583, 3874, -1, 3878 }},
+    {{ 697, 701, -1, 3875 }},
+    {{ -1, 706, 1644, 3876 }},
+    {{ -1, 1834, 4191, 3877 }},
+    {{ -1, -1, 4197, 8056 }},
+    {{ -1, 3879, 12, 3882 }},
+    {{ 711, 714, -1, 3880 }},
+    {{ -1, 1836, -1, 3881 }},
+    {{ -1, -1, -1, 4267 }},
+    {{ -1, 3883, 2182, 2187 }},
+    {{ 1842, 2174, -1, 3884 }},
+    {{ -1, -1, 2179, 7758 }},
+    {{ 1851, -1, 4737, 3886 }},
+    {{ -1, 3887, 4784, 4789 }},
+    {{ 1863, 3888, -1, 4778 }},
+    {{ 739, 3889, -1, 4894 }},
+    {{ 4773, 4889, -1, 3890 }},
+    {{ -1, -1, 818, 5218 }},
+    {{ 4804, 3892, 15, -1 }},
+    {{ 92, 746, -1, 3893 }},
+    {{ -1, 1872, 935, 3894 }},
+    {{ -1, -1, 5880, 1766 }},
+    {{ 4883, 4889, -1, 2200 }},
+    {{ -1, 3897, 1895, 4999 }},
+    {{ 3898, 4972, -1, 5511 }},
+    {{ 767, 3899, 4967, -1 }},
+    {{ 4960, 919, -1, 3900 }},
+    {{ -1, -1, 7610, 5874 }},
+    {{ 808, 3902, 5194, -1 }},
+    {{ 813, 5179, -1, 3903 }},
+    {{ -1, 5190, 3904, 6095 }},
+    {{ 2608, -1, -1, 6091 }},
+    {{ 3906, 5211, -1, 1910 }},
+    {{ 6153, 4116, 3907, -1 }},
+    {{ 3005, -1, 6163, 3908 }},
+    {{ -1, 8, -1, 6173 }},
+    {{ 823, 5221, -1, 3910 }},
+    {{ -1, 3348, 3911, 3370 }},
+    {{ -1, -1, 6250, 1053 }},
+    {{ 3913, -1, 1955, 3919 }},
+    {{ 5302, 3914, 1950, -1 }},
+    {{ 5323, 3915, -1, 3917 }},
+    {{ 106, 836, -1, 3916 }},
+    {{ -1, 1948, 6835, 672 }},
+    {{ -1, 3918, -1, 1138 }},
+    {{ 5347, 634, -1, 2801 }},
+    {{ -1, 3920, 5426, 1966 }},
+    {{ 3921, 5417, -1, 1230 }},
+    {{ 251, 3922, 5414, -1 }},
+    {{ 5407, 794, -1, 680 }},
+    {{ 5495, 3924, 5500, -1 }},
+    {{ 37, 6085, -1, 3925 }},
+    {{ -1, 352, -1, 6095 }},
+    {{ 3927, 6176, -1, 3929 }},
+    {{ 6153, 6158, 3928, -1 }},
+    {{ 3005, -1, 7706, -1 }},
+    {{ -1, 6199, 3930, 6214 }},
+    {{ -1, -1, -1, 6209 }},
+    {{ 3932, -1, 1977, 1526 }},
+    {{ 868, 3933, 5527, -1 }},
+    {{ 256, 3934, -1, 20 }},
+    {{ 5524, 1128, -1, 693 }},
+    {{ 2213, 3936, 3941, -1 }},
+    {{ 2237, 2243, -1, 3937 }},
+    {{ -1, 2256, 288, 3938 }},
+    {{ -1, 1445, 292, 3939 }},
+    {{ -1, 1460, 3940, 8056 }},
+    {{ 1776, -1, -1, 8051 }},
+    {{ 2265, -1, 2275, 3942 }},
+    {{ -1, 296, 247, 3943 }},
+    {{ -1, 3944, 1525, 1530 }},
+    {{ 854, 1517, -1, 3945 }},
+    {{ -1, 1391, -1, 7758 }},
+    {{ 2315, 2328, -1, 3947 }},
+    {{ -1, 1633, 3948, 3951 }},
+    {{ 2334, -1, 307, 3949 }},
+    {{ -1, 3219, 3950, 3544 }},
+    {{ 3230, -1, -1, 1240 }},
+    {{ -1, 1660, 3952, 3269 }},
+    {{ 2341, -1, 3953, 3616 }},
+    {{ 3260, -1, -1, 7906 }},
+    {{ 2345, 1676, -1, 3955 }},
+    {{ -1, 3348, 3956, 1690 }},
+    {{ 2354, -1, 3957, 1053 }},
+    {{ 3366, -1, -1, 6512 }},
+    {{ 24, -1, 309, 3959 }},
+    {{ -1, 1426, -1, 3960 }},
+    {{ -1, 1437, 3961, 7525 }},
+    {{ -1, -1, 7507, 7520 }},
+    {{ -1, 1762, 3963, 7952 }},
+    {{ -1, -1, 1235, 1240 }},
+    {{ 322, -1, 2417, 3965 }},
+    {{ -1, 3966, 2432, 2436 }},
+    {{ 1869, 3967, -1, 4900 }},
+    {{ 752, 1875, -1, 3968 }},
+    {{ -1, 1490, -1, 5245 }},
+    {{ 1900, 1905, -1, 3970 }},
+    {{ -1, 822, 3971, 1916 }},
+    {{ 1495, -1, -1, 5240 }},
+    {{ -1, 1508, 3973, 6608 }},
+    {{ -1, -1, 6595, 6602 }},
+    {{ 326, 3975, 3983, -1 }},
+    {{ 2473, 2482, -1, 3976 }},
+    {{ -1, 352, 3977, 3980 }},
+    {{ 2488, -1, 334, 3978 }},
+    {{ -1, 1726, 3979, 1740 }},
+    {{ 1562, -1, -1, 1737 }},
+    {{ -1, 2632, 3981, 1766 }},
+    {{ 2496, -1, 3982, 1761 }},
+    {{ 2645, -1, -1, 7906 }},
+    {{ 2498, -1, 3984, 3988 }},
+    {{ 2513, -1, 390, 3985 }},
+    {{ -1, 3986, 402, 2039 }},
+    {{ 1869, 1874, -1, 3987 }},
+    {{ -1, 4901, -1, 5295 }},
+    {{ -1, 3989, 336, 3992 }},
+    {{ -1, 406, -1, 3990 }},
+    {{ -1, 411, 3991, 2931 }},
+    {{ 828, -1, -1, 2927 }},
+    {{ -1, 1575, -1, 3993 }},
+    {{ -1, 1586, 3994, 8056 }},
+    {{ -1, -1, 8037, 8051 }},
+    {{ 2523, 2534, 3996, -1 }},
+    {{ 2539, -1, 341, 3997 }},
+    {{ -1, 8, 345, 3998 }},
+    {{ -1, 2061, 3999, 2074 }},
+    {{ 1614, -1, -1, 2070 }},
+    {{ 2548, 3090, -1, 4001 }},
+    {{ -1, 3115, 4002, 3138 }},
+    {{ 2562, -1, 4003, 3132 }},
+    {{ 2567, -1, 4004, 2150 }},
+    {{ 3128, -1, -1, 2148 }},
+    {{ -1, 3213, 4006, 1213 }},
+    {{ -1, -1, 7208, 7214 }},
+    {{ -1, 1660, 4008, 3269 }},
+    {{ 4009, -1, 3259, 3616 }},
+    {{ 2587, 3249, 4010, -1 }},
+    {{ 3255, -1, -1, 7858 }},
+    {{ 4012, 2602, -1, 4016 }},
+    {{ 2590, 1666, 4013, -1 }},
+    {{ 2597, -1, 355, 4014 }},
+    {{ -1, -1, 4015, 977 }},
+    {{ 3319, -1, -1, 974 }},
+    {{ -1, 3348, 4017, 1690 }},
+    {{ 4018, -1, 3365, 1053 }},
+    {{ 208, 3360, 4019, -1 }},
+    {{ 1688, -1, -1, 1163 }},
+    {{ -1, 4021, 2638, 2162 }},
+    {{ 4022, 1750, -1, 1576 }},
+    {{ 2634, 3551, 4023, -1 }},
+    {{ 221, -1, 4024, 16 }},
+    {{ 3559, -1, -1, 969 }},
+    {{ 2648, 4026, 365, -1 }},
+    {{ 546, 2659, -1, 4027 }},
+    {{ -1, 3814, 363, 4028 }},
+    {{ -1, 562, 1450, 4029 }},
+    {{ -1, 1789, -1, 8056 }},
+    {{ 2703, 607, -1, 4031 }},
+    {{ -1, 619, 4032, 4034 }},
+    {{ 1645, -1, 1650, 4033 }},
+    {{ -1, 3219, -1, 3544 }},
+    {{ -1, 627, 4035, 4192 }},
+    {{ 467, -1, -1, 1526 }},
+    {{ 630, 634, -1, 4037 }},
+    {{ -1, 642, 4038, 645 }},
+    {{ -1, -1, -1, 4254 }},
+    {{ -1, 1808, 3994, 8056 }},
+    {{ 4041, -1, 390, 401 }},
+    {{ 380, 4042, 386, -1 }},
+    {{ 2777, 4043, -1, 48 }},
+    {{ 2789, 701, -1, 4044 }},
+    {{ -1, 706, 2794, 4045 }},
+    {{ -1, 1834, -1, 4192 }},
+    {{ -1, 406, -1, 4047 }},
+    {{ -1, 4048, 2926, 2931 }},
+    {{ 412, 2918, -1, 3723 }},
+    {{ 5494, 7703, -1, 4050 }},
+    {{ -1, 1013, 4051, 1022 }},
+    {{ -1, -1, -1, 6285 }},
+    {{ 2213, 286, 4053, -1 }},
+    {{ 2265, -1, 2275, 4054 }},
+    {{ -1, 296, 247, 4055 }},
+    {{ -1, 1389, 1525, 330 }},
+    {{ 299, 304, -1, 4057 }},
+    {{ -1, 2344, 4058, 4061 }},
+    {{ 24, -1, 4059, 35 }},
+    {{ 2356, -1, 2360, 4060 }},
+    {{ -1, 261, -1, 1722 }},
+    {{ -1, 2361, 4062, 1459 }},
+    {{ 522, -1, 4063, 1455 }},
+    {{ 2365, -1, -1, 2004 }},
+    {{ 2968, -1, 2972, 4065 }},
+    {{ -1, 4066, 2432, 2436 }},
+    {{ 1869, 1488, -1, 3987 }},
+    {{ 29, 1492, -1, 4068 }},
+    {{ -1, 185, 4069, 1507 }},
+    {{ 828, -1, -1, 2010 }},
+    {{ -1, 1988, 3994, 8056 }},
+    {{ 326, 331, 4072, -1 }},
+    {{ 2498, -1, 4073, 4075 }},
+    {{ 2513, -1, 390, 4074 }},
+    {{ -1, 1868, 402, 343 }},
+    {{ -1, 8, 4076, 40 }},
+    {{ 2518, -1, 2522, 4077 }},
+    {{ -1, 275, -1, 2057 }},
+    {{ 339, 2547, -1, 4079 }},
+    {{ -1, 2570, 4080, 2584 }},
+    {{ 349, -1, 4081, 3218 }},
+    {{ 461, -1, 4082, 1655 }},
+    {{ 2581, -1, -1, 2019 }},
+    {{ 63, 25, 4084, -1 }},
+    {{ 2610, -1, 2614, 351 }},
+    {{ -1, 261, 4006, 2028 }},
+    {{ -1, 2632, 4087, 1766 }},
+    {{ 4088, -1, 3001, 1761 }},
+    {{ 523, 527, 4089, -1 }},
+    {{ 2641, -1, -1, 7858 }},
+    {{ 360, 4091, 4097, -1 }},
+    {{ 370, 2702, -1, 4092 }},
+    {{ -1, 79, 4093, 4095 }},
+    {{ -1, -1, 648, 4094 }},
+    {{ -1, 4299, -1, 4312 }},
+    {{ -1, 226, 4096, 1807 }},
+    {{ 522, -1, -1, 2034 }},
+    {{ 3007, -1, 3011, 4098 }},
+    {{ -1, 4099, 2744, 2753 }},
+    {{ 4466, -1, -1, 4100 }},
+    {{ -1, 379, -1, 1934 }},
+    {{ 4102, -1, 427, 4106 }},
+    {{ 3015, 4103, 424, -1 }},
+    {{ 3025, 2788, -1, 4104 }},
+    {{ -1, -1, 12, 4105 }},
+    {{ -1, 385, -1, 2187 }},
+    {{ -1, 4107, 2093, 1605 }},
+    {{ 2212, 1874, -1, 4900 }},
+    {{ 285, 2960, 4109, -1 }},
+    {{ 312, -1, 4110, 4112 }},
+    {{ 2968, -1, 2972, 4111 }},
+    {{ -1, 1487, 2432, 343 }},
+    {{ -1, 2007, 4113, 4114 }},
+    {{ 2518, -1, 2977, 2596 }},
+    {{ -1, 1516, 4115, 2014 }},
+    {{ 2978, -1, -1, 2034 }},
+    {{ 37, 2981, -1, 4117 }},
+    {{ -1, 352, 4118, 2995 }},
+    {{ 2608, -1, 4119, 2990 }},
+    {{ 357, -1, 4120, 260 }},
+    {{ 421, -1, -1, 2090 }},
+    {{ 360, 369, 4122, -1 }},
+    {{ 3007, -1, 3011, 4123 }},
+    {{ -1, 44, 2744, 2600 }},
+    {{ -1, 765, 4125, 4999 }},
+    {{ -1, -1, 5533, 5547 }},
+    {{ -1, 275, 3963, 2112 }},
+    {{ 4128, 3090, -1, 4137 }},
+    {{ 3062, 3069, 4129, -1 }},
+    {{ 3005, -1, 4130, 4134 }},
+    {{ 423, -1, 4131, 4132 }},
+    {{ 3075, -1, 3079, 2607 }},
+    {{ -1, 1868, 4133, 2097 }},
+    {{ 3082, -1, -1, 2118 }},
+    {{ -1, 8, 4135, 3086 }},
+    {{ 431, -1, 4136, 274 }},
+    {{ 440, -1, -1, 2120 }},
+    {{ -1, 3115, 4138, 3138 }},
+    {{ 4139, -1, 4142, 3132 }},
+    {{ 3173, 19, 4140, -1 }},
+    {{ 54, -1, 4141, 2139 }},
+    {{ 446, -1, -1, 2122 }},
+    {{ 4143, -1, 3112, 2150 }},
+    {{ 462, 3489, 4144, -1 }},
+    {{ 450, -1, -1, 1186 }},
+    {{ 4146, 3162, -1, 3801 }},
+    {{ 3153, 3291, 4147, -1 }},
+    {{ 3304, -1, 4148, 3158 }},
+    {{ 60, -1, 4149, 969 }},
+    {{ 446, -1, -1, 2124 }},
+    {{ 487, 495, 4151, -1 }},
+    {{ 3175, -1, 3179, 4152 }},
+    {{ -1, -1, -1, 3463 }},
+    {{ -1, 1164, 4154, 6989 }},
+    {{ -1, -1, 6984, 248 }},
+    {{ -1, 4156, 4157, 3269 }},
+    {{ 3809, 3563, -1, 3575 }},
+    {{ 4158, -1, 3148, 3616 }},
+    {{ 4159, 3249, 3145, -1 }},
+    {{ 524, 1306, 4160, -1 }},
+    {{ 470, -1, -1, 7799 }},
+    {{ 876, 3277, 4162, -1 }},
+    {{ 898, -1, 4163, 4164 }},
+    {{ 3284, -1, 3285, 2637 }},
+    {{ -1, 2007, 4165, 2012 }},
+    {{ 3290, -1, -1, 5747 }},
+    {{ 939, 946, 4167, -1 }},
+    {{ 3306, -1, 3310, 4168 }},
+    {{ -1, -1, -1, 5948 }},
+    {{ -1, 6008, 4170, 6022 }},
+    {{ -1, -1, 6019, 2036 }},
+    {{ 4172, 3332, -1, 4176 }},
+    {{ 3321, 982, 4173, -1 }},
+    {{ 6102, -1, 4174, 3823 }},
+    {{ 989, -1, 4175, 2092 }},
+    {{ 480, -1, -1, 6134 }},
+    {{ -1, 1013, 4177, 1022 }},
+    {{ 3340, -1, 4178, 6285 }},
+    {{ 4179, -1, 2147, 6280 }},
+    {{ -1, 3489, 6276, -1 }},
+    {{ -1, 1059, 4181, 6608 }},
+    {{ 4182, -1, 6595, 6602 }},
+    {{ 4183, 1072, 7846, -1 }},
+    {{ -1, 1306, 6587, -1 }},
+    {{ 1263, 1266, 4185, -1 }},
+    {{ 1271, -1, 4186, 5742 }},
+    {{ 421, -1, -1, 7597 }},
+    {{ 4188, 7703, -1, 7709 }},
+    {{ 3565, 982, 4189, -1 }},
+    {{ 3570, -1, 4190, 7700 }},
+    {{ -1, -1, 992, 2092 }},
+    {{ 467, -1, 3259, 1526 }},
+    {{ -1, 4193, 4197, 8056 }},
+    {{ 4194, 7988, -1, 8002 }},
+    {{ 4195, 7973, 1462, -1 }},
+    {{ 3627, 1266, 4196, -1 }},
+    {{ -1, -1, 1274, 5742 }},
+    {{ 4198, -1, 8037, 8051 }},
+    {{ 3272, 1533, 8031, -1 }},
+    {{ 876, 4200, 3282, -1 }},
+    {{ 887, 891, -1, 4201 }},
+    {{ -1, 5682, 3279, 4202 }},
+    {{ -1, 5698, 4203, 1459 }},
+    {{ 522, -1, -1, 1455 }},
+    {{ 920, 5812, -1, 4205 }},
+    {{ -1, 5823, 4206, 5832 }},
+    {{ 928, -1, 4207, 3218 }},
+    {{ 461, -1, -1, 1655 }},
+    {{ -1, 1726, 591, 1740 }},
+    {{ -1, 5875, 4210, 1766 }},
+    {{ 4211, -1, 4212, 1761 }},
+    {{ 523, 527, -1, -1 }},
+    {{ -1, -1, 7899, 7906 }},
+    {{ 285, 6066, 4214, -1 }},
+    {{ 312, -1, 6073, 4215 }},
+    {{ -1, 2007, 3324, 4216 }},
+    {{ -1, 1516, -1, 2014 }},
+    {{ 37, 6085, -1, 4218 }},
+    {{ -1, 352, 1903, 6095 }},
+    {{ -1, 2061, 606, 2074 }},
+    {{ 4221, 6176, -1, 4225 }},
+    {{ 6153, 6158, 4222, -1 }},
+    {{ 3005, -1, 4223, 1908 }},
+    {{ 423, -1, 3336, 4224 }},
+    {{ -1, 1868, -1, 2097 }},
+    {{ -1, 6199, 4226, 6214 }},
+    {{ 819, -1, 4227, 6209 }},
+    {{ 1913, -1, 4228, 2150 }},
+    {{ -1, -1, 7111, 2148 }},
+    {{ 823, 6236, -1, 6242 }},
+    {{ -1, 6286, 4231, 3544 }},
+    {{ 4232, -1, 1235, 1240 }},
+    {{ -1, 6299, 7406, -1 }},
+    {{ -1, 6302, 4234, 6330 }},
+    {{ 4235, -1, 4237, 3616 }},
+    {{ 1919, 6315, 4236, -1 }},
+    {{ -1, -1, 1152, 7858 }},
+    {{ 4238, -1, 7899, 7906 }},
+    {{ -1, 6327, 1185, -1 }},
+    {{ 876, 6337, 4240, -1 }},
+    {{ 898, -1, 3352, 4241 }},
+    {{ -1, 2007, -1, 2012 }},
+    {{ -1, -1, 4243, 977 }},
+    {{ -1, -1, 6029, 974 }},
+    {{ -1, 6405, 4245, 6425 }},
+    {{ 4246, -1, 4248, 1053 }},
+    {{ 208, 6415, 4247, -1 }},
+    {{ -1, -1, 1152, 1163 }},
+    {{ 4249, -1, 1190, 6512 }},
+    {{ -1, 6423, 1185, -1 }},
+    {{ 3366, -1, 1190, 4251 }},
+    {{ -1, 4252, 1208, 1213 }},
+    {{ 4253, 6518, -1, 7182 }},
+    {{ -1, 153, 15, -1 }},
+    {{ -1, 4255, 4258, 6544 }},
+    {{ 4256, 6530, -1, 1230 }},
+    {{ 1933, 6522, 4257, -1 }},
+    {{ -1, -1, 118, 16 }},
+    {{ 4259, -1, 1235, 1240 }},
+    {{ 7378, 4260, 7406, -1 }},
+    {{ -1, 162, -1, 7401 }},
+    {{ 4262, 6558, -1, 6570 }},
+    {{ 1937, 6550, 4263, -1 }},
+    {{ 221, -1, 656, 16 }},
+    {{ 4265, -1, 7899, 7906 }},
+    {{ 7868, 4266, 1185, -1 }},
+    {{ -1, 6599, -1, 7896 }},
+    {{ -1, 6609, 4268, 8056 }},
+    {{ 4269, -1, 8037, 8051 }},
+    {{ 4270, 6630, 8031, -1 }},
+    {{ -1, 6627, 1313, -1 }},
+    {{ 3472, 4272, 4276, -1 }},
+    {{ 3490, 4273, -1, 1181 }},
+    {{ 4274, 1178, -1, 705 }},
+    {{ 7034, 1176, 4275, -1 }},
+    {{ 7044, -1, 4101, -1 }},
+    {{ 83, -1, 7068, 4277 }},
+    {{ -1, 4278, 689, 7078 }},
+    {{ 4466, 4279, -1, 7074 }},
+    {{ -1, -1, -1, 283 }},
+    {{ 4281, -1, 7111, 4285 }},
+    {{ 7086, 4282, 7106, -1 }},
+    {{ 4583, 7092, -1, 4283 }},
+    {{ -1, 4284, 12, 7102 }},
+    {{ -1, -1, -1, 80 }},
+    {{ -1, 4286, 7142, 7147 }},
+    {{ 4287, 4289, -1, 7137 }},
+    {{ 4804, 4288, 15, -1 }},
+    {{ -1, -1, -1, 802 }},
+    {{ 4290, 7133, -1, 4894 }},
+    {{ -1, -1, 5194, -1 }},
+    {{ 4292, -1, 7208, 7214 }},
+    {{ 7199, 4293, 5352, -1 }},
+    {{ 5323, 4294, -1, 7204 }},
+    {{ -1, -1, -1, 1134 }},
+    {{ -1, 4296, 7242, 7255 }},
+    {{ 4297, 7234, -1, 5511 }},
+    {{ 4298, 7227, 7230, -1 }},
+    {{ -1, -1, 1270, -1 }},
+    {{ 507, 3528, -1, 4300 }},
+    {{ -1, 7350, 4301, 7372 }},
+    {{ 4302, -1, 7364, 1053 }},
+    {{ 4303, 7356, 7360, -1 }},
+    {{ -1, -1, 134, -1 }},
+    {{ 4305, -1, 7429, 7435 }},
+    {{ 7420, 4306, 1185, -1 }},
+    {{ 7024, 4307, -1, 7425 }},
+    {{ -1, -1, -1, 705 }},
+    {{ -1, 4309, 7457, 7467 }},
+    {{ 4310, 7451, -1, 1230 }},
+    {{ 4311, 7445, 7448, -1 }},
+    {{ -1, -1, 1227, -1 }},
+    {{ -1, 4313, 4317, 7525 }},
+    {{ 4314, 7486, -1, 7493 }},
+    {{ 3547, 5471, 4315, -1 }},
+    {{ 4316, -1, 7482, 16 }},
+    {{ -1, -1, 168, -1 }},
+    {{ 4318, -1, 7507, 7520 }},
+    {{ 4319, 4321, 7502, -1 }},
+    {{ 1303, 4320, 1313, -1 }},
+    {{ -1, -1, -1, 6698 }},
+    {{ 4322, 7499, -1, 20 }},
+    {{ -1, -1, 1326, -1 }},
+    {{ 3652, 4324, 537, -1 }},
+    {{ 3675, 3686, -1, 4325 }},
+    {{ -1, 204, 534, 4326 }},
+    {{ -1, 1445, 1375, 4327 }},
+    {{ -1, 3703, 1775, 3685 }},
+    {{ 556, 3781, -1, 4329 }},
+    {{ -1, 3796, 4330, 3807 }},
+    {{ 1645, -1, 1417, 4331 }},
+    {{ -1, 3806, 3229, 1414 }},
+    {{ 24, -1, 1421, 4333 }},
+    {{ -1, 4334, 179, 1436 }},
+    {{ 507, 3830, -1, 4335 }},
+    {{ -1, -1, -1, 7372 }},
+    {{ 565, -1, 570, 4337 }},
+    {{ -1, 4338, 3912, 4342 }},
+    {{ 29, 4339, -1, 70 }},
+    {{ 3901, 3905, -1, 4340 }},
+    {{ -1, 3909, 284, 4341 }},
+    {{ -1, -1, 1917, 6330 }},
+    {{ -1, 4343, 3931, 1530 }},
+    {{ 854, 4344, -1, 1521 }},
+    {{ 3923, 3926, -1, 4345 }},
+    {{ -1, -1, -1, 1022 }},
+    {{ 577, 4347, 4352, -1 }},
+    {{ 3974, 586, -1, 4348 }},
+    {{ -1, 4011, 4349, 4020 }},
+    {{ 2608, -1, -1, 4350 }},
+    {{ -1, 3700, 591, 4351 }},
+    {{ -1, -1, 1745, 7525 }},
+    {{ 593, -1, 4040, 4353 }},
+    {{ -1, 4354, 1570, 4357 }},
+    {{ -1, 406, -1, 4355 }},
+    {{ -1, 4048, 2926, 4356 }},
+    {{ -1, -1, 2938, 6608 }},
+    {{ -1, 4358, 196, 1585 }},
+    {{ 854, 4049, -1, 4359 }},
+    {{ -1, -1, -1, 7758 }},
+    {{ 4361, 607, -1, 4366 }},
+    {{ 597, 601, 4362, -1 }},
+    {{ 4090, -1, 4101, 4363 }},
+    {{ -1, 8, -1, 4364 }},
+    {{ -1, 3766, 606, 4365 }},
+    {{ -1, -1, 2079, 8056 }},
+    {{ -1, 619, 1644, 4367 }},
+    {{ -1, 4368, 4191, 4192 }},
+    {{ 628, 4187, -1, 2173 }},
+    {{ 630, 634, -1, 4370 }},
+    {{ -1, 4371, 81, 645 }},
+    {{ 643, 1922, -1, 4372 }},
+    {{ -1, 6405, 4373, 6425 }},
+    {{ -1, -1, 4248, 1053 }},
+    {{ 657, 4375, 662, -1 }},
+    {{ 4346, 4376, -1, 4379 }},
+    {{ 4361, 607, -1, 4377 }},
+    {{ -1, 619, 1644, 4378 }},
+    {{ -1, 4368, 4191, 3877 }},
+    {{ -1, 4380, 12, 86 }},
+    {{ 630, 634, -1, 4381 }},
+    {{ -1, 4371, 81, 4382 }},
+    {{ -1, -1, 646, 4267 }},
+    {{ 668, -1, 4419, 4384 }},
+    {{ -1, 4385, 4454, 4460 }},
+    {{ 678, 4386, -1, 4900 }},
+    {{ 752, 4387, -1, 1879 }},
+    {{ 4446, 4449, -1, 4388 }},
+    {{ -1, -1, -1, 5218 }},
+    {{ 96, 4390, 30, -1 }},
+    {{ 100, 794, -1, 4391 }},
+    {{ -1, 4469, 935, 3894 }},
+    {{ -1, 4393, 4538, 1987 }},
+    {{ 4394, 4532, -1, 1972 }},
+    {{ 855, 4395, 862, -1 }},
+    {{ 4525, 4528, -1, 3900 }},
+    {{ 531, 4397, 4576, -1 }},
+    {{ 546, 4398, -1, 4402 }},
+    {{ 4546, 4550, -1, 4399 }},
+    {{ -1, 3796, 3804, 4400 }},
+    {{ -1, 4556, 466, 4401 }},
+    {{ -1, -1, 3270, 8056 }},
+    {{ -1, 4403, 2157, 4406 }},
+    {{ 4559, 4563, -1, 4404 }},
+    {{ -1, 4567, 206, 4405 }},
+    {{ -1, -1, 1691, 6608 }},
+    {{ -1, 4407, 1450, 2162 }},
+    {{ 4570, 4573, -1, 4408 }},
+    {{ -1, -1, -1, 3843 }},
+    {{ 577, 4410, 592, -1 }},
+    {{ 4585, 4590, -1, 4411 }},
+    {{ -1, 4011, 74, 4412 }},
+    {{ -1, 4597, 2638, 661 }},
+    {{ 83, -1, 4673, 4414 }},
+    {{ -1, 4415, 689, 4691 }},
+    {{ 4466, 4416, -1, 4686 }},
+    {{ 681, 4417, -1, 283 }},
+    {{ 724, 4683, -1, 4418 }},
+    {{ -1, -1, -1, 4495 }},
+    {{ 4420, -1, 4737, 4432 }},
+    {{ 4701, 4421, 4732, -1 }},
+    {{ 4583, 4422, -1, 4428 }},
+    {{ 697, 4423, -1, 4426 }},
+    {{ 4710, 4711, -1, 4424 }},
+    {{ -1, 4715, 615, 4425 }},
+    {{ -1, -1, 4157, 3269 }},
+    {{ -1, 4427, 1644, 626 }},
+    {{ 4719, 4721, -1, 4408 }},
+    {{ -1, 4429, 12, 4728 }},
+    {{ 711, 4430, -1, 80 }},
+    {{ 731, 4726, -1, 4431 }},
+    {{ -1, -1, -1, 4661 }},
+    {{ -1, 4433, 4784, 4789 }},
+    {{ 4434, 4438, -1, 4778 }},
+    {{ 4804, 4435, 15, -1 }},
+    {{ 92, 4436, -1, 802 }},
+    {{ 737, 4683, -1, 4437 }},
+    {{ -1, -1, -1, 4847 }},
+    {{ 4439, 4772, -1, 4894 }},
+    {{ 753, 4440, 5194, -1 }},
+    {{ 741, 4767, -1, 4441 }},
+    {{ -1, -1, 984, 6095 }},
+    {{ 770, 4443, 784, -1 }},
+    {{ 4806, 4810, -1, 4444 }},
+    {{ -1, 4815, -1, 4445 }},
+    {{ -1, -1, 5065, 1459 }},
+    {{ 4884, 4447, 1001, -1 }},
+    {{ 4888, 2981, -1, 4448 }},
+    {{ -1, 352, -1, 2995 }},
+    {{ 4450, 3090, -1, 4452 }},
+    {{ 3062, 3069, 4451, -1 }},
+    {{ 3005, -1, 6179, -1 }},
+    {{ -1, 3115, 4453, 3138 }},
+    {{ -1, -1, -1, 3132 }},
+    {{ 4455, -1, 4931, 1889 }},
+    {{ 4922, 4456, 5352, -1 }},
+    {{ 5323, 4457, -1, 4927 }},
+    {{ 106, 4458, -1, 1134 }},
+    {{ 737, 4683, -1, 4459 }},
+    {{ -1, -1, -1, 5342 }},
+    {{ -1, 4461, 1895, 4999 }},
+    {{ 4462, 4972, -1, 5511 }},
+    {{ 4463, 4959, 4967, -1 }},
+    {{ 856, 4464, 1270, -1 }},
+    {{ 769, 4955, -1, 4465 }},
+    {{ -1, -1, 7578, 5697 }},
+    {{ 96, 4467, 30, -1 }},
+    {{ 100, 794, -1, 4468 }},
+    {{ -1, 4469, 935, 5141 }},
+    {{ 804, 5138, -1, 4470 }},
+    {{ -1, 3348, 4471, 1690 }},
+    {{ -1, -1, 3365, 1053 }},
+    {{ 5144, 4473, 5163, -1 }},
+    {{ 5155, 5159, -1, 4474 }},
+    {{ -1, 2344, 811, 1110 }},
+    {{ 5180, 2547, -1, 4476 }},
+    {{ -1, 2570, 1118, 2584 }},
+    {{ -1, 2632, 4478, 1766 }},
+    {{ -1, -1, -1, 1761 }},
+    {{ 285, 2960, 4480, -1 }},
+    {{ 312, -1, 2967, 4481 }},
+    {{ -1, 2007, 2976, -1 }},
+    {{ 37, 2981, -1, 4483 }},
+    {{ -1, 352, 4484, 2995 }},
+    {{ 2608, -1, -1, 2990 }},
+    {{ 4486, 3090, -1, 4488 }},
+    {{ 3062, 3069, 4487, -1 }},
+    {{ 3005, -1, 1131, 704 }},
+    {{ -1, 3115, 4489, 3138 }},
+    {{ 1878, -1, 4490, 3132 }},
+    {{ -1, -1, -1, 2150 }},
+    {{ 4492, 3162, -1, 2126 }},
+    {{ 3153, 3291, 4493, -1 }},
+    {{ 3304, -1, -1, 3158 }},
+    {{ -1, 3219, 3963, 3544 }},
+    {{ -1, 2151, 4496, 3269 }},
+    {{ 4497, -1, 4212, 3616 }},
+    {{ -1, 3249, -1, -1 }},
+    {{ -1, 4499, 1929, 1934 }},
+    {{ 4500, 1922, -1, 1926 }},
+    {{ 4501, 4504, 246, -1 }},
+    {{ 5257, 4502, 6342, -1 }},
+    {{ 5260, 891, -1, 4503 }},
+    {{ -1, 5682, -1, 5697 }},
+    {{ 4505, 919, -1, 6357 }},
+    {{ 909, 913, 4506, -1 }},
+    {{ 5778, -1, 5787, -1 }},
+    {{ 1075, 4508, 5317, -1 }},
+    {{ 1087, 4509, -1, 4511 }},
+    {{ 5305, 5306, -1, 4510 }},
+    {{ -1, 4715, 3804, 2818 }},
+    {{ -1, 4512, 2157, 561 }},
+    {{ 5312, 5313, -1, 2821 }},
+    {{ 1107, 4514, 1119, -1 }},
+    {{ 5325, 5329, -1, 4515 }},
+    {{ -1, 5333, -1, 2827 }},
+    {{ 4517, -1, 5385, 1961 }},
+    {{ 5370, 4518, 1185, -1 }},
+    {{ 7024, 4519, -1, 1958 }},
+    {{ 1175, 4520, -1, 705 }},
+    {{ 844, 5377, -1, 2842 }},
+    {{ -1, 4522, 4538, 1987 }},
+    {{ 4523, 4532, -1, 1972 }},
+    {{ 855, 4524, 862, -1 }},
+    {{ 4525, 4528, -1, 7609 }},
+    {{ 5473, 4526, 7601, -1 }},
+    {{ 5478, 3744, -1, 4527 }},
+    {{ -1, 352, -1, 5774 }},
+    {{ 4529, 5812, -1, 4531 }},
+    {{ 5798, 3772, 4530, -1 }},
+    {{ 5806, -1, 922, -1 }},
+    {{ -1, 5823, 750, 5832 }},
+    {{ 4533, 7703, -1, 7709 }},
+    {{ 4534, 4536, 5500, -1 }},
+    {{ 5496, 4535, 7674, -1 }},
+    {{ 4856, 304, -1, 755 }},
+    {{ 4537, 6085, -1, 983 }},
+    {{ 326, 331, 758, -1 }},
+    {{ 4539, -1, 1977, 1982 }},
+    {{ 4540, 255, 5527, -1 }},
+    {{ 1303, 4541, 1313, -1 }},
+    {{ 1307, 4542, -1, 6698 }},
+    {{ 724, 5519, -1, 2874 }},
+    {{ 531, 4544, 4576, -1 }},
+    {{ 546, 4545, -1, 4557 }},
+    {{ 4546, 4550, -1, 4554 }},
+    {{ 3767, 4547, 557, -1 }},
+    {{ 37, 2981, -1, 4548 }},
+    {{ -1, 352, 4549, 2995 }},
+    {{ 2608, -1, 1904, 2990 }},
+    {{ 4551, 3090, -1, 3790 }},
+    {{ 3062, 3069, 4552, -1 }},
+    {{ 3005, -1, 3784, 4553 }},
+    {{ -1, 8, 1909, 3086 }},
+    {{ -1, 3796, 3804, 4555 }},
+    {{ -1, 4556, 466, 3811 }},
+    {{ 3809, 3563, -1, 2173 }},
+    {{ -1, 4558, 2157, 4568 }},
+    {{ 4559, 4563, -1, 4566 }},
+    {{ 3276, 4560, 1671, -1 }},
+    {{ 3292, 919, -1, 4561 }},
+    {{ -1, 931, 4562, 5874 }},
+    {{ 3299, -1, -1, 5869 }},
+    {{ 4564, 3332, -1, 1682 }},
+    {{ 3321, 982, 4565, -1 }},
+    {{ 6102, -1, 478, 3840 }},
+    {{ -1, 4567, 206, 3827 }},
+    {{ 3349, 1027, -1, 3723 }},
+    {{ -1, 4569, 1450, 2162 }},
+    {{ 4570, 4573, -1, 563 }},
+    {{ 514, 4571, 220, -1 }},
+    {{ 3552, 919, -1, 4572 }},
+    {{ -1, 931, -1, 5874 }},
+    {{ 4574, 7703, -1, 4050 }},
+    {{ 3565, 982, 4575, -1 }},
+    {{ 3570, -1, 1753, -1 }},
+    {{ 565, -1, 570, 4577 }},
+    {{ -1, 69, 3912, 4578 }},
+    {{ -1, 4579, 3931, 1530 }},
+    {{ 854, 4580, -1, 1521 }},
+    {{ 3923, 4581, -1, 2168 }},
+    {{ 4582, 6176, -1, 3929 }},
+    {{ 6153, 6158, -1, -1 }},
+    {{ 577, 4584, 592, -1 }},
+    {{ 4585, 4590, -1, 4595 }},
+    {{ 326, 4586, 3983, -1 }},
+    {{ 2473, 2482, -1, 4587 }},
+    {{ -1, 352, 4588, 3980 }},
+    {{ 2488, -1, 4589, 3978 }},
+    {{ 357, -1, 2491, -1 }},
+    {{ 4591, 4000, -1, 587 }},
+    {{ 2523, 2534, 4592, -1 }},
+    {{ 2539, -1, 341, 4593 }},
+    {{ -1, 8, 4594, 3998 }},
+    {{ 431, -1, 2544, -1 }},
+    {{ -1, 4011, 74, 4596 }},
+    {{ -1, 4597, 2638, 2162 }},
+    {{ 4022, 1750, -1, 2173 }},
+    {{ 4052, 4599, 4602, -1 }},
+    {{ 299, 304, -1, 4600 }},
+    {{ -1, 2344, 4058, 4601 }},
+    {{ -1, 2361, 4203, 1459 }},
+    {{ 312, -1, 4064, 4603 }},
+    {{ -1, 4604, 2976, 600 }},
+    {{ 29, 1492, -1, 4605 }},
+    {{ -1, 185, -1, 1507 }},
+    {{ 339, 2547, -1, 4607 }},
+    {{ -1, 2570, 4608, 2584 }},
+    {{ 349, -1, 4207, 3218 }},
+    {{ 4610, -1, 4101, 78 }},
+    {{ 360, 4611, 4097, -1 }},
+    {{ 370, 2702, -1, 4612 }},
+    {{ -1, 79, 4093, 4613 }},
+    {{ -1, 226, -1, 1807 }},
+    {{ 285, 2960, 4615, -1 }},
+    {{ 312, -1, 4110, 4616 }},
+    {{ -1, 2007, 4113, 4216 }},
+    {{ 4618, 3090, -1, 4621 }},
+    {{ 3062, 3069, 4619, -1 }},
+    {{ 3005, -1, 4620, 4553 }},
+    {{ 423, -1, 4131, 4224 }},
+    {{ -1, 3115, 4622, 3138 }},
+    {{ 819, -1, 4142, 3132 }},
+    {{ -1, 4624, 615, 4628 }},
+    {{ 4625, 3162, -1, 4627 }},
+    {{ 3153, 3291, 4626, -1 }},
+    {{ 3304, -1, 825, 3158 }},
+    {{ -1, 3348, 624, 3370 }},
+    {{ -1, 4629, 4157, 3269 }},
+    {{ 4630, 3563, -1, 3575 }},
+    {{ 3238, 3551, 629, -1 }},
+    {{ 4161, 4560, 621, -1 }},
+    {{ 4633, 3332, -1, 4635 }},
+    {{ 3321, 982, 4634, -1 }},
+    {{ 6102, -1, 4174, 3840 }},
+    {{ -1, 1013, 4636, 1022 }},
+    {{ 640, -1, 641, 6285 }},
+    {{ 4638, 1027, -1, 1032 }},
+    {{ 3350, 6351, 4639, -1 }},
+    {{ 3355, -1, -1, 6376 }},
+    {{ 876, 4641, 3282, -1 }},
+    {{ 887, 891, -1, 4642 }},
+    {{ -1, 5682, 3279, 4643 }},
+    {{ -1, 5698, -1, 1459 }},
+    {{ 920, 5812, -1, 4645 }},
+    {{ -1, 5823, 4646, 5832 }},
+    {{ 928, -1, -1, 3218 }},
+    {{ -1, 5875, 4478, 1766 }},
+    {{ 285, 6066, 4649, -1 }},
+    {{ 312, -1, 6073, 4650 }},
+    {{ -1, 2007, 3324, -1 }},
+    {{ 37, 6085, -1, 4652 }},
+    {{ -1, 352, 3904, 6095 }},
+    {{ 4654, 6176, -1, 4657 }},
+    {{ 6153, 6158, 4655, -1 }},
+    {{ 3005, -1, 4656, 3908 }},
+    {{ 423, -1, 3336, -1 }},
+    {{ -1, 6199, 4658, 6214 }},
+    {{ 1878, -1, 4490, 6209 }},
+    {{ 1881, 6236, -1, 6242 }},
+    {{ -1, 6286, 3963, 3544 }},
+    {{ -1, 6302, 4662, 6330 }},
+    {{ 4663, -1, 4212, 3616 }},
+    {{ -1, 6315, -1, -1 }},
+    {{ -1, 4665, 2182, 2187 }},
+    {{ 4666, 2174, -1, 2178 }},
+    {{ 4667, 4670, 279, -1 }},
+    {{ 1263, 4668, 515, -1 }},
+    {{ 1267, 7568, -1, 4669 }},
+    {{ -1, 7575, -1, 5697 }},
+    {{ 4671, 919, -1, 7609 }},
+    {{ 909, 913, 4672, -1 }},
+    {{ 5778, -1, 3554, -1 }},
+    {{ 668, -1, 4419, 4674 }},
+    {{ -1, 4675, 4454, 4460 }},
+    {{ 678, 4676, -1, 4900 }},
+    {{ 752, 4677, -1, 1879 }},
+    {{ 4446, 4678, -1, 2200 }},
+    {{ 4679, 3090, -1, 4452 }},
+    {{ 3062, 3069, -1, -1 }},
+    {{ 285, 2960, 4681, -1 }},
+    {{ 312, -1, 2967, -1 }},
+    {{ 37, 2981, -1, 4448 }},
+    {{ 4684, 3090, -1, 4452 }},
+    {{ 3062, 3069, 4685, -1 }},
+    {{ 3005, -1, -1, -1 }},
+    {{ -1, 4687, 1929, 1934 }},
+    {{ 4688, 1922, -1, 1926 }},
+    {{ 4501, 4689, 246, -1 }},
+    {{ 4690, 919, -1, 6357 }},
+    {{ 909, 913, -1, -1 }},
+    {{ -1, 4692, 4538, 1987 }},
+    {{ 4693, 4697, -1, 1972 }},
+    {{ 855, 4694, 862, -1 }},
+    {{ 4525, 4695, -1, 7609 }},
+    {{ 4696, 5812, -1, 4531 }},
+    {{ 5798, 3772, -1, -1 }},
+    {{ 4698, 7703, -1, 7709 }},
+    {{ 4534, 4699, 5500, -1 }},
+    {{ 4700, 6085, -1, 983 }},
+    {{ 326, 331, -1, -1 }},
+    {{ 531, 4702, 4576, -1 }},
+    {{ 546, 4545, -1, 4703 }},
+    {{ -1, 4558, 2157, 4704 }},
+    {{ -1, 4705, 1450, 2162 }},
+    {{ 4570, 4706, -1, 563 }},
+    {{ 4707, 7703, -1, 4050 }},
+    {{ 3565, 982, -1, -1 }},
+    {{ 697, 4709, -1, 4717 }},
+    {{ 4710, 4711, -1, 4714 }},
+    {{ 4614, 4482, 703, -1 }},
+    {{ 4712, 3090, -1, 4621 }},
+    {{ 3062, 3069, 4713, -1 }},
+    {{ 3005, -1, 4620, 704 }},
+    {{ -1, 4715, 615, 4628 }},
+    {{ 4625, 3162, -1, 4716 }},
+    {{ -1, 3348, 708, 3370 }},
+    {{ -1, 4718, 1644, 626 }},
+    {{ 4719, 4721, -1, 707 }},
+    {{ 4161, 4720, 621, -1 }},
+    {{ 3292, 919, -1, 4572 }},
+    {{ 4722, 3332, -1, 4050 }},
+    {{ 3321, 982, 4723, -1 }},
+    {{ 6102, -1, 4174, -1 }},
+    {{ 285, 6066, 4725, -1 }},
+    {{ 312, -1, 6073, -1 }},
+    {{ 4727, 6176, -1, 3929 }},
+    {{ 6153, 6158, 4685, -1 }},
+    {{ -1, 4729, 2182, 2187 }},
+    {{ 4730, 2174, -1, 2178 }},
+    {{ 4667, 4731, 279, -1 }},
+    {{ 4690, 919, -1, 7609 }},
+    {{ 83, -1, 4673, 4733 }},
+    {{ -1, 4734, 689, 4691 }},
+    {{ 4466, 4735, -1, 4686 }},
+    {{ 681, 4736, -1, 283 }},
+    {{ 724, 4678, -1, 687 }},
+    {{ 4738, -1, 4737, 4748 }},
+    {{ 4701, 4739, 4732, -1 }},
+    {{ 4583, 4740, -1, 4745 }},
+    {{ 697, 4709, -1, 4741 }},
+    {{ -1, 4742, 1644, 626 }},
+    {{ 4719, 4743, -1, 707 }},
+    {{ 4744, 3332, -1, 4050 }},
+    {{ 3321, 982, -1, -1 }},
+    {{ -1, 4746, 12, 4728 }},
+    {{ 711, 4747, -1, 80 }},
+    {{ 731, 4581, -1, 717 }},
+    {{ -1, 4749, 4784, 4789 }},
+    {{ 4750, 4753, -1, 4778 }},
+    {{ 4804, 4751, 15, -1 }},
+    {{ 92, 4752, -1, 802 }},
+    {{ 737, 4678, -1, 749 }},
+    {{ 4754, 4758, -1, 4894 }},
+    {{ 753, 4755, 5194, -1 }},
+    {{ 741, 4756, -1, 4878 }},
+    {{ 4757, 2547, -1, 4770 }},
+    {{ 2523, 2534, -1, -1 }},
+    {{ 4759, 4889, -1, 4892 }},
+    {{ 4774, 4760, 1001, -1 }},
+    {{ 4700, 2981, -1, 4117 }},
+    {{ 285, 2960, 4762, -1 }},
+    {{ 312, -1, -1, -1 }},
+    {{ 2450, 2455, 4764, -1 }},
+    {{ 312, -1, 2465, -1 }},
+    {{ 2473, 2482, -1, 4766 }},
+    {{ -1, 352, -1, 2494 }},
+    {{ 4768, 2547, -1, 4770 }},
+    {{ 2523, 2534, 4769, -1 }},
+    {{ 2539, -1, -1, -1 }},
+    {{ -1, 2570, 4771, 2584 }},
+    {{ -1, -1, 6088, 3218 }},
+    {{ 4773, 4889, -1, 4892 }},
+    {{ 4774, 4777, 1001, -1 }},
+    {{ 285, 4775, 6154, -1 }},
+    {{ 299, 304, -1, 4776 }},
+    {{ -1, 2344, -1, 2962 }},
+    {{ 4537, 2981, -1, 4117 }},
+    {{ -1, 4779, 4912, 5295 }},
+    {{ 4780, 1027, -1, 1032 }},
+    {{ 4781, 6351, 4908, -1 }},
+    {{ 4904, 4782, 6342, -1 }},
+    {{ 4783, 891, -1, 6338 }},
+    {{ 5641, 5646, -1, -1 }},
+    {{ 4785, -1, 4931, 4937 }},
+    {{ 4922, 4786, 5352, -1 }},
+    {{ 5323, 4787, -1, 4927 }},
+    {{ 106, 4788, -1, 1134 }},
+    {{ 737, 4678, -1, 837 }},
+    {{ -1, 4790, 4985, 4999 }},
+    {{ 4791, 4799, -1, 5511 }},
+    {{ 4792, 4796, 4967, -1 }},
+    {{ 856, 4793, 1270, -1 }},
+    {{ 769, 4794, -1, 5467 }},
+    {{ 4795, 5669, -1, 4957 }},
+    {{ 1593, 1598, -1, -1 }},
+    {{ 4797, 919, -1, 7609 }},
+    {{ 4961, 4798, 7601, -1 }},
+    {{ 4700, 3744, -1, 914 }},
+    {{ 4800, 7703, -1, 7709 }},
+    {{ 4801, 982, 4981, -1 }},
+    {{ 4975, 4802, 7674, -1 }},
+    {{ 4803, 304, -1, 6067 }},
+    {{ 2289, 2294, -1, -1 }},
+    {{ 770, 4805, 784, -1 }},
+    {{ 4806, 4810, -1, 4814 }},
+    {{ 5029, 4807, 779, -1 }},
+    {{ 37, 1552, -1, 4808 }},
+    {{ -1, 352, 4809, 5036 }},
+    {{ 2608, -1, -1, 5035 }},
+    {{ 4811, 5046, -1, 782 }},
+    {{ 1593, 1598, 4812, -1 }},
+    {{ 3005, -1, 3423, 4813 }},
+    {{ -1, 8, -1, 5045 }},
+    {{ -1, 4815, -1, 5063 }},
+    {{ 5056, 1676, -1, 4470 }},
+    {{ 2213, 286, 4817, -1 }},
+    {{ 2265, -1, 2275, 4818 }},
+    {{ -1, 296, 247, -1 }},
+    {{ 299, 304, -1, 4820 }},
+    {{ -1, 2344, 4821, 1110 }},
+    {{ 24, -1, -1, -1 }},
+    {{ 322, -1, 2417, 4823 }},
+    {{ -1, -1, 2432, 2436 }},
+    {{ 326, 331, 4825, -1 }},
+    {{ 2498, -1, 4826, 4827 }},
+    {{ 2513, -1, 390, -1 }},
+    {{ -1, 8, -1, -1 }},
+    {{ 339, 2547, -1, 4829 }},
+    {{ -1, 2570, 4830, 2584 }},
+    {{ 349, -1, -1, 3218 }},
+    {{ -1, 2632, 4832, 1766 }},
+    {{ -1, -1, 2644, 1761 }},
+    {{ 285, 2960, 4834, -1 }},
+    {{ 312, -1, 4835, 4836 }},
+    {{ 2968, -1, 2972, -1 }},
+    {{ -1, 2007, -1, -1 }},
+    {{ 360, 369, 4838, -1 }},
+    {{ 3007, -1, 3011, -1 }},
+    {{ 4840, 3090, -1, 4843 }},
+    {{ 3062, 3069, 4841, -1 }},
+    {{ 3005, -1, 4842, 704 }},
+    {{ 423, -1, -1, -1 }},
+    {{ -1, 3115, 4844, 3138 }},
+    {{ 1878, -1, 4845, 3132 }},
+    {{ -1, -1, 3127, 2150 }},
+    {{ 4492, 3162, -1, 1639 }},
+    {{ -1, 1660, 4848, 3269 }},
+    {{ 4849, -1, 3259, 3616 }},
+    {{ -1, 3249, 3254, -1 }},
+    {{ 2213, 4851, 4853, -1 }},
+    {{ 2237, 2243, -1, 4852 }},
+    {{ -1, 2256, 773, 774 }},
+    {{ 2265, -1, 2275, 4854 }},
+    {{ -1, 4855, 247, 1388 }},
+    {{ 29, 2285, -1, -1 }},
+    {{ 2289, 2294, 4857, -1 }},
+    {{ 1564, -1, 2306, 4858 }},
+    {{ -1, 2310, 1570, -1 }},
+    {{ 2315, 2328, -1, 4860 }},
+    {{ -1, 1633, 4861, 2339 }},
+    {{ 2334, -1, -1, 3218 }},
+    {{ 4863, -1, 5169, 6078 }},
+    {{ 2368, 4864, 5168, -1 }},
+    {{ 2381, 2386, -1, 4865 }},
+    {{ -1, 2394, 12, -1 }},
+    {{ 2450, 2455, 4867, -1 }},
+    {{ 312, -1, 2465, 4868 }},
+    {{ -1, 2468, 2439, -1 }},
+    {{ 2473, 2482, -1, 4870 }},
+    {{ -1, 352, 4871, 2494 }},
+    {{ 2488, -1, -1, 1560 }},
+    {{ 4873, 2547, -1, 4875 }},
+    {{ 2523, 2534, 4874, -1 }},
+    {{ 2539, -1, 797, 798 }},
+    {{ -1, 2570, 4876, 2584 }},
+    {{ 4877, -1, 6088, 3218 }},
+    {{ 2576, 19, -1, -1 }},
+    {{ -1, 4879, 984, 6095 }},
+    {{ 4880, 2602, -1, 205 }},
+    {{ 2590, 1666, 4881, -1 }},
+    {{ 2597, -1, -1, 3317 }},
+    {{ 4883, 4889, -1, 4892 }},
+    {{ 4884, 4887, 1001, -1 }},
+    {{ 285, 4885, 6154, -1 }},
+    {{ 299, 304, -1, 4886 }},
+    {{ -1, 2344, 811, 2962 }},
+    {{ 4888, 2981, -1, 4117 }},
+    {{ 326, 331, 814, -1 }},
+    {{ 5212, 3090, -1, 4890 }},
+    {{ -1, 3115, 4891, 3138 }},
+    {{ 819, -1, 5216, 3132 }},
+    {{ -1, 4893, 818, 5218 }},
+    {{ 4625, 3162, -1, 2126 }},
+    {{ -1, 822, 4895, 5245 }},
+    {{ 4896, -1, 5235, 5240 }},
+    {{ 4897, 19, 125, -1 }},
+    {{ 5230, 4898, 6254, -1 }},
+    {{ 4899, 3420, -1, 6698 }},
+    {{ 3411, 1088, -1, -1 }},
+    {{ -1, 4901, 4912, 5295 }},
+    {{ 4902, 1027, -1, 1032 }},
+    {{ 4903, 6351, 4908, -1 }},
+    {{ 4904, 4906, 6342, -1 }},
+    {{ 5584, 4905, 883, -1 }},
+    {{ 5603, 5608, -1, 858 }},
+    {{ 4907, 891, -1, 6338 }},
+    {{ 5641, 5646, 861, -1 }},
+    {{ 4909, -1, 130, 6376 }},
+    {{ 5263, 4910, 6365, -1 }},
+    {{ 4911, 5919, -1, 2031 }},
+    {{ 5915, 72, -1, -1 }},
+    {{ 4913, -1, 5285, 1053 }},
+    {{ 4914, 4918, 5280, -1 }},
+    {{ 1037, 4915, 134, -1 }},
+    {{ 831, 4916, -1, 6698 }},
+    {{ 4917, 6689, -1, 6695 }},
+    {{ 6686, 4547, -1, -1 }},
+    {{ 4919, 142, -1, 20 }},
+    {{ 5274, 4920, 6471, -1 }},
+    {{ 4921, 1116, -1, 141 }},
+    {{ 5172, 6782, -1, -1 }},
+    {{ 1075, 4923, 5317, -1 }},
+    {{ 1087, 5304, -1, 4924 }},
+    {{ -1, 4925, 2157, 561 }},
+    {{ 5312, 4926, -1, 6703 }},
+    {{ 4744, 3332, -1, 5315 }},
+    {{ -1, 4928, -1, 1138 }},
+    {{ 4929, 634, -1, 80 }},
+    {{ 5348, 4930, 1671, -1 }},
+    {{ 4690, 4204, -1, 632 }},
+    {{ 4932, -1, 5385, 5391 }},
+    {{ 5370, 4933, 1185, -1 }},
+    {{ 7024, 4934, -1, 5380 }},
+    {{ 1175, 4935, -1, 705 }},
+    {{ 844, 4936, -1, 7056 }},
+    {{ 4679, 3090, -1, 5378 }},
+    {{ -1, 4938, 5426, 5436 }},
+    {{ 4939, 4947, -1, 1230 }},
+    {{ 4940, 4944, 5414, -1 }},
+    {{ 1218, 4941, 1227, -1 }},
+    {{ 850, 4942, -1, -1 }},
+    {{ 4795, 4943, -1, -1 }},
+    {{ 1617, 3090, -1, -1 }},
+    {{ 4945, 794, -1, 802 }},
+    {{ 5408, 4946, 7307, -1 }},
+    {{ 4700, 4606, -1, 792 }},
+    {{ 4948, 816, -1, 7340 }},
+    {{ 4949, 812, 5424, -1 }},
+    {{ 5420, 4950, 7326, -1 }},
+    {{ 4803, 5159, -1, 810 }},
+    {{ 285, 1536, 4952, -1 }},
+    {{ 312, -1, 321, -1 }},
+    {{ 37, 1552, -1, 4954 }},
+    {{ -1, 352, -1, 5651 }},
+    {{ 4956, 5669, -1, 4957 }},
+    {{ 1593, 1598, 4685, -1 }},
+    {{ -1, 1633, 4958, 5678 }},
+    {{ -1, -1, 894, 3218 }},
+    {{ 4960, 919, -1, 7609 }},
+    {{ 4961, 4964, 7601, -1 }},
+    {{ 5748, 4962, 910, -1 }},
+    {{ 299, 304, -1, 4963 }},
+    {{ -1, 2344, -1, 3734 }},
+    {{ 4965, 3744, -1, 914 }},
+    {{ 326, 331, 4966, -1 }},
+    {{ 2498, -1, 5764, -1 }},
+    {{ 4968, -1, 5488, 16 }},
+    {{ 1277, 4969, 168, -1 }},
+    {{ 865, 4970, -1, 2031 }},
+    {{ 4971, 607, -1, 618 }},
+    {{ 597, 601, -1, -1 }},
+    {{ 4973, 7703, -1, 7709 }},
+    {{ 4974, 982, 4981, -1 }},
+    {{ 4975, 4978, 7674, -1 }},
+    {{ 2213, 4976, 294, -1 }},
+    {{ 2237, 2243, -1, 4977 }},
+    {{ -1, 2256, -1, 291 }},
+    {{ 4979, 304, -1, 6067 }},
+    {{ 2289, 2294, 4980, -1 }},
+    {{ 1564, -1, 2306, -1 }},
+    {{ 4982, -1, 5507, 7700 }},
+    {{ 5502, 4983, 7684, -1 }},
+    {{ 4984, 2702, -1, 2031 }},
+    {{ 2686, 72, -1, -1 }},
+    {{ 4986, -1, 5533, 5547 }},
+    {{ 4987, 4991, 5527, -1 }},
+    {{ 1303, 4988, 1313, -1 }},
+    {{ 1307, 4989, -1, 6698 }},
+    {{ 724, 4990, -1, 7789 }},
+    {{ 4679, 3090, -1, 5520 }},
+    {{ 4992, 4996, -1, 20 }},
+    {{ 1317, 4993, 1326, -1 }},
+    {{ 874, 4994, -1, -1 }},
+    {{ 4757, 4995, -1, -1 }},
+    {{ 2548, 3090, -1, -1 }},
+    {{ 4997, 1128, -1, 1134 }},
+    {{ 5525, 4998, 7840, -1 }},
+    {{ 4700, 4606, -1, 1126 }},
+    {{ -1, 5000, 5573, 8056 }},
+    {{ 5001, 7988, -1, 8002 }},
+    {{ 5002, 7973, 5567, -1 }},
+    {{ 5003, 1266, 5563, -1 }},
+    {{ 5557, 5004, 7962, -1 }},
+    {{ 5005, 7556, -1, 1265 }},
+    {{ 1535, 1394, -1, -1 }},
+    {{ 1364, 5007, 5011, -1 }},
+    {{ 1393, 1408, -1, 5008 }},
+    {{ -1, 204, 3379, 5009 }},
+    {{ -1, 1445, 3382, 5010 }},
+    {{ -1, 1460, -1, 8056 }},
+    {{ 1464, -1, 1479, 5012 }},
+    {{ -1, 3385, 247, 5013 }},
+    {{ -1, 3388, 1525, 1530 }},
+    {{ 1535, 1394, 3391, -1 }},
+    {{ 1409, 1616, -1, 5016 }},
+    {{ -1, 1633, 5017, 5018 }},
+    {{ 1645, -1, 3397, 4033 }},
+    {{ -1, 1660, 5019, 3269 }},
+    {{ 467, -1, -1, 3616 }},
+    {{ 1665, 1676, -1, 5021 }},
+    {{ -1, 3348, 5022, 1690 }},
+    {{ 207, -1, -1, 1053 }},
+    {{ 1780, 3400, 5630, -1 }},
+    {{ 5632, -1, 1850, 5025 }},
+    {{ -1, 5026, 1883, 1894 }},
+    {{ 1869, 3406, -1, 4900 }},
+    {{ 1900, 1905, -1, 5028 }},
+    {{ -1, 822, -1, 1916 }},
+    {{ 285, 1536, 5030, -1 }},
+    {{ 312, -1, 321, 5031 }},
+    {{ -1, 1544, 2439, 3414 }},
+    {{ 37, 1552, -1, 5033 }},
+    {{ -1, 352, 5034, 5036 }},
+    {{ 2608, -1, 550, 5035 }},
+    {{ -1, 1726, -1, 1740 }},
+    {{ -1, 2632, 5037, 1766 }},
+    {{ 2639, -1, -1, 1761 }},
+    {{ 46, -1, 390, 5039 }},
+    {{ -1, 3417, 402, 2039 }},
+    {{ -1, 406, -1, 5041 }},
+    {{ -1, 411, -1, 2931 }},
+    {{ 1593, 1598, 5043, -1 }},
+    {{ 3005, -1, 3423, 5044 }},
+    {{ -1, 8, 559, 5045 }},
+    {{ -1, 2061, -1, 2074 }},
+    {{ 1617, 3090, -1, 5047 }},
+    {{ -1, 3115, 5048, 3138 }},
+    {{ 1628, -1, 5049, 3132 }},
+    {{ 448, -1, -1, 2150 }},
+    {{ 3173, 19, 5051, -1 }},
+    {{ 54, -1, 2132, -1 }},
+    {{ -1, 1660, 5053, 3269 }},
+    {{ 5054, -1, 3259, 3616 }},
+    {{ 468, 3249, -1, -1 }},
+    {{ 5056, 1676, -1, 5060 }},
+    {{ 3276, 1666, 5057, -1 }},
+    {{ 3304, -1, 5058, 5059 }},
+    {{ 60, -1, 962, -1 }},
+    {{ -1, -1, -1, 977 }},
+    {{ -1, 3348, 5061, 1690 }},
+    {{ 5062, -1, 3365, 1053 }},
+    {{ -1, 3360, -1, -1 }},
+    {{ -1, 5064, 5065, 1459 }},
+    {{ 1140, 1750, -1, 1446 }},
+    {{ 5066, -1, 5703, 1455 }},
+    {{ 523, 5067, 7846, -1 }},
+    {{ 528, 3601, -1, -1 }},
+    {{ 531, 5069, 5711, -1 }},
+    {{ 546, 555, -1, 5070 }},
+    {{ -1, 3814, 3018, 3428 }},
+    {{ 76, 607, -1, 5072 }},
+    {{ -1, 619, 3431, 5073 }},
+    {{ -1, 627, -1, 4192 }},
+    {{ 630, 634, -1, 5075 }},
+    {{ -1, 642, -1, 645 }},
+    {{ 5077, -1, 5731, 5737 }},
+    {{ 5725, 5078, 2969, -1 }},
+    {{ 4583, 3442, -1, 908 }},
+    {{ 2213, 286, 5080, -1 }},
+    {{ 2265, -1, 2275, 5081 }},
+    {{ -1, 296, 247, 5082 }},
+    {{ -1, 1389, 1525, -1 }},
+    {{ 299, 304, -1, 5084 }},
+    {{ -1, 2344, 5085, 4601 }},
+    {{ 24, -1, 5086, 35 }},
+    {{ 2356, -1, 2360, -1 }},
+    {{ 322, -1, 2417, 5088 }},
+    {{ -1, 5089, 2432, 2436 }},
+    {{ 1869, 1488, -1, -1 }},
+    {{ 326, 331, 5091, -1 }},
+    {{ 2498, -1, 5092, 5094 }},
+    {{ 2513, -1, 390, 5093 }},
+    {{ -1, 1868, 402, -1 }},
+    {{ -1, 8, 5095, 40 }},
+    {{ 2518, -1, 2522, -1 }},
+    {{ 63, 25, 5097, -1 }},
+    {{ 2610, -1, 2614, -1 }},
+    {{ -1, 2632, 5099, 1766 }},
+    {{ 4211, -1, 2644, 1761 }},
+    {{ 360, 5101, 5104, -1 }},
+    {{ 370, 2702, -1, 5102 }},
+    {{ -1, 79, 5103, 4613 }},
+    {{ -1, -1, 648, -1 }},
+    {{ 2708, -1, 374, 5105 }},
+    {{ -1, 5106, 2744, 2753 }},
+    {{ 4466, -1, -1, -1 }},
+    {{ 5108, -1, 5793, 401 }},
+    {{ 380, 5109, 5792, -1 }},
+    {{ 2777, 2788, -1, 3194 }},
+    {{ 285, 2960, 5111, -1 }},
+    {{ 312, -1, 5112, 5114 }},
+    {{ 2968, -1, 2972, 5113 }},
+    {{ -1, 1487, 2432, -1 }},
+    {{ -1, 2007, 5115, 4216 }},
+    {{ 2518, -1, 2977, -1 }},
+    {{ 360, 369, 5117, -1 }},
+    {{ 3007, -1, 3011, 5118 }},
+    {{ -1, 44, 2744, -1 }},
+    {{ 5120, 3090, -1, 5124 }},
+    {{ 3062, 3069, 5121, -1 }},
+    {{ 3005, -1, 5122, 4553 }},
+    {{ 423, -1, 5123, 4224 }},
+    {{ 3075, -1, 3079, -1 }},
+    {{ -1, 3115, 5125, 3138 }},
+    {{ 819, -1, 5126, 3132 }},
+    {{ 1913, -1, 3127, 2150 }},
+    {{ 4625, 3162, -1, 1639 }},
+    {{ 487, 495, 5129, -1 }},
+    {{ 3175, -1, 3179, -1 }},
+    {{ -1, 1660, 5131, 3269 }},
+    {{ 5132, -1, 3259, 3616 }},
+    {{ 1919, 3249, 3254, -1 }},
+    {{ 876, 3277, 5134, -1 }},
+    {{ 898, -1, 5135, 4241 }},
+    {{ 3284, -1, 3285, -1 }},
+    {{ 939, 946, 5137, -1 }},
+    {{ 3306, -1, 3310, -1 }},
+    {{ 5139, 3332, -1, 1682 }},
+    {{ 3321, 982, 5140, -1 }},
+    {{ 6102, -1, 1925, 1679 }},
+    {{ -1, 5142, 5880, 1766 }},
+    {{ 5143, 1750, -1, 1755 }},
+    {{ 1937, 3551, 220, -1 }},
+    {{ 2213, 5145, 5151, -1 }},
+    {{ 2237, 2243, -1, 5146 }},
+    {{ -1, 2256, 5147, 5149 }},
+    {{ 24, -1, 1421, 5148 }},
+    {{ -1, 1426, 2261, -1 }},
+    {{ -1, 1445, 5150, 1459 }},
+    {{ 522, -1, 2264, -1 }},
+    {{ 2265, -1, 2275, 5152 }},
+    {{ -1, 5153, 247, 1388 }},
+    {{ 29, 2285, -1, 5154 }},
+    {{ -1, 185, 2009, -1 }},
+    {{ 2289, 2294, 5156, -1 }},
+    {{ 1564, -1, 2306, 5157 }},
+    {{ -1, 2310, 1570, 5158 }},
+    {{ -1, 1575, 2314, -1 }},
+    {{ 2315, 2328, -1, 5160 }},
+    {{ -1, 1633, 5161, 2339 }},
+    {{ 2334, -1, 5162, 3218 }},
+    {{ 461, -1, 2338, -1 }},
+    {{ 5164, -1, 5169, 6078 }},
+    {{ 2368, 5165, 5168, -1 }},
+    {{ 2381, 2386, -1, 5166 }},
+    {{ -1, 2394, 12, 5167 }},
+    {{ -1, 226, 2033, -1 }},
+    {{ 83, -1, 2398, 903 }},
+    {{ 5170, -1, 6075, 2431 }},
+    {{ 2403, 5171, 3076, -1 }},
+    {{ 4583, 2408, -1, 908 }},
+    {{ 2450, 2455, 5173, -1 }},
+    {{ 312, -1, 2465, 5174 }},
+    {{ -1, 2468, 2439, 5175 }},
+    {{ -1, 1516, 2472, -1 }},
+    {{ 2473, 2482, -1, 5177 }},
+    {{ -1, 352, 5178, 2494 }},
+    {{ 2488, -1, 4589, 1560 }},
+    {{ 5180, 2547, -1, 5185 }},
+    {{ 2523, 2534, 5181, -1 }},
+    {{ 2539, -1, 5182, 5184 }},
+    {{ 423, -1, 427, 5183 }},
+    {{ -1, 1868, 2543, -1 }},
+    {{ -1, 8, 4594, 1612 }},
+    {{ -1, 2570, 5186, 2584 }},
+    {{ 5187, -1, 6088, 3218 }},
+    {{ 2576, 19, 5188, -1 }},
+    {{ 54, -1, 2580, -1 }},
+    {{ -1, 5190, 984, 6095 }},
+    {{ 5191, 2602, -1, 205 }},
+    {{ 2590, 1666, 5192, -1 }},
+    {{ 2597, -1, 5193, 3317 }},
+    {{ 60, -1, 2601, -1 }},
+    {{ 5195, -1, 988, 995 }},
+    {{ 5196, 5202, 5206, -1 }},
+    {{ 2648, 5197, 5200, -1 }},
+    {{ 546, 2659, -1, 5198 }},
+    {{ -1, 3814, 5199, 1787 }},
+    {{ 24, -1, 2664, -1 }},
+    {{ 565, -1, 2668, 5201 }},
+    {{ -1, 944, 2680, 367 }},
+    {{ 5203, 2702, -1, 2031 }},
+    {{ 2686, 72, 5204, -1 }},
+    {{ 593, -1, 2691, 5205 }},
+    {{ -1, 4046, 2697, -1 }},
+    {{ 5207, -1, 6108, 43 }},
+    {{ 657, 5208, 6105, -1 }},
+    {{ 4346, 2710, -1, 5209 }},
+    {{ -1, 4369, 2715, -1 }},
+    {{ 6153, 4116, 1001, -1 }},
+    {{ 5212, 3090, -1, 5214 }},
+    {{ 3062, 3069, 5213, -1 }},
+    {{ 3005, -1, 6179, 4134 }},
+    {{ -1, 3115, 5215, 3138 }},
+    {{ 4139, -1, 5216, 3132 }},
+    {{ 4143, -1, 6196, 2150 }},
+    {{ 4146, 3162, -1, 2126 }},
+    {{ -1, 2151, 5219, 3269 }},
+    {{ 5220, -1, 6223, 3616 }},
+    {{ 4159, 3249, 6220, -1 }},
+    {{ 5222, 3332, -1, 3338 }},
+    {{ 3321, 982, 5223, -1 }},
+    {{ 6102, -1, 4174, 3328 }},
+    {{ -1, 3348, 5225, 3370 }},
+    {{ 5226, -1, 6250, 1053 }},
+    {{ 1642, 3360, 6248, -1 }},
+    {{ 5228, -1, 5235, 5240 }},
+    {{ 5229, 19, 125, -1 }},
+    {{ 5230, 5232, 6254, -1 }},
+    {{ 3376, 5231, 491, -1 }},
+    {{ 3390, 3394, -1, 1039 }},
+    {{ 5233, 3420, -1, 6698 }},
+    {{ 3411, 1088, 5234, -1 }},
+    {{ 6675, -1, 3415, -1 }},
+    {{ 5236, -1, 2147, 6280 }},
+    {{ 5237, 3489, 6276, -1 }},
+    {{ 6265, 5238, 1021, -1 }},
+    {{ 5239, 3481, -1, 7011 }},
+    {{ 3731, 3480, -1, -1 }},
+    {{ -1, 5241, 6294, 3544 }},
+    {{ 5242, 3528, -1, 1230 }},
+    {{ 5243, 3518, 6291, -1 }},
+    {{ 1218, 158, 5244, -1 }},
+    {{ 510, -1, -1, 5742 }},
+    {{ -1, 5246, 5249, 6330 }},
+    {{ 5247, 3563, -1, 3575 }},
+    {{ 4184, 3551, 5248, -1 }},
+    {{ 1663, -1, 6312, 16 }},
+    {{ 5250, -1, 6322, 3616 }},
+    {{ 1025, 5251, 6319, -1 }},
+    {{ 5252, 3601, -1, 20 }},
+    {{ 1317, 173, 5253, -1 }},
+    {{ 530, -1, -1, 2170 }},
+    {{ 5255, 1027, -1, 1032 }},
+    {{ 5256, 6351, 5261, -1 }},
+    {{ 5257, 5259, 6342, -1 }},
+    {{ 5584, 5258, 883, -1 }},
+    {{ 5603, 5608, -1, 1265 }},
+    {{ 5260, 891, -1, 6338 }},
+    {{ 5641, 5646, 1268, -1 }},
+    {{ 5262, -1, 130, 6376 }},
+    {{ 5263, 5265, 6365, -1 }},
+    {{ 5889, 5264, 942, -1 }},
+    {{ 5899, 5903, -1, 1279 }},
+    {{ 5266, 5919, -1, 2031 }},
+    {{ 5915, 72, 5267, -1 }},
+    {{ 593, -1, 5918, -1 }},
+    {{ 285, 6671, 4952, -1 }},
+    {{ 37, 4606, -1, 1309 }},
+    {{ 5271, 6689, -1, 6695 }},
+    {{ 6686, 4547, 4685, -1 }},
+    {{ 5273, 142, -1, 20 }},
+    {{ 5274, 5277, 6471, -1 }},
+    {{ 6765, 5275, 1111, -1 }},
+    {{ 5155, 6771, -1, 5276 }},
+    {{ -1, 6776, -1, 1110 }},
+    {{ 5278, 1116, -1, 141 }},
+    {{ 5172, 6782, 5279, -1 }},
+    {{ 2498, -1, 6787, -1 }},
+    {{ 5281, -1, 1152, 1163 }},
+    {{ 6476, 5282, 6484, -1 }},
+    {{ 6480, 5283, -1, 1052 }},
+    {{ 5284, 6893, -1, 4366 }},
+    {{ 597, 6889, -1, -1 }},
+    {{ 5286, -1, 1190, 6512 }},
+    {{ 5287, 5291, 1185, -1 }},
+    {{ 6491, 5288, 6500, -1 }},
+    {{ 6495, 5289, -1, 7011 }},
+    {{ 5290, 7008, -1, 4554 }},
+    {{ 3767, 4482, -1, -1 }},
+    {{ 5292, 1174, -1, 1181 }},
+    {{ 6503, 5293, 6509, -1 }},
+    {{ 5294, 7030, -1, 4595 }},
+    {{ 326, 7027, -1, -1 }},
+    {{ -1, 1059, 5296, 6608 }},
+    {{ 5297, -1, 6595, 6602 }},
+    {{ 5298, 1072, 7846, -1 }},
+    {{ 5299, 1306, 6587, -1 }},
+    {{ 6576, 5300, 1071, -1 }},
+    {{ 5301, 7773, -1, 1077 }},
+    {{ 1535, 7772, -1, -1 }},
+    {{ 1075, 5303, 5317, -1 }},
+    {{ 1087, 5304, -1, 5310 }},
+    {{ 5305, 5306, -1, 5309 }},
+    {{ 6686, 4482, 1096, -1 }},
+    {{ 5307, 3090, -1, 6693 }},
+    {{ 3062, 3069, 5308, -1 }},
+    {{ 3005, -1, 6692, 704 }},
+    {{ -1, 4715, 3804, 6696 }},
+    {{ -1, 5311, 2157, 561 }},
+    {{ 5312, 5313, -1, 6703 }},
+    {{ 3276, 4720, 1671, -1 }},
+    {{ 5314, 3332, -1, 5315 }},
+    {{ 3321, 982, 716, -1 }},
+    {{ -1, 1013, 5316, 1022 }},
+    {{ -1, -1, 1684, 6285 }},
+    {{ 1097, -1, 1101, 5318 }},
+    {{ -1, 5319, 6745, 6756 }},
+    {{ 29, 5320, -1, -1 }},
+    {{ 6740, 5321, -1, 1106 }},
+    {{ 5322, 5211, -1, 1910 }},
+    {{ 6153, 4116, -1, -1 }},
+    {{ 1107, 5324, 1119, -1 }},
+    {{ 5325, 5329, -1, 5332 }},
+    {{ 5172, 5326, 1114, -1 }},
+    {{ 2473, 2482, -1, 5327 }},
+    {{ -1, 352, 5328, 6785 }},
+    {{ 2488, -1, -1, 5035 }},
+    {{ 5330, 6791, -1, 1117 }},
+    {{ 2523, 2534, 5331, -1 }},
+    {{ 2539, -1, 5182, 4813 }},
+    {{ -1, 5333, -1, 6801 }},
+    {{ 6799, 2602, -1, 4470 }},
+    {{ 2968, -1, 2972, 4823 }},
+    {{ -1, 2632, 5336, 1766 }},
+    {{ -1, -1, 3001, 1761 }},
+    {{ 4840, 3090, -1, 5338 }},
+    {{ -1, 3115, 5339, 3138 }},
+    {{ 1878, -1, 5340, 3132 }},
+    {{ -1, -1, 3112, 2150 }},
+    {{ 4492, 3162, -1, 3801 }},
+    {{ -1, 4156, 5343, 3269 }},
+    {{ 5344, -1, 3148, 3616 }},
+    {{ -1, 3249, 3145, -1 }},
+    {{ -1, 5346, -1, 1138 }},
+    {{ 5347, 634, -1, 80 }},
+    {{ 5348, 5351, 1671, -1 }},
+    {{ 876, 5349, 3282, -1 }},
+    {{ 887, 891, -1, 5350 }},
+    {{ -1, 5682, -1, 4202 }},
+    {{ 4505, 4204, -1, 632 }},
+    {{ 5353, -1, 1152, 5359 }},
+    {{ 1142, 5354, 1148, -1 }},
+    {{ 6878, 6887, -1, 5355 }},
+    {{ -1, 5356, 12, -1 }},
+    {{ 6895, 5357, -1, 1147 }},
+    {{ 5358, 4220, -1, 638 }},
+    {{ 4213, 4217, -1, -1 }},
+    {{ -1, 5360, 1168, 6989 }},
+    {{ 5361, 5365, -1, 6969 }},
+    {{ 96, 5362, 30, -1 }},
+    {{ 6957, 5363, -1, 4468 }},
+    {{ 5364, 5119, -1, 799 }},
+    {{ 5110, 4547, -1, -1 }},
+    {{ 5366, 684, -1, 283 }},
+    {{ 6963, 5367, 5194, -1 }},
+    {{ 5368, 5369, -1, -1 }},
+    {{ 5172, 5176, -1, -1 }},
+    {{ 5180, 2547, -1, -1 }},
+    {{ 531, 5371, 7018, -1 }},
+    {{ 546, 7006, -1, 5372 }},
+    {{ -1, 5373, 2157, 7014 }},
+    {{ 5312, 5374, -1, 4566 }},
+    {{ 4744, 3332, -1, 1682 }},
+    {{ 285, 2960, 5376, -1 }},
+    {{ 312, -1, 4110, -1 }},
+    {{ 4684, 3090, -1, 5378 }},
+    {{ -1, 3115, 5379, 3138 }},
+    {{ -1, -1, 4142, 3132 }},
+    {{ -1, 5381, 12, 7063 }},
+    {{ 5382, 714, -1, 80 }},
+    {{ 7058, 5383, 1671, -1 }},
+    {{ 4690, 5384, -1, -1 }},
+    {{ 920, 5812, -1, -1 }},
+    {{ 5386, -1, 7111, 1196 }},
+    {{ 7086, 5387, 7106, -1 }},
+    {{ 4583, 5388, -1, 1193 }},
+    {{ 697, 5389, -1, 7098 }},
+    {{ 7094, 5390, -1, 4714 }},
+    {{ 4679, 3090, -1, 4621 }},
+    {{ -1, 5392, 1208, 1213 }},
+    {{ 5393, 5397, -1, 7182 }},
+    {{ 5394, 153, 15, -1 }},
+    {{ 770, 5395, 784, -1 }},
+    {{ 7162, 5396, -1, 4814 }},
+    {{ 4795, 5046, -1, 782 }},
+    {{ 5398, 4882, -1, 7177 }},
+    {{ 5399, 756, 5194, -1 }},
+    {{ 7168, 5400, 7174, -1 }},
+    {{ 4803, 5401, -1, -1 }},
+    {{ 2315, 2328, -1, -1 }},
+    {{ 37, 1552, -1, 5403 }},
+    {{ -1, 352, -1, -1 }},
+    {{ 1617, 3090, -1, 5405 }},
+    {{ -1, 3115, -1, 3138 }},
+    {{ 5407, 794, -1, 802 }},
+    {{ 5408, 5411, 7307, -1 }},
+    {{ 5079, 5409, 789, -1 }},
+    {{ 299, 304, -1, 5410 }},
+    {{ -1, 2344, -1, 4601 }},
+    {{ 5412, 4606, -1, 792 }},
+    {{ 326, 331, 5413, -1 }},
+    {{ 2498, -1, 5092, -1 }},
+    {{ 5415, -1, 118, 16 }},
+    {{ 939, 5416, 116, -1 }},
+    {{ 7315, 4970, -1, 2031 }},
+    {{ 5418, 816, -1, 7340 }},
+    {{ 5419, 812, 5424, -1 }},
+    {{ 5420, 5423, 7326, -1 }},
+    {{ 2213, 5421, 5151, -1 }},
+    {{ 2237, 2243, -1, 5422 }},
+    {{ -1, 2256, -1, 5149 }},
+    {{ 4979, 5159, -1, 810 }},
+    {{ 5425, -1, 988, 995 }},
+    {{ 7334, 4983, 7337, -1 }},
+    {{ 5427, -1, 1235, 1240 }},
+    {{ 5428, 5432, 7406, -1 }},
+    {{ 1075, 5429, 7388, -1 }},
+    {{ 1087, 5430, -1, 7385 }},
+    {{ 7381, 5431, -1, 5309 }},
+    {{ 4679, 3090, -1, 6693 }},
+    {{ 5433, 162, -1, 7401 }},
+    {{ 1107, 5434, 1119, -1 }},
+    {{ 7395, 5435, -1, 5332 }},
+    {{ 4757, 6791, -1, 1117 }},
+    {{ -1, 5437, 1254, 7525 }},
+    {{ 5438, 7486, -1, 7493 }},
+    {{ 5439, 5471, 1251, -1 }},
+    {{ 5440, 859, 1270, -1 }},
+    {{ 7473, 5441, 7480, -1 }},
+    {{ 5005, 5442, -1, -1 }},
+    {{ 1409, 1616, -1, -1 }},
+    {{ 1364, 5444, 5447, -1 }},
+    {{ 1393, 1408, -1, 5445 }},
+    {{ -1, 204, 773, 5446 }},
+    {{ -1, 1445, -1, 5593 }},
+    {{ 1464, -1, 1479, 5448 }},
+    {{ -1, 493, 247, 5600 }},
+    {{ 1535, 1394, 3589, -1 }},
+    {{ 1409, 1616, -1, 5451 }},
+    {{ -1, 1633, 5452, 5615 }},
+    {{ 1645, -1, -1, 5613 }},
+    {{ 5454, -1, 7562, 884 }},
+    {{ 1780, 3592, 7561, -1 }},
+    {{ 285, 1536, 5456, -1 }},
+    {{ 312, -1, 321, 5457 }},
+    {{ -1, 1544, 2439, -1 }},
+    {{ 37, 1552, -1, 5459 }},
+    {{ -1, 352, 5460, 5651 }},
+    {{ 2608, -1, -1, 5649 }},
+    {{ 5462, 5669, -1, 5465 }},
+    {{ 1593, 1598, 5463, -1 }},
+    {{ 3005, -1, 797, 5464 }},
+    {{ -1, 8, -1, 5667 }},
+    {{ -1, 1633, 5466, 5678 }},
+    {{ 1878, -1, 894, 3218 }},
+    {{ -1, 5468, 7578, 5697 }},
+    {{ 5469, 1676, -1, 5689 }},
+    {{ 3276, 1666, 5470, -1 }},
+    {{ 3304, -1, -1, 5687 }},
+    {{ 5472, 919, -1, 7609 }},
+    {{ 5473, 5477, 7601, -1 }},
+    {{ 5748, 5474, 910, -1 }},
+    {{ 299, 304, -1, 5475 }},
+    {{ -1, 2344, 5476, 3734 }},
+    {{ 24, -1, 5756, -1 }},
+    {{ 5478, 3744, -1, 914 }},
+    {{ 326, 331, 5479, -1 }},
+    {{ 2498, -1, 5764, 5480 }},
+    {{ -1, 8, 5768, -1 }},
+    {{ 3935, 578, 5482, -1 }},
+    {{ 312, -1, 3964, -1 }},
+    {{ 3974, 586, -1, 5484 }},
+    {{ -1, 4011, -1, 4020 }},
+    {{ 5486, 607, -1, 618 }},
+    {{ 597, 601, 5487, -1 }},
+    {{ 4090, -1, -1, -1 }},
+    {{ 5489, -1, 962, 969 }},
+    {{ 7654, 5490, 7665, -1 }},
+    {{ 7659, 5491, -1, -1 }},
+    {{ 5492, 701, -1, 5972 }},
+    {{ 4598, 698, -1, -1 }},
+    {{ 5494, 7703, -1, 7709 }},
+    {{ 5495, 982, 5500, -1 }},
+    {{ 5496, 5499, 7674, -1 }},
+    {{ 2213, 5497, 294, -1 }},
+    {{ 2237, 2243, -1, 5498 }},
+    {{ -1, 2256, 773, 291 }},
+    {{ 4856, 304, -1, 6067 }},
+    {{ 5501, -1, 5507, 7700 }},
+    {{ 5502, 5504, 7684, -1 }},
+    {{ 2648, 5503, 365, -1 }},
+    {{ 546, 2659, -1, 1279 }},
+    {{ 5505, 2702, -1, 2031 }},
+    {{ 2686, 72, 5506, -1 }},
+    {{ 593, -1, 2691, -1 }},
+    {{ 5508, -1, 992, 2092 }},
+    {{ 7691, 5509, 1294, -1 }},
+    {{ 5510, 2788, -1, 48 }},
+    {{ 577, 2778, -1, -1 }},
+    {{ -1, 7721, 5512, 7758 }},
+    {{ 5513, -1, 7748, 1053 }},
+    {{ 5514, 7738, 7743, -1 }},
+    {{ 5515, 1042, 134, -1 }},
+    {{ 7732, 5516, 1301, -1 }},
+    {{ 5517, 5518, -1, -1 }},
+    {{ 1535, 6644, -1, -1 }},
+    {{ 6646, 1616, -1, -1 }},
+    {{ 4684, 3090, -1, 5520 }},
+    {{ -1, 3115, 838, 3138 }},
+    {{ 2473, 2482, -1, 5403 }},
+    {{ 2548, 3090, -1, 5405 }},
+    {{ 5524, 1128, -1, 1134 }},
+    {{ 5525, 5526, 7840, -1 }},
+    {{ 5079, 5409, 1123, -1 }},
+    {{ 5412, 4606, -1, 1126 }},
+    {{ 5528, -1, 1152, 7858 }},
+    {{ 1142, 5529, 1148, -1 }},
+    {{ 6878, 5530, -1, 7854 }},
+    {{ 7850, 5531, -1, 4366 }},
+    {{ 5532, 4127, -1, 614 }},
+    {{ 4108, 4116, -1, -1 }},
+    {{ 5534, -1, 7899, 7906 }},
+    {{ 5535, 5539, 1185, -1 }},
+    {{ 3473, 5536, 3484, -1 }},
+    {{ 546, 5537, -1, 7875 }},
+    {{ 7871, 5538, -1, 4554 }},
+    {{ 4679, 3090, -1, 3790 }},
+    {{ 5540, 5543, -1, 7896 }},
+    {{ 7878, 5541, 3501, -1 }},
+    {{ 7880, 5542, -1, 4595 }},
+    {{ 4757, 4000, -1, 587 }},
+    {{ 5544, 1178, -1, 705 }},
+    {{ 7886, 5545, 7893, -1 }},
+    {{ 4700, 5546, -1, -1 }},
+    {{ 339, 2547, -1, -1 }},
+    {{ -1, 5548, 7941, 7952 }},
+    {{ 5549, 7931, -1, 1230 }},
+    {{ 5550, 7923, 7927, -1 }},
+    {{ 5551, 158, 1227, -1 }},
+    {{ 7732, 5441, 1341, -1 }},
+    {{ -1, 5553, 5573, 8056 }},
+    {{ 5554, 7988, -1, 8002 }},
+    {{ 5555, 7973, 5567, -1 }},
+    {{ 5556, 1266, 5563, -1 }},
+    {{ 5557, 5560, 7962, -1 }},
+    {{ 1364, 5558, 7554, -1 }},
+    {{ 1393, 1408, -1, 5559 }},
+    {{ -1, 204, -1, 7553 }},
+    {{ 5561, 7556, -1, 1265 }},
+    {{ 1535, 1394, 5562, -1 }},
+    {{ 1564, -1, 45, -1 }},
+    {{ 5564, -1, 1274, 5742 }},
+    {{ 7968, 5565, 938, -1 }},
+    {{ 5566, 5716, -1, 900 }},
+    {{ 577, 72, -1, -1 }},
+    {{ 5568, -1, 7983, 16 }},
+    {{ 5569, 1282, 168, -1 }},
+    {{ 7979, 5570, 1352, -1 }},
+    {{ 5571, 5572, -1, -1 }},
+    {{ 3731, 547, -1, -1 }},
+    {{ 556, 3781, -1, -1 }},
+    {{ 5574, -1, 8037, 8051 }},
+    {{ 5575, 5581, 8031, -1 }},
+    {{ 5576, 5579, 1313, -1 }},
+    {{ 8008, 5577, 8017, -1 }},
+    {{ 8012, 5578, -1, 1077 }},
+    {{ 4795, 1616, -1, 6648 }},
+    {{ 5580, 1310, -1, 6698 }},
+    {{ 8018, 5545, 8021, -1 }},
+    {{ 5582, 8027, -1, 20 }},
+    {{ 5583, 173, 1326, -1 }},
+    {{ 8023, 5400, 1363, -1 }},
+    {{ 1364, 5585, 5595, -1 }},
+    {{ 1393, 1408, -1, 5586 }},
+    {{ -1, 204, 5587, 5590 }},
+    {{ 24, -1, 1421, 5588 }},
+    {{ -1, 1426, 179, 5589 }},
+    {{ -1, 1370, 1372, -1 }},
+    {{ -1, 1445, 5591, 5593 }},
+    {{ 522, -1, 1451, 5592 }},
+    {{ -1, 1762, 1377, -1 }},
+    {{ -1, 1460, 5594, 8056 }},
+    {{ 1776, -1, 8037, -1 }},
+    {{ 1464, -1, 1479, 5596 }},
+    {{ -1, 5597, 247, 5600 }},
+    {{ 29, 1492, -1, 5598 }},
+    {{ -1, 185, 1503, 5599 }},
+    {{ -1, 1384, 1386, -1 }},
+    {{ -1, 5601, 1525, 1530 }},
+    {{ 854, 1517, -1, 5602 }},
+    {{ -1, 1391, 1973, -1 }},
+    {{ 1535, 1394, 5604, -1 }},
+    {{ 1564, -1, 45, 5605 }},
+    {{ -1, 8, 1570, 5606 }},
+    {{ -1, 1575, 196, 5607 }},
+    {{ -1, 1404, 1406, -1 }},
+    {{ 1409, 1616, -1, 5609 }},
+    {{ -1, 1633, 5610, 5615 }},
+    {{ 1645, -1, 5611, 5613 }},
+    {{ 461, -1, 1651, 5612 }},
+    {{ -1, 3213, 1419, -1 }},
+    {{ -1, 3219, 5614, 3544 }},
+    {{ 3230, -1, 1235, -1 }},
+    {{ -1, 1660, 5616, 3269 }},
+    {{ 467, -1, 5617, 3616 }},
+    {{ 3260, -1, 7899, -1 }},
+    {{ 1665, 1676, -1, 5619 }},
+    {{ -1, 3348, 5620, 1690 }},
+    {{ 207, -1, 5621, 1053 }},
+    {{ 3366, -1, 1190, -1 }},
+    {{ 180, -1, 1430, 5623 }},
+    {{ -1, -1, 7457, 7467 }},
+    {{ 3607, -1, 7899, 1541 }},
+    {{ 1780, 5626, 5630, -1 }},
+    {{ 1797, 75, -1, 5627 }},
+    {{ -1, 79, 12, 5628 }},
+    {{ -1, 226, 1806, 5629 }},
+    {{ -1, 1469, 1471, -1 }},
+    {{ 83, -1, 1813, 318 }},
+    {{ 5632, -1, 1850, 5634 }},
+    {{ 1825, 5633, 1844, -1 }},
+    {{ 4583, 1831, -1, 324 }},
+    {{ -1, 5635, 1883, 1894 }},
+    {{ 1869, 5636, -1, 4900 }},
+    {{ 752, 1875, -1, 5637 }},
+    {{ -1, 1490, 4895, -1 }},
+    {{ 1900, 1905, -1, 5639 }},
+    {{ -1, 822, 5640, 1916 }},
+    {{ 1495, -1, 5235, -1 }},
+    {{ 285, 1536, 5642, -1 }},
+    {{ 312, -1, 321, 5643 }},
+    {{ -1, 1544, 2439, 5644 }},
+    {{ -1, 1516, 2013, 5645 }},
+    {{ -1, 1988, 1550, -1 }},
+    {{ 37, 1552, -1, 5647 }},
+    {{ -1, 352, 5648, 5651 }},
+    {{ 2608, -1, 3679, 5649 }},
+    {{ -1, 1726, 5650, 1740 }},
+    {{ 1562, -1, 1733, -1 }},
+    {{ -1, 2632, 5652, 1766 }},
+    {{ 2639, -1, 5653, 1761 }},
+    {{ 2645, -1, 7899, -1 }},
+    {{ 46, -1, 390, 5655 }},
+    {{ -1, 5656, 402, 2039 }},
+    {{ 1869, 1874, -1, 5657 }},
+    {{ -1, 4901, 4912, -1 }},
+    {{ -1, 406, -1, 5659 }},
+    {{ -1, 411, 3741, 2931 }},
+    {{ 197, -1, 1579, 1569 }},
+    {{ 1593, 1598, 5662, -1 }},
+    {{ 3005, -1, 5663, 5666 }},
+    {{ 423, -1, 427, 5664 }},
+    {{ -1, 1868, 2093, 5665 }},
+    {{ -1, 765, 1606, -1 }},
+    {{ -1, 8, 3690, 5667 }},
+    {{ -1, 2061, 5668, 2074 }},
+    {{ 1614, -1, 2066, -1 }},
+    {{ 1617, 3090, -1, 5670 }},
+    {{ -1, 3115, 5671, 3138 }},
+    {{ 1628, -1, 5672, 3132 }},
+    {{ 448, -1, 5673, 2150 }},
+    {{ 3128, -1, 7111, -1 }},
+    {{ 3173, 19, 5675, -1 }},
+    {{ 54, -1, 2132, 5676 }},
+    {{ -1, 1164, 1648, -1 }},
+    {{ 1191, -1, 7111, 1557 }},
+    {{ -1, 1660, 5679, 3269 }},
+    {{ 5680, -1, 3259, 3616 }},
+    {{ 468, 3249, 5681, -1 }},
+    {{ 3255, -1, 1152, -1 }},
+    {{ 5683, 1676, -1, 5689 }},
+    {{ 3276, 1666, 5684, -1 }},
+    {{ 3304, -1, 5685, 5687 }},
+    {{ 60, -1, 962, 5686 }},
+    {{ -1, 6008, 1674, -1 }},
+    {{ -1, -1, 5688, 977 }},
+    {{ 3319, -1, 6029, -1 }},
+    {{ -1, 3348, 5690, 1690 }},
+    {{ 5691, -1, 3365, 1053 }},
+    {{ 208, 3360, 5692, -1 }},
+    {{ 1688, -1, 1152, -1 }},
+    {{ 3472, 3489, 2366, -1 }},
+    {{ 5695, -1, 7111, 1710 }},
+    {{ 7086, 5696, 7106, -1 }},
+    {{ 4583, 7092, -1, -1 }},
+    {{ -1, 5698, 5702, 1459 }},
+    {{ 5699, 1750, -1, 1446 }},
+    {{ 514, 3551, 5700, -1 }},
+    {{ 221, -1, 5701, 16 }},
+    {{ 3559, -1, 962, -1 }},
+    {{ 522, -1, 5703, 1455 }},
+    {{ 5704, -1, 7899, 2004 }},
+    {{ 7868, 3608, 5705, -1 }},
+    {{ 83, -1, 7068, -1 }},
+    {{ 531, 5707, 5711, -1 }},
+    {{ 546, 555, -1, 5708 }},
+    {{ -1, 3814, 3018, 5709 }},
+    {{ -1, 562, 1450, 5710 }},
+    {{ -1, 1789, 1775, -1 }},
+    {{ 565, -1, 570, 5712 }},
+    {{ -1, 69, 3912, 3022 }},
+    {{ 577, 72, 5714, -1 }},
+    {{ 593, -1, 4040, 5715 }},
+    {{ -1, 4046, 1570, 3028 }},
+    {{ 76, 607, -1, 5717 }},
+    {{ -1, 619, 5718, 5720 }},
+    {{ 1645, -1, 1650, 5719 }},
+    {{ -1, 3219, 3229, -1 }},
+    {{ -1, 627, 5721, 4192 }},
+    {{ 467, -1, 3259, -1 }},
+    {{ 630, 634, -1, 5723 }},
+    {{ -1, 642, 5724, 645 }},
+    {{ -1, -1, 4250, -1 }},
+    {{ 531, 5726, 4576, -1 }},
+    {{ 546, 4545, -1, 5727 }},
+    {{ -1, 4558, 2157, 3036 }},
+    {{ 697, 701, -1, 5729 }},
+    {{ -1, 706, 1644, 5730 }},
+    {{ -1, 1834, 4191, -1 }},
+    {{ 5732, -1, 4737, 5735 }},
+    {{ 4701, 5733, 4732, -1 }},
+    {{ 4583, 5734, -1, 2975 }},
+    {{ 697, 4709, -1, 3041 }},
+    {{ -1, 5736, 4784, 4789 }},
+    {{ 1712, 738, -1, 4778 }},
+    {{ -1, 1487, 5738, 5739 }},
+    {{ 3046, -1, 4931, 2094 }},
+    {{ -1, 765, 5740, 4999 }},
+    {{ 5741, -1, 5533, 5547 }},
+    {{ 4987, 2100, 5527, -1 }},
+    {{ -1, 2007, 5743, 2012 }},
+    {{ 2518, -1, 5744, 5747 }},
+    {{ 2102, -1, 5385, 5745 }},
+    {{ -1, 5746, 1208, 1213 }},
+    {{ 2107, 1963, -1, 7182 }},
+    {{ -1, 249, 2109, 1966 }},
+    {{ 2213, 286, 5749, -1 }},
+    {{ 2265, -1, 2275, 5750 }},
+    {{ -1, 296, 247, 5751 }},
+    {{ -1, 1389, 1525, 5752 }},
+    {{ -1, 1988, 1531, -1 }},
+    {{ 299, 304, -1, 5754 }},
+    {{ -1, 2344, 5755, 3734 }},
+    {{ 24, -1, 5756, 35 }},
+    {{ 2356, -1, 2360, 5757 }},
+    {{ -1, 261, 1718, -1 }},
+    {{ 322, -1, 2417, 5759 }},
+    {{ -1, 5760, 2432, 2436 }},
+    {{ 1869, 1488, -1, 5657 }},
+    {{ 254, -1, 1977, 1569 }},
+    {{ 326, 331, 5763, -1 }},
+    {{ 2498, -1, 5764, 5767 }},
+    {{ 2513, -1, 390, 5765 }},
+    {{ -1, 1868, 402, 5766 }},
+    {{ -1, 765, 2040, -1 }},
+    {{ -1, 8, 5768, 40 }},
+    {{ 2518, -1, 2522, 5769 }},
+    {{ -1, 275, 2948, -1 }},
+    {{ 63, 25, 5771, -1 }},
+    {{ 2610, -1, 2614, 5772 }},
+    {{ -1, 1164, 1168, -1 }},
+    {{ 2022, -1, 7111, 1557 }},
+    {{ -1, 2632, 5775, 1766 }},
+    {{ 5776, -1, 2644, 1761 }},
+    {{ 523, 527, 5777, -1 }},
+    {{ 2641, -1, 1152, -1 }},
+    {{ 360, 5779, 5783, -1 }},
+    {{ 370, 2702, -1, 5780 }},
+    {{ -1, 79, 5781, 3752 }},
+    {{ -1, -1, 648, 5782 }},
+    {{ -1, 4299, 653, -1 }},
+    {{ 2708, -1, 374, 5784 }},
+    {{ -1, 5785, 2744, 2753 }},
+    {{ 4466, -1, -1, 5786 }},
+    {{ -1, 379, 1929, -1 }},
+    {{ 5788, -1, 5793, 401 }},
+    {{ 380, 5789, 5792, -1 }},
+    {{ 2777, 2788, -1, 5790 }},
+    {{ -1, -1, 12, 5791 }},
+    {{ -1, 385, 2182, -1 }},
+    {{ 2795, -1, 2802, 425 }},
+    {{ 5794, -1, 2837, 397 }},
+    {{ 2814, 429, 2832, -1 }},
+    {{ 5796, -1, 5385, 2053 }},
+    {{ 5370, 5797, 1185, -1 }},
+    {{ 7024, 842, -1, -1 }},
+    {{ 285, 2960, 5799, -1 }},
+    {{ 312, -1, 5800, 5803 }},
+    {{ 2968, -1, 2972, 5801 }},
+    {{ -1, 1487, 2432, 5802 }},
+    {{ -1, 765, 2437, -1 }},
+    {{ -1, 2007, 5804, 3770 }},
+    {{ 2518, -1, 2977, 5805 }},
+    {{ -1, 249, 5426, -1 }},
+    {{ 360, 369, 5807, -1 }},
+    {{ 3007, -1, 3011, 5808 }},
+    {{ -1, 44, 2744, 5809 }},
+    {{ -1, 4522, 2754, -1 }},
+    {{ 403, -1, 2882, 1622 }},
+    {{ 2102, -1, 5385, 1541 }},
+    {{ 5813, 3090, -1, 5818 }},
+    {{ 3062, 3069, 5814, -1 }},
+    {{ 3005, -1, 5815, 3787 }},
+    {{ 423, -1, 5816, 3785 }},
+    {{ 3075, -1, 3079, 5817 }},
+    {{ -1, 398, 3045, -1 }},
+    {{ -1, 3115, 5819, 3138 }},
+    {{ 3792, -1, 5820, 3132 }},
+    {{ 5821, -1, 3127, 2150 }},
+    {{ 462, 3489, 5822, -1 }},
+    {{ 450, -1, 7068, -1 }},
+    {{ 3797, 3162, -1, 1639 }},
+    {{ 487, 495, 5825, -1 }},
+    {{ 3175, -1, 3179, 5826 }},
+    {{ -1, -1, 3455, -1 }},
+    {{ 2133, -1, 6930, 1631 }},
+    {{ 461, -1, 5829, 1655 }},
+    {{ 5830, -1, 7111, 2019 }},
+    {{ 7086, 1192, 5831, -1 }},
+    {{ 83, -1, 4673, -1 }},
+    {{ -1, 1660, 5833, 3269 }},
+    {{ 5834, -1, 3259, 3616 }},
+    {{ 5835, 3249, 3254, -1 }},
+    {{ 524, 1306, 5836, -1 }},
+    {{ 470, -1, 7793, -1 }},
+    {{ 876, 3277, 5838, -1 }},
+    {{ 898, -1, 5839, 5841 }},
+    {{ 3284, -1, 3285, 5840 }},
+    {{ -1, 1487, 5738, -1 }},
+    {{ -1, 2007, 5842, 2012 }},
+    {{ 3290, -1, 5744, -1 }},
+    {{ 939, 946, 5844, -1 }},
+    {{ 3306, -1, 3310, 5845 }},
+    {{ -1, -1, 5944, -1 }},
+    {{ 963, -1, 5995, 1638 }},
+    {{ 5848, 3332, -1, 1682 }},
+    {{ 3321, 982, 5849, -1 }},
+    {{ 6102, -1, 5850, 1679 }},
+    {{ 989, -1, 5851, 2092 }},
+    {{ 480, -1, 6128, -1 }},
+    {{ 63, 25, 5853, -1 }},
+    {{ 5854, -1, 5855, 1163 }},
+    {{ 1142, 1697, 2642, -1 }},
+    {{ 5856, -1, 6930, 1159 }},
+    {{ 6916, 5857, 2412, -1 }},
+    {{ 6924, 1155, -1, -1 }},
+    {{ 3473, 3478, 5859, -1 }},
+    {{ 3485, -1, 570, 5860 }},
+    {{ -1, -1, 3912, -1 }},
+    {{ 657, 5862, 662, -1 }},
+    {{ 4346, 4360, -1, -1 }},
+    {{ 668, -1, 4419, 5864 }},
+    {{ -1, -1, 4454, 4460 }},
+    {{ 5866, -1, 7111, 2025 }},
+    {{ 7086, 5867, 7106, -1 }},
+    {{ 4583, 7092, -1, 5868 }},
+    {{ -1, -1, -1, 7102 }},
+    {{ -1, 1726, 5870, 1740 }},
+    {{ 5871, -1, 1733, 1737 }},
+    {{ 5872, 216, 7406, -1 }},
+    {{ 1075, 7379, 5873, -1 }},
+    {{ 1097, -1, 1101, -1 }},
+    {{ -1, 5875, 5880, 1766 }},
+    {{ 5876, 1750, -1, 1755 }},
+    {{ 5877, 3551, 220, -1 }},
+    {{ 1263, 1266, 5878, -1 }},
+    {{ 1271, -1, 5879, 5742 }},
+    {{ 421, -1, 7592, -1 }},
+    {{ 5881, -1, 5885, 1761 }},
+    {{ 523, 527, 5882, -1 }},
+    {{ 5883, -1, 1152, 7858 }},
+    {{ 1142, 7848, 5884, -1 }},
+    {{ 6900, -1, 2398, -1 }},
+    {{ 5886, -1, 7899, 7906 }},
+    {{ 5887, 3608, 1185, -1 }},
+    {{ 3473, 7869, 5888, -1 }},
+    {{ 3485, -1, 570, -1 }},
+    {{ 3652, 5890, 5895, -1 }},
+    {{ 3675, 3686, -1, 5891 }},
+    {{ -1, 204, 5892, 5894 }},
+    {{ 24, -1, 3696, 5893 }},
+    {{ -1, 3700, 179, -1 }},
+    {{ -1, 1445, 3382, 3702 }},
+    {{ 3704, -1, 3709, 5896 }},
+    {{ -1, 3476, 3725, 5897 }},
+    {{ -1, 5898, 1525, 3389 }},
+    {{ 854, 3730, -1, -1 }},
+    {{ 3731, 547, 5900, -1 }},
+    {{ 3749, -1, 3754, 5901 }},
+    {{ -1, 8, 3762, 5902 }},
+    {{ -1, 3766, 196, -1 }},
+    {{ 556, 3781, -1, 5904 }},
+    {{ -1, 3796, 5905, 3807 }},
+    {{ 1645, -1, 3397, 3805 }},
+    {{ 3872, -1, 3885, 5907 }},
+    {{ -1, 5908, 1883, 5910 }},
+    {{ 3891, 5909, -1, 2694 }},
+    {{ 752, 3895, -1, -1 }},
+    {{ -1, 5911, 1895, 4999 }},
+    {{ 3898, -1, -1, 5511 }},
+    {{ 3913, -1, 1955, 5913 }},
+    {{ -1, 5914, 5426, 1966 }},
+    {{ 3921, -1, -1, 1230 }},
+    {{ 3935, 578, 5916, -1 }},
+    {{ 312, -1, 3964, 5917 }},
+    {{ -1, 584, 2439, 3414 }},
+    {{ 4041, -1, 390, 3416 }},
+    {{ 5920, 607, -1, 618 }},
+    {{ 597, 601, 5921, -1 }},
+    {{ 4090, -1, 5922, 78 }},
+    {{ 4102, -1, 427, 5923 }},
+    {{ -1, 4107, 2093, -1 }},
+    {{ 4323, 5925, 4336, -1 }},
+    {{ 546, 4328, -1, 5926 }},
+    {{ -1, 3814, 4332, 3428 }},
+    {{ 4361, 607, -1, 5928 }},
+    {{ -1, 619, 3431, 4367 }},
+    {{ 4374, -1, 4383, 5930 }},
+    {{ -1, 5931, 689, 5932 }},
+    {{ 4389, 320, -1, 3437 }},
+    {{ -1, 5933, 4538, 1987 }},
+    {{ 4394, -1, -1, 1972 }},
+    {{ 4396, 5935, 4413, -1 }},
+    {{ 4409, 3442, -1, 3444 }},
+    {{ 4420, -1, 4737, 5937 }},
+    {{ -1, 5938, 4784, 4789 }},
+    {{ 4434, 5939, -1, 4778 }},
+    {{ 4439, -1, -1, 4894 }},
+    {{ 4442, 3451, 15, -1 }},
+    {{ -1, 5942, 1895, 4999 }},
+    {{ 5943, 4972, -1, 5511 }},
+    {{ 4463, -1, 4967, -1 }},
+    {{ 5945, -1, 4516, 5947 }},
+    {{ 4507, 5946, 1950, -1 }},
+    {{ 4513, 3458, -1, 3459 }},
+    {{ -1, 975, 5426, 1966 }},
+    {{ -1, 4522, 5949, 1987 }},
+    {{ 5950, -1, 1977, 1982 }},
+    {{ 4540, 980, 5527, -1 }},
+    {{ 3652, 5952, 537, -1 }},
+    {{ 3675, 3686, -1, 5953 }},
+    {{ -1, 204, 534, 5954 }},
+    {{ -1, 1445, 1375, -1 }},
+    {{ 4546, 4550, -1, 5956 }},
+    {{ -1, 3796, 5957, 4555 }},
+    {{ 1645, -1, 1417, -1 }},
+    {{ 565, -1, 570, 5959 }},
+    {{ -1, 5960, 3912, 3022 }},
+    {{ 29, 5961, -1, 70 }},
+    {{ 3901, 3905, -1, -1 }},
+    {{ 577, 5963, 5966, -1 }},
+    {{ 4585, 4590, -1, 5964 }},
+    {{ -1, 4011, 5965, 4596 }},
+    {{ 2608, -1, -1, -1 }},
+    {{ 593, -1, 4040, 5967 }},
+    {{ -1, 5968, 1570, 3028 }},
+    {{ -1, 406, -1, -1 }},
+    {{ 5970, 701, -1, 5972 }},
+    {{ 4598, 698, 5971, -1 }},
+    {{ 4610, -1, 4101, 4827 }},
+    {{ -1, 706, 5973, 1833 }},
+    {{ 5974, -1, 1650, 3218 }},
+    {{ 3173, -1, 1646, -1 }},
+    {{ 657, 5976, 662, -1 }},
+    {{ 4346, 5977, -1, 5979 }},
+    {{ 4361, 607, -1, 5978 }},
+    {{ -1, 619, 1644, -1 }},
+    {{ -1, 5980, 12, 86 }},
+    {{ 630, 634, -1, -1 }},
+    {{ 96, 5982, 30, -1 }},
+    {{ 100, 794, -1, -1 }},
+    {{ -1, 5984, 4538, 1987 }},
+    {{ 5985, 4697, -1, 1972 }},
+    {{ 855, -1, 862, -1 }},
+    {{ 531, 5987, 4576, -1 }},
+    {{ 546, 5988, -1, 5990 }},
+    {{ 4546, 4550, -1, 5989 }},
+    {{ -1, 3796, 3804, -1 }},
+    {{ -1, 5991, 2157, 3036 }},
+    {{ 4559, 4563, -1, -1 }},
+    {{ 577, 5993, 592, -1 }},
+    {{ 4585, 4590, -1, 5994 }},
+    {{ -1, 4011, 74, -1 }},
+    {{ 5996, -1, 4737, 6000 }},
+    {{ 4701, 5997, 4732, -1 }},
+    {{ 4583, 5998, -1, 2975 }},
+    {{ 697, 5999, -1, 3041 }},
+    {{ 4710, 4711, -1, -1 }},
+    {{ -1, 6001, 4784, 4789 }},
+    {{ 1712, 6002, -1, 4778 }},
+    {{ 1715, 4758, -1, 4894 }},
+    {{ 770, 6004, 784, -1 }},
+    {{ 4806, 4810, -1, -1 }},
+    {{ -1, 6006, 4985, 4999 }},
+    {{ 6007, 4799, -1, 5511 }},
+    {{ 1725, 4796, 4967, -1 }},
+    {{ 1869, 6009, -1, 4900 }},
+    {{ 752, 1875, -1, 6010 }},
+    {{ -1, 1880, 6011, 5245 }},
+    {{ 6012, -1, 5235, 5240 }},
+    {{ 4897, 19, -1, -1 }},
+    {{ 1075, 6014, 5317, -1 }},
+    {{ 1087, 6015, -1, 6016 }},
+    {{ 5305, 5306, -1, -1 }},
+    {{ -1, -1, 2157, 561 }},
+    {{ 1107, 6018, 1119, -1 }},
+    {{ 5325, 5329, -1, -1 }},
+    {{ 6020, -1, 5385, 5391 }},
+    {{ 5370, 6021, 1185, -1 }},
+    {{ 7024, 1736, -1, 5380 }},
+    {{ -1, 765, 6023, 4999 }},
+    {{ 6024, -1, 5533, 5547 }},
+    {{ 1747, 2042, 5527, -1 }},
+    {{ 5302, 1945, 6026, -1 }},
+    {{ 5353, -1, 1152, 6027 }},
+    {{ -1, 6028, 1168, 6989 }},
+    {{ 5361, 4279, -1, 6969 }},
+    {{ 6030, -1, 5385, 6033 }},
+    {{ 5370, 6031, 1185, -1 }},
+    {{ 7024, 842, -1, 6032 }},
+    {{ -1, 4284, 12, 7063 }},
+    {{ -1, 6034, 1208, 1213 }},
+    {{ 6035, 6036, -1, 7182 }},
+    {{ 5394, 4288, 15, -1 }},
+    {{ 4290, 4882, -1, 7177 }},
+    {{ 6038, -1, 1235, 1240 }},
+    {{ 5428, 6039, 7406, -1 }},
+    {{ 5433, 4294, -1, 7401 }},
+    {{ -1, 6041, 1254, 7525 }},
+    {{ 6042, 7486, -1, 7493 }},
+    {{ 4298, 5471, 1251, -1 }},
+    {{ 6044, 5493, -1, 6048 }},
+    {{ 6045, 5471, 862, -1 }},
+    {{ 856, 6046, 1270, -1 }},
+    {{ 860, 5461, -1, 6047 }},
+    {{ -1, 5468, -1, 5697 }},
+    {{ -1, 7721, 6049, 7758 }},
+    {{ 6050, -1, 7748, 1053 }},
+    {{ 4303, 7738, 7743, -1 }},
+    {{ 6052, -1, 7899, 7906 }},
+    {{ 5535, 6053, 1185, -1 }},
+    {{ 5540, 4307, -1, 7896 }},
+    {{ -1, 6055, 7941, 7952 }},
+    {{ 6056, 7931, -1, 1230 }},
+    {{ 4311, 7923, 7927, -1 }},
+    {{ -1, 6058, 6061, 8056 }},
+    {{ 6059, 7988, -1, 8002 }},
+    {{ 5555, 7973, 6060, -1 }},
+    {{ 4316, -1, 7983, 16 }},
+    {{ 6062, -1, 8037, 8051 }},
+    {{ 6063, 6064, 8031, -1 }},
+    {{ 5576, 4320, 1313, -1 }},
+    {{ 4322, 8027, -1, 20 }},
+    {{ 285, 6066, 6072, -1 }},
+    {{ 299, 304, -1, 6067 }},
+    {{ -1, 2344, 34, 6068 }},
+    {{ -1, 2361, 6069, 1459 }},
+    {{ 522, -1, 6070, 1455 }},
+    {{ 2365, -1, 6071, 2004 }},
+    {{ -1, -1, 7111, 1196 }},
+    {{ 312, -1, 6073, 6078 }},
+    {{ 6074, -1, 6075, 2431 }},
+    {{ 2403, 323, 3076, -1 }},
+    {{ 6076, -1, 4737, 2426 }},
+    {{ 4701, 6077, 4732, -1 }},
+    {{ 4583, 2420, -1, 430 }},
+    {{ -1, 2007, 6079, 6081 }},
+    {{ 3290, -1, 6080, 248 }},
+    {{ 5796, -1, 5385, 1961 }},
+    {{ -1, 1516, 6082, 2014 }},
+    {{ 6083, -1, 1977, 2034 }},
+    {{ 868, 255, 6084, -1 }},
+    {{ 5528, -1, 1152, -1 }},
+    {{ 339, 2547, -1, 6086 }},
+    {{ -1, 2570, 6087, 2584 }},
+    {{ 349, -1, 6088, 3218 }},
+    {{ 461, -1, 6089, 1655 }},
+    {{ 2581, -1, 6090, 2019 }},
+    {{ -1, -1, 4737, 7121 }},
+    {{ -1, 1726, 6092, 1740 }},
+    {{ 6093, -1, 1733, 1737 }},
+    {{ 2628, 216, 6094, -1 }},
+    {{ -1, -1, 1152, 7412 }},
+    {{ -1, 2632, 6096, 1766 }},
+    {{ 6097, -1, 6100, 1761 }},
+    {{ 523, 527, 6098, -1 }},
+    {{ 2641, -1, 6099, 7858 }},
+    {{ -1, -1, 6930, 1159 }},
+    {{ 6101, -1, 7899, 7906 }},
+    {{ 2646, 3608, 1012, -1 }},
+    {{ 360, 369, 6103, -1 }},
+    {{ 6104, -1, 6108, 43 }},
+    {{ 657, 2709, 6105, -1 }},
+    {{ 4374, -1, 4383, 6106 }},
+    {{ -1, 6107, 689, 2725 }},
+    {{ 4389, -1, -1, 2723 }},
+    {{ 6109, -1, 2733, 375 }},
+    {{ 4396, 6110, 4413, -1 }},
+    {{ 4409, 670, -1, 6111 }},
+    {{ -1, -1, 12, 2731 }},
+    {{ 2758, 6113, 6115, -1 }},
+    {{ 546, 2762, -1, 6114 }},
+    {{ -1, 4558, 773, 383 }},
+    {{ 565, -1, 570, 6116 }},
+    {{ -1, 6117, 3912, 945 }},
+    {{ 29, 2772, -1, -1 }},
+    {{ 6119, 2788, -1, 48 }},
+    {{ 577, 2778, 6120, -1 }},
+    {{ 593, -1, 4040, 6121 }},
+    {{ -1, 2784, 1570, -1 }},
+    {{ 657, 6123, 662, -1 }},
+    {{ 4346, 2797, -1, 6124 }},
+    {{ -1, 2800, 12, -1 }},
+    {{ 531, 6126, 4576, -1 }},
+    {{ 546, 2816, -1, 6127 }},
+    {{ -1, 2820, 2157, -1 }},
+    {{ 6129, -1, 4737, 6132 }},
+    {{ 4701, 6130, 4732, -1 }},
+    {{ 4583, 6131, -1, 430 }},
+    {{ 697, 2841, -1, -1 }},
+    {{ -1, 6133, 4784, 4789 }},
+    {{ 1654, 2853, -1, 4778 }},
+    {{ -1, 398, 6135, 2866 }},
+    {{ 6136, -1, 4931, 4937 }},
+    {{ 4922, 6137, 5352, -1 }},
+    {{ 5323, -1, -1, 4927 }},
+    {{ 1075, 5303, 6139, -1 }},
+    {{ 1097, -1, 1101, 6140 }},
+    {{ -1, -1, 6745, -1 }},
+    {{ 1142, 6142, 1148, -1 }},
+    {{ 6878, 6887, -1, -1 }},
+    {{ 1153, -1, 6930, 1631 }},
+    {{ 6145, -1, 5385, 2105 }},
+    {{ 5370, 6146, 1185, -1 }},
+    {{ 7024, 842, -1, 6147 }},
+    {{ -1, -1, -1, 7063 }},
+    {{ -1, 2061, 6149, 2074 }},
+    {{ 6150, -1, 2066, 2070 }},
+    {{ 6151, 269, 5527, -1 }},
+    {{ 1303, 869, 6152, -1 }},
+    {{ 1314, -1, 7793, -1 }},
+    {{ 285, 2960, 6154, -1 }},
+    {{ 312, -1, 2967, 6155 }},
+    {{ -1, 2007, 2976, 6156 }},
+    {{ -1, 1516, 6157, 2014 }},
+    {{ 2978, -1, 4212, 2034 }},
+    {{ 37, 2981, -1, 6159 }},
+    {{ -1, 352, 6160, 2995 }},
+    {{ 2608, -1, 6161, 2990 }},
+    {{ 357, -1, 6162, 260 }},
+    {{ 421, -1, 6090, 2090 }},
+    {{ 423, -1, 6164, 6169 }},
+    {{ 6165, -1, 6166, 3044 }},
+    {{ 3033, 429, 2582, -1 }},
+    {{ 6167, -1, 4737, 3042 }},
+    {{ 4701, 6168, 4732, -1 }},
+    {{ 4583, 3040, -1, -1 }},
+    {{ -1, 1868, 6170, 2097 }},
+    {{ 6171, -1, 2882, 2118 }},
+    {{ 2871, 404, 6172, -1 }},
+    {{ 5353, -1, 1152, -1 }},
+    {{ -1, 2061, 6174, 2074 }},
+    {{ 6175, -1, 2066, 2070 }},
+    {{ 3059, 269, 4236, -1 }},
+    {{ 6177, 3090, -1, 6186 }},
+    {{ 3062, 3069, 6178, -1 }},
+    {{ 3005, -1, 6179, 6183 }},
+    {{ 423, -1, 3074, 6180 }},
+    {{ -1, 1868, 6181, 2097 }},
+    {{ 3082, -1, 6182, 2118 }},
+    {{ -1, -1, 5385, 5391 }},
+    {{ -1, 8, 6184, 3086 }},
+    {{ 431, -1, 6185, 274 }},
+    {{ 440, -1, 6071, 2120 }},
+    {{ -1, 3115, 6187, 3138 }},
+    {{ 6188, -1, 6192, 3132 }},
+    {{ 3173, 19, 6189, -1 }},
+    {{ 54, -1, 6190, 2139 }},
+    {{ 446, -1, 6191, 2122 }},
+    {{ -1, -1, 4737, 6936 }},
+    {{ 6193, -1, 6196, 2150 }},
+    {{ 462, 3489, 6194, -1 }},
+    {{ 450, -1, 6195, 1186 }},
+    {{ -1, -1, 4419, 7069 }},
+    {{ 6197, -1, 7111, 2148 }},
+    {{ 3129, 1192, 6198, -1 }},
+    {{ -1, -1, 4673, 7107 }},
+    {{ 6200, 3162, -1, 2126 }},
+    {{ 3153, 3291, 6201, -1 }},
+    {{ 3304, -1, 6202, 3158 }},
+    {{ 60, -1, 6203, 969 }},
+    {{ 446, -1, 6204, 2124 }},
+    {{ -1, -1, 4737, 6000 }},
+    {{ 6206, -1, 7111, 2148 }},
+    {{ 6207, 1192, 7106, -1 }},
+    {{ 531, 7087, 6208, -1 }},
+    {{ 565, -1, 570, -1 }},
+    {{ -1, 3219, 6210, 3544 }},
+    {{ 6211, -1, 1235, 1240 }},
+    {{ 6212, 3234, 7406, -1 }},
+    {{ 3232, 7379, 6213, -1 }},
+    {{ -1, -1, 1101, 7389 }},
+    {{ -1, 2151, 6215, 3269 }},
+    {{ 6216, -1, 6223, 3616 }},
+    {{ 6217, 3249, 6220, -1 }},
+    {{ 524, 1306, 6218, -1 }},
+    {{ 470, -1, 6219, 7799 }},
+    {{ -1, -1, 6727, 7797 }},
+    {{ 6221, -1, 1152, 7858 }},
+    {{ 3256, 7848, 6222, -1 }},
+    {{ -1, -1, 2398, 1149 }},
+    {{ 6224, -1, 7899, 7906 }},
+    {{ 6225, 3265, 1185, -1 }},
+    {{ 3262, 7869, 6226, -1 }},
+    {{ -1, -1, 570, 7019 }},
+    {{ 876, 3277, 6228, -1 }},
+    {{ 898, -1, 3283, 6229 }},
+    {{ -1, 2007, 6230, 2012 }},
+    {{ 3290, -1, 6231, 5747 }},
+    {{ -1, -1, 5385, 5745 }},
+    {{ -1, -1, 6233, 977 }},
+    {{ 6234, -1, 6029, 974 }},
+    {{ 3320, 1945, 6235, -1 }},
+    {{ -1, -1, 1152, 6027 }},
+    {{ 6237, 3332, -1, 3338 }},
+    {{ 3321, 982, 6238, -1 }},
+    {{ 6102, -1, 6239, 3328 }},
+    {{ 989, -1, 6240, 2092 }},
+    {{ 480, -1, 6241, 6134 }},
+    {{ -1, -1, 4737, 6132 }},
+    {{ -1, 3348, 6243, 3370 }},
+    {{ 6244, -1, 6250, 1053 }},
+    {{ 6245, 3360, 6248, -1 }},
+    {{ 1037, 1042, 6246, -1 }},
+    {{ 486, -1, 6247, -1 }},
+    {{ -1, -1, 6464, -1 }},
+    {{ 6249, -1, 1152, 1163 }},
+    {{ 3256, 1051, 6222, -1 }},
+    {{ 6251, -1, 1190, 6512 }},
+    {{ 6252, 3368, 1185, -1 }},
+    {{ 3262, 6494, 6226, -1 }},
+    {{ 487, 495, 6254, -1 }},
+    {{ 6255, -1, 6258, 65 }},
+    {{ 3425, 500, 6256, -1 }},
+    {{ 83, -1, 1813, 6257 }},
+    {{ -1, -1, 689, 3438 }},
+    {{ 6259, -1, 3446, 503 }},
+    {{ 1825, 6260, 1844, -1 }},
+    {{ 4583, 3442, -1, -1 }},
+    {{ 6262, -1, 6930, 2136 }},
+    {{ 6916, 6263, 2412, -1 }},
+    {{ 6924, 2135, -1, 6264 }},
+    {{ -1, -1, -1, 1840 }},
+    {{ 3652, 6266, 6267, -1 }},
+    {{ 3675, 3686, -1, 1039 }},
+    {{ 3704, -1, 3709, 6268 }},
+    {{ -1, -1, 3725, -1 }},
+    {{ 6270, 3481, -1, 7011 }},
+    {{ 3731, 3480, 6271, -1 }},
+    {{ 3749, -1, 3754, -1 }},
+    {{ 3846, 6273, 3860, -1 }},
+    {{ 1797, 3851, -1, -1 }},
+    {{ 3872, -1, 3885, 6275 }},
+    {{ -1, -1, 1883, 3896 }},
+    {{ 6277, -1, 7068, 1186 }},
+    {{ 657, 6278, 662, -1 }},
+    {{ 4346, 4360, -1, 6279 }},
+    {{ -1, 4369, -1, -1 }},
+    {{ -1, 6281, 1718, 1213 }},
+    {{ 6282, 3511, -1, 7182 }},
+    {{ 6283, 153, 15, -1 }},
+    {{ 3509, 7161, 6284, -1 }},
+    {{ -1, -1, 5076, 5742 }},
+    {{ -1, 6286, 6294, 3544 }},
+    {{ 6287, 3528, -1, 1230 }},
+    {{ 6288, 3518, 6291, -1 }},
+    {{ 1218, 158, 6289, -1 }},
+    {{ 510, -1, 6290, 5742 }},
+    {{ -1, -1, 5731, 5737 }},
+    {{ 6292, -1, 118, 16 }},
+    {{ 3525, 7314, 6293, -1 }},
+    {{ -1, -1, 953, 117 }},
+    {{ 6295, -1, 1235, 1240 }},
+    {{ 6296, 6299, 7406, -1 }},
+    {{ 6297, 7379, 7388, -1 }},
+    {{ 6634, 1076, 6298, -1 }},
+    {{ 6654, -1, 6655, -1 }},
+    {{ 6300, 162, -1, 7401 }},
+    {{ 3542, 7394, 6301, -1 }},
+    {{ -1, -1, 6808, 2170 }},
+    {{ 6303, 3563, -1, 3575 }},
+    {{ 6304, 3551, 6308, -1 }},
+    {{ 1263, 1266, 6305, -1 }},
+    {{ 1271, -1, 6306, 5742 }},
+    {{ 421, -1, 6307, 7597 }},
+    {{ -1, -1, 4737, 7595 }},
+    {{ 6309, -1, 6312, 16 }},
+    {{ 1277, 1282, 6310, -1 }},
+    {{ 520, -1, 6311, -1 }},
+    {{ -1, -1, 7649, -1 }},
+    {{ 6313, -1, 962, 969 }},
+    {{ 3560, 7658, 6314, -1 }},
+    {{ -1, -1, 3029, 960 }},
+    {{ 6316, 3601, -1, 20 }},
+    {{ 1317, 173, 6317, -1 }},
+    {{ 530, -1, 6318, 2170 }},
+    {{ -1, -1, 390, 401 }},
+    {{ 6320, -1, 1152, 7858 }},
+    {{ 6321, 7848, 1148, -1 }},
+    {{ 6863, 1143, 6208, -1 }},
+    {{ 6323, -1, 7899, 7906 }},
+    {{ 6324, 6327, 1185, -1 }},
+    {{ 6325, 7869, 3484, -1 }},
+    {{ 3652, 532, 6326, -1 }},
+    {{ 3704, -1, 3709, -1 }},
+    {{ 6328, 3612, -1, 7896 }},
+    {{ 3610, 7879, 6329, -1 }},
+    {{ -1, -1, 4040, 2170 }},
+    {{ -1, 3624, 6331, 8056 }},
+    {{ 6332, -1, 8037, 8051 }},
+    {{ 6333, 3647, 8031, -1 }},
+    {{ 6334, 3643, 1313, -1 }},
+    {{ 3640, 8011, 6335, -1 }},
+    {{ -1, -1, 7776, 1305 }},
+    {{ 876, 6337, 6342, -1 }},
+    {{ 887, 891, -1, 6338 }},
+    {{ -1, 5682, 6339, 5697 }},
+    {{ 24, -1, 6340, -1 }},
+    {{ 5693, -1, 6341, 896 }},
+    {{ -1, -1, 7111, 1710 }},
+    {{ 898, -1, 6343, 6348 }},
+    {{ 6344, -1, 6345, 5737 }},
+    {{ 5725, 907, 2582, -1 }},
+    {{ 6346, -1, 4737, 5735 }},
+    {{ 4701, 6347, 4732, -1 }},
+    {{ 4583, 5734, -1, -1 }},
+    {{ -1, 2007, 6349, 2012 }},
+    {{ 6350, -1, 5744, 5747 }},
+    {{ 5302, 1945, 6172, -1 }},
+    {{ 6352, 919, -1, 6357 }},
+    {{ 909, 913, 6353, -1 }},
+    {{ 5778, -1, 5787, 6354 }},
+    {{ -1, 8, 6355, -1 }},
+    {{ 3290, -1, 6356, 918 }},
+    {{ -1, -1, 5385, 2053 }},
+    {{ -1, 931, 6358, 5874 }},
+    {{ 6359, -1, 6361, 5869 }},
+    {{ 63, 25, 6360, -1 }},
+    {{ 5854, -1, 6099, 1163 }},
+    {{ 6362, -1, 5865, 260 }},
+    {{ 5858, 3489, 6363, -1 }},
+    {{ -1, -1, 5863, -1 }},
+    {{ 939, 946, 6365, -1 }},
+    {{ 6366, -1, 6369, 117 }},
+    {{ 5924, 951, 6367, -1 }},
+    {{ 4374, -1, 4383, 6368 }},
+    {{ -1, -1, 689, 5932 }},
+    {{ 6370, -1, 5936, 954 }},
+    {{ 4396, 6371, 4413, -1 }},
+    {{ 4409, 3442, -1, -1 }},
+    {{ 6373, -1, 5995, 966 }},
+    {{ 5986, 6374, 2969, -1 }},
+    {{ 5992, 965, -1, 6375 }},
+    {{ -1, -1, -1, 4728 }},
+    {{ -1, -1, 6377, 977 }},
+    {{ 6378, -1, 6029, 974 }},
+    {{ 6379, 1945, 6026, -1 }},
+    {{ 1075, 5303, 5873, -1 }},
+    {{ 285, 6066, 6381, -1 }},
+    {{ 312, -1, 6073, 6382 }},
+    {{ -1, 2007, 6383, 6081 }},
+    {{ 3290, -1, 6384, 248 }},
+    {{ -1, -1, 5385, 1961 }},
+    {{ -1, 8, 6386, 6148 }},
+    {{ 6387, -1, 6144, 274 }},
+    {{ 6138, 1945, 6388, -1 }},
+    {{ -1, -1, 6143, -1 }},
+    {{ 6390, 6176, -1, 1005 }},
+    {{ 6153, 6158, 6391, -1 }},
+    {{ 3005, -1, 6392, 1002 }},
+    {{ 423, -1, 6393, 6169 }},
+    {{ 6165, -1, 6394, 3044 }},
+    {{ -1, -1, 4737, 3042 }},
+    {{ -1, 1013, 6396, 1022 }},
+    {{ 6397, -1, 6401, 6285 }},
+    {{ 6398, 19, 125, -1 }},
+    {{ 487, 495, 6399, -1 }},
+    {{ 6255, -1, 6400, 65 }},
+    {{ -1, -1, 3446, 503 }},
+    {{ 6402, -1, 2147, 6280 }},
+    {{ 6403, 3489, 6276, -1 }},
+    {{ 6265, 6269, 6404, -1 }},
+    {{ -1, -1, 6274, -1 }},
+    {{ 6406, 1027, -1, 1032 }},
+    {{ 6407, 6351, 6411, -1 }},
+    {{ 876, 6337, 6408, -1 }},
+    {{ 898, -1, 6409, 6348 }},
+    {{ 6344, -1, 6410, 5737 }},
+    {{ -1, -1, 4737, 5735 }},
+    {{ 6412, -1, 130, 6376 }},
+    {{ 939, 946, 6413, -1 }},
+    {{ 6366, -1, 6414, 117 }},
+    {{ -1, -1, 5936, 954 }},
+    {{ 6416, 142, -1, 20 }},
+    {{ 1107, 140, 6417, -1 }},
+    {{ 6472, -1, 6318, 2170 }},
+    {{ 6419, -1, 1152, 1163 }},
+    {{ 6321, 1051, 6484, -1 }},
+    {{ 6421, -1, 1190, 6512 }},
+    {{ 6422, 6423, 1185, -1 }},
+    {{ 6325, 6494, 6500, -1 }},
+    {{ 6424, 1174, -1, 1181 }},
+    {{ 6503, 6506, 6329, -1 }},
+    {{ -1, 1059, 6426, 6608 }},
+    {{ 6427, -1, 6595, 6602 }},
+    {{ 6428, 1072, 7846, -1 }},
+    {{ 6429, 1306, 6587, -1 }},
+    {{ 6576, 6581, 6430, -1 }},
+    {{ -1, -1, 6585, -1 }},
+    {{ 1364, 6432, 6434, -1 }},
+    {{ 1393, 1408, -1, 6433 }},
+    {{ -1, 204, 773, 774 }},
+    {{ 1464, -1, 1479, 6435 }},
+    {{ -1, 493, 247, 6436 }},
+    {{ -1, -1, 1525, -1 }},
+    {{ 1535, 6644, 3589, -1 }},
+    {{ 6646, 1616, -1, 6439 }},
+    {{ -1, 1633, 6440, 1659 }},
+    {{ 1645, -1, -1, 3218 }},
+    {{ 1480, -1, 1850, 6442 }},
+    {{ -1, 6443, 1883, 6444 }},
+    {{ 1869, -1, -1, -1 }},
+    {{ -1, -1, 1895, 4999 }},
+    {{ 1944, -1, 1955, 6446 }},
+    {{ -1, -1, 5426, 1966 }},
+    {{ 285, 6671, 6448, -1 }},
+    {{ 312, -1, 321, 790 }},
+    {{ 46, -1, 390, 6450 }},
+    {{ -1, -1, 402, -1 }},
+    {{ 6452, 6689, -1, 6695 }},
+    {{ 6686, 4547, 6453, -1 }},
+    {{ 3005, -1, 797, 798 }},
+    {{ 531, 6455, 1791, -1 }},
+    {{ 546, 555, -1, 6456 }},
+    {{ -1, 3814, 1783, -1 }},
+    {{ 76, 607, -1, 6458 }},
+    {{ -1, 619, -1, 626 }},
+    {{ 83, -1, 1813, 6460 }},
+    {{ -1, 5106, 689, 6461 }},
+    {{ -1, -1, 4538, 1987 }},
+    {{ 1825, 6463, 1844, -1 }},
+    {{ 4583, 2135, -1, 3194 }},
+    {{ 1851, -1, 4737, 6465 }},
+    {{ -1, 6466, 4784, 4789 }},
+    {{ 1863, -1, -1, 4778 }},
+    {{ -1, 6468, 1895, 4999 }},
+    {{ -1, 4972, -1, 5511 }},
+    {{ 6470, 142, -1, 20 }},
+    {{ 1107, 140, 6471, -1 }},
+    {{ 6472, -1, 6473, 2170 }},
+    {{ 6804, 1121, 3599, -1 }},
+    {{ 6474, -1, 390, 401 }},
+    {{ 380, 6475, 386, -1 }},
+    {{ 2777, 6811, -1, -1 }},
+    {{ 6863, 1143, 6477, -1 }},
+    {{ 565, -1, 570, 6478 }},
+    {{ -1, 6479, 3912, 2378 }},
+    {{ 29, 6876, -1, -1 }},
+    {{ 577, 5483, 6883, -1 }},
+    {{ 6482, 6893, -1, 4366 }},
+    {{ 597, 6889, 6483, -1 }},
+    {{ 4090, -1, 4101, -1 }},
+    {{ 6485, -1, 2398, 1149 }},
+    {{ 657, 6486, 662, -1 }},
+    {{ 4346, 6902, -1, 6487 }},
+    {{ -1, 6906, 12, -1 }},
+    {{ 6489, -1, 1190, 6512 }},
+    {{ 6490, 6501, 1185, -1 }},
+    {{ 6491, 6494, 6500, -1 }},
+    {{ 3652, 532, 6492, -1 }},
+    {{ 3704, -1, 3709, 6493 }},
+    {{ -1, 493, 3725, 542 }},
+    {{ 6495, 6497, -1, 7011 }},
+    {{ 3731, 6496, 551, -1 }},
+    {{ 37, 3744, -1, 1309 }},
+    {{ 6498, 7008, -1, 4554 }},
+    {{ 3767, 4482, 6499, -1 }},
+    {{ 3005, -1, 3777, -1 }},
+    {{ 3207, -1, 570, 7019 }},
+    {{ 6502, 1174, -1, 1181 }},
+    {{ 6503, 6506, 6509, -1 }},
+    {{ 3935, 6504, 3611, -1 }},
+    {{ 299, 3946, -1, 6505 }},
+    {{ -1, 3954, -1, 580 }},
+    {{ 6507, 7030, -1, 4595 }},
+    {{ 326, 7027, 6508, -1 }},
+    {{ 2498, -1, 3984, -1 }},
+    {{ 6510, -1, 4040, 2170 }},
+    {{ 4025, 6511, 42, -1 }},
+    {{ 370, 4030, -1, -1 }},
+    {{ -1, 6513, 1208, 1213 }},
+    {{ 6514, 6518, -1, 7182 }},
+    {{ 6515, 153, 15, -1 }},
+    {{ 6516, 7161, 784, -1 }},
+    {{ 5006, 771, 6517, -1 }},
+    {{ 5023, -1, 5024, -1 }},
+    {{ 6519, 4882, -1, 7177 }},
+    {{ 6520, 756, 5194, -1 }},
+    {{ 7168, 1207, 6521, -1 }},
+    {{ -1, -1, 5169, 6078 }},
+    {{ 6523, 794, -1, 802 }},
+    {{ 7299, 7303, 6524, -1 }},
+    {{ 7308, -1, 6525, -1 }},
+    {{ -1, -1, 5793, 401 }},
+    {{ 6527, -1, 118, 16 }},
+    {{ 6528, 7314, 116, -1 }},
+    {{ 5889, 940, 6529, -1 }},
+    {{ 3485, -1, 5906, -1 }},
+    {{ 6531, 816, -1, 7340 }},
+    {{ 6532, 812, 6535, -1 }},
+    {{ 7322, 7325, 6533, -1 }},
+    {{ 7327, -1, 6534, 6078 }},
+    {{ -1, -1, 6075, 2431 }},
+    {{ 6536, -1, 988, 995 }},
+    {{ 7334, 5504, 6537, -1 }},
+    {{ -1, -1, 6108, 43 }},
+    {{ 6539, -1, 1235, 1240 }},
+    {{ 7378, 6540, 7406, -1 }},
+    {{ 6541, 162, -1, 7401 }},
+    {{ 6542, 7394, 1119, -1 }},
+    {{ 6765, 1108, 6543, -1 }},
+    {{ 6779, -1, 6780, -1 }},
+    {{ -1, 6545, 1254, 7525 }},
+    {{ 6546, 7486, -1, 7493 }},
+    {{ 6547, 5471, 1251, -1 }},
+    {{ 6548, 859, 1270, -1 }},
+    {{ 7473, 1250, 6549, -1 }},
+    {{ -1, -1, 7562, 884 }},
+    {{ 6551, 919, -1, 7609 }},
+    {{ 909, 913, 6552, -1 }},
+    {{ 5778, -1, 6553, 7607 }},
+    {{ 7603, -1, 6554, 401 }},
+    {{ -1, -1, 2837, 397 }},
+    {{ 6556, -1, 962, 969 }},
+    {{ 6557, 7658, 7665, -1 }},
+    {{ 5951, 957, 6208, -1 }},
+    {{ 6559, 7703, -1, 7709 }},
+    {{ 6560, 982, 6564, -1 }},
+    {{ 7670, 7673, 6561, -1 }},
+    {{ 312, -1, 6562, 7680 }},
+    {{ 7676, -1, 6563, 2431 }},
+    {{ -1, -1, 4737, 2426 }},
+    {{ 6565, -1, 6568, 7700 }},
+    {{ 7683, 5202, 6566, -1 }},
+    {{ 7685, -1, 6567, 43 }},
+    {{ -1, -1, 2733, 375 }},
+    {{ 6569, -1, 992, 2092 }},
+    {{ 7691, 7695, 6363, -1 }},
+    {{ -1, 7721, 6571, 7758 }},
+    {{ 6572, -1, 7748, 1053 }},
+    {{ 6573, 7738, 7743, -1 }},
+    {{ 6574, 1042, 134, -1 }},
+    {{ 7732, 1300, 6575, -1 }},
+    {{ -1, -1, 7736, -1 }},
+    {{ 1364, 6577, 6579, -1 }},
+    {{ 1393, 1408, -1, 6578 }},
+    {{ -1, 204, -1, 6637 }},
+    {{ 1464, -1, 1479, 6580 }},
+    {{ -1, -1, 247, -1 }},
+    {{ 6582, 7773, -1, 1077 }},
+    {{ 1535, 7772, 5562, -1 }},
+    {{ 1780, 6584, 1473, -1 }},
+    {{ 1797, 75, -1, -1 }},
+    {{ 1480, -1, 1850, 6586 }},
+    {{ -1, -1, 1883, 6660 }},
+    {{ 6588, -1, 7793, 7799 }},
+    {{ 3425, 6589, 7790, -1 }},
+    {{ 1797, 6708, -1, 6590 }},
+    {{ -1, 79, -1, -1 }},
+    {{ 6592, 1128, -1, 1134 }},
+    {{ 7838, 7839, 6593, -1 }},
+    {{ 7841, -1, 6594, -1 }},
+    {{ -1, -1, 427, 6821 }},
+    {{ 6596, -1, 7899, 7906 }},
+    {{ 7868, 6597, 1185, -1 }},
+    {{ 6598, 6599, -1, 7896 }},
+    {{ 5481, 7879, 3501, -1 }},
+    {{ 6600, 1178, -1, 705 }},
+    {{ 7886, 1334, 6601, -1 }},
+    {{ -1, -1, 4101, 78 }},
+    {{ -1, 6603, 7941, 7952 }},
+    {{ 6604, 7931, -1, 1230 }},
+    {{ 6605, 7923, 7927, -1 }},
+    {{ 6606, 158, 1227, -1 }},
+    {{ 7732, 1340, 6607, -1 }},
+    {{ -1, -1, 7921, -1 }},
+    {{ -1, 6609, 6621, 8056 }},
+    {{ 6610, 7988, -1, 8002 }},
+    {{ 6611, 7973, 6617, -1 }},
+    {{ 6612, 1266, 6615, -1 }},
+    {{ 7958, 7961, 6613, -1 }},
+    {{ 7963, -1, 6614, 884 }},
+    {{ -1, -1, 1850, 5634 }},
+    {{ 6616, -1, 1274, 5742 }},
+    {{ 7968, 7971, 6363, -1 }},
+    {{ 6618, -1, 7983, 16 }},
+    {{ 6619, 1282, 168, -1 }},
+    {{ 7979, 1351, 6620, -1 }},
+    {{ -1, -1, 7982, -1 }},
+    {{ 6622, -1, 8037, 8051 }},
+    {{ 6623, 6630, 8031, -1 }},
+    {{ 6624, 6627, 1313, -1 }},
+    {{ 6625, 8011, 8017, -1 }},
+    {{ 1364, 7765, 6626, -1 }},
+    {{ 1464, -1, 1479, -1 }},
+    {{ 6628, 1310, -1, 6698 }},
+    {{ 8018, 1358, 6629, -1 }},
+    {{ -1, -1, 6678, 1092 }},
+    {{ 6631, 8027, -1, 20 }},
+    {{ 6632, 173, 1326, -1 }},
+    {{ 8023, 1362, 6633, -1 }},
+    {{ -1, -1, 4822, -1 }},
+    {{ 1364, 6635, 6638, -1 }},
+    {{ 1393, 1408, -1, 6636 }},
+    {{ -1, 204, 5587, 6637 }},
+    {{ -1, 1445, 5591, 1459 }},
+    {{ 1464, -1, 1479, 6639 }},
+    {{ -1, 5597, 247, 6640 }},
+    {{ -1, 5601, 1525, 6641 }},
+    {{ -1, 6642, 1531, 8056 }},
+    {{ 1989, 7988, -1, -1 }},
+    {{ 1535, 6644, 5604, -1 }},
+    {{ 37, 1552, -1, 548 }},
+    {{ 6646, 1616, -1, 6648 }},
+    {{ 1593, 1598, 6647, -1 }},
+    {{ 3005, -1, 1603, 558 }},
+    {{ -1, 1633, 6649, 1659 }},
+    {{ 1645, -1, 5611, 3218 }},
+    {{ 1700, -1, 1705, 6651 }},
+    {{ -1, 6652, 1718, 1722 }},
+    {{ 1424, 3511, -1, -1 }},
+    {{ 507, 3528, -1, 1786 }},
+    {{ 1780, 5626, 1473, -1 }},
+    {{ 1480, -1, 1850, 6656 }},
+    {{ -1, 6657, 1883, 6660 }},
+    {{ 1869, 5636, -1, 6658 }},
+    {{ -1, 6659, 4912, 5295 }},
+    {{ 4902, 1027, -1, -1 }},
+    {{ -1, 6661, 1895, 4999 }},
+    {{ 766, 6662, -1, 5511 }},
+    {{ 4973, 7703, -1, -1 }},
+    {{ 186, 1497, -1, 6664 }},
+    {{ -1, 6405, -1, 6425 }},
+    {{ 1944, -1, 1955, 6666 }},
+    {{ -1, 6667, 5426, 1966 }},
+    {{ 250, 6668, -1, 1230 }},
+    {{ 5418, 816, -1, -1 }},
+    {{ 5494, 7703, -1, 1796 }},
+    {{ 285, 6671, 6673, -1 }},
+    {{ 299, 304, -1, 6672 }},
+    {{ -1, 2344, 34, 4601 }},
+    {{ 312, -1, 321, 6674 }},
+    {{ -1, 4604, 2439, 5644 }},
+    {{ 360, 6676, 42, -1 }},
+    {{ 370, 2702, -1, 6677 }},
+    {{ -1, 79, 12, 4613 }},
+    {{ 46, -1, 390, 6679 }},
+    {{ -1, 5656, 402, 6680 }},
+    {{ -1, 6681, 2040, 4999 }},
+    {{ 766, 4972, -1, -1 }},
+    {{ 2043, -1, 2048, 6683 }},
+    {{ -1, 6684, 2948, 2057 }},
+    {{ 1573, 5417, -1, -1 }},
+    {{ 854, 5493, -1, 1802 }},
+    {{ 285, 2960, 6687, -1 }},
+    {{ 312, -1, 2967, 6688 }},
+    {{ -1, 2007, 2976, 4216 }},
+    {{ 6690, 3090, -1, 6693 }},
+    {{ 3062, 3069, 6691, -1 }},
+    {{ 3005, -1, 6692, 4553 }},
+    {{ 423, -1, 3074, 4224 }},
+    {{ -1, 3115, 6694, 3138 }},
+    {{ 819, -1, 447, 3132 }},
+    {{ -1, 4624, 3804, 6696 }},
+    {{ -1, 6697, 466, 3811 }},
+    {{ 4630, 3563, -1, 1576 }},
+    {{ -1, 6699, 2157, 561 }},
+    {{ 4559, 6700, -1, 6703 }},
+    {{ 4564, 3332, -1, 6701 }},
+    {{ -1, 1013, 6702, 1022 }},
+    {{ 640, -1, 1684, 6285 }},
+    {{ -1, 6704, 206, 3827 }},
+    {{ 4638, 1027, -1, 1500 }},
+    {{ 531, 6706, 1791, -1 }},
+    {{ 546, 555, -1, 6707 }},
+    {{ -1, 3814, 1783, 5709 }},
+    {{ 76, 607, -1, 6709 }},
+    {{ -1, 619, 5718, 626 }},
+    {{ -1, -1, 648, 6711 }},
+    {{ -1, 6712, 653, 4312 }},
+    {{ 507, 3528, -1, -1 }},
+    {{ 227, 1803, -1, 1802 }},
+    {{ 83, -1, 1813, 6715 }},
+    {{ -1, 6716, 689, 6719 }},
+    {{ 4466, 2273, -1, 6717 }},
+    {{ -1, 6718, 1929, 1934 }},
+    {{ 1823, 1922, -1, -1 }},
+    {{ -1, 6720, 4538, 1987 }},
+    {{ 4523, 6721, -1, 1972 }},
+    {{ 4533, 7703, -1, -1 }},
+    {{ 1825, 6723, 1844, -1 }},
+    {{ 4583, 5728, -1, 6724 }},
+    {{ -1, 2279, 12, 6725 }},
+    {{ -1, 6726, 2182, 2187 }},
+    {{ 1842, 2174, -1, -1 }},
+    {{ 1851, -1, 4737, 6728 }},
+    {{ -1, 6729, 4784, 4789 }},
+    {{ 1863, 6730, -1, 4778 }},
+    {{ 739, 6731, -1, 4894 }},
+    {{ 4773, 4889, -1, -1 }},
+    {{ 4804, 6733, 15, -1 }},
+    {{ 92, 746, -1, 6734 }},
+    {{ -1, 1872, 935, -1 }},
+    {{ 4883, 4889, -1, 1818 }},
+    {{ -1, 6737, 1895, 4999 }},
+    {{ 6738, 4972, -1, 5511 }},
+    {{ 767, 6739, 4967, -1 }},
+    {{ 4960, 919, -1, -1 }},
+    {{ 808, 6741, 5194, -1 }},
+    {{ 813, 5179, -1, 6742 }},
+    {{ -1, 5190, -1, 6095 }},
+    {{ 6744, 5211, -1, 1910 }},
+    {{ 6153, 4116, 686, -1 }},
+    {{ 6746, -1, 1955, 6752 }},
+    {{ 5302, 6747, 1950, -1 }},
+    {{ 5323, 6748, -1, 6750 }},
+    {{ 106, 836, -1, 6749 }},
+    {{ -1, 1948, 6835, -1 }},
+    {{ -1, 6751, -1, 1138 }},
+    {{ 5347, 634, -1, -1 }},
+    {{ -1, 6753, 5426, 1966 }},
+    {{ 6754, 5417, -1, 1230 }},
+    {{ 251, 6755, 5414, -1 }},
+    {{ 5407, 794, -1, -1 }},
+    {{ -1, 6757, 6761, 1530 }},
+    {{ 854, 6758, -1, 1521 }},
+    {{ 6759, 3926, -1, 2168 }},
+    {{ 5495, 6760, 5500, -1 }},
+    {{ 37, 6085, -1, -1 }},
+    {{ 6762, -1, 1977, 1526 }},
+    {{ 868, 6763, 5527, -1 }},
+    {{ 256, 6764, -1, 20 }},
+    {{ 5524, 1128, -1, -1 }},
+    {{ 2213, 6766, 6769, -1 }},
+    {{ 2237, 2243, -1, 6767 }},
+    {{ -1, 2256, 5147, 6768 }},
+    {{ -1, 1445, 5150, 5010 }},
+    {{ 2265, -1, 2275, 6770 }},
+    {{ -1, 5153, 247, 5013 }},
+    {{ 2315, 2328, -1, 6772 }},
+    {{ -1, 1633, 6773, 6774 }},
+    {{ 2334, -1, 5162, 4033 }},
+    {{ -1, 1660, 6775, 3269 }},
+    {{ 2341, -1, -1, 3616 }},
+    {{ 2345, 1676, -1, 6777 }},
+    {{ -1, 3348, 6778, 1690 }},
+    {{ 2354, -1, -1, 1053 }},
+    {{ 2368, 5165, 317, -1 }},
+    {{ 322, -1, 2417, 6781 }},
+    {{ -1, 5026, 2432, 2436 }},
+    {{ 2473, 2482, -1, 6783 }},
+    {{ -1, 352, 6784, 6785 }},
+    {{ 2488, -1, 4589, 5035 }},
+    {{ -1, 2632, 6786, 1766 }},
+    {{ 2496, -1, -1, 1761 }},
+    {{ 2513, -1, 390, 5039 }},
+    {{ 2523, 2534, 6789, -1 }},
+    {{ 2539, -1, 5182, 6790 }},
+    {{ -1, 8, 4594, 5045 }},
+    {{ 2548, 3090, -1, 6792 }},
+    {{ -1, 3115, 6793, 3138 }},
+    {{ 2562, -1, 6794, 3132 }},
+    {{ 2567, -1, -1, 2150 }},
+    {{ -1, 1660, 6796, 3269 }},
+    {{ 6797, -1, 3259, 3616 }},
+    {{ 2587, 3249, -1, -1 }},
+    {{ 6799, 2602, -1, 5060 }},
+    {{ 2590, 1666, 6800, -1 }},
+    {{ 2597, -1, 5193, 5059 }},
+    {{ -1, 6802, 2638, 2162 }},
+    {{ 6803, 1750, -1, 1576 }},
+    {{ 2634, 3551, 1141, -1 }},
+    {{ 2648, 6805, 365, -1 }},
+    {{ 546, 2659, -1, 6806 }},
+    {{ -1, 3814, 363, 3428 }},
+    {{ 2703, 607, -1, 5072 }},
+    {{ 6809, -1, 390, 401 }},
+    {{ 380, 6810, 386, -1 }},
+    {{ 2777, 6811, -1, 48 }},
+    {{ 2789, 701, -1, 6812 }},
+    {{ -1, 706, 2794, -1 }},
+    {{ 2968, -1, 2972, 5088 }},
+    {{ -1, 2632, 6815, 1766 }},
+    {{ 4211, -1, 3001, 1761 }},
+    {{ 360, 5101, 6817, -1 }},
+    {{ 3007, -1, 3011, 5105 }},
+    {{ 6819, -1, 427, 6821 }},
+    {{ 3015, 6820, 424, -1 }},
+    {{ 3025, 2788, -1, 3194 }},
+    {{ -1, 6822, 2093, 1605 }},
+    {{ 6823, 1874, -1, 4900 }},
+    {{ 4804, 1870, -1, -1 }},
+    {{ 5120, 3090, -1, 6825 }},
+    {{ -1, 3115, 6826, 3138 }},
+    {{ 819, -1, 6827, 3132 }},
+    {{ 1913, -1, 3112, 2150 }},
+    {{ 4625, 3162, -1, 3801 }},
+    {{ -1, 4156, 6830, 3269 }},
+    {{ 6831, -1, 3148, 3616 }},
+    {{ 1919, 3249, 3145, -1 }},
+    {{ 6833, 3332, -1, 4176 }},
+    {{ 3321, 982, 6834, -1 }},
+    {{ 6102, -1, 1925, 3823 }},
+    {{ 1645, -1, 6836, 3218 }},
+    {{ 461, -1, 1651, 6837 }},
+    {{ -1, 6838, 1656, 1213 }},
+    {{ 6839, 3511, -1, 7182 }},
+    {{ 3215, -1, 15, -1 }},
+    {{ -1, 6841, 4191, 4192 }},
+    {{ 6842, 4187, -1, 1446 }},
+    {{ 1937, 3551, 629, -1 }},
+    {{ 6844, 7703, -1, 7709 }},
+    {{ 3565, 982, 6845, -1 }},
+    {{ 3570, -1, 2921, 7700 }},
+    {{ -1, 7721, 6847, 7758 }},
+    {{ 6848, -1, 7748, 1053 }},
+    {{ 2925, 7738, 7743, -1 }},
+    {{ 6850, -1, 3606, 6852 }},
+    {{ 6851, 527, 7846, -1 }},
+    {{ 524, 1306, 3060, -1 }},
+    {{ -1, 6853, 7941, 7952 }},
+    {{ 6854, 7931, -1, 1230 }},
+    {{ 2930, 7923, 7927, -1 }},
+    {{ -1, 6856, 6860, 8056 }},
+    {{ 6857, 7988, -1, 8002 }},
+    {{ 6858, 7973, 6859, -1 }},
+    {{ 3627, 1266, 2935, -1 }},
+    {{ 2937, -1, 7983, 16 }},
+    {{ 6861, -1, 8037, 8051 }},
+    {{ 3638, 6862, 8031, -1 }},
+    {{ 2941, 8027, -1, 20 }},
+    {{ 3652, 6864, 537, -1 }},
+    {{ 3675, 3686, -1, 6865 }},
+    {{ -1, 204, 534, 6866 }},
+    {{ -1, 1445, 1375, 6867 }},
+    {{ -1, 3703, 1775, -1 }},
+    {{ 556, 3781, -1, 6869 }},
+    {{ -1, 3796, 6870, 3807 }},
+    {{ 1645, -1, 1417, 6871 }},
+    {{ -1, 3806, 3229, -1 }},
+    {{ 3833, 3837, -1, 1830 }},
+    {{ 565, -1, 570, 6874 }},
+    {{ -1, 6875, 3912, 2378 }},
+    {{ 29, 6876, -1, 70 }},
+    {{ 3901, 3905, -1, 6877 }},
+    {{ -1, 3909, 284, -1 }},
+    {{ 577, 6879, 6883, -1 }},
+    {{ 3974, 586, -1, 6880 }},
+    {{ -1, 4011, 6881, 4020 }},
+    {{ 2608, -1, -1, 6882 }},
+    {{ -1, 3700, 591, -1 }},
+    {{ 593, -1, 4040, 6884 }},
+    {{ -1, 6885, 1570, 2384 }},
+    {{ -1, 406, -1, 6886 }},
+    {{ -1, 4048, 2926, -1 }},
+    {{ 6888, 6893, -1, 4366 }},
+    {{ 597, 6889, 6890, -1 }},
+    {{ 4071, 4078, -1, 699 }},
+    {{ 4090, -1, 4101, 6891 }},
+    {{ -1, 8, -1, 6892 }},
+    {{ -1, 3766, 606, -1 }},
+    {{ 6894, 4127, -1, 614 }},
+    {{ 4108, 4116, 703, -1 }},
+    {{ 4199, 6896, 1671, -1 }},
+    {{ 3292, 4204, -1, 6897 }},
+    {{ -1, 931, -1, 4209 }},
+    {{ 6899, 4220, -1, 638 }},
+    {{ 4213, 4217, 716, -1 }},
+    {{ 657, 6901, 662, -1 }},
+    {{ 4346, 6902, -1, 6905 }},
+    {{ 4361, 607, -1, 6903 }},
+    {{ -1, 619, 1644, 6904 }},
+    {{ -1, 4368, 4191, -1 }},
+    {{ -1, 6906, 12, 86 }},
+    {{ 630, 634, -1, 6907 }},
+    {{ -1, 4371, 81, -1 }},
+    {{ 96, 6909, 30, -1 }},
+    {{ 100, 794, -1, 6910 }},
+    {{ -1, 4469, 935, -1 }},
+    {{ 685, 4485, -1, 1849 }},
+    {{ -1, 6913, 4538, 1987 }},
+    {{ 6914, 4532, -1, 1972 }},
+    {{ 855, 6915, 862, -1 }},
+    {{ 4525, 4528, -1, -1 }},
+    {{ 531, 6917, 4576, -1 }},
+    {{ 546, 6918, -1, 6921 }},
+    {{ 4546, 4550, -1, 6919 }},
+    {{ -1, 3796, 3804, 6920 }},
+    {{ -1, 4556, 466, -1 }},
+    {{ -1, 6922, 2157, 2406 }},
+    {{ 4559, 4563, -1, 6923 }},
+    {{ -1, 4567, 206, -1 }},
+    {{ 577, 6925, 592, -1 }},
+    {{ 4585, 4590, -1, 6926 }},
+    {{ -1, 4011, 74, 6927 }},
+    {{ -1, 4597, 2638, -1 }},
+    {{ 4631, 4632, -1, 1856 }},
+    {{ 715, 4653, -1, 1860 }},
+    {{ 6931, -1, 4737, 6936 }},
+    {{ 4701, 6932, 4732, -1 }},
+    {{ 4583, 6933, -1, 2423 }},
+    {{ 697, 6934, -1, 2421 }},
+    {{ 4710, 4711, -1, 6935 }},
+    {{ -1, 4715, 615, -1 }},
+    {{ -1, 6937, 4784, 4789 }},
+    {{ 2428, 6938, -1, 4778 }},
+    {{ 6939, 4772, -1, 4894 }},
+    {{ 753, 6940, 5194, -1 }},
+    {{ 741, 4767, -1, -1 }},
+    {{ 770, 6942, 784, -1 }},
+    {{ 4806, 4810, -1, 6943 }},
+    {{ -1, 4815, -1, -1 }},
+    {{ 747, 4839, -1, 1866 }},
+    {{ 752, 6946, -1, 1879 }},
+    {{ 6947, 4449, -1, 2200 }},
+    {{ 4884, 6948, 1001, -1 }},
+    {{ 4888, 2981, -1, -1 }},
+    {{ 2433, -1, 4931, 1889 }},
+    {{ -1, 6951, 1895, 4999 }},
+    {{ 6952, 4972, -1, 5511 }},
+    {{ 6953, 4959, 4967, -1 }},
+    {{ 856, 6954, 1270, -1 }},
+    {{ 769, 4955, -1, -1 }},
+    {{ 96, 6956, 30, -1 }},
+    {{ 6957, 6960, -1, 4468 }},
+    {{ 788, 6958, 101, -1 }},
+    {{ 5090, 4606, -1, 6959 }},
+    {{ -1, 352, -1, 5098 }},
+    {{ 6961, 5119, -1, 799 }},
+    {{ 5110, 4547, 6962, -1 }},
+    {{ 5116, -1, 797, -1 }},
+    {{ 5144, 6964, 5163, -1 }},
+    {{ 5155, 5159, -1, 6965 }},
+    {{ -1, 2344, -1, -1 }},
+    {{ 5172, 5176, 758, -1 }},
+    {{ 5180, 2547, -1, 6968 }},
+    {{ -1, 2570, -1, 2584 }},
+    {{ -1, 6970, 1929, 1934 }},
+    {{ 6971, 1922, -1, 1926 }},
+    {{ 6972, 4504, 246, -1 }},
+    {{ 5257, 6973, 6342, -1 }},
+    {{ 5260, 891, -1, -1 }},
+    {{ 1075, 6975, 5317, -1 }},
+    {{ 1087, 6976, -1, 6978 }},
+    {{ 5305, 5306, -1, 6977 }},
+    {{ -1, 4715, 3804, -1 }},
+    {{ -1, 6979, 2157, 561 }},
+    {{ 5312, 5313, -1, -1 }},
+    {{ 1107, 6981, 1119, -1 }},
+    {{ 5325, 5329, -1, 6982 }},
+    {{ -1, 5333, -1, -1 }},
+    {{ 747, 5337, -1, 1888 }},
+    {{ 6985, -1, 5385, 1961 }},
+    {{ 5370, 6986, 1185, -1 }},
+    {{ 7024, 6987, -1, 1958 }},
+    {{ 1175, 6988, -1, 705 }},
+    {{ 844, 5377, -1, -1 }},
+    {{ -1, 6990, 6999, 1987 }},
+    {{ 6991, 6995, -1, 1972 }},
+    {{ 855, 6992, 862, -1 }},
+    {{ 6993, 4528, -1, 7609 }},
+    {{ 5473, 6994, 7601, -1 }},
+    {{ 5478, 3744, -1, -1 }},
+    {{ 6996, 7703, -1, 7709 }},
+    {{ 6997, 4536, 5500, -1 }},
+    {{ 5496, 6998, 7674, -1 }},
+    {{ 4856, 304, -1, -1 }},
+    {{ 7000, -1, 1977, 1982 }},
+    {{ 7001, 255, 5527, -1 }},
+    {{ 1303, 7002, 1313, -1 }},
+    {{ 1307, 7003, -1, 6698 }},
+    {{ 724, 5519, -1, -1 }},
+    {{ 531, 7005, 7018, -1 }},
+    {{ 546, 7006, -1, 7011 }},
+    {{ 7007, 7008, -1, 4554 }},
+    {{ 3767, 4482, 557, -1 }},
+    {{ 7009, 3090, -1, 3790 }},
+    {{ 3062, 3069, 7010, -1 }},
+    {{ 3005, -1, 3784, 704 }},
+    {{ -1, 7012, 2157, 7014 }},
+    {{ 5312, 7013, -1, 4566 }},
+    {{ 5314, 3332, -1, 1682 }},
+    {{ -1, 7015, 1450, 2162 }},
+    {{ 7016, 4573, -1, 563 }},
+    {{ 514, 7017, 220, -1 }},
+    {{ 3552, 919, -1, -1 }},
+    {{ 565, -1, 570, 7019 }},
+    {{ -1, 69, 3912, 7020 }},
+    {{ -1, 7021, 3931, 1530 }},
+    {{ 854, 7022, -1, 1521 }},
+    {{ 3923, 7023, -1, 2168 }},
+    {{ -1, 6176, -1, 3929 }},
+    {{ 577, 7025, 592, -1 }},
+    {{ 7026, 7030, -1, 4595 }},
+    {{ 326, 7027, 3983, -1 }},
+    {{ 2473, 2482, -1, 7028 }},
+    {{ -1, 352, 7029, 3980 }},
+    {{ 2488, -1, -1, 3978 }},
+    {{ 7031, 4000, -1, 587 }},
+    {{ 2523, 2534, 7032, -1 }},
+    {{ 2539, -1, 341, 7033 }},
+    {{ -1, 8, -1, 3998 }},
+    {{ 4052, 7035, 7038, -1 }},
+    {{ 299, 304, -1, 7036 }},
+    {{ -1, 2344, 7037, 1110 }},
+    {{ 24, -1, 4059, -1 }},
+    {{ 312, -1, 4064, 7039 }},
+    {{ -1, 493, 2976, 600 }},
+    {{ 326, 331, 7041, -1 }},
+    {{ 2498, -1, 4073, 7042 }},
+    {{ -1, 8, 4076, -1 }},
+    {{ 7044, -1, 4101, 78 }},
+    {{ 360, 7045, 4097, -1 }},
+    {{ 370, 2702, -1, 7046 }},
+    {{ -1, 79, 4093, -1 }},
+    {{ 285, 2960, 7048, -1 }},
+    {{ 312, -1, 4110, 7049 }},
+    {{ -1, 2007, 4113, -1 }},
+    {{ 7051, 3090, -1, 7054 }},
+    {{ 3062, 3069, 7052, -1 }},
+    {{ 3005, -1, 7053, 704 }},
+    {{ 423, -1, 4131, -1 }},
+    {{ -1, 3115, 7055, 3138 }},
+    {{ 1878, -1, 4142, 3132 }},
+    {{ -1, 7057, 615, 4628 }},
+    {{ 4492, 3162, -1, 4627 }},
+    {{ 876, 7059, 3282, -1 }},
+    {{ 887, 891, -1, 7060 }},
+    {{ -1, 5682, -1, -1 }},
+    {{ 920, 5812, -1, 7062 }},
+    {{ -1, 5823, -1, 5832 }},
+    {{ -1, 7064, 2182, 2187 }},
+    {{ 7065, 2174, -1, 2178 }},
+    {{ 7066, 4670, 279, -1 }},
+    {{ 1263, 7067, 515, -1 }},
+    {{ 1267, 7568, -1, -1 }},
+    {{ 668, -1, 4419, 7069 }},
+    {{ -1, 7070, 4454, 4460 }},
+    {{ 678, 7071, -1, 4900 }},
+    {{ 752, 7072, -1, 1879 }},
+    {{ 4446, 7073, -1, 2200 }},
+    {{ -1, 3090, -1, 4452 }},
+    {{ -1, 7075, 1929, 1934 }},
+    {{ 7076, 1922, -1, 1926 }},
+    {{ 4501, 7077, 246, -1 }},
+    {{ -1, 919, -1, 6357 }},
+    {{ -1, 7079, 4538, 1987 }},
+    {{ 7080, 7083, -1, 1972 }},
+    {{ 855, 7081, 862, -1 }},
+    {{ 4525, 7082, -1, 7609 }},
+    {{ -1, 5812, -1, 4531 }},
+    {{ 7084, 7703, -1, 7709 }},
+    {{ 4534, 7085, 5500, -1 }},
+    {{ -1, 6085, -1, 983 }},
+    {{ 531, 7087, 4576, -1 }},
+    {{ 546, 4545, -1, 7088 }},
+    {{ -1, 4558, 2157, 7089 }},
+    {{ -1, 7090, 1450, 2162 }},
+    {{ 4570, 7091, -1, 563 }},
+    {{ -1, 7703, -1, 4050 }},
+    {{ 697, 7093, -1, 7098 }},
+    {{ 7094, 7095, -1, 4714 }},
+    {{ 4614, 4682, 703, -1 }},
+    {{ 7096, 3090, -1, 4621 }},
+    {{ 3062, 3069, 7097, -1 }},
+    {{ 3005, -1, 4620, -1 }},
+    {{ -1, 7099, 1644, 626 }},
+    {{ 7100, 4721, -1, 707 }},
+    {{ 4161, 7101, 621, -1 }},
+    {{ 3292, 919, -1, -1 }},
+    {{ -1, 7103, 2182, 2187 }},
+    {{ 7104, 2174, -1, 2178 }},
+    {{ 4667, 7105, 279, -1 }},
+    {{ -1, 919, -1, 7609 }},
+    {{ 83, -1, 4673, 7107 }},
+    {{ -1, 7108, 689, 4691 }},
+    {{ 4466, 7109, -1, 4686 }},
+    {{ 681, 7110, -1, 283 }},
+    {{ 724, 7073, -1, 687 }},
+    {{ 7112, -1, 4737, 7121 }},
+    {{ 4701, 7113, 4732, -1 }},
+    {{ 4583, 7114, -1, 7118 }},
+    {{ 697, 4709, -1, 7115 }},
+    {{ -1, 7116, 1644, 626 }},
+    {{ 4719, 7117, -1, 707 }},
+    {{ -1, 3332, -1, 4050 }},
+    {{ -1, 7119, 12, 4728 }},
+    {{ 711, 7120, -1, 80 }},
+    {{ 731, 7023, -1, 717 }},
+    {{ -1, 7122, 4784, 4789 }},
+    {{ 7123, 7126, -1, 4778 }},
+    {{ 4804, 7124, 15, -1 }},
+    {{ 92, 7125, -1, 802 }},
+    {{ 737, 7073, -1, 749 }},
+    {{ 7127, 7130, -1, 4894 }},
+    {{ 753, 7128, 5194, -1 }},
+    {{ 741, 7129, -1, 4878 }},
+    {{ -1, 2547, -1, 4770 }},
+    {{ 7131, 4889, -1, 4892 }},
+    {{ 4774, 7132, 1001, -1 }},
+    {{ -1, 2981, -1, 4117 }},
+    {{ 7134, 4889, -1, 4892 }},
+    {{ 7135, 4777, 1001, -1 }},
+    {{ 285, 7136, 6154, -1 }},
+    {{ 299, 304, -1, -1 }},
+    {{ -1, 7138, 4912, 5295 }},
+    {{ 7139, 1027, -1, 1032 }},
+    {{ 7140, 6351, 4908, -1 }},
+    {{ 4904, 7141, 6342, -1 }},
+    {{ -1, 891, -1, 6338 }},
+    {{ 7143, -1, 4931, 4937 }},
+    {{ 4922, 7144, 5352, -1 }},
+    {{ 5323, 7145, -1, 4927 }},
+    {{ 106, 7146, -1, 1134 }},
+    {{ 737, 7073, -1, 837 }},
+    {{ -1, 7148, 4985, 4999 }},
+    {{ 7149, 7156, -1, 5511 }},
+    {{ 7150, 7153, 4967, -1 }},
+    {{ 856, 7151, 1270, -1 }},
+    {{ 769, 7152, -1, 5467 }},
+    {{ -1, 5669, -1, 4957 }},
+    {{ 7154, 919, -1, 7609 }},
+    {{ 4961, 7155, 7601, -1 }},
+    {{ -1, 3744, -1, 914 }},
+    {{ 7157, 7703, -1, 7709 }},
+    {{ 7158, 982, 4981, -1 }},
+    {{ 4975, 7159, 7674, -1 }},
+    {{ -1, 304, -1, 6067 }},
+    {{ 770, 7161, 784, -1 }},
+    {{ 7162, 7165, -1, 4814 }},
+    {{ 5029, 7163, 779, -1 }},
+    {{ 37, 1552, -1, 7164 }},
+    {{ -1, 352, -1, 5036 }},
+    {{ 7166, 5046, -1, 782 }},
+    {{ 1593, 1598, 7167, -1 }},
+    {{ 3005, -1, 3423, -1 }},
+    {{ 2213, 7169, 7171, -1 }},
+    {{ 2237, 2243, -1, 7170 }},
+    {{ -1, 2256, -1, -1 }},
+    {{ 2265, -1, 2275, 1222 }},
+    {{ 2315, 2328, -1, 7173 }},
+    {{ -1, 1633, -1, 2339 }},
+    {{ 7175, -1, 5169, 6078 }},
+    {{ 2368, 7176, 5168, -1 }},
+    {{ 2381, 2386, -1, -1 }},
+    {{ -1, 822, 7178, 5245 }},
+    {{ 7179, -1, 5235, 5240 }},
+    {{ 7180, 19, 125, -1 }},
+    {{ 5230, 7181, 6254, -1 }},
+    {{ -1, 3420, -1, 6698 }},
+    {{ -1, 7183, 7191, 5295 }},
+    {{ 7184, 1027, -1, 1032 }},
+    {{ 7185, 6351, 7188, -1 }},
+    {{ 7186, 4906, 6342, -1 }},
+    {{ 5584, 7187, 883, -1 }},
+    {{ 5603, 5608, -1, -1 }},
+    {{ 7189, -1, 130, 6376 }},
+    {{ 5263, 7190, 6365, -1 }},
+    {{ -1, 5919, -1, 2031 }},
+    {{ 7192, -1, 5285, 1053 }},
+    {{ 7193, 7196, 5280, -1 }},
+    {{ 1037, 7194, 134, -1 }},
+    {{ 831, 7195, -1, 6698 }},
+    {{ -1, 6689, -1, 6695 }},
+    {{ 7197, 142, -1, 20 }},
+    {{ 5274, 7198, 6471, -1 }},
+    {{ -1, 1116, -1, 141 }},
+    {{ 1075, 7200, 5317, -1 }},
+    {{ 1087, 5304, -1, 7201 }},
+    {{ -1, 7202, 2157, 561 }},
+    {{ 5312, 7203, -1, 6703 }},
+    {{ -1, 3332, -1, 5315 }},
+    {{ -1, 7205, -1, 1138 }},
+    {{ 7206, 634, -1, 80 }},
+    {{ 5348, 7207, 1671, -1 }},
+    {{ -1, 4204, -1, 632 }},
+    {{ 7209, -1, 5385, 5391 }},
+    {{ 5370, 7210, 1185, -1 }},
+    {{ 7024, 7211, -1, 5380 }},
+    {{ 1175, 7212, -1, 705 }},
+    {{ 844, 7213, -1, 7056 }},
+    {{ -1, 3090, -1, 5378 }},
+    {{ -1, 7215, 5426, 5436 }},
+    {{ 7216, 7223, -1, 1230 }},
+    {{ 7217, 7220, 5414, -1 }},
+    {{ 1218, 7218, 1227, -1 }},
+    {{ 850, 7219, -1, -1 }},
+    {{ -1, 4943, -1, -1 }},
+    {{ 7221, 794, -1, 802 }},
+    {{ 5408, 7222, 7307, -1 }},
+    {{ -1, 4606, -1, 792 }},
+    {{ 7224, 816, -1, 7340 }},
+    {{ 7225, 812, 5424, -1 }},
+    {{ 5420, 7226, 7326, -1 }},
+    {{ -1, 5159, -1, 810 }},
+    {{ 7228, 919, -1, 7609 }},
+    {{ 7229, 4964, 7601, -1 }},
+    {{ 5748, 7136, 910, -1 }},
+    {{ 7231, -1, 5488, 16 }},
+    {{ 1277, 7232, 168, -1 }},
+    {{ 865, 7233, -1, 2031 }},
+    {{ -1, 607, -1, 618 }},
+    {{ 7235, 7703, -1, 7709 }},
+    {{ 7236, 982, 7239, -1 }},
+    {{ 7237, 4978, 7674, -1 }},
+    {{ 2213, 7238, 294, -1 }},
+    {{ 2237, 2243, -1, -1 }},
+    {{ 7240, -1, 5507, 7700 }},
+    {{ 5502, 7241, 7684, -1 }},
+    {{ -1, 2702, -1, 2031 }},
+    {{ 7243, -1, 5533, 5547 }},
+    {{ 7244, 7248, 5527, -1 }},
+    {{ 1303, 7245, 1313, -1 }},
+    {{ 1307, 7246, -1, 6698 }},
+    {{ 724, 7247, -1, 7789 }},
+    {{ -1, 3090, -1, 5520 }},
+    {{ 7249, 7252, -1, 20 }},
+    {{ 1317, 7250, 1326, -1 }},
+    {{ 874, 7251, -1, -1 }},
+    {{ -1, 4995, -1, -1 }},
+    {{ 7253, 1128, -1, 1134 }},
+    {{ 5525, 7254, 7840, -1 }},
+    {{ -1, 4606, -1, 1126 }},
+    {{ -1, 7256, 5573, 8056 }},
+    {{ 7257, 7988, -1, 8002 }},
+    {{ 7258, 7973, 5567, -1 }},
+    {{ 7259, 1266, 5563, -1 }},
+    {{ 5557, 7260, 7962, -1 }},
+    {{ -1, 7556, -1, 1265 }},
+    {{ 1364, 7262, 7265, -1 }},
+    {{ 1393, 1408, -1, 7263 }},
+    {{ -1, 204, 773, 7264 }},
+    {{ -1, 1445, -1, -1 }},
+    {{ 1464, -1, 1479, 7266 }},
+    {{ -1, 493, 247, 494 }},
+    {{ 1409, 1616, -1, 7268 }},
+    {{ -1, 1633, 7269, 7270 }},
+    {{ 1645, -1, -1, -1 }},
+    {{ -1, 1660, -1, 3269 }},
+    {{ 1665, 1676, -1, 7272 }},
+    {{ -1, 3348, -1, 1690 }},
+    {{ 1780, 3592, 5630, -1 }},
+    {{ 5632, -1, 1850, 7275 }},
+    {{ -1, 7276, 1883, 1894 }},
+    {{ 1869, -1, -1, 4900 }},
+    {{ 37, 1552, -1, 7278 }},
+    {{ -1, 352, 5965, 7279 }},
+    {{ -1, 2632, -1, 1766 }},
+    {{ 46, -1, 390, 7281 }},
+    {{ -1, -1, 402, 2039 }},
+    {{ 1593, 1598, 7283, -1 }},
+    {{ 3005, -1, 797, 4827 }},
+    {{ 1617, 3090, -1, 7285 }},
+    {{ -1, 3115, 7286, 3138 }},
+    {{ 1628, -1, -1, 3132 }},
+    {{ -1, 1660, 7288, 3269 }},
+    {{ -1, -1, 3259, 3616 }},
+    {{ 531, 7290, 5711, -1 }},
+    {{ 546, 555, -1, 7291 }},
+    {{ -1, 3814, 3018, -1 }},
+    {{ 76, 607, -1, 7293 }},
+    {{ -1, 619, -1, -1 }},
+    {{ 7295, -1, 5731, 5737 }},
+    {{ 5725, 7296, 2969, -1 }},
+    {{ 4583, 2135, -1, 908 }},
+    {{ 7298, 794, -1, 802 }},
+    {{ 7299, 7303, 7307, -1 }},
+    {{ 5079, 7300, 789, -1 }},
+    {{ 299, 304, -1, 7301 }},
+    {{ -1, 2344, 7302, 4601 }},
+    {{ 24, -1, 5086, -1 }},
+    {{ 7304, 4606, -1, 792 }},
+    {{ 326, 331, 7305, -1 }},
+    {{ 2498, -1, 5092, 7306 }},
+    {{ -1, 8, 5095, -1 }},
+    {{ 7308, -1, 7309, -1 }},
+    {{ 360, 5101, 3599, -1 }},
+    {{ 7310, -1, 5793, 401 }},
+    {{ 380, 7311, 5792, -1 }},
+    {{ 2777, 2788, -1, -1 }},
+    {{ 7313, -1, 118, 16 }},
+    {{ 939, 7314, 116, -1 }},
+    {{ 7315, 7316, -1, 2031 }},
+    {{ 5915, 5483, 948, -1 }},
+    {{ 7317, 607, -1, 618 }},
+    {{ 597, 601, 7318, -1 }},
+    {{ 4090, -1, 5922, -1 }},
+    {{ 7320, 816, -1, 7340 }},
+    {{ 7321, 812, 7332, -1 }},
+    {{ 7322, 7325, 7326, -1 }},
+    {{ 2213, 7323, 5151, -1 }},
+    {{ 2237, 2243, -1, 7324 }},
+    {{ -1, 2256, 773, 5149 }},
+    {{ 4856, 5159, -1, 810 }},
+    {{ 7327, -1, 7329, 6078 }},
+    {{ 2368, 5165, 7328, -1 }},
+    {{ 83, -1, 2398, 1273 }},
+    {{ 7330, -1, 6075, 2431 }},
+    {{ 2403, 7331, 3076, -1 }},
+    {{ 4583, 2408, -1, -1 }},
+    {{ 7333, -1, 988, 995 }},
+    {{ 7334, 5504, 7337, -1 }},
+    {{ 2648, 5503, 7335, -1 }},
+    {{ 565, -1, 2668, 7336 }},
+    {{ -1, -1, 2680, 367 }},
+    {{ 7338, -1, 6108, 43 }},
+    {{ 657, 7339, 6105, -1 }},
+    {{ 4346, 2710, -1, -1 }},
+    {{ -1, 822, 7341, 5245 }},
+    {{ 7342, -1, 7346, 5240 }},
+    {{ 7343, 19, 125, -1 }},
+    {{ 7344, 5232, 6254, -1 }},
+    {{ 3376, 7345, 491, -1 }},
+    {{ 3390, 3394, -1, -1 }},
+    {{ 7347, -1, 2147, 6280 }},
+    {{ 7348, 3489, 6276, -1 }},
+    {{ 6265, 7349, 1021, -1 }},
+    {{ -1, 3481, -1, 7011 }},
+    {{ 7351, 1027, -1, 1032 }},
+    {{ 5256, 6351, 7352, -1 }},
+    {{ 7353, -1, 130, 6376 }},
+    {{ 7354, 5265, 6365, -1 }},
+    {{ 5889, 7355, 942, -1 }},
+    {{ 5899, 5903, -1, -1 }},
+    {{ 7357, 142, -1, 20 }},
+    {{ 7358, 5277, 6471, -1 }},
+    {{ 6765, 7359, 1111, -1 }},
+    {{ 5155, 6771, -1, -1 }},
+    {{ 7361, -1, 1152, 1163 }},
+    {{ 6476, 7362, 6484, -1 }},
+    {{ 6480, 7363, -1, 1052 }},
+    {{ -1, 6893, -1, 4366 }},
+    {{ 7365, -1, 1190, 6512 }},
+    {{ 7366, 7369, 1185, -1 }},
+    {{ 6491, 7367, 6500, -1 }},
+    {{ 6495, 7368, -1, 7011 }},
+    {{ -1, 7008, -1, 4554 }},
+    {{ 7370, 1174, -1, 1181 }},
+    {{ 6503, 7371, 6509, -1 }},
+    {{ -1, 7030, -1, 4595 }},
+    {{ -1, 1059, 7373, 6608 }},
+    {{ 7374, -1, 6595, 6602 }},
+    {{ 7375, 1072, 7846, -1 }},
+    {{ 7376, 1306, 6587, -1 }},
+    {{ 6576, 7377, 1071, -1 }},
+    {{ -1, 7773, -1, 1077 }},
+    {{ 1075, 7379, 7388, -1 }},
+    {{ 1087, 7380, -1, 7385 }},
+    {{ 7381, 7382, -1, 5309 }},
+    {{ 6686, 4682, 1096, -1 }},
+    {{ 7383, 3090, -1, 6693 }},
+    {{ 3062, 3069, 7384, -1 }},
+    {{ 3005, -1, 6692, -1 }},
+    {{ -1, 7386, 2157, 561 }},
+    {{ 7387, 5313, -1, 6703 }},
+    {{ 3276, 7101, 1671, -1 }},
+    {{ 1097, -1, 1101, 7389 }},
+    {{ -1, 7390, 6745, 6756 }},
+    {{ 29, 7391, -1, -1 }},
+    {{ 6740, 7392, -1, 1106 }},
+    {{ -1, 5211, -1, 1910 }},
+    {{ 1107, 7394, 1119, -1 }},
+    {{ 7395, 7398, -1, 5332 }},
+    {{ 5172, 7396, 1114, -1 }},
+    {{ 2473, 2482, -1, 7397 }},
+    {{ -1, 352, -1, 6785 }},
+    {{ 7399, 6791, -1, 1117 }},
+    {{ 2523, 2534, 7400, -1 }},
+    {{ 2539, -1, 5182, -1 }},
+    {{ -1, 7402, -1, 1138 }},
+    {{ 7403, 634, -1, 80 }},
+    {{ 7404, 5351, 1671, -1 }},
+    {{ 876, 7405, 3282, -1 }},
+    {{ 887, 891, -1, -1 }},
+    {{ 7407, -1, 1152, 7412 }},
+    {{ 1142, 7408, 1148, -1 }},
+    {{ 6878, 6887, -1, 7409 }},
+    {{ -1, 7410, 12, -1 }},
+    {{ 6895, 7411, -1, 1147 }},
+    {{ -1, 4220, -1, 638 }},
+    {{ -1, 7413, 1168, 6989 }},
+    {{ 7414, 7417, -1, 6969 }},
+    {{ 96, 7415, 30, -1 }},
+    {{ 6957, 7416, -1, 4468 }},
+    {{ -1, 5119, -1, 799 }},
+    {{ 7418, 684, -1, 283 }},
+    {{ 6963, 7419, 5194, -1 }},
+    {{ -1, 5369, -1, -1 }},
+    {{ 531, 7421, 7018, -1 }},
+    {{ 546, 7006, -1, 7422 }},
+    {{ -1, 7423, 2157, 7014 }},
+    {{ 5312, 7424, -1, 4566 }},
+    {{ -1, 3332, -1, 1682 }},
+    {{ -1, 7426, 12, 7063 }},
+    {{ 7427, 714, -1, 80 }},
+    {{ 7058, 7428, 1671, -1 }},
+    {{ -1, 5384, -1, -1 }},
+    {{ 7430, -1, 7111, 1196 }},
+    {{ 7086, 7431, 7106, -1 }},
+    {{ 4583, 7432, -1, 1193 }},
+    {{ 697, 7433, -1, 7098 }},
+    {{ 7094, 7434, -1, 4714 }},
+    {{ -1, 3090, -1, 4621 }},
+    {{ -1, 7436, 1208, 1213 }},
+    {{ 7437, 7441, -1, 7182 }},
+    {{ 7438, 153, 15, -1 }},
+    {{ 770, 7439, 784, -1 }},
+    {{ 7162, 7440, -1, 4814 }},
+    {{ -1, 5046, -1, 782 }},
+    {{ 7442, 4882, -1, 7177 }},
+    {{ 7443, 756, 5194, -1 }},
+    {{ 7168, 7444, 7174, -1 }},
+    {{ -1, 5401, -1, -1 }},
+    {{ 7446, 794, -1, 802 }},
+    {{ 7447, 5411, 7307, -1 }},
+    {{ 5079, 7136, 789, -1 }},
+    {{ 7449, -1, 118, 16 }},
+    {{ 939, 7450, 116, -1 }},
+    {{ 7315, 7233, -1, 2031 }},
+    {{ 7452, 816, -1, 7340 }},
+    {{ 7453, 812, 7455, -1 }},
+    {{ 7454, 5423, 7326, -1 }},
+    {{ 2213, 7238, 5151, -1 }},
+    {{ 7456, -1, 988, 995 }},
+    {{ 7334, 7241, 7337, -1 }},
+    {{ 7458, -1, 1235, 1240 }},
+    {{ 7459, 7463, 7406, -1 }},
+    {{ 1075, 7460, 7388, -1 }},
+    {{ 1087, 7461, -1, 7385 }},
+    {{ 7381, 7462, -1, 5309 }},
+    {{ -1, 3090, -1, 6693 }},
+    {{ 7464, 162, -1, 7401 }},
+    {{ 1107, 7465, 1119, -1 }},
+    {{ 7395, 7466, -1, 5332 }},
+    {{ -1, 6791, -1, 1117 }},
+    {{ -1, 7468, 1254, 7525 }},
+    {{ 7469, 7486, -1, 7493 }},
+    {{ 7470, 5471, 1251, -1 }},
+    {{ 7471, 859, 1270, -1 }},
+    {{ 7473, 7472, 7480, -1 }},
+    {{ -1, 5442, -1, -1 }},
+    {{ 1364, 7474, 7476, -1 }},
+    {{ 1393, 1408, -1, 7475 }},
+    {{ -1, 204, -1, -1 }},
+    {{ 1464, -1, 1479, 7477 }},
+    {{ -1, -1, 247, 5600 }},
+    {{ 1409, 1616, -1, 7479 }},
+    {{ -1, 1633, -1, 5615 }},
+    {{ 7481, -1, 7562, 884 }},
+    {{ 1780, 6584, 7561, -1 }},
+    {{ 7483, -1, 962, 969 }},
+    {{ 7654, 7484, 7665, -1 }},
+    {{ 7659, 7485, -1, -1 }},
+    {{ -1, 701, -1, 5972 }},
+    {{ 7487, 7703, -1, 7709 }},
+    {{ 5495, 982, 7488, -1 }},
+    {{ 7489, -1, 7490, 7700 }},
+    {{ 3597, 5504, 7684, -1 }},
+    {{ 7491, -1, 992, 2092 }},
+    {{ 7691, 7492, 1294, -1 }},
+    {{ -1, 2788, -1, 48 }},
+    {{ -1, 7721, 7494, 7758 }},
+    {{ 7495, -1, 7748, 1053 }},
+    {{ 7496, 7738, 7743, -1 }},
+    {{ 7497, 1042, 134, -1 }},
+    {{ 7732, 7498, 1301, -1 }},
+    {{ -1, 5518, -1, -1 }},
+    {{ 7500, 1128, -1, 1134 }},
+    {{ 7501, 5526, 7840, -1 }},
+    {{ 5079, 7136, 1123, -1 }},
+    {{ 7503, -1, 1152, 7858 }},
+    {{ 1142, 7504, 1148, -1 }},
+    {{ 6878, 7505, -1, 7854 }},
+    {{ 7850, 7506, -1, 4366 }},
+    {{ -1, 4127, -1, 614 }},
+    {{ 7508, -1, 7899, 7906 }},
+    {{ 7509, 7513, 1185, -1 }},
+    {{ 3473, 7510, 3484, -1 }},
+    {{ 546, 7511, -1, 7875 }},
+    {{ 7871, 7512, -1, 4554 }},
+    {{ -1, 3090, -1, 3790 }},
+    {{ 7514, 7517, -1, 7896 }},
+    {{ 7878, 7515, 3501, -1 }},
+    {{ 7880, 7516, -1, 4595 }},
+    {{ -1, 4000, -1, 587 }},
+    {{ 7518, 1178, -1, 705 }},
+    {{ 7886, 7519, 7893, -1 }},
+    {{ -1, 5546, -1, -1 }},
+    {{ -1, 7521, 7941, 7952 }},
+    {{ 7522, 7931, -1, 1230 }},
+    {{ 7523, 7923, 7927, -1 }},
+    {{ 7524, 158, 1227, -1 }},
+    {{ 7732, 7472, 1341, -1 }},
+    {{ -1, 7526, 7539, 8056 }},
+    {{ 7527, 7988, -1, 8002 }},
+    {{ 7528, 7973, 7535, -1 }},
+    {{ 7529, 1266, 7532, -1 }},
+    {{ 7530, 5560, 7962, -1 }},
+    {{ 1364, 7531, 7554, -1 }},
+    {{ 1393, 1408, -1, -1 }},
+    {{ 7533, -1, 1274, 5742 }},
+    {{ 7968, 7534, 938, -1 }},
+    {{ -1, 5716, -1, 900 }},
+    {{ 7536, -1, 7983, 16 }},
+    {{ 7537, 1282, 168, -1 }},
+    {{ 7979, 7538, 1352, -1 }},
+    {{ -1, 5572, -1, -1 }},
+    {{ 7540, -1, 8037, 8051 }},
+    {{ 7541, 7547, 8031, -1 }},
+    {{ 7542, 7545, 1313, -1 }},
+    {{ 8008, 7543, 8017, -1 }},
+    {{ 8012, 7544, -1, 1077 }},
+    {{ -1, 1616, -1, 6648 }},
+    {{ 7546, 1310, -1, 6698 }},
+    {{ 8018, 7519, 8021, -1 }},
+    {{ 7548, 8027, -1, 20 }},
+    {{ 7549, 173, 1326, -1 }},
+    {{ 8023, 7444, 1363, -1 }},
+    {{ 1364, 7551, 7554, -1 }},
+    {{ 1393, 1408, -1, 7552 }},
+    {{ -1, 204, 3379, 7553 }},
+    {{ -1, 1445, 3382, 5593 }},
+    {{ 1464, -1, 1479, 7555 }},
+    {{ -1, 3385, 247, 5600 }},
+    {{ 1409, 1616, -1, 7557 }},
+    {{ -1, 1633, 7558, 5615 }},
+    {{ 1645, -1, 3397, 5613 }},
+    {{ 7560, -1, 7562, 884 }},
+    {{ 1780, 3400, 7561, -1 }},
+    {{ 83, -1, 1813, 903 }},
+    {{ 7563, -1, 1850, 5634 }},
+    {{ 1825, 7564, 1844, -1 }},
+    {{ 4583, 1831, -1, 908 }},
+    {{ 37, 1552, -1, 7566 }},
+    {{ -1, 352, 7567, 5651 }},
+    {{ 2608, -1, 550, 5649 }},
+    {{ 7569, 5669, -1, 7572 }},
+    {{ 1593, 1598, 7570, -1 }},
+    {{ 3005, -1, 3423, 7571 }},
+    {{ -1, 8, 559, 5667 }},
+    {{ -1, 1633, 7573, 5678 }},
+    {{ 5050, -1, 894, 3218 }},
+    {{ -1, 7575, 7578, 5697 }},
+    {{ 7576, 1676, -1, 5689 }},
+    {{ 3276, 1666, 7577, -1 }},
+    {{ 3304, -1, 5058, 5687 }},
+    {{ 24, -1, 7579, -1 }},
+    {{ 7580, -1, 5694, 896 }},
+    {{ 3472, 3489, 5705, -1 }},
+    {{ 531, 7582, 7584, -1 }},
+    {{ 546, 555, -1, 7583 }},
+    {{ -1, 3814, 773, 5709 }},
+    {{ 565, -1, 570, 2619 }},
+    {{ 7586, 5716, -1, 900 }},
+    {{ 577, 72, 7587, -1 }},
+    {{ 593, -1, 4040, 7588 }},
+    {{ -1, 4046, 1570, -1 }},
+    {{ 531, 7590, 4576, -1 }},
+    {{ 546, 4545, -1, 7591 }},
+    {{ -1, 4558, 2157, -1 }},
+    {{ 7593, -1, 4737, 7595 }},
+    {{ 4701, 7594, 4732, -1 }},
+    {{ 4583, 965, -1, 430 }},
+    {{ -1, 7596, 4784, 4789 }},
+    {{ 1654, 738, -1, 4778 }},
+    {{ -1, 1487, 7598, 5739 }},
+    {{ 6136, -1, 4931, 2094 }},
+    {{ 7600, 919, -1, 7609 }},
+    {{ 909, 913, 7601, -1 }},
+    {{ 5778, -1, 7602, 7607 }},
+    {{ 7603, -1, 7605, 401 }},
+    {{ 380, 5789, 7604, -1 }},
+    {{ 2795, -1, 2802, 991 }},
+    {{ 7606, -1, 2837, 397 }},
+    {{ 2814, 994, 2832, -1 }},
+    {{ -1, 8, 7608, -1 }},
+    {{ 6350, -1, 5795, 918 }},
+    {{ -1, 931, 7610, 5874 }},
+    {{ 7611, -1, 7614, 5869 }},
+    {{ 63, 25, 7612, -1 }},
+    {{ 7613, -1, 5855, 1163 }},
+    {{ 1142, 1697, 5884, -1 }},
+    {{ 7615, -1, 5865, 260 }},
+    {{ 7616, 3489, 938, -1 }},
+    {{ 3473, 3478, 5888, -1 }},
+    {{ 3652, 7618, 7621, -1 }},
+    {{ 3675, 3686, -1, 7619 }},
+    {{ -1, 204, 3200, 7620 }},
+    {{ -1, 1445, -1, 3702 }},
+    {{ 3704, -1, 3709, 7622 }},
+    {{ -1, 493, 3725, 6436 }},
+    {{ 3731, 547, 3205, -1 }},
+    {{ 556, 3781, -1, 7625 }},
+    {{ -1, 3796, 7626, 3807 }},
+    {{ 1645, -1, -1, 3805 }},
+    {{ 3872, -1, 3885, 7628 }},
+    {{ -1, 7629, 1883, 6444 }},
+    {{ 3891, -1, -1, -1 }},
+    {{ 3913, -1, 1955, 6446 }},
+    {{ 3935, 578, 7632, -1 }},
+    {{ 312, -1, 3964, 7633 }},
+    {{ -1, 584, 2439, -1 }},
+    {{ 4041, -1, 390, 6450 }},
+    {{ 7636, 607, -1, 618 }},
+    {{ 597, 601, 7637, -1 }},
+    {{ 4090, -1, 7638, 78 }},
+    {{ 4102, -1, 427, -1 }},
+    {{ 4323, 7640, 4336, -1 }},
+    {{ 546, 4328, -1, 7641 }},
+    {{ -1, 3814, 4332, -1 }},
+    {{ 4361, 607, -1, 7643 }},
+    {{ -1, 619, -1, 4367 }},
+    {{ 4374, -1, 4383, 7645 }},
+    {{ -1, 7646, 689, 6461 }},
+    {{ 4389, -1, -1, -1 }},
+    {{ 4396, 7648, 4413, -1 }},
+    {{ 4409, 2135, -1, 3194 }},
+    {{ 4420, -1, 4737, 7650 }},
+    {{ -1, 7651, 4784, 4789 }},
+    {{ 4434, -1, -1, 4778 }},
+    {{ 7653, -1, 962, 969 }},
+    {{ 7654, 7658, 7665, -1 }},
+    {{ 5951, 957, 7655, -1 }},
+    {{ 565, -1, 570, 7656 }},
+    {{ -1, 7657, 3912, 3022 }},
+    {{ 29, 5961, -1, -1 }},
+    {{ 7659, 7662, -1, -1 }},
+    {{ 577, 7660, 5966, -1 }},
+    {{ 4585, 4590, -1, 7661 }},
+    {{ -1, 4011, -1, 4596 }},
+    {{ 7663, 701, -1, 5972 }},
+    {{ 4598, 698, 7664, -1 }},
+    {{ 4610, -1, 4101, -1 }},
+    {{ 7666, -1, 3029, 960 }},
+    {{ 657, 7667, 662, -1 }},
+    {{ 4346, 5977, -1, 7668 }},
+    {{ -1, 5980, 12, -1 }},
+    {{ 7670, 7673, 7674, -1 }},
+    {{ 2213, 7671, 294, -1 }},
+    {{ 2237, 2243, -1, 7672 }},
+    {{ -1, 2256, 5147, 291 }},
+    {{ 5155, 304, -1, 6067 }},
+    {{ 312, -1, 7675, 7680 }},
+    {{ 7676, -1, 7677, 2431 }},
+    {{ 2403, 323, 2582, -1 }},
+    {{ 7678, -1, 4737, 2426 }},
+    {{ 4701, 7679, 4732, -1 }},
+    {{ 4583, 2420, -1, -1 }},
+    {{ -1, 2007, 7681, 6081 }},
+    {{ 6350, -1, 6080, 248 }},
+    {{ 7683, 5202, 7684, -1 }},
+    {{ 2648, 5197, 365, -1 }},
+    {{ 7685, -1, 7688, 43 }},
+    {{ 657, 2709, 7686, -1 }},
+    {{ 4374, -1, 4383, 7687 }},
+    {{ -1, -1, 689, 2725 }},
+    {{ 7689, -1, 2733, 375 }},
+    {{ 4396, 7690, 4413, -1 }},
+    {{ 4409, 670, -1, -1 }},
+    {{ 2758, 7692, 7694, -1 }},
+    {{ 546, 2762, -1, 7693 }},
+    {{ -1, 4558, -1, 383 }},
+    {{ 565, -1, 570, 5860 }},
+    {{ 7696, 2788, -1, 48 }},
+    {{ 577, 2778, 7697, -1 }},
+    {{ 593, -1, 4040, -1 }},
+    {{ 657, 7699, 662, -1 }},
+    {{ 4346, 2797, -1, -1 }},
+    {{ -1, 8, 7701, 6148 }},
+    {{ 7702, -1, 6144, 274 }},
+    {{ 6379, 1945, 998, -1 }},
+    {{ 7704, 6176, -1, 1005 }},
+    {{ 6153, 6158, 7705, -1 }},
+    {{ 3005, -1, 7706, 1002 }},
+    {{ 423, -1, 7707, 6169 }},
+    {{ 7708, -1, 6166, 3044 }},
+    {{ 3033, 429, 5831, -1 }},
+    {{ -1, 1013, 7710, 1022 }},
+    {{ 7711, -1, 7716, 6285 }},
+    {{ 7712, 19, 125, -1 }},
+    {{ 487, 495, 7713, -1 }},
+    {{ 7714, -1, 6258, 65 }},
+    {{ 3425, 500, 7715, -1 }},
+    {{ 83, -1, 1813, -1 }},
+    {{ 7717, -1, 2147, 6280 }},
+    {{ 7718, 3489, 6276, -1 }},
+    {{ 7719, 6269, 1021, -1 }},
+    {{ 3652, 7720, 6326, -1 }},
+    {{ 3675, 3686, -1, -1 }},
+    {{ 7722, 1027, -1, 1032 }},
+    {{ 7723, 6351, 7727, -1 }},
+    {{ 876, 6337, 7724, -1 }},
+    {{ 898, -1, 7725, 6348 }},
+    {{ 7726, -1, 6345, 5737 }},
+    {{ 5725, 907, 5831, -1 }},
+    {{ 7728, -1, 130, 6376 }},
+    {{ 939, 946, 7729, -1 }},
+    {{ 7730, -1, 6369, 117 }},
+    {{ 5924, 951, 7731, -1 }},
+    {{ 4374, -1, 4383, -1 }},
+    {{ 1364, 7474, 6579, -1 }},
+    {{ 1535, 6644, 5562, -1 }},
+    {{ 6646, 1616, -1, 7735 }},
+    {{ -1, 1633, -1, 1659 }},
+    {{ 1480, -1, 1850, 7737 }},
+    {{ -1, -1, 1883, -1 }},
+    {{ 7739, 142, -1, 20 }},
+    {{ 1107, 140, 7740, -1 }},
+    {{ 7741, -1, 6473, 2170 }},
+    {{ 6804, 1121, 7742, -1 }},
+    {{ 2708, -1, 374, -1 }},
+    {{ 7744, -1, 1152, 1163 }},
+    {{ 6476, 7745, 6484, -1 }},
+    {{ 7746, 6481, -1, 1052 }},
+    {{ 577, 7747, 6883, -1 }},
+    {{ 3974, 586, -1, -1 }},
+    {{ 7749, -1, 1190, 6512 }},
+    {{ 7750, 7754, 1185, -1 }},
+    {{ 6491, 7751, 6500, -1 }},
+    {{ 7752, 6497, -1, 7011 }},
+    {{ 3731, 7753, 551, -1 }},
+    {{ 37, 3744, -1, -1 }},
+    {{ 7755, 1174, -1, 1181 }},
+    {{ 7756, 6506, 6509, -1 }},
+    {{ 3935, 7757, 5482, -1 }},
+    {{ 299, 3946, -1, -1 }},
+    {{ -1, 1059, 7759, 6608 }},
+    {{ 7760, -1, 6595, 6602 }},
+    {{ 7761, 1072, 7846, -1 }},
+    {{ 7762, 1306, 6587, -1 }},
+    {{ 7763, 6581, 1071, -1 }},
+    {{ 1364, 7531, 6626, -1 }},
+    {{ 1364, 7765, 7767, -1 }},
+    {{ 1393, 1408, -1, 7766 }},
+    {{ -1, 204, 3379, 6637 }},
+    {{ 1464, -1, 1479, 7768 }},
+    {{ -1, 3385, 247, 7769 }},
+    {{ -1, 3388, 1525, 6641 }},
+    {{ 7771, 7773, -1, 1077 }},
+    {{ 1535, 7772, 3391, -1 }},
+    {{ 37, 1552, -1, 1089 }},
+    {{ 7774, 1616, -1, 6648 }},
+    {{ 1593, 1598, 7775, -1 }},
+    {{ 3005, -1, 1603, 798 }},
+    {{ 1480, -1, 1850, 7777 }},
+    {{ -1, 7778, 1883, 6660 }},
+    {{ 1869, 3406, -1, 6658 }},
+    {{ 285, 7780, 7781, -1 }},
+    {{ 299, 304, -1, 4474 }},
+    {{ 312, -1, 321, 7782 }},
+    {{ -1, 493, 2439, 5644 }},
+    {{ 7784, -1, 6678, 1092 }},
+    {{ 360, 7785, 42, -1 }},
+    {{ 370, 2702, -1, 3593 }},
+    {{ 4486, 3090, -1, 7787 }},
+    {{ -1, 3115, 7788, 3138 }},
+    {{ 1878, -1, 447, 3132 }},
+    {{ -1, 7057, 3804, 6696 }},
+    {{ 83, -1, 1813, 7791 }},
+    {{ -1, 7792, 689, 6719 }},
+    {{ 4466, 320, -1, 6717 }},
+    {{ 7794, -1, 6727, 7797 }},
+    {{ 1825, 7795, 1844, -1 }},
+    {{ 4583, 3442, -1, 7796 }},
+    {{ -1, 325, 12, 6725 }},
+    {{ -1, 7798, 1883, 6736 }},
+    {{ 3450, 1104, -1, 4900 }},
+    {{ -1, 7800, 7804, 6756 }},
+    {{ 29, 7801, -1, -1 }},
+    {{ 7802, 6743, -1, 1106 }},
+    {{ 808, 7803, 5194, -1 }},
+    {{ 813, 5179, -1, -1 }},
+    {{ 7805, -1, 1955, 6752 }},
+    {{ 5302, 7806, 1950, -1 }},
+    {{ 5323, 3458, -1, 6750 }},
+    {{ 2213, 7808, 7810, -1 }},
+    {{ 2237, 2243, -1, 7809 }},
+    {{ -1, 2256, 773, 7264 }},
+    {{ 2265, -1, 2275, 7811 }},
+    {{ -1, 4855, 247, 494 }},
+    {{ 2315, 2328, -1, 7813 }},
+    {{ -1, 1633, 7814, 7270 }},
+    {{ 2334, -1, -1, -1 }},
+    {{ 2345, 1676, -1, 7272 }},
+    {{ 2368, 4864, 317, -1 }},
+    {{ 322, -1, 2417, 7818 }},
+    {{ -1, 7276, 2432, 2436 }},
+    {{ 2473, 2482, -1, 7820 }},
+    {{ -1, 352, 7821, 7279 }},
+    {{ 2488, -1, -1, -1 }},
+    {{ 2513, -1, 390, 7281 }},
+    {{ 2523, 2534, 7824, -1 }},
+    {{ 2539, -1, 797, 4827 }},
+    {{ 2548, 3090, -1, 7826 }},
+    {{ -1, 3115, 7827, 3138 }},
+    {{ 2562, -1, -1, 3132 }},
+    {{ 2648, 7829, 365, -1 }},
+    {{ 546, 2659, -1, 7830 }},
+    {{ -1, 3814, 363, -1 }},
+    {{ 2703, 607, -1, 7293 }},
+    {{ 7833, -1, 390, 401 }},
+    {{ 380, 7834, 386, -1 }},
+    {{ 2777, 7835, -1, 48 }},
+    {{ 2789, 701, -1, -1 }},
+    {{ 7837, 1128, -1, 1134 }},
+    {{ 7838, 7839, 7840, -1 }},
+    {{ 5079, 7300, 1123, -1 }},
+    {{ 7304, 4606, -1, 1126 }},
+    {{ 7841, -1, 7843, -1 }},
+    {{ 360, 5101, 7842, -1 }},
+    {{ 3007, -1, 3011, 3600 }},
+    {{ 7844, -1, 427, 6821 }},
+    {{ 3015, 7845, 424, -1 }},
+    {{ 3025, 2788, -1, -1 }},
+    {{ 7847, -1, 1152, 7858 }},
+    {{ 1142, 7848, 1148, -1 }},
+    {{ 6878, 7849, -1, 7854 }},
+    {{ 7850, 7852, -1, 4366 }},
+    {{ 597, 7851, 6890, -1 }},
+    {{ 4071, 4078, -1, 1177 }},
+    {{ 7853, 4127, -1, 614 }},
+    {{ 4108, 4116, 1180, -1 }},
+    {{ -1, 7855, 12, -1 }},
+    {{ 7856, 6898, -1, 1147 }},
+    {{ 4199, 7857, 1671, -1 }},
+    {{ 3292, 4204, -1, -1 }},
+    {{ -1, 7859, 1168, 6989 }},
+    {{ 7860, 7864, -1, 6969 }},
+    {{ 96, 7861, 30, -1 }},
+    {{ 7862, 6960, -1, 4468 }},
+    {{ 788, 7863, 101, -1 }},
+    {{ 5090, 4606, -1, -1 }},
+    {{ 7865, 684, -1, 283 }},
+    {{ 7866, 1167, 5194, -1 }},
+    {{ 5144, 7867, 5163, -1 }},
+    {{ 5155, 5159, -1, -1 }},
+    {{ 3473, 7869, 3484, -1 }},
+    {{ 546, 7870, -1, 7875 }},
+    {{ 7871, 7872, -1, 4554 }},
+    {{ 3767, 4682, 557, -1 }},
+    {{ 7873, 3090, -1, 3790 }},
+    {{ 3062, 3069, 7874, -1 }},
+    {{ 3005, -1, 3784, -1 }},
+    {{ -1, 7876, 2157, 7014 }},
+    {{ 7387, 7013, -1, 4566 }},
+    {{ 7878, 7879, 3501, -1 }},
+    {{ 3935, 578, 3494, -1 }},
+    {{ 7880, 7883, -1, 4595 }},
+    {{ 326, 7881, 3983, -1 }},
+    {{ 2473, 2482, -1, 7882 }},
+    {{ -1, 352, -1, 3980 }},
+    {{ 7884, 4000, -1, 587 }},
+    {{ 2523, 2534, 7885, -1 }},
+    {{ 2539, -1, 341, -1 }},
+    {{ 4052, 7887, 7888, -1 }},
+    {{ 299, 304, -1, 6965 }},
+    {{ 312, -1, 4064, 7889 }},
+    {{ -1, -1, 2976, 600 }},
+    {{ 326, 331, 7891, -1 }},
+    {{ 2498, -1, 4073, -1 }},
+    {{ 339, 2547, -1, 6968 }},
+    {{ 7894, -1, 4101, 78 }},
+    {{ 360, 7895, 4097, -1 }},
+    {{ 370, 2702, -1, -1 }},
+    {{ -1, 7897, 12, 7063 }},
+    {{ 7898, 714, -1, 80 }},
+    {{ 7404, 1184, 1671, -1 }},
+    {{ 7900, -1, 7111, 1196 }},
+    {{ 7086, 7901, 7106, -1 }},
+    {{ 4583, 7902, -1, 1193 }},
+    {{ 697, 7903, -1, 7098 }},
+    {{ 7904, 7095, -1, 4714 }},
+    {{ 4614, 7905, 703, -1 }},
+    {{ 37, 2981, -1, -1 }},
+    {{ -1, 7907, 1208, 1213 }},
+    {{ 7908, 7913, -1, 7182 }},
+    {{ 7909, 153, 15, -1 }},
+    {{ 770, 7910, 784, -1 }},
+    {{ 7911, 7165, -1, 4814 }},
+    {{ 5029, 7912, 779, -1 }},
+    {{ 37, 1552, -1, -1 }},
+    {{ 7914, 4882, -1, 7177 }},
+    {{ 7915, 756, 5194, -1 }},
+    {{ 7916, 1207, 7174, -1 }},
+    {{ 2213, 7238, 7917, -1 }},
+    {{ 2265, -1, 2275, -1 }},
+    {{ 1409, 1616, -1, 7919 }},
+    {{ -1, 1633, -1, -1 }},
+    {{ 1780, 6584, 5630, -1 }},
+    {{ 5632, -1, 1850, 7922 }},
+    {{ -1, -1, 1883, 1894 }},
+    {{ 7924, 794, -1, 802 }},
+    {{ 7299, 7303, 7925, -1 }},
+    {{ 7926, -1, 7309, -1 }},
+    {{ 360, 5101, 7742, -1 }},
+    {{ 7928, -1, 118, 16 }},
+    {{ 939, 7929, 116, -1 }},
+    {{ 7930, 7316, -1, 2031 }},
+    {{ 5915, 7747, 948, -1 }},
+    {{ 7932, 816, -1, 7340 }},
+    {{ 7933, 812, 7937, -1 }},
+    {{ 7322, 7325, 7934, -1 }},
+    {{ 7935, -1, 7329, 6078 }},
+    {{ 2368, 5165, 7936, -1 }},
+    {{ 83, -1, 2398, -1 }},
+    {{ 7938, -1, 988, 995 }},
+    {{ 7939, 5504, 7337, -1 }},
+    {{ 2648, 3598, 7940, -1 }},
+    {{ 565, -1, 2668, -1 }},
+    {{ 7942, -1, 1235, 1240 }},
+    {{ 7943, 7947, 7406, -1 }},
+    {{ 1075, 7944, 7388, -1 }},
+    {{ 1087, 7945, -1, 7385 }},
+    {{ 7946, 7382, -1, 5309 }},
+    {{ 6686, 7905, 1096, -1 }},
+    {{ 7948, 162, -1, 7401 }},
+    {{ 1107, 7949, 1119, -1 }},
+    {{ 7950, 7398, -1, 5332 }},
+    {{ 5172, 7951, 1114, -1 }},
+    {{ 2473, 2482, -1, -1 }},
+    {{ -1, 7953, 1254, 7525 }},
+    {{ 7954, 7486, -1, 7493 }},
+    {{ 7955, 5471, 1251, -1 }},
+    {{ 7956, 859, 1270, -1 }},
+    {{ 7763, 1250, 7480, -1 }},
+    {{ 7958, 7961, 7962, -1 }},
+    {{ 1364, 7959, 7554, -1 }},
+    {{ 1393, 1408, -1, 7960 }},
+    {{ -1, 204, 773, 7553 }},
+    {{ 5449, 7556, -1, 1265 }},
+    {{ 7963, -1, 7965, 884 }},
+    {{ 1780, 3400, 7964, -1 }},
+    {{ 83, -1, 1813, 1273 }},
+    {{ 7966, -1, 1850, 5634 }},
+    {{ 1825, 7967, 1844, -1 }},
+    {{ 4583, 1831, -1, -1 }},
+    {{ 531, 7969, 7694, -1 }},
+    {{ 546, 555, -1, 7970 }},
+    {{ -1, 3814, -1, 5709 }},
+    {{ 7972, 5716, -1, 900 }},
+    {{ 577, 72, 7697, -1 }},
+    {{ 7974, 919, -1, 7609 }},
+    {{ 909, 913, 7975, -1 }},
+    {{ 5778, -1, 7976, 7607 }},
+    {{ 7977, -1, 7605, 401 }},
+    {{ 380, 5789, 7978, -1 }},
+    {{ 2795, -1, 2802, -1 }},
+    {{ 3652, 7980, 6267, -1 }},
+    {{ 3675, 3686, -1, 7475 }},
+    {{ 3731, 547, 6271, -1 }},
+    {{ 3872, -1, 3885, 7737 }},
+    {{ 7984, -1, 962, 969 }},
+    {{ 7654, 7985, 7665, -1 }},
+    {{ 7986, 7662, -1, -1 }},
+    {{ 577, 7987, 5966, -1 }},
+    {{ 4585, 4590, -1, -1 }},
+    {{ 7989, 7703, -1, 7709 }},
+    {{ 7990, 982, 7994, -1 }},
+    {{ 7670, 7673, 7991, -1 }},
+    {{ 312, -1, 7992, 7680 }},
+    {{ 7993, -1, 7677, 2431 }},
+    {{ 2403, 323, 5831, -1 }},
+    {{ 7995, -1, 7998, 7700 }},
+    {{ 7683, 5202, 7996, -1 }},
+    {{ 7997, -1, 7688, 43 }},
+    {{ 657, 2709, 7731, -1 }},
+    {{ 7999, -1, 992, 2092 }},
+    {{ 8000, 7695, 1294, -1 }},
+    {{ 2758, 8001, 6208, -1 }},
+    {{ 546, 2762, -1, -1 }},
+    {{ -1, 7721, 8003, 7758 }},
+    {{ 8004, -1, 7748, 1053 }},
+    {{ 8005, 7738, 7743, -1 }},
+    {{ 8006, 1042, 134, -1 }},
+    {{ 7763, 1300, 1301, -1 }},
+    {{ 8008, 8011, 8017, -1 }},
+    {{ 1364, 7765, 8009, -1 }},
+    {{ 1464, -1, 1479, 8010 }},
+    {{ -1, 493, 247, 7769 }},
+    {{ 8012, 8014, -1, 1077 }},
+    {{ 1535, 8013, 3391, -1 }},
+    {{ 37, 1552, -1, 1309 }},
+    {{ 8015, 1616, -1, 6648 }},
+    {{ 1593, 1598, 8016, -1 }},
+    {{ 3005, -1, 1603, -1 }},
+    {{ 3591, -1, 7776, 1305 }},
+    {{ 285, 7887, 8019, -1 }},
+    {{ 312, -1, 321, 8020 }},
+    {{ -1, -1, 2439, 5644 }},
+    {{ 8022, -1, 6678, 1092 }},
+    {{ 360, 7895, 42, -1 }},
+    {{ 2213, 7169, 8024, -1 }},
+    {{ 2265, -1, 2275, 6580 }},
+    {{ 2315, 2328, -1, 7919 }},
+    {{ 2368, 7176, 317, -1 }},
+    {{ 8028, 1128, -1, 1134 }},
+    {{ 7838, 7839, 8029, -1 }},
+    {{ 8030, -1, 7843, -1 }},
+    {{ 360, 5101, 4838, -1 }},
+    {{ 8032, -1, 1152, 7858 }},
+    {{ 1142, 8033, 1148, -1 }},
+    {{ 6878, 8034, -1, 7854 }},
+    {{ 8035, 7852, -1, 4366 }},
+    {{ 597, 8036, 6890, -1 }},
+    {{ 4071, 4078, -1, -1 }},
+    {{ 8038, -1, 7899, 7906 }},
+    {{ 8039, 8043, 1185, -1 }},
+    {{ 3473, 8040, 3484, -1 }},
+    {{ 546, 8041, -1, 7875 }},
+    {{ 8042, 7872, -1, 4554 }},
+    {{ 3767, 7905, 557, -1 }},
+    {{ 8044, 8047, -1, 7896 }},
+    {{ 7878, 8045, 3501, -1 }},
+    {{ 8046, 7883, -1, 4595 }},
+    {{ 326, 7951, 3983, -1 }},
+    {{ 8048, 1178, -1, 705 }},
+    {{ 8049, 1334, 7893, -1 }},
+    {{ 4052, 7136, 8050, -1 }},
+    {{ 312, -1, 4064, -1 }},
+    {{ -1, 8052, 7941, 7952 }},
+    {{ 8053, 7931, -1, 1230 }},
+    {{ 8054, 7923, 7927, -1 }},
+    {{ 8055, 158, 1227, -1 }},
+    {{ 7763, 1340, 1341, -1 }},
+    {{ -1, 8057, 8069, 8056 }},
+    {{ 8058, 7988, -1, 8002 }},
+    {{ 8059, 7973, 8066, -1 }},
+    {{ 8060, 1266, 8063, -1 }},
+    {{ 7958, 7961, 8061, -1 }},
+    {{ 8062, -1, 7965, 884 }},
+    {{ 1780, 3400, 7715, -1 }},
+    {{ 8064, -1, 1274, 5742 }},
+    {{ 8065, 7971, 938, -1 }},
+    {{ 531, 3246, 6208, -1 }},
+    {{ 8067, -1, 7983, 16 }},
+    {{ 8068, 1282, 168, -1 }},
+    {{ 7719, 1351, 1352, -1 }},
+    {{ 8070, -1, 8037, 8051 }},
+    {{ 8071, 8078, 8031, -1 }},
+    {{ 8072, 8075, 1313, -1 }},
+    {{ 8008, 8073, 8017, -1 }},
+    {{ 8074, 8014, -1, 1077 }},
+    {{ 1535, 7912, 3391, -1 }},
+    {{ 8076, 1310, -1, 6698 }},
+    {{ 8077, 1358, 8021, -1 }},
+    {{ 285, 7136, 4952, -1 }},
+    {{ 8079, 8027, -1, 20 }},
+    {{ 8080, 173, 1326, -1 }},
+    {{ 7916, 1362, 1363, -1 }}
+}};
+
+#endif
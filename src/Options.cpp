@@ -0,0 +1,237 @@
+#include "Options.h"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+
+//
+// Returns the value of option argv[ i ], which is the next argument
+//
+const char* Value( int argc, char** argv, int& i )
+{
+    if( i + 1 >= argc )
+        throw std::invalid_argument( std::string( "Missing value of option " ) + argv[ i ] );
+    return argv[ ++i ];
+}
+
+//
+// Converts the value "val" of option "opt" to the non-negative number of seconds
+//
+double Seconds( const char* opt, const char* val )
+{
+    char* end = nullptr;
+    const double x = strtod( val, &end );
+    if( end == val || *end != '\0' || !std::isfinite( x ) || x < 0 )
+        throw std::invalid_argument( std::string( "Not allowed value of option " ) + opt + ": " + val );
+    return x;
+}
+
+//
+// Converts the value "val" of option "opt" to the integer in range [0, max]
+//
+uint64_t Integer( const char* opt, const char* val, uint64_t max )
+{
+    char* end = nullptr;
+    errno = 0;
+    const unsigned long long x = ( *val >= '0' && *val <= '9' ) ? strtoull( val, &end, 10 ) : 0;
+    if( end == nullptr || *end != '\0' || errno == ERANGE || x > max )
+        throw std::invalid_argument( std::string( "Not allowed value of option " ) + opt + ": " + val );
+    return x;
+}
+
+//
+// Returns "true" if the option "arg" is used in mode "mode". The service takes no options,
+// the portfolio takes the heuristic, the perimeter and the limits.
+//
+bool IsUsed( Options::Mode mode, const std::string& arg )
+{
+    static const char* const portfolio[] = { "--heuristic", "--perimeter", "--perimeter-margin",
+        "--time", "--max-expanded", "--max-memory", "--quiet" };
+
+    if( mode == Options::SERVE )
+        return false;
+    if( mode == Options::PORTFOLIO )
+        return std::find( std::begin( portfolio ), std::end( portfolio ), arg ) != std::end( portfolio );
+    return true;
+}
+
+}
+
+//
+// Parses the command line
+//
+Options Options::Parse( int argc, char** argv )
+{
+    Options opt;
+    const std::string first = argc > 1 ? argv[ 1 ] : "";
+
+    constexpr uint64_t UINT_MAX_VALUE = std::numeric_limits< unsigned int >::max();
+
+    // Legacy modes. The options of the portfolio follow its time.
+    int start = 1;
+    if( first == "--serve" && argc > 2 )
+    {
+        opt.m_mode = SERVE;
+        opt.m_socket = argv[ 2 ];
+        start = 3;
+        if( argc > 3 && std::string( argv[ 3 ] ).compare( 0, 2, "--" ) != 0 )
+        {
+            opt.m_threadNo = static_cast< unsigned int >( Integer( "--serve", argv[ 3 ], UINT_MAX_VALUE ) );
+            start = 4;
+        }
+    }
+    else if( first == "--portfolio" && argc > 2 )
+    {
+        opt.m_mode = PORTFOLIO;
+        opt.m_deadline = Seconds( "--portfolio", argv[ 2 ] );
+        start = 3;
+    }
+
+    int positionalNo = 0;
+    for( int i = start; i < argc; i++ )
+    {
+        const std::string arg = argv[ i ];
+
+        if( arg.compare( 0, 2, "--" ) == 0 && !IsUsed( opt.m_mode, arg ) )
+            throw std::invalid_argument( "Option " + arg + " is not supported by " + first );
+
+        if( arg == "--help" || arg == "-h" )
+            opt.m_mode = HELP;
+        else if( arg == "--list-engines" )
+            opt.m_mode = LIST;
+        else if( arg == "--engine" )
+            opt.m_engine = Value( argc, argv, i );
+        else if( arg == "--closed" )
+            opt.m_closed = Value( argc, argv, i );
+        else if( arg == "--open" )
+            opt.m_open = Value( argc, argv, i );
+        else if( arg == "--heuristic" )
+        {
+            const std::string val = Value( argc, argv, i );
+            if( val == Graph::Name( Graph::MANHATTAN ) )
+                opt.m_heuristic = Graph::MANHATTAN;
+            else if( val == Graph::Name( Graph::LINEAR_CONFLICT ) )
+                opt.m_heuristic = Graph::LINEAR_CONFLICT;
+            else
+                throw std::invalid_argument( "Unknown heuristic: " + val );
+        }
+        else if( arg == "--perimeter" )
+            opt.m_perimeter = static_cast< unsigned int >( Integer( arg.c_str(), Value( argc, argv, i ), Perimeter::MAX_DEPTH ) );
+        else if( arg == "--perimeter-margin" )
+            opt.m_perimeterMargin = static_cast< unsigned int >( Integer( arg.c_str(), Value( argc, argv, i ), UINT_MAX_VALUE ) );
+        else if( arg == "--work-dir" )
+            opt.m_workDir = Value( argc, argv, i );
+        else if( arg == "--threads" )
+        {
+            opt.m_threadNo = static_cast< unsigned int >( Integer( arg.c_str(), Value( argc, argv, i ), UINT_MAX_VALUE ) );
+            if( opt.m_threadNo == 0 )
+                throw std::invalid_argument( "Number of threads must be positive" );
+        }
+        else if( arg == "--time" )
+            opt.m_limits.m_maxSeconds = Seconds( arg.c_str(), Value( argc, argv, i ) );
+        else if( arg == "--max-expanded" )
+            opt.m_limits.m_maxExpanded = static_cast< size_t >( Integer( arg.c_str(), Value( argc, argv, i ), SIZE_MAX ) );
+        else if( arg == "--max-memory" )
+            opt.m_limits.m_maxBytes = static_cast< size_t >( Integer( arg.c_str(), Value( argc, argv, i ), SIZE_MAX >> 20 ) ) << 20;
+        else if( arg == "--format" )
+        {
+            const std::string val = Value( argc, argv, i );
+            if( val == "text" )
+                opt.m_format = TEXT;
+            else if( val == "line" )
+                opt.m_format = LINE;
+            else if( val == "json" )
+                opt.m_format = JSON;
+            else
+                throw std::invalid_argument( "Unknown format: " + val );
+        }
+        else if( arg == "--quiet" )
+            opt.m_quiet = true;
+        else if( arg == "--metrics" )
+            opt.m_metrics = true;
+        else if( arg == "--profile" )
+            opt.m_profile = true;
+        else if( arg == "--layers" )
+            opt.m_layers = true;
+        else if( arg == "--memory" )
+            opt.m_memory = true;
+        else if( arg == "--trace" )
+            opt.m_trace = Value( argc, argv, i );
+        else if( arg == "--all-optimal" )
+        {
+            opt.m_allOptimal = true;
+            opt.m_optimalPrintNo = static_cast< size_t >( Integer( arg.c_str(), Value( argc, argv, i ), SIZE_MAX ) );
+        }
+        else if( arg.compare( 0, 2, "--" ) == 0 )
+            throw std::invalid_argument( "Unknown option: " + arg );
+        else if( opt.m_mode == SERVE || ( opt.m_mode == PORTFOLIO && positionalNo > 0 ) )
+            throw std::invalid_argument( "Too many arguments: " + arg );
+        else if( positionalNo == 0 )
+        {
+            opt.m_input = arg;
+            positionalNo++;
+        }
+        else if( positionalNo == 1 )
+        {
+            opt.m_output = arg;
+            positionalNo++;
+        }
+        else
+            throw std::invalid_argument( "Too many arguments: " + arg );
+    }
+
+    // The report is printed to standard output, the binary solutions would be mixed with it
+    if( opt.m_output == "-" )
+        throw std::invalid_argument( "Standard output is not allowed for the binary file of solutions" );
+
+    if( opt.m_threadNo > 1 && !opt.m_trace.empty() )
+        throw std::invalid_argument( "Option --trace requires single thread" );
+
+    if( opt.m_allOptimal && opt.m_perimeter > 0 )
+        throw std::invalid_argument( "Option --all-optimal does not support option --perimeter" );
+
+    return opt;
+}
+
+//
+// Prints the usage
+//
+void Options::Usage( std::ostream& out, const char* name )
+{
+    out << "Usage:\n"
+        << "   " << name << " [OPTIONS] [PATH [OUT]]\n"
+        << "   " << name << " --serve SOCKET [WORKERS]\n"
+        << "   " << name << " --portfolio SECONDS [OPTIONS] [PATH]\n"
+        << "   " << name << " --list-engines\n"
+        << "\n"
+        << "   PATH                   file with instances, text or binary (\"-\" for standard input),\n"
+        << "                          the built-in examples are solved without it\n"
+        << "   OUT                    binary file, where the solutions are written (not standard output)\n"
+        << "\n"
+        << "   --engine NAME          astar (default), wastar-W, alstar-K, epea, idastar,\n"
+        << "                          idastar-basic, idastar-tt-M, idastar-basic-tt-M, bfhs or extastar-M\n"
+        << "   --closed POLICY        closed set: hash (default) or tree\n"
+        << "   --open POLICY          open set: hash (default), bucket or tree\n"
+        << "   --heuristic NAME       manhattan (default) or linear-conflict\n"
+        << "   --perimeter D          perimeter of depth D around the goal, built once by N threads\n"
+        << "   --perimeter-margin M   margin of front-to-front estimate of perimeter (default 0)\n"
+        << "   --work-dir DIR         directory of run files of extastar (default temporary directory)\n"
+        << "   --threads N            number of instances solved in parallel\n"
+        << "   --time SECONDS         limit of wall time for each instance\n"
+        << "   --max-expanded N       limit of expanded nodes for each instance\n"
+        << "   --max-memory MIB       limit of memory of the search for each instance\n"
+        << "   --format FORMAT        text (default), line or json\n"
+        << "   --quiet                intro and states are not printed\n"
+        << "   --metrics              metrics of each search\n"
+        << "   --profile              time of each phase of the search\n"
+        << "   --layers               statistics of f-layers\n"
+        << "   --memory               memory of each data structure\n"
+        << "   --trace TRACE          each expansion is written to binary file TRACE\n"
+        << "   --all-optimal N        number of all optimal solutions, at most N of them are printed\n";
+}
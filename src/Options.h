@@ -0,0 +1,123 @@
+#ifndef ASTAR_OPTIONS_H
+#define ASTAR_OPTIONS_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Options of the command line of program sliding-puzzle.
+//
+// 2. The search is selected at run time:
+//       --engine NAME        - engine (see EngineRegistry), default "astar"
+//       --closed POLICY      - closed set: "hash" (default) or "tree"
+//       --open POLICY        - open set: "hash" (default), "bucket" or "tree"
+//       --heuristic NAME     - "manhattan" (default) or "linear-conflict"
+//       --threads N          - number of instances solved in parallel, default 1.
+//                              The perimeter is built by N threads as well.
+//       --time SECONDS       - limit of wall time for each instance
+//       --max-expanded N     - limit of expanded nodes for each instance
+//       --max-memory MIB     - limit of memory of the search for each instance
+//       --perimeter D        - perimeter of depth D around the GOAL state (see Perimeter.h),
+//                              built once for all instances
+//       --perimeter-margin M - margin of the front-to-front estimate of the perimeter, default 0
+//       --work-dir DIR       - directory of the files of the search on disk (see ExternalAstar.h),
+//                              the stopped search is resumed only in the explicit directory,
+//                              default the directory of temporary files
+//
+// 3. The output is selected by:
+//       --format FORMAT      - "text" (default), "line" (one line per instance) or "json"
+//                              (one JSON object per line)
+//       --quiet              - the intro and the states are not printed in format "text"
+//       --metrics, --profile, --layers, --memory
+//                            - the statistics of each search (see Metrics.h, Profiler.h,
+//                              LayerStats.h and MemoryStats.h)
+//       --trace PATH         - each expansion is written to the binary file PATH (see Trace.h)
+//       --all-optimal N      - the number of all optimal solutions is reported and at most N
+//                              of them are printed (only A*, see astar.h)
+//
+// 4. The positional arguments are the input file with instances ("-" for standard input)
+//    and the binary file, where the solutions are written. Without the input file,
+//    the built-in examples are solved. The binary file cannot be standard output ("-"),
+//    where the report is printed.
+//
+// 5. The legacy modes "--serve SOCKET [WORKERS]" and "--portfolio SECONDS [OPTIONS] [PATH]"
+//    are recognized, when they are the first argument. The portfolio uses the heuristic,
+//    the perimeter and the limits given by the options. The service takes no options.
+//
+// 6. If the option is not correct, or it is not used by the mode, the exception
+//    std::invalid_argument is thrown. The counts are integers, only the seconds may be fractional.
+//
+
+#include "Graph.h"
+#include "Limits.h"
+#include <ostream>
+#include <string>
+
+class Options
+{
+public:
+    // Mode of the program
+    enum Mode
+    {
+        SOLVE,      // Instances are solved by selected engine
+        SERVE,      // Solver service (see Server.h)
+        PORTFOLIO,  // Engines are raced on each instance (see Portfolio.h)
+        LIST,       // Registered engines are printed
+        HELP        // Usage is printed
+    };
+
+    // Format of the output
+    enum Format
+    {
+        TEXT,
+        LINE,
+        JSON
+    };
+
+public:
+    static Options Parse( int argc, char** argv );
+    static void Usage( std::ostream& out, const char* name );
+
+public:
+    Mode m_mode = SOLVE;
+
+    // Engine and its policies of closed set and open set
+    std::string m_engine = "astar";
+    std::string m_closed = "hash";
+    std::string m_open = "hash";
+
+    Graph::Heuristic m_heuristic = Graph::MANHATTAN;
+
+    // Depth of the perimeter, zero if it is not used, and the margin of its front-to-front estimate
+    unsigned int m_perimeter = 0;
+    unsigned int m_perimeterMargin = Perimeter::DEFAULT_MARGIN;
+    unsigned int m_threadNo = 1;
+    Limits m_limits;
+
+    // Directory of the files of the search on disk, empty for the default directory
+    std::string m_workDir;
+
+    Format m_format = TEXT;
+    bool m_quiet = false;
+    bool m_metrics = false;
+    bool m_profile = false;
+    bool m_layers = false;
+    bool m_memory = false;
+    std::string m_trace;
+
+    // All optimal solutions are enumerated, at most m_optimalPrintNo of them are printed
+    bool m_allOptimal = false;
+    size_t m_optimalPrintNo = 0;
+
+    // Input file (empty for the built-in examples) and output file of solutions
+    std::string m_input;
+    std::string m_output;
+
+    // Service socket and the number of its workers
+    std::string m_socket;
+
+    // Time limit of portfolio in seconds
+    double m_deadline = 0;
+};
+
+#endif
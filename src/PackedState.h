@@ -0,0 +1,123 @@
+#ifndef ASTAR_PACKEDSTATE_H
+#define ASTAR_PACKEDSTATE_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Compact representation of State.
+//
+// 2. Each tile is stored on BITS bits. For the board 5x5 there are 25 * 5 = 125 bits,
+//    hence the state is stored in 16 bytes (two 64-bit words).
+//
+// 3. The packed states are used by binary files and as the keys of the tables,
+//    which must be compact.
+//
+
+#include "State.h"
+#include <cstdint>
+
+class PackedState
+{
+public:
+    // Number of bits used by single tile
+    inline static constexpr unsigned int BITS =
+        ( State::TILENO <= 16 ) ? 4 : ( State::TILENO <= 32 ) ? 5 : 6;
+
+    static_assert( State::TILENO * BITS <= 128, "PackedState is too small for this board" );
+
+public:
+    PackedState( ) : m_word{ 0, 0 } {}
+    explicit PackedState( const State& s );
+
+    State Unpack( ) const;
+
+    bool operator==( const PackedState& p ) const;
+    bool operator< ( const PackedState& p ) const;
+
+    uint64_t Hash( ) const;
+
+public:
+    // Packed tiles. Tile "i" occupies bits [i * BITS, (i + 1) * BITS)
+    uint64_t m_word[ 2 ];
+};
+
+//
+// Constructor. Packs state "s"
+//
+inline
+PackedState::PackedState( const State& s ) : m_word{ 0, 0 }
+{
+    for( uint8_t i = 0; i < State::TILENO; i++ )
+    {
+        const uint pos = i * BITS;
+        const uint w = pos / 64;
+        const uint shift = pos % 64;
+        const uint64_t val = static_cast< uint64_t >( s.Tile( i ) );
+
+        m_word[ w ] |= val << shift;
+        if( shift + BITS > 64 ) // The tile is split between two words
+            m_word[ w + 1 ] |= val >> ( 64 - shift );
+    }
+}
+
+//
+// Returns the unpacked state
+//
+inline
+State PackedState::Unpack( ) const
+{
+    constexpr uint64_t mask = ( uint64_t( 1 ) << BITS ) - 1;
+    std::array< char, State::TILENO > tab;
+
+    for( uint i = 0; i < State::TILENO; i++ )
+    {
+        const uint pos = i * BITS;
+        const uint w = pos / 64;
+        const uint shift = pos % 64;
+
+        uint64_t val = m_word[ w ] >> shift;
+        if( shift + BITS > 64 ) // The tile is split between two words
+            val |= m_word[ w + 1 ] << ( 64 - shift );
+
+        tab[ i ] = static_cast< char >( val & mask );
+    }
+    return State{ tab };
+}
+
+//
+// Equality operator
+//
+inline
+bool PackedState::operator==( const PackedState& p ) const
+{
+    return m_word[ 0 ] == p.m_word[ 0 ] && m_word[ 1 ] == p.m_word[ 1 ];
+}
+
+//
+// Less operator. The order is not the same as the order of State::operator<
+//
+inline
+bool PackedState::operator<( const PackedState& p ) const
+{
+    if( m_word[ 1 ] != p.m_word[ 1 ] )
+        return m_word[ 1 ] < p.m_word[ 1 ];
+    return m_word[ 0 ] < p.m_word[ 0 ];
+}
+
+//
+// Returns 64-bit hash of the state (mixing function of MurmurHash3)
+//
+inline
+uint64_t PackedState::Hash( ) const
+{
+    uint64_t h = m_word[ 0 ] ^ ( m_word[ 1 ] * 0x9e3779b97f4a7c15ULL );
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+#endif
@@ -0,0 +1,235 @@
+#include "Perimeter.h"
+#include "Graph.h"
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+//
+// Constructor. Builds the perimeter by the breadth-first search from the GOAL state.
+// "depth"    - depth of the perimeter
+// "margin"   - margin of the front-to-front estimate, zero disables it
+// "threadNo" - number of threads of the search
+//
+Perimeter::Perimeter( unsigned int depth, unsigned int margin, unsigned int threadNo )
+    : m_depth( depth )
+    , m_margin( margin )
+    , m_mask( 0 )
+    , m_frontNo( 0 )
+{
+    if( depth == 0 || depth > MAX_DEPTH )
+        throw std::invalid_argument( "Depth of perimeter must be in range [1, " + std::to_string( MAX_DEPTH ) + "]" );
+    if( threadNo == 0 )
+        throw std::invalid_argument( "Number of threads must be positive" );
+
+    std::vector< PackedState > prev;
+    std::vector< PackedState > level = { PackedState( Graph::Goal() ) };
+
+    // All states level by level and their distances
+    std::vector< PackedState > key = level;
+    std::vector< uint8_t > dist = { 0 };
+
+    for( unsigned int d = 1; d <= depth; d++ )
+    {
+        std::vector< PackedState > next = Expand( level, prev, threadNo );
+        key.insert( key.end(), next.begin(), next.end() );
+        dist.insert( dist.end(), next.size(), static_cast< uint8_t >( d ) );
+
+        prev.swap( level );
+        level.swap( next );
+    }
+
+    if( key.size() >= std::numeric_limits< uint32_t >::max() )
+        throw std::invalid_argument( "Perimeter is too large" );
+
+    Index( key, dist );
+
+    // Positions of tiles of the front states
+    m_frontNo = level.size();
+    if( margin > 0 )
+    {
+        m_front.resize( level.size() );
+        for( size_t i = 0; i < level.size(); i++ )
+        {
+            const State x = level[ i ].Unpack();
+            for( uint8_t pos = 0; pos < State::TILENO; pos++ )
+                m_front[ i ][ static_cast< unsigned char >( x.Tile( pos ) ) ] = pos;
+        }
+    }
+}
+
+//
+// Returns the next level of the breadth-first search, i.e. the sorted neighbours of "level",
+// which are not in the previous level "prev". Both levels are sorted.
+//
+std::vector< PackedState > Perimeter::Expand( const std::vector< PackedState >& level,
+    const std::vector< PackedState >& prev, unsigned int threadNo )
+{
+    const size_t chunk = ( level.size() + threadNo - 1 ) / threadNo;
+    std::vector< std::vector< PackedState > > part( threadNo );
+
+    auto work = [&]( unsigned int t )
+    {
+        const size_t begin = std::min( level.size(), t * chunk );
+        const size_t end = std::min( level.size(), begin + chunk );
+        std::vector< PackedState >& out = part[ t ];
+
+        for( size_t i = begin; i < end; i++ )
+        {
+            const State x = level[ i ].Unpack();
+            const uint8_t sp = static_cast< uint8_t >( x.SpaceIdx() );
+            const char movesNo = Graph::MovesNo( sp );
+            for( uint8_t j = 0; j < movesNo; j++ )
+            {
+                State y = x;
+                y.Swap( sp, Graph::Move( sp, j ) );
+                out.push_back( PackedState( y ) );
+            }
+        }
+
+        std::sort( out.begin(), out.end() );
+        out.erase( std::unique( out.begin(), out.end() ), out.end() );
+
+        // The graph is bipartite, the other neighbours are in the previous level
+        auto visited = [&]( const PackedState& s ) { return std::binary_search( prev.begin(), prev.end(), s ); };
+        out.erase( std::remove_if( out.begin(), out.end(), visited ), out.end() );
+    };
+
+    if( threadNo == 1 )
+    {
+        work( 0 );
+    }
+    else
+    {
+        std::vector< std::thread > threads;
+        for( unsigned int t = 0; t < threadNo; t++ )
+            threads.emplace_back( work, t );
+        for( std::thread& t : threads )
+            t.join();
+    }
+
+    // The parts are merged pairwise by the tree of threads, each level halves the number of parts.
+    // The same state may be reached from the parts of different threads, the union keeps one copy.
+    auto merge = [&]( size_t a, size_t b )
+    {
+        std::vector< PackedState > out;
+        out.reserve( part[ a ].size() + part[ b ].size() );
+        std::set_union( part[ a ].begin(), part[ a ].end(), part[ b ].begin(), part[ b ].end(), std::back_inserter( out ) );
+        part[ a ].swap( out );
+        std::vector< PackedState >().swap( part[ b ] );
+    };
+
+    for( size_t step = 1; step < part.size(); step *= 2 )
+    {
+        std::vector< std::thread > threads;
+        for( size_t a = 0; a + step < part.size(); a += 2 * step )
+            threads.emplace_back( merge, a, a + step );
+        for( std::thread& t : threads )
+            t.join();
+    }
+
+    return std::move( part[ 0 ] );
+}
+
+//
+// Stores states "key" with distances "dist" sorted by the bucket (counting sort)
+//
+void Perimeter::Index( const std::vector< PackedState >& key, const std::vector< uint8_t >& dist )
+{
+    size_t bucketNo = 1;
+    while( bucketNo < key.size() )
+        bucketNo *= 2;
+    m_mask = bucketNo - 1;
+
+    m_start.assign( bucketNo + 1, 0 );
+    for( const PackedState& s : key )
+        m_start[ ( s.Hash() & m_mask ) + 1 ]++;
+    for( size_t b = 0; b < bucketNo; b++ )
+        m_start[ b + 1 ] += m_start[ b ];
+
+    m_key.resize( key.size() );
+    m_dist.resize( key.size() );
+
+    std::vector< uint32_t > pos( m_start.begin(), m_start.end() - 1 );
+    for( size_t i = 0; i < key.size(); i++ )
+    {
+        const uint32_t j = pos[ key[ i ].Hash() & m_mask ]++;
+        m_key[ j ] = key[ i ];
+        m_dist[ j ] = dist[ i ];
+    }
+}
+
+//
+// Returns the minimum over the front states "p" of "depth + Manhattan distance between x and p",
+// but not greater than "cap"
+//
+Cost Perimeter::Front( const State& x, Cost cap ) const
+{
+    std::array< uint8_t, State::TILENO > pos;
+    for( uint8_t i = 0; i < State::TILENO; i++ )
+        pos[ static_cast< unsigned char >( x.Tile( i ) ) ] = i;
+
+    // The state outside the perimeter is at least one move from the front
+    const Cost depth = static_cast< Cost >( m_depth );
+    Cost best = cap - depth;
+
+    for( const std::array< uint8_t, State::TILENO >& p : m_front )
+    {
+        Cost d = 0;
+        for( unsigned int tile = 1; tile < State::TILENO && d < best; tile++ )
+            d += Graph::Distance( pos[ tile ], p[ tile ] );
+
+        if( d < best )
+        {
+            best = d;
+            if( best <= 1 )
+                break;
+        }
+    }
+
+    return depth + best;
+}
+
+//
+// Appends the path from the last state of "path", which is within the perimeter, to the GOAL state
+//
+void Perimeter::Complete( std::vector< State >& path ) const
+{
+    int d = Distance( path.back() );
+    if( d < 0 )
+        throw std::invalid_argument( "State is outside the perimeter" );
+
+    while( d > 0 )
+    {
+        const State x = path.back();
+        const uint8_t sp = static_cast< uint8_t >( x.SpaceIdx() );
+        const char movesNo = Graph::MovesNo( sp );
+
+        for( uint8_t j = 0; j < movesNo; j++ )
+        {
+            State y = x;
+            y.Swap( sp, Graph::Move( sp, j ) );
+            if( Distance( y ) == d - 1 )
+            {
+                path.push_back( y );
+                break;
+            }
+        }
+        d--;
+    }
+}
+
+//
+// Returns the memory occupied by the perimeter
+//
+MemoryUsage Perimeter::Memory( ) const
+{
+    MemoryUsage m;
+
+    const size_t state = sizeof( PackedState ) + sizeof( uint8_t );
+    m.m_used = m_key.size() * state + m_start.size() * sizeof( uint32_t ) + m_front.size() * sizeof( m_front[ 0 ] );
+    m.m_reserved = m_key.capacity() * state + m_start.capacity() * sizeof( uint32_t ) + m_front.capacity() * sizeof( m_front[ 0 ] );
+    m.m_load = m_start.empty() ? 0 : double( m_key.size() ) / ( m_mask + 1 );
+    return m;
+}
@@ -0,0 +1,157 @@
+#ifndef ASTAR_PERIMETER_H
+#define ASTAR_PERIMETER_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Represents the perimeter around the GOAL state (perimeter search), i.e. the endgame
+//    database of exact distances. All states within the distance "depth" from the GOAL state
+//    are found by the breadth-first search, which starts from the GOAL state. Since the moves
+//    are reversible, it is the backward search.
+//
+// 2. The search keeps each level as the sorted array of packed states. The graph is bipartite
+//    (each move changes the colour of the cell of SPACE), hence the neighbours of the level "d"
+//    are in the levels "d - 1" and "d + 1". The next level is made of the sorted neighbours
+//    without the previous level, no hash table of visited states is needed. The current level
+//    is divided among the threads, each thread sorts its neighbours and the parts are merged
+//    pairwise by the tree of threads.
+//
+// 3. The states are stored with their exact distances in the array of packed states and the array
+//    of distances (one byte per state). The arrays are sorted by the bucket, i.e. the low bits
+//    of the hash of the state, and the index of the first state of each bucket is kept.
+//    There are no empty slots, the bucket holds one state on average.
+//
+// 4. The states with distance equal to "depth" form the perimeter (the front). The other
+//    states are inside it.
+//
+// 5. The forward search terminates, when it reaches any state within the perimeter.
+//    The path to the GOAL state is completed by function Complete, following the decreasing
+//    distances.
+//
+// 6. Function Estimate improves the heuristic "h" of the state:
+//       - within the perimeter it is the exact distance,
+//       - outside the perimeter it is at least "depth + 1",
+//       - if "h" is lower than "depth + margin", it is the minimum over the front states "p"
+//         of "depth + Manhattan distance between the state and p", but not greater
+//         than "depth + margin". It is evaluated only near the perimeter, since it visits
+//         each front state. It is disabled by default (zero margin), since it costs much more
+//         than the expansions it saves. The front is kept only if the margin is positive.
+//    All three values are consistent, hence their maximum is consistent as well.
+//    The estimate is rounded up to the parity of the original heuristic, since the length
+//    of each path to the GOAL state has this parity. Otherwise IDA* would need twice more iterations.
+//
+// 7. The perimeter is built once and it is shared by the graphs solving the instances
+//    (see Graph::SetPerimeter). It is not modified by the search, hence it is shared
+//    by the threads as well.
+//
+
+#include "Cost.h"
+#include "MemoryUsage.h"
+#include "PackedState.h"
+#include "State.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+class Perimeter
+{
+public:
+    // Maximal depth of the perimeter
+    inline static constexpr unsigned int MAX_DEPTH = 30;
+
+    // Default margin of the front-to-front estimate, it is disabled
+    inline static constexpr unsigned int DEFAULT_MARGIN = 0;
+
+public:
+    Perimeter( unsigned int depth, unsigned int margin = DEFAULT_MARGIN, unsigned int threadNo = 1 );
+
+    unsigned int Depth( ) const { return m_depth; }
+    unsigned int Margin( ) const { return m_margin; }
+    size_t StateNo( ) const { return m_key.size(); }
+    size_t FrontNo( ) const { return m_frontNo; }
+
+    int Distance( const State& x ) const;
+    Cost Estimate( const State& x, Cost h ) const;
+    void Complete( std::vector< State >& path ) const;
+
+    MemoryUsage Memory( ) const;
+
+private:
+    static std::vector< PackedState > Expand( const std::vector< PackedState >& level,
+        const std::vector< PackedState >& prev, unsigned int threadNo );
+    void Index( const std::vector< PackedState >& key, const std::vector< uint8_t >& dist );
+    Cost Front( const State& x, Cost cap ) const;
+
+private:
+    // Depth of the perimeter
+    const unsigned int m_depth;
+
+    // Margin of the front-to-front estimate
+    const unsigned int m_margin;
+
+    // States within the perimeter and their distances, sorted by the bucket
+    std::vector< PackedState > m_key;
+    std::vector< uint8_t > m_dist;
+
+    // Index of the first state of each bucket, m_start[ b + 1 ] is the end of bucket "b"
+    std::vector< uint32_t > m_start;
+
+    // Mask of the bucket, the number of buckets is the power of two
+    size_t m_mask;
+
+    // Number of the front states
+    size_t m_frontNo;
+
+    // Positions of tiles of the front states, m_front[ i ][ tile ] is the position of "tile"
+    std::vector< std::array< uint8_t, State::TILENO > > m_front;
+};
+
+//
+// Returns the distance of "x" to the GOAL state, or -1 if "x" is outside the perimeter
+//
+inline
+int Perimeter::Distance( const State& x ) const
+{
+    const PackedState s( x );
+    const size_t b = s.Hash() & m_mask;
+    for( uint32_t i = m_start[ b ]; i < m_start[ b + 1 ]; i++ )
+    {
+        if( m_key[ i ] == s )
+            return m_dist[ i ];
+    }
+    return -1;
+}
+
+//
+// Returns the heuristic "h" of state "x" improved by the perimeter
+//
+inline
+Cost Perimeter::Estimate( const State& x, Cost h ) const
+{
+    const Cost depth = static_cast< Cost >( m_depth );
+    const Cost h0 = h;
+
+    // The heuristic is admissible, hence the states within the perimeter have "h <= depth"
+    if( h <= depth )
+    {
+        const int d = Distance( x );
+        if( d >= 0 )
+            return d;
+        h = depth + 1;
+    }
+
+    const Cost cap = depth + static_cast< Cost >( m_margin );
+    if( h < cap )
+    {
+        const Cost f = Front( x, cap );
+        if( f > h )
+            h = f;
+    }
+
+    // The length of each path to the GOAL state has the same parity as Manhattan distance
+    // (and the original heuristic), hence the estimate is rounded up to this parity
+    return h + ( ( h - h0 ) & 1 );
+}
+
+#endif
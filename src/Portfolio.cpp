@@ -0,0 +1,141 @@
+#include "Portfolio.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+
+//
+// Adds engine "engine" named "name" to portfolio
+//
+void Portfolio::Add( const std::string& name, std::unique_ptr< Engine > engine )
+{
+    m_engine.push_back( std::move( engine ) );
+
+    Stats st;
+    st.m_name = name;
+    m_stats.push_back( st );
+}
+
+//
+// Sets the heuristic of the graphs of all engines and the perimeter shared by them
+//
+void Portfolio::SetHeuristic( Graph::Heuristic heuristic, const Perimeter* perimeter )
+{
+    m_heuristic = heuristic;
+    m_perimeter = perimeter;
+}
+
+//
+// Runs all engines concurrently on instance "beg" with the limits "limits".
+// The time limit is the deadline of the race, zero means no limit.
+// The losers are cancelled by the flag of the portfolio, the flag of "limits" is not used.
+//
+Portfolio::Result Portfolio::Solve( const State& beg, const Limits& limits )
+{
+    const size_t engineNo = m_engine.size();
+    const double deadline = limits.m_maxSeconds;
+
+    std::atomic< bool > cancel{ false };
+    std::mutex mutex;
+    std::condition_variable done;
+
+    // Outcomes of engines, protected by "mutex"
+    std::vector< std::optional< std::vector< State > > > found( engineNo );
+    std::vector< double > seconds( engineNo, 0 );
+    size_t finishedNo = 0;
+    size_t winner = engineNo;
+
+    Limits race = limits;
+    race.m_cancel = &cancel;
+
+    Limits clock;
+    clock.Start();
+
+    std::vector< std::thread > threads;
+    for( size_t i = 0; i < engineNo; i++ )
+    {
+        threads.emplace_back( [&, i]
+        {
+            Graph graph( m_heuristic );
+            graph.SetPerimeter( m_perimeter );
+            std::optional< std::vector< State > > path = m_engine[ i ]->Solve( graph, beg, race );
+
+            std::lock_guard< std::mutex > lock( mutex );
+            seconds[ i ] = clock.Elapsed();
+            if( path.has_value() && m_engine[ i ]->IsOptimal() && winner == engineNo )
+                winner = i;
+            found[ i ] = std::move( path );
+            finishedNo++;
+            done.notify_all();
+        } );
+    }
+
+    {
+        std::unique_lock< std::mutex > lock( mutex );
+        auto finished = [&] { return winner < engineNo || finishedNo == engineNo; };
+
+        if( deadline > 0 )
+            done.wait_for( lock, std::chrono::duration< double >( deadline ), finished );
+        else
+            done.wait( lock, finished );
+
+        // Losers are cancelled
+        cancel.store( true );
+    }
+
+    for( auto& t : threads )
+        t.join();
+
+    // If there is no optimal solution, the shortest bounded solution is taken
+    bool optimal = ( winner < engineNo );
+    if( !optimal )
+    {
+        for( size_t i = 0; i < engineNo; i++ )
+        {
+            if( found[ i ].has_value() && ( winner == engineNo || found[ i ]->size() < found[ winner ]->size() ) )
+                winner = i;
+        }
+    }
+
+    Result res;
+    res.m_seconds = clock.Elapsed();
+
+    for( size_t i = 0; i < engineNo; i++ )
+    {
+        m_stats[ i ].m_runNo++;
+        if( found[ i ].has_value() && !m_engine[ i ]->IsOptimal() )
+            m_stats[ i ].m_boundedNo++;
+    }
+
+    if( winner < engineNo )
+    {
+        m_stats[ winner ].m_winNo++;
+        m_stats[ winner ].m_winSeconds += seconds[ winner ];
+
+        res.m_path = std::move( found[ winner ] );
+        res.m_optimal = optimal;
+        res.m_winner = m_stats[ winner ].m_name;
+    }
+
+    return res;
+}
+
+//
+// Prints statistics of engines
+//
+void Portfolio::PrintStats( std::ostream& out ) const
+{
+    out << "PORTFOLIO-STATISTICS:\n";
+    out << "   engine           runs   wins  bounded  avg-win-time[s]\n";
+
+    for( const Stats& st : m_stats )
+    {
+        char line[ 128 ];
+        snprintf( line, sizeof( line ), "   %-15s %5zu  %5zu  %7zu  %15.4f\n",
+            st.m_name.c_str(), st.m_runNo, st.m_winNo, st.m_boundedNo,
+            st.m_winNo > 0 ? st.m_winSeconds / st.m_winNo : 0.0 );
+        out << line;
+    }
+}
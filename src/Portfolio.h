@@ -0,0 +1,83 @@
+#ifndef ASTAR_PORTFOLIO_H
+#define ASTAR_PORTFOLIO_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Portfolio of search engines racing on the same instance.
+//
+// 2. Each engine is run on its own thread. The engines are created once,
+//    when they are added to the portfolio, and reused by all instances.
+//
+// 3. The first proven-optimal solution wins, and the other engines are cancelled.
+//
+// 4. If no optimal solution is found before the deadline, the shortest bounded
+//    solution (found by engine which does not guarantee optimality) is returned.
+//
+// 5. For each engine the statistics are collected: number of runs, number of wins,
+//    number of bounded solutions and the time of winning runs.
+//    They help to tune the composition of portfolio.
+//
+// 6. All engines use the same heuristic and the perimeter (function SetHeuristic)
+//    and the same limits. The time limit of the limits is the deadline of the race.
+//
+
+#include "Engine.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include <ostream>
+
+class Portfolio
+{
+public:
+    // Result of the race
+    struct Result
+    {
+        // Found solution, empty if not found
+        std::optional< std::vector< State > > m_path;
+
+        // "true" if the solution is proven-optimal
+        bool m_optimal = false;
+
+        // Name of the winning engine
+        std::string m_winner;
+
+        // Wall time in seconds
+        double m_seconds = 0;
+    };
+
+    // Statistics of the engine
+    struct Stats
+    {
+        std::string m_name;
+        size_t m_runNo = 0;
+        size_t m_winNo = 0;
+        size_t m_boundedNo = 0;
+        double m_winSeconds = 0;
+    };
+
+public:
+    void Add( const std::string& name, std::unique_ptr< Engine > engine );
+
+    void SetHeuristic( Graph::Heuristic heuristic, const Perimeter* perimeter );
+
+    Result Solve( const State& beg, const Limits& limits );
+
+    const std::vector< Stats >& GetStats( ) const { return m_stats; }
+    void PrintStats( std::ostream& out ) const;
+
+private:
+    // Engines taking part in the race
+    std::vector< std::unique_ptr< Engine > > m_engine;
+
+    // Statistics of engines, indexed as m_engine
+    std::vector< Stats > m_stats;
+
+    // Heuristic of the graphs and the perimeter shared by them, NULL if it is not used
+    Graph::Heuristic m_heuristic = Graph::MANHATTAN;
+    const Perimeter* m_perimeter = nullptr;
+};
+
+#endif
@@ -0,0 +1,277 @@
+#include "Profiler.h"
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstring>
+#include <cstdio>
+#include <cassert>
+
+//
+// Constructor
+// "hardware" - if "true", the hardware counters are opened
+//
+Profiler::Profiler( bool hardware )
+    : m_eventNo( 0 )
+    , m_hardware( hardware )
+    , m_secondsPerTick( 1e-9 )
+{
+    if( hardware )
+        OpenCounters();
+
+    Calibrate();
+    Reset();
+}
+
+//
+// Destructor. Closes the hardware counters.
+//
+Profiler::~Profiler( )
+{
+    CloseCounters();
+}
+
+//
+// Sets all measurements to zero
+//
+void Profiler::Reset( )
+{
+    memset( m_phase, 0, sizeof( m_phase ) );
+    Mark();
+}
+
+//
+// Opens the hardware counters of the calling thread. The counters, which cannot be opened, are skipped.
+//
+void Profiler::OpenCounters( )
+{
+    m_thread = std::this_thread::get_id();
+
+    for( int e = 0; e < EVENT_NO; e++ )
+    {
+        perf_event_attr attr;
+        memset( &attr, 0, sizeof( attr ) );
+        attr.size = sizeof( attr );
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        switch( e )
+        {
+        case CACHE_MISSES:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        case BRANCH_MISSES:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        case DTLB_MISSES:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) |
+                ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 );
+            break;
+        }
+
+        // The counter of the calling thread on any processor
+        const int fd = static_cast< int >( syscall( SYS_perf_event_open, &attr, 0, -1, -1, 0 ) );
+        if( fd < 0 )
+            continue;
+
+        Counter& c = m_counter[ e ];
+        c.m_fd = fd;
+
+        // The page with the information required by instruction rdpmc
+        void* page = mmap( nullptr, sysconf( _SC_PAGESIZE ), PROT_READ, MAP_SHARED, fd, 0 );
+        if( page != MAP_FAILED )
+            c.m_page = page;
+
+        m_eventNo++;
+    }
+}
+
+//
+// Closes the hardware counters
+//
+void Profiler::CloseCounters( )
+{
+    for( Counter& c : m_counter )
+    {
+        if( c.m_page )
+            munmap( c.m_page, sysconf( _SC_PAGESIZE ) );
+        if( c.m_fd >= 0 )
+            close( c.m_fd );
+        c = Counter();
+    }
+    m_eventNo = 0;
+}
+
+//
+// Returns the current value of counter "e"
+//
+uint64_t Profiler::ReadCounter( Event e ) const
+{
+    const Counter& c = m_counter[ e ];
+    if( c.m_fd < 0 )
+        return 0;
+
+#ifdef ASTAR_PROFILER_TSC
+    // Reading in user space, see the description of perf_event_mmap_page in <linux/perf_event.h>
+    if( c.m_page )
+    {
+        const volatile perf_event_mmap_page* pc = static_cast< const volatile perf_event_mmap_page* >( c.m_page );
+        uint32_t seq;
+        uint64_t count;
+        bool ok;
+
+        do
+        {
+            seq = pc->lock;
+            __sync_synchronize();
+
+            const uint32_t idx = pc->index;
+            ok = pc->cap_user_rdpmc && idx != 0;
+            count = pc->offset;
+
+            if( ok )
+            {
+                const uint16_t width = pc->pmc_width;
+                int64_t pmc = __rdpmc( idx - 1 );
+                pmc <<= 64 - width;
+                pmc >>= 64 - width;
+                count += pmc;
+            }
+
+            __sync_synchronize();
+        }
+        while( pc->lock != seq );
+
+        if( ok )
+            return count;
+    }
+#endif
+
+    uint64_t value = 0;
+    if( read( c.m_fd, &value, sizeof( value ) ) != sizeof( value ) )
+        return 0;
+    return value;
+}
+
+//
+// The hardware events since the previous call of Lap or Mark are attributed to phase "p"
+//
+void Profiler::ReadEvents( Phase p )
+{
+    for( int e = 0; e < EVENT_NO; e++ )
+    {
+        const uint64_t v = ReadCounter( static_cast< Event >( e ) );
+        m_phase[ p ].m_events[ e ] += v - m_lastEvent[ e ];
+        m_lastEvent[ e ] = v;
+    }
+}
+
+//
+// Calculates the length of the tick
+//
+void Profiler::Calibrate( )
+{
+#ifdef ASTAR_PROFILER_TSC
+    using Clock = std::chrono::steady_clock;
+
+    const Clock::time_point t0 = Clock::now();
+    const uint64_t c0 = Now();
+
+    // Busy wait, since the ticks must be compared with the wall time
+    Clock::time_point t1;
+    do
+    {
+        t1 = Clock::now();
+    }
+    while( t1 - t0 < std::chrono::milliseconds( 20 ) );
+
+    const uint64_t c1 = Now();
+    const std::chrono::duration< double > d = t1 - t0;
+    m_secondsPerTick = d.count() / static_cast< double >( c1 - c0 );
+#else
+    m_secondsPerTick = 1e-9;
+#endif
+}
+
+//
+// Returns name of phase "p"
+//
+const char* Profiler::Name( Phase p )
+{
+    static const char* const name[ PHASE_NO ] = {
+        "select",
+        "close",
+        "moves",
+        "heuristic",
+        "closed-lookup",
+        "open-lookup",
+        "alloc",
+        "open-insert",
+        "open-update" };
+
+    assert( p < PHASE_NO );
+    return name[ p ];
+}
+
+//
+// Returns name of event "e"
+//
+const char* Profiler::Name( Event e )
+{
+    static const char* const name[ EVENT_NO ] = {
+        "cache-miss",
+        "branch-miss",
+        "dtlb-miss" };
+
+    assert( e < EVENT_NO );
+    return name[ e ];
+}
+
+//
+// Prints the breakdown of time (and hardware events) by phases
+//
+void Profiler::Print( std::ostream& out ) const
+{
+    uint64_t total = 0;
+    for( const Stats& s : m_phase )
+        total += s.m_ticks;
+
+    char line[ 256 ];
+    int n = snprintf( line, sizeof( line ), "   %-14s %12s %10s %7s %9s", "phase", "calls", "time[ms]", "time[%]", "ns/call" );
+    for( int e = 0; e < EVENT_NO; e++ )
+    {
+        if( HasEvent( static_cast< Event >( e ) ) )
+            n += snprintf( line + n, sizeof( line ) - n, " %12s", Name( static_cast< Event >( e ) ) );
+    }
+
+    out << "PROFILE:\n" << line << "\n";
+
+    for( int p = 0; p < PHASE_NO; p++ )
+    {
+        const Stats& s = m_phase[ p ];
+        const double sec = s.m_ticks * m_secondsPerTick;
+
+        n = snprintf( line, sizeof( line ), "   %-14s %12llu %10.2f %7.2f %9.1f",
+            Name( static_cast< Phase >( p ) ),
+            static_cast< unsigned long long >( s.m_calls ),
+            1e3 * sec,
+            total > 0 ? 100.0 * s.m_ticks / total : 0.0,
+            s.m_calls > 0 ? 1e9 * sec / s.m_calls : 0.0 );
+
+        for( int e = 0; e < EVENT_NO; e++ )
+        {
+            if( HasEvent( static_cast< Event >( e ) ) )
+                n += snprintf( line + n, sizeof( line ) - n, " %12llu", static_cast< unsigned long long >( s.m_events[ e ] ) );
+        }
+
+        out << line << "\n";
+    }
+
+    if( m_eventNo == 0 )
+        out << "   Hardware counters are not available.\n";
+}
@@ -0,0 +1,192 @@
+#ifndef ASTAR_PROFILER_H
+#define ASTAR_PROFILER_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Profiler of the phases of the search (selection of the best node, generation of
+//    children, evaluation of heuristic, searching in hash tables, etc.).
+//
+// 2. The solver calls function Lap at the end of each phase. The time elapsed since
+//    the previous call of Lap (or Mark) is attributed to the phase.
+//    The time is measured by the time stamp counter (TSC) of the processor.
+//    On other processors std::chrono::steady_clock is used.
+//
+// 3. If the hardware counters are requested, the cache misses, branch misses and
+//    data TLB misses are attributed to the phases as well. The counters are opened by
+//    system call perf_event_open and read in user space (instruction rdpmc),
+//    if the kernel allows it. Otherwise they are read by system call "read",
+//    which is much slower and disturbs the measurement.
+//    If the counters are not available (e.g. virtual machine, or perf_event_paranoid
+//    forbids it), only the time is measured.
+//
+// 4. The profiling is optional. If the solver has no profiler, the phases are not measured.
+//    Measuring the phases costs tens of cycles per phase, hence the profiled search is slower.
+//
+// 5. The hardware counters count the events of the thread, which opened them. Function Mark
+//    opens them again, if it is called by other thread than the previous one, hence the counters
+//    follow the thread running the search, not the thread constructing the profiler.
+//    The profiler is not shared by the threads searching at the same time, each of them
+//    has its own profiler (e.g. the workers of option --threads).
+//
+
+#include <cstdint>
+#include <cstddef>
+#include <ostream>
+#include <thread>
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+#include <x86intrin.h>
+#define ASTAR_PROFILER_TSC
+#else
+#include <chrono>
+#endif
+
+class Profiler
+{
+public:
+    enum Phase
+    {
+        SELECT,         // Checking the limits, selection and removal of the best node from open set
+        CLOSE,          // Insertion of the expanded node into closed set
+        MOVES,          // Generation of children (Graph::GetMoves)
+        HEURISTIC,      // Evaluation of heuristic
+        CLOSED_LOOKUP,  // Searching for children in closed set
+        OPEN_LOOKUP,    // Searching for children in open set
+        ALLOC,          // Allocation of nodes (MemMgr)
+        OPEN_INSERT,    // Insertion of new nodes into open set
+        OPEN_UPDATE,    // Decreasing the cost of nodes in open set
+        PHASE_NO
+    };
+
+    enum Event
+    {
+        CACHE_MISSES,
+        BRANCH_MISSES,
+        DTLB_MISSES,
+        EVENT_NO
+    };
+
+public:
+    explicit Profiler( bool hardware = true );
+    ~Profiler( );
+
+    Profiler( const Profiler& ) = delete;
+    Profiler& operator=( const Profiler& ) = delete;
+
+    void Reset( );
+    void Mark( );
+    void Lap( Phase p );
+
+    uint64_t Calls( Phase p ) const { return m_phase[ p ].m_calls; }
+    uint64_t Ticks( Phase p ) const { return m_phase[ p ].m_ticks; }
+    uint64_t Events( Phase p, Event e ) const { return m_phase[ p ].m_events[ e ]; }
+    bool HasEvent( Event e ) const { return m_counter[ e ].m_fd >= 0; }
+    double Seconds( Phase p ) const { return m_phase[ p ].m_ticks * m_secondsPerTick; }
+
+    void Print( std::ostream& out ) const;
+
+    static const char* Name( Phase p );
+    static const char* Name( Event e );
+
+private:
+    static uint64_t Now( );
+    void ReadEvents( Phase p );
+    uint64_t ReadCounter( Event e ) const;
+    void OpenCounters( );
+    void CloseCounters( );
+    void Calibrate( );
+
+private:
+    // Measurements of single phase
+    struct Stats
+    {
+        uint64_t m_calls;
+        uint64_t m_ticks;
+        uint64_t m_events[ EVENT_NO ];
+    };
+
+    // Hardware counter opened by perf_event_open
+    struct Counter
+    {
+        int m_fd = -1;
+        void* m_page = nullptr;
+    };
+
+private:
+    Stats m_phase[ PHASE_NO ];
+
+    // Time of the last call of Lap or Mark
+    uint64_t m_last;
+
+    // Values of counters at the last call of Lap or Mark
+    uint64_t m_lastEvent[ EVENT_NO ];
+
+    Counter m_counter[ EVENT_NO ];
+
+    // Number of opened counters
+    unsigned int m_eventNo;
+
+    // "true" if the hardware counters are requested
+    bool m_hardware;
+
+    // Thread, whose events are counted
+    std::thread::id m_thread;
+
+    // Length of the tick in seconds
+    double m_secondsPerTick;
+};
+
+//
+// Returns the current time in ticks
+//
+inline
+uint64_t Profiler::Now( )
+{
+#ifdef ASTAR_PROFILER_TSC
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast< std::chrono::nanoseconds >(
+        std::chrono::steady_clock::now().time_since_epoch() ).count();
+#endif
+}
+
+//
+// The time of the previous phase is not attributed to any phase.
+// It is called at the beginning of the measured code, by the thread running it.
+//
+inline
+void Profiler::Mark( )
+{
+    if( m_hardware && std::this_thread::get_id() != m_thread )
+    {
+        CloseCounters();
+        OpenCounters();
+    }
+
+    m_last = Now();
+    if( m_eventNo > 0 )
+    {
+        for( int e = 0; e < EVENT_NO; e++ )
+            m_lastEvent[ e ] = ReadCounter( static_cast< Event >( e ) );
+    }
+}
+
+//
+// The time (and the hardware events) since the previous call of Lap or Mark
+// is attributed to phase "p".
+//
+inline
+void Profiler::Lap( Phase p )
+{
+    const uint64_t t = Now();
+    m_phase[ p ].m_calls++;
+    m_phase[ p ].m_ticks += t - m_last;
+    m_last = t;
+
+    if( m_eventNo > 0 )
+        ReadEvents( p );
+}
+
+#endif
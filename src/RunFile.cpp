@@ -0,0 +1,198 @@
+#include "RunFile.h"
+#include <algorithm>
+#include <stdexcept>
+
+// ---------------------------------------------------------------------------------
+//   I / O   T H R E A D
+// ---------------------------------------------------------------------------------
+
+//
+// Constructor. Starts the thread.
+// "queueSize" - maximal number of the tasks waiting in the queue
+//
+IoThread::IoThread( size_t queueSize )
+    : m_queueSize( std::max< size_t >( queueSize, 1 ) )
+    , m_stop( false )
+    , m_thread( &IoThread::Run, this )
+{
+}
+
+//
+// Destructor. Runs the waiting tasks and stops the thread.
+//
+IoThread::~IoThread( )
+{
+    {
+        std::lock_guard< std::mutex > lock( m_mutex );
+        m_stop = true;
+    }
+    m_posted.notify_one();
+    m_thread.join();
+}
+
+//
+// Runs the tasks in the order of posting, until the thread is stopped
+//
+void IoThread::Run( )
+{
+    for( ;; )
+    {
+        std::function< void( ) > task;
+        {
+            std::unique_lock< std::mutex > lock( m_mutex );
+            m_posted.wait( lock, [ this ]( ) { return m_stop || !m_queue.empty(); } );
+            if( m_queue.empty() )
+                return;
+
+            task = std::move( m_queue.front() );
+            m_queue.pop_front();
+        }
+        m_taken.notify_one();
+
+        // The exception of the task is kept by its future
+        task();
+    }
+}
+
+// ---------------------------------------------------------------------------------
+//   R U N   W R I T E R
+// ---------------------------------------------------------------------------------
+
+//
+// Constructor. Creates the file "path", or opens it for appending, if "append" is "true".
+// The file is written by thread "io".
+//
+RunWriter::RunWriter( IoThread& io, const std::string& path, bool append, size_t bufferBytes )
+    : m_io( io )
+    , m_path( path )
+    , m_file( fopen( path.c_str(), append ? "ab" : "wb" ) )
+    , m_buffer( std::max< size_t >( bufferBytes / sizeof( PackedState ), 1 ) )
+    , m_pending( m_buffer.size() )
+    , m_size( 0 )
+    , m_count( 0 )
+{
+    if( !m_file )
+        Error( "Cannot open file." );
+
+    setvbuf( m_file, nullptr, _IONBF, 0 );
+}
+
+//
+// Destructor. The file, which is not closed by function Close, is closed without checking errors.
+//
+RunWriter::~RunWriter( )
+{
+    if( !m_file )
+        return;
+
+    if( m_write.valid() )
+        m_write.wait();
+    fclose( m_file );
+}
+
+//
+// Writes the remaining states and closes the file
+//
+void RunWriter::Close( )
+{
+    if( !m_file )
+        return;
+
+    Flush();
+    Wait();
+
+    const bool ok = ( fclose( m_file ) == 0 );
+    m_file = nullptr;
+    if( !ok )
+        Error( "Error during writing file." );
+}
+
+//
+// Passes the collected states to the background task, after the previous task is finished
+//
+void RunWriter::Flush( )
+{
+    Wait();
+    if( m_size == 0 )
+        return;
+
+    m_buffer.swap( m_pending );
+    const size_t n = m_size;
+    m_size = 0;
+
+    m_write = m_io.Post( [ this, n ]( ) {
+        return fwrite( m_pending.data(), sizeof( PackedState ), n, m_file ) == n;
+    } );
+}
+
+//
+// Waits for the background task. Throws the exception, if the writing fails.
+//
+void RunWriter::Wait( )
+{
+    if( m_write.valid() && !m_write.get() )
+        Error( "Error during writing file." );
+}
+
+//
+// Throws exception with error message
+//
+void RunWriter::Error( const char* what ) const
+{
+    std::string msg = what;
+    msg += "\nPath = " + m_path;
+    throw std::invalid_argument( msg );
+}
+
+// ---------------------------------------------------------------------------------
+//   R U N   R E A D E R
+// ---------------------------------------------------------------------------------
+
+//
+// Constructor. Opens the file and starts reading its first part by thread "io".
+//
+RunReader::RunReader( IoThread& io, const std::string& path, size_t bufferBytes )
+    : m_io( io )
+    , m_path( path )
+    , m_file( fopen( path.c_str(), "rb" ) )
+    , m_buffer( std::max< size_t >( bufferBytes / sizeof( PackedState ), 1 ) )
+    , m_ahead( m_buffer.size() )
+    , m_size( 0 )
+    , m_pos( 0 )
+{
+    if( !m_file )
+    {
+        const std::string msg = "Cannot open file. Path = " + m_path;
+        throw std::invalid_argument( msg );
+    }
+
+    setvbuf( m_file, nullptr, _IONBF, 0 );
+    ReadAhead();
+}
+
+//
+// Destructor. Waits for the background task.
+//
+RunReader::~RunReader( )
+{
+    if( m_read.valid() )
+        m_read.wait();
+    fclose( m_file );
+}
+
+//
+// Starts the background task reading the next part of the file to "m_ahead".
+// The incomplete state at the end of the file is ignored.
+//
+void RunReader::ReadAhead( )
+{
+    m_read = m_io.Post( [ this ]( ) {
+        const size_t n = fread( m_ahead.data(), sizeof( PackedState ), m_ahead.size(), m_file );
+        if( n < m_ahead.size() && ferror( m_file ) )
+        {
+            const std::string msg = "Error during reading file.\nPath = " + m_path;
+            throw std::invalid_argument( msg );
+        }
+        return n;
+    } );
+}
@@ -0,0 +1,216 @@
+#ifndef ASTAR_RUNFILE_H
+#define ASTAR_RUNFILE_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Sequential files of packed states (run files) used by the external-memory search
+//    (see ExternalAstar.h). Each state occupies 16 bytes, the file has no header.
+//
+// 2. RunWriter appends the states to the file. The states are collected in the buffer.
+//    When the buffer is full, it is written by the background task (write-behind),
+//    while the states are collected in the second buffer. Hence, the search does not wait
+//    for the disk, unless the disk is slower than the search.
+//
+// 3. RunReader reads the states from the file. The next part of the file is read
+//    by the background task (read-ahead), while the states of the current buffer are consumed.
+//
+// 4. The background tasks of all files of the search are run by one persistent thread
+//    (class IoThread), which is owned by the search and passed to the writers and readers.
+//    The tasks are run in the order of posting. The queue of the waiting tasks is bounded,
+//    posting to the full queue waits, hence the files cannot run ahead of the disk.
+//    Each file has at most one task in the queue.
+//
+// 5. The files are only read or written sequentially, by large blocks of "bufferBytes".
+//    The buffering of the C library is disabled.
+//
+// 6. If the file cannot be opened, read or written, the exception std::invalid_argument is thrown.
+//    The errors of the background tasks are thrown by the next call of the writer or reader.
+//
+
+#include "PackedState.h"
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class IoThread
+{
+public:
+    // Default number of the tasks waiting in the queue
+    inline static constexpr size_t QUEUE_SIZE = 64;
+
+public:
+    explicit IoThread( size_t queueSize = QUEUE_SIZE );
+    ~IoThread( );
+
+    IoThread( const IoThread& ) = delete;
+    IoThread& operator=( const IoThread& ) = delete;
+
+    template< typename F >
+    auto Post( F task ) -> std::future< decltype( task() ) >;
+
+private:
+    void Run( );
+
+private:
+    std::mutex m_mutex;
+
+    // Signalled, when the task is posted or the thread is stopped
+    std::condition_variable m_posted;
+
+    // Signalled, when the task is taken from the queue
+    std::condition_variable m_taken;
+
+    // Tasks waiting for the thread and the maximal number of them
+    std::deque< std::function< void( ) > > m_queue;
+    const size_t m_queueSize;
+
+    // The thread is stopped, after the waiting tasks are run
+    bool m_stop;
+
+    // The thread is started, after the other members are initialized
+    std::thread m_thread;
+};
+
+class RunWriter
+{
+public:
+    // Default size of each of two buffers
+    inline static constexpr size_t BUFFER_BYTES = 1 << 20;
+
+public:
+    RunWriter( IoThread& io, const std::string& path, bool append, size_t bufferBytes = BUFFER_BYTES );
+    ~RunWriter( );
+
+    RunWriter( const RunWriter& ) = delete;
+    RunWriter& operator=( const RunWriter& ) = delete;
+
+    void Write( const PackedState& s );
+    void Close( );
+
+    // Number of states written by this writer
+    uint64_t Count( ) const { return m_count; }
+
+    // Memory of the buffers
+    size_t Bytes( ) const { return 2 * m_buffer.size() * sizeof( PackedState ); }
+
+private:
+    void Flush( );
+    void Wait( );
+    void Error( const char* what ) const;
+
+private:
+    IoThread& m_io;
+    std::string m_path;
+    FILE* m_file;
+
+    // Buffer collecting the states and the buffer written by the background task
+    std::vector< PackedState > m_buffer;
+    std::vector< PackedState > m_pending;
+    size_t m_size;
+
+    // Background task writing "m_pending", "false" if the writing fails
+    std::future< bool > m_write;
+
+    uint64_t m_count;
+};
+
+class RunReader
+{
+public:
+    // Default size of each of two buffers
+    inline static constexpr size_t BUFFER_BYTES = 1 << 20;
+
+public:
+    RunReader( IoThread& io, const std::string& path, size_t bufferBytes = BUFFER_BYTES );
+    ~RunReader( );
+
+    RunReader( const RunReader& ) = delete;
+    RunReader& operator=( const RunReader& ) = delete;
+
+    bool Read( PackedState& s );
+
+    // Memory of the buffers
+    size_t Bytes( ) const { return 2 * m_buffer.size() * sizeof( PackedState ); }
+
+private:
+    void ReadAhead( );
+
+private:
+    IoThread& m_io;
+    std::string m_path;
+    FILE* m_file;
+
+    // Buffer consumed by function Read and the buffer filled by the background task
+    std::vector< PackedState > m_buffer;
+    std::vector< PackedState > m_ahead;
+    size_t m_size;
+    size_t m_pos;
+
+    // Background task filling "m_ahead", returns the number of states read
+    std::future< size_t > m_read;
+};
+
+//
+// Passes "task" to the thread. Waits, if the queue is full.
+// Returns the future of the result of the task, or of its exception.
+//
+template< typename F >
+auto IoThread::Post( F task ) -> std::future< decltype( task() ) >
+{
+    using R = decltype( task() );
+
+    // The packaged task is not copyable, unlike the function in the queue
+    const std::shared_ptr< std::packaged_task< R( ) > > t = std::make_shared< std::packaged_task< R( ) > >( std::move( task ) );
+    std::future< R > result = t->get_future();
+    {
+        std::unique_lock< std::mutex > lock( m_mutex );
+        m_taken.wait( lock, [ this ]( ) { return m_queue.size() < m_queueSize; } );
+        m_queue.push_back( [ t ]( ) { ( *t )(); } );
+    }
+    m_posted.notify_one();
+    return result;
+}
+
+//
+// Appends state "s"
+//
+inline
+void RunWriter::Write( const PackedState& s )
+{
+    m_buffer[ m_size++ ] = s;
+    m_count++;
+    if( m_size == m_buffer.size() )
+        Flush();
+}
+
+//
+// Reads the next state to "s". Returns "false" at the end of the file.
+//
+inline
+bool RunReader::Read( PackedState& s )
+{
+    if( m_pos == m_size )
+    {
+        m_size = m_read.valid() ? m_read.get() : 0;
+        m_pos = 0;
+        if( m_size == 0 )
+            return false;
+
+        m_buffer.swap( m_ahead );
+        ReadAhead();
+    }
+    s = m_buffer[ m_pos++ ];
+    return true;
+}
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef ASTAR_SEARCHPROGRESS_H
+#define ASTAR_SEARCHPROGRESS_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Progress of the incremental search.
+//
+// 2. It is returned by function Step of the search engine
+//    and passed to the progress callback.
+//
+
+#include "Cost.h"
+#include <cstddef>
+
+class SearchProgress
+{
+public:
+    // State of the search
+    enum Status
+    {
+        RUNNING,   // Search is not finished, Step must be called again
+        FOUND,     // Solution is found
+        NOT_FOUND, // Solution does not exist
+        LIMIT      // Search was stopped by the limits
+    };
+
+    bool IsFinished( ) const { return m_status != RUNNING; }
+
+public:
+    Status m_status = RUNNING;
+
+    // The lowest value of "f = g + h" in the open set
+    Cost m_minF = 0;
+
+    // Number of nodes in open set and closed set
+    size_t m_openNo = 0;
+    size_t m_closedNo = 0;
+
+    // Number of expanded nodes from the beginning of search
+    size_t m_expandedNo = 0;
+
+    // Wall time in seconds from the beginning of search
+    double m_seconds = 0;
+
+    // Memory of the solver in bytes, the last sample and the peak (see class MemoryStats)
+    size_t m_memoryUsed = 0;
+    size_t m_memoryPeak = 0;
+};
+
+#endif
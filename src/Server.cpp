@@ -0,0 +1,428 @@
+#include "Server.h"
+#include "EngineRegistry.h"
+#include "Graph.h"
+#include "Solution.h"
+#include <algorithm>
+#include <stdexcept>
+#include <sstream>
+#include <map>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <cstdio>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+//
+// Constructor. Creates the listening socket.
+// "path"      - path to the Unix domain socket
+// "workerNo"  - number of workers, each worker owns its own solver
+// "queueSize" - maximal number of waiting requests
+//
+Server::Server( const std::string& path, unsigned int workerNo, size_t queueSize )
+    : m_path( path )
+    , m_fd( -1 )
+    , m_queueSize( queueSize )
+    , m_closed( false )
+    , m_workerNo( workerNo > 0 ? workerNo : 1 )
+{
+    sockaddr_un addr;
+    memset( &addr, 0, sizeof( addr ) );
+    addr.sun_family = AF_UNIX;
+
+    if( m_path.size() >= sizeof( addr.sun_path ) )
+        throw std::invalid_argument( "Path to the socket is too long. Path = " + m_path );
+    strcpy( addr.sun_path, m_path.c_str() );
+
+    m_fd = socket( AF_UNIX, SOCK_STREAM, 0 );
+    if( m_fd < 0 )
+        throw std::invalid_argument( "Cannot create socket. Path = " + m_path );
+
+    unlink( m_path.c_str() );
+    if( bind( m_fd, reinterpret_cast< sockaddr* >( &addr ), sizeof( addr ) ) != 0 || listen( m_fd, 64 ) != 0 )
+    {
+        close( m_fd );
+        throw std::invalid_argument( "Cannot bind socket. Path = " + m_path + ". " + strerror( errno ) );
+    }
+}
+
+//
+// Destructor
+//
+Server::~Server( )
+{
+    if( m_fd >= 0 )
+    {
+        close( m_fd );
+        unlink( m_path.c_str() );
+    }
+}
+
+//
+// Accepts the connections until "stop" is set.
+// After that, the waiting requests are completed and the function returns.
+//
+void Server::Run( const std::atomic< bool >& stop )
+{
+    for( unsigned int i = 0; i < m_workerNo; i++ )
+        m_workers.emplace_back( &Server::Worker, this );
+
+    while( !stop.load() )
+    {
+        pollfd pfd = { m_fd, POLLIN, 0 };
+        if( poll( &pfd, 1, 200 ) <= 0 )
+            continue;
+
+        const int fd = accept( m_fd, nullptr, nullptr );
+        if( fd < 0 )
+            continue;
+
+        JoinFinished();
+
+        auto conn = std::make_shared< Connection >( fd );
+        auto done = std::make_shared< std::atomic< bool > >( false );
+
+        std::lock_guard< std::mutex > lock( m_connMutex );
+        m_readers.push_back( ReaderThread{ std::thread( &Server::Reader, this, conn, done ), conn, done } );
+    }
+
+    // Stop reading the requests
+    {
+        std::lock_guard< std::mutex > lock( m_connMutex );
+        for( auto& r : m_readers )
+        {
+            if( auto conn = r.m_conn.lock() )
+                shutdown( conn->m_fd, SHUT_RD );
+        }
+    }
+
+    {
+        std::lock_guard< std::mutex > lock( m_mutex );
+        m_closed = true;
+    }
+    m_notEmpty.notify_all();
+    m_notFull.notify_all();
+
+    for( auto& r : m_readers )
+        r.m_thread.join();
+    m_readers.clear();
+
+    for( auto& t : m_workers )
+        t.join();
+}
+
+//
+// Joins the threads of closed connections
+//
+void Server::JoinFinished( )
+{
+    std::lock_guard< std::mutex > lock( m_connMutex );
+
+    for( size_t i = 0; i < m_readers.size(); )
+    {
+        if( m_readers[ i ].m_done->load() )
+        {
+            m_readers[ i ].m_thread.join();
+            m_readers[ i ] = std::move( m_readers.back() );
+            m_readers.pop_back();
+        }
+        else
+        {
+            i++;
+        }
+    }
+}
+
+//
+// Reads the requests from connection "conn" and puts them into the queue.
+// Flag "done" is set, when the connection is closed. The reading stops at the line
+// longer than MAX_LINE, hence the client cannot grow the memory of the server.
+//
+void Server::Reader( std::shared_ptr< Connection > conn, std::shared_ptr< std::atomic< bool > > done )
+{
+    std::string line;
+    size_t reqNo = 0;
+    char buf[ 4096 ];
+    bool open = true;
+
+    while( open )
+    {
+        const ssize_t n = recv( conn->m_fd, buf, sizeof( buf ), 0 );
+        if( n < 0 && errno == EINTR )
+            continue;
+        if( n <= 0 )
+            break;
+
+        for( ssize_t i = 0; i < n; i++ )
+        {
+            if( buf[ i ] != '\n' )
+            {
+                if( line.size() == MAX_LINE )
+                {
+                    // The client cannot send more. The received bytes are discarded, since
+                    // the socket closed with the unread bytes resets the connection and
+                    // the client would lose the response.
+                    conn->Send( std::to_string( ++reqNo ) + " ERROR line too long" );
+                    shutdown( conn->m_fd, SHUT_RD );
+                    while( recv( conn->m_fd, buf, sizeof( buf ), MSG_DONTWAIT ) > 0 )
+                        ;
+                    open = false;
+                    break;
+                }
+                line += buf[ i ];
+                continue;
+            }
+
+            // The clients sending CRLF line ends
+            if( !line.empty() && line.back() == '\r' )
+                line.pop_back();
+
+            Request req;
+            std::string error;
+            req.m_conn = conn;
+            req.m_id = std::to_string( ++reqNo );
+
+            if( !Parse( line, req, error ) )
+                conn->Send( req.m_id + " ERROR " + error );
+            else if( !Push( std::move( req ) ) )
+            {
+                open = false;
+                break;
+            }
+
+            line.clear();
+        }
+    }
+
+    done->store( true );
+}
+
+//
+// Solves the requests taken from the queue
+//
+void Server::Worker( )
+{
+    // Engine of each algorithm and its name. The engine is created on the first use
+    // and reused by the next requests of the same name.
+    struct Cached
+    {
+        std::string m_name;
+        std::unique_ptr< Engine > m_engine;
+    };
+
+    std::map< std::string, Cached > engines;
+    Graph graph;
+    Request req;
+
+    while( Pop( req ) )
+    {
+        try
+        {
+            Cached& cached = engines[ req.m_algorithm ];
+            if( !cached.m_engine || cached.m_name != req.m_engine )
+            {
+                // The previous engine is destroyed first, hence only one of them is allocated
+                cached.m_engine.reset();
+                cached.m_engine = EngineRegistry::Create( req.m_engine );
+                cached.m_engine->SetMetricsEnabled( false );
+                cached.m_name = req.m_engine;
+            }
+            Engine& engine = *cached.m_engine;
+
+            const std::optional< std::vector< State > > path = engine.Solve( graph, req.m_beg, req.m_limits );
+            const double sec = req.m_limits.Elapsed();
+
+            char time[ 32 ];
+            snprintf( time, sizeof( time ), "%.6f", sec );
+
+            if( path.has_value() )
+            {
+                const Solution sol = Solution::FromPath( path.value(), engine.IsOptimal() );
+                req.m_conn->Send( req.m_id + " OK " + std::to_string( sol.Length() ) + " " + time + " " + sol.ToText( req.m_beg ) );
+            }
+            else
+            {
+                const char* reason = engine.LimitReached() ? "limit" : "no-solution";
+                req.m_conn->Send( req.m_id + " FAIL " + reason + " " + time );
+            }
+
+            engine.Release();
+        }
+        catch( const std::exception& e )
+        {
+            // The engine may be left in any state, hence it is destroyed
+            engines.erase( req.m_algorithm );
+
+            std::string msg = e.what();
+            std::replace( msg.begin(), msg.end(), '\n', ' ' );
+            req.m_conn->Send( req.m_id + " FAIL error " + msg );
+        }
+
+        // Release the connection
+        req.m_conn.reset();
+    }
+}
+
+//
+// Parses the request stored in "line".
+// Returns "false" and the message in "error" if the request is not correct.
+//
+bool Server::Parse( const std::string& line, Request& req, std::string& error ) const
+{
+    std::istringstream in( line );
+    std::string tok;
+    std::array< char, State::TILENO > tab;
+    uint tileNo = 0;
+    uint32_t seen = 0;
+
+    req.m_engine = "astar";
+
+    while( in >> tok )
+    {
+        const size_t eq = tok.find( '=' );
+        if( eq != std::string::npos )
+        {
+            const std::string key = tok.substr( 0, eq );
+            const std::string val = tok.substr( eq + 1 );
+            char* end = nullptr;
+
+            if( key == "id" )
+                req.m_id = val;
+            else if( key == "engine" )
+                req.m_engine = val;
+            else if( key == "max-expanded" )
+                req.m_limits.m_maxExpanded = strtoull( val.c_str(), &end, 10 );
+            else if( key == "time" )
+                req.m_limits.m_maxSeconds = strtod( val.c_str(), &end );
+            else
+            {
+                error = "Unknown parameter: " + key;
+                return false;
+            }
+
+            if( end && ( end == val.c_str() || *end != '\0' ) )
+            {
+                error = "Not allowed value of parameter: " + key;
+                return false;
+            }
+            continue;
+        }
+
+        char* end;
+        const long t = strtol( tok.c_str(), &end, 10 );
+        if( *end != '\0' || t < 0 || t >= static_cast< long >( State::TILENO ) || tileNo >= State::TILENO )
+        {
+            error = "Not allowed tile: " + tok;
+            return false;
+        }
+
+        if( seen & ( 1u << t ) )
+        {
+            error = "Duplicated tile: " + tok;
+            return false;
+        }
+
+        seen |= 1u << t;
+        tab[ tileNo++ ] = static_cast< char >( t );
+    }
+
+    if( tileNo != State::TILENO )
+    {
+        error = "Expected " + std::to_string( State::TILENO ) + " tiles";
+        return false;
+    }
+
+    try
+    {
+        EngineRegistry::Params params;
+        req.m_algorithm = EngineRegistry::Find( req.m_engine, "hash", "hash", params ).m_algorithm;
+
+        if( params.m_table > MAX_ENGINE_MIB || params.m_sort > MAX_ENGINE_MIB )
+        {
+            error = "Memory of engine is above " + std::to_string( MAX_ENGINE_MIB ) + " MiB: " + req.m_engine;
+            return false;
+        }
+    }
+    catch( const std::invalid_argument& e )
+    {
+        error = e.what();
+        return false;
+    }
+
+    req.m_beg = State{ tab };
+    if( !req.m_beg.IsSolvable() )
+    {
+        error = "The state is not solvable";
+        return false;
+    }
+
+    return true;
+}
+
+//
+// Puts the request into the queue. Waits if the queue is full.
+// Returns "false" if the server is stopped.
+//
+bool Server::Push( Request&& req )
+{
+    std::unique_lock< std::mutex > lock( m_mutex );
+    m_notFull.wait( lock, [this] { return m_closed || m_queue.size() < m_queueSize; } );
+
+    if( m_closed )
+        return false;
+
+    m_queue.push_back( std::move( req ) );
+    m_notEmpty.notify_one();
+    return true;
+}
+
+//
+// Takes the request from the queue. Waits if the queue is empty.
+// Returns "false" if the server is stopped and the queue is empty.
+//
+bool Server::Pop( Request& req )
+{
+    std::unique_lock< std::mutex > lock( m_mutex );
+    m_notEmpty.wait( lock, [this] { return m_closed || !m_queue.empty(); } );
+
+    if( m_queue.empty() )
+        return false;
+
+    req = std::move( m_queue.front() );
+    m_queue.pop_front();
+    m_notFull.notify_one();
+
+    // The limits are measured from the beginning of solving
+    req.m_limits.Start();
+    return true;
+}
+
+//
+// Destructor of connection. Closes the socket.
+//
+Server::Connection::~Connection( )
+{
+    close( m_fd );
+}
+
+//
+// Sends "line" to the client
+//
+void Server::Connection::Send( const std::string& line )
+{
+    std::lock_guard< std::mutex > lock( m_mutex );
+
+    const std::string msg = line + "\n";
+    size_t done = 0;
+    while( done < msg.size() )
+    {
+        const ssize_t n = send( m_fd, msg.data() + done, msg.size() - done, MSG_NOSIGNAL );
+        if( n < 0 && errno == EINTR )
+            continue;
+        if( n <= 0 )
+            return; // Client is gone
+        done += n;
+    }
+}
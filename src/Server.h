@@ -0,0 +1,138 @@
+#ifndef ASTAR_SERVER_H
+#define ASTAR_SERVER_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Long-running solver service listening on the Unix domain socket.
+//
+// 2. Each request is a single line. It consists of the tiles of the initial state
+//    and optional parameters written as "key=value":
+//       id=STRING         - identifier of the request, echoed in the response
+//       engine=NAME       - search engine: astar (default), wastar-W, alstar-K, epea, idastar,
+//                           idastar-basic, idastar-tt-M, bfhs, extastar-M
+//                           (see EngineRegistry.h), the memory M is at most MAX_ENGINE_MIB
+//       max-expanded=N    - limit of expanded nodes
+//       time=SECONDS      - limit of wall time
+//    For example:
+//       id=7 time=2.5 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 21 22 0 23 24
+//
+// 3. Each response is a single line:
+//       ID OK <number of moves> <seconds> <moved tiles>
+//       ID FAIL <reason> <seconds>
+//       ID FAIL error <message>
+//       ID ERROR <message>
+//    The response "FAIL error" is sent, if the search throws the exception (e.g. I/O error),
+//    the response "ERROR" is sent, if the request is not correct. The line ends with "\n"
+//    or "\r\n". The line longer than MAX_LINE bytes gets the response "ERROR line too long"
+//    and no more requests are read from the connection, which is closed after the responses
+//    to its pending requests.
+//    If "id" is not given, the number of the request in the connection is used.
+//    The responses are sent in the order of completion.
+//
+// 4. The requests are queued and solved by the pool of workers. Each worker owns
+//    preallocated solver, hence the hash tables and the memory of nodes
+//    are allocated once and stay resident between requests. Each worker keeps
+//    one engine per algorithm, the engine of other parameters (e.g. weight) replaces it.
+//    After each request the memory of nodes above the first chunk is given back,
+//    hence one large request does not keep its peak memory.
+//
+// 5. The queue is bounded. If it is full, reading of the requests is suspended.
+//
+
+#include "State.h"
+#include "Limits.h"
+#include <string>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+
+class Server
+{
+public:
+    // Maximal memory in MiB of the engines of the requests, e.g. "idastar-tt-M"
+    inline static constexpr unsigned int MAX_ENGINE_MIB = 1024;
+
+    // Maximal length of the request in bytes
+    inline static constexpr size_t MAX_LINE = 4096;
+
+public:
+    Server( const std::string& path, unsigned int workerNo, size_t queueSize = 1024 );
+    ~Server( );
+
+    Server( const Server& ) = delete;
+    Server& operator=( const Server& ) = delete;
+
+    void Run( const std::atomic< bool >& stop );
+
+private:
+    // Client connection. The socket is closed when the last reference is released.
+    struct Connection
+    {
+        explicit Connection( int fd ) : m_fd( fd ) {}
+        ~Connection( );
+
+        void Send( const std::string& line );
+
+        const int m_fd;
+        std::mutex m_mutex;
+    };
+
+    // Queued request
+    struct Request
+    {
+        std::shared_ptr< Connection > m_conn;
+        std::string m_id;
+        std::string m_engine;
+        std::string m_algorithm;
+        State m_beg;
+        Limits m_limits;
+    };
+
+private:
+    void Reader( std::shared_ptr< Connection > conn, std::shared_ptr< std::atomic< bool > > done );
+    void JoinFinished( );
+    void Worker( );
+
+    bool Parse( const std::string& line, Request& req, std::string& error ) const;
+
+    bool Push( Request&& req );
+    bool Pop( Request& req );
+
+private:
+    // Path to the socket
+    const std::string m_path;
+
+    // Listening socket
+    int m_fd;
+
+    // Queue of requests
+    std::deque< Request > m_queue;
+    const size_t m_queueSize;
+    bool m_closed;
+    std::mutex m_mutex;
+    std::condition_variable m_notEmpty;
+    std::condition_variable m_notFull;
+
+    // Workers solving the requests
+    const unsigned int m_workerNo;
+    std::vector< std::thread > m_workers;
+
+    // Thread reading the requests, one per connection
+    struct ReaderThread
+    {
+        std::thread m_thread;
+        std::weak_ptr< Connection > m_conn;
+        std::shared_ptr< std::atomic< bool > > m_done;
+    };
+    std::vector< ReaderThread > m_readers;
+    std::mutex m_connMutex;
+};
+
+#endif
@@ -0,0 +1,168 @@
+#include "Solution.h"
+#include <stdexcept>
+#include <cstdlib>
+
+//
+// Creates the solution from the path found by the solver.
+// The consecutive states of "path" must differ by one move.
+//
+Solution Solution::FromPath( const std::vector< State >& path, bool optimal )
+{
+    Solution sol;
+    sol.m_optimal = optimal;
+    sol.m_bytes.reserve( ( path.size() + 3 ) / 4 );
+
+    for( size_t i = 1; i < path.size(); i++ )
+    {
+        const int d = path[ i ].SpaceIdx() - path[ i - 1 ].SpaceIdx();
+
+        if( d == -static_cast< int >( State::WIDTH ) )
+            sol.Push( UP );
+        else if( d == static_cast< int >( State::WIDTH ) )
+            sol.Push( DOWN );
+        else if( d == -1 )
+            sol.Push( LEFT );
+        else
+        {
+            assert( d == 1 );
+            sol.Push( RIGHT );
+        }
+    }
+    return sol;
+}
+
+//
+// Returns the path of states starting from "beg"
+//
+std::vector< State > Solution::ToPath( const State& beg ) const
+{
+    std::vector< State > path;
+    path.reserve( m_length + 1 );
+    path.push_back( beg );
+
+    State s = beg;
+    for( size_t i = 0; i < m_length; i++ )
+    {
+        if( !Apply( s, Get( i ) ) )
+            throw std::invalid_argument( "Not allowed move in the solution." );
+        path.push_back( s );
+    }
+    return path;
+}
+
+//
+// Creates the solution from the sequence of moved tiles, e.g. "4 9 10 15 20".
+// "beg" is the state before the first move.
+//
+Solution Solution::FromText( const State& beg, const std::string& tiles, bool optimal )
+{
+    Solution sol;
+    sol.m_optimal = optimal;
+
+    State s = beg;
+    const char* p = tiles.c_str();
+
+    while( true )
+    {
+        char* end;
+        const long t = strtol( p, &end, 10 );
+        if( end == p )
+            break;
+        p = end;
+
+        const int sp = s.SpaceIdx();
+        Move m;
+        if( sp >= static_cast< int >( State::WIDTH ) && s.Tile( sp - State::WIDTH ) == t )
+            m = UP;
+        else if( sp + State::WIDTH < State::TILENO && s.Tile( sp + State::WIDTH ) == t )
+            m = DOWN;
+        else if( sp % State::WIDTH > 0 && s.Tile( sp - 1 ) == t )
+            m = LEFT;
+        else if( sp % State::WIDTH < State::WIDTH - 1 && s.Tile( sp + 1 ) == t )
+            m = RIGHT;
+        else
+            throw std::invalid_argument( "Tile " + std::to_string( t ) + " cannot be moved." );
+
+        Apply( s, m );
+        sol.Push( m );
+    }
+
+    while( *p == ' ' || *p == '\t' || *p == '\r' || *p == '\n' )
+        p++;
+
+    if( *p != '\0' )
+        throw std::invalid_argument( "Not allowed character in the solution: " + tiles );
+
+    return sol;
+}
+
+//
+// Returns the sequence of moved tiles separated by spaces.
+// "beg" is the state before the first move.
+//
+std::string Solution::ToText( const State& beg ) const
+{
+    std::string txt;
+    txt.reserve( 3 * m_length );
+
+    State s = beg;
+    for( size_t i = 0; i < m_length; i++ )
+    {
+        const int sp = s.SpaceIdx();
+        if( !Apply( s, Get( i ) ) )
+            throw std::invalid_argument( "Not allowed move in the solution." );
+
+        // After the move, the moved tile is located on the former position of SPACE
+        txt += std::to_string( static_cast< int >( s.Tile( sp ) ) );
+        if( i + 1 < m_length )
+            txt += ' ';
+    }
+    return txt;
+}
+
+//
+// Sets the moves from the packed representation
+//
+void Solution::Assign( const uint8_t* bytes, size_t length, bool optimal )
+{
+    m_bytes.assign( bytes, bytes + ( length + 3 ) / 4 );
+    m_length = length;
+    m_optimal = optimal;
+}
+
+//
+// Moves SPACE of state "s" in direction "m".
+// Returns "false" if the move is not allowed.
+//
+bool Solution::Apply( State& s, Move m )
+{
+    const int sp = s.SpaceIdx();
+    int np;
+
+    switch( m )
+    {
+    case UP:
+        if( sp < static_cast< int >( State::WIDTH ) )
+            return false;
+        np = sp - State::WIDTH;
+        break;
+    case DOWN:
+        if( sp + State::WIDTH >= State::TILENO )
+            return false;
+        np = sp + State::WIDTH;
+        break;
+    case LEFT:
+        if( sp % State::WIDTH == 0 )
+            return false;
+        np = sp - 1;
+        break;
+    default:
+        if( sp % State::WIDTH == State::WIDTH - 1 )
+            return false;
+        np = sp + 1;
+        break;
+    }
+
+    s.Swap( sp, np );
+    return true;
+}
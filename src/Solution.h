@@ -0,0 +1,85 @@
+#ifndef ASTAR_SOLUTION_H
+#define ASTAR_SOLUTION_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Compact representation of the solution, i.e. the sequence of moves.
+//
+// 2. The move is the direction in which SPACE is moved. The move is stored on 2 bits.
+//
+// 3. Besides the moves, the solution holds the flag, which indicates that
+//    the solution is known to be optimal.
+//
+// 4. The text representation of the solution is the sequence of moved tiles,
+//    the same as printed by State::PrintDiff.
+//
+
+#include "State.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+class Solution
+{
+public:
+    // Directions of SPACE movement
+    enum Move : uint8_t { UP = 0, DOWN = 1, LEFT = 2, RIGHT = 3 };
+
+public:
+    Solution( ) : m_length( 0 ), m_optimal( false ) {}
+
+    static Solution FromPath( const std::vector< State >& path, bool optimal );
+    std::vector< State > ToPath( const State& beg ) const;
+
+    static Solution FromText( const State& beg, const std::string& tiles, bool optimal );
+    std::string ToText( const State& beg ) const;
+
+    void Push( Move m );
+    Move Get( size_t i ) const;
+
+    size_t Length( ) const { return m_length; }
+    bool IsOptimal( ) const { return m_optimal; }
+    void SetOptimal( bool optimal ) { m_optimal = optimal; }
+
+    const std::vector< uint8_t >& Bytes( ) const { return m_bytes; }
+    void Assign( const uint8_t* bytes, size_t length, bool optimal );
+
+    static bool Apply( State& s, Move m );
+
+private:
+    // Moves, four moves in each byte
+    std::vector< uint8_t > m_bytes;
+
+    // Number of moves
+    size_t m_length;
+
+    // "true" if the solution is optimal
+    bool m_optimal;
+};
+
+//
+// Appends move "m" at the end of solution
+//
+inline
+void Solution::Push( Move m )
+{
+    if( m_length % 4 == 0 )
+        m_bytes.push_back( 0 );
+
+    m_bytes.back() |= static_cast< uint8_t >( m << ( 2 * ( m_length % 4 ) ) );
+    m_length++;
+}
+
+//
+// Returns i-th move
+//
+inline
+Solution::Move Solution::Get( size_t i ) const
+{
+    assert( i < m_length );
+    return static_cast< Move >( ( m_bytes[ i / 4 ] >> ( 2 * ( i % 4 ) ) ) & 3 );
+}
+
+#endif
@@ -1,28 +1,10 @@
 #include "State.h"
-#include <sstream>
-#include <fstream>
-#include <iostream>
-#include <algorithm>
-
-
-// X-coordinates for tiles 
-const char State::m_coorX[State::TILENO] = {
-    0, 1, 2, 3, 4,
-    0, 1, 2, 3, 4,
-    0, 1, 2, 3, 4,
-    0, 1, 2, 3, 4,
-    0, 1, 2, 3, 4};
-
-// Y-coordinates for tiles 
-const char State::m_coorY[State::TILENO] = {
-    0, 0, 0, 0, 0,
-    1, 1, 1, 1, 1,
-    2, 2, 2, 2, 2,
-    3, 3, 3, 3, 3,
-    4, 4, 4, 4, 4};
-
-// Label of tiles. 
-const char* const State::m_label[TILENO] = {
+#include "InstanceReader.h"
+#include <stdexcept>
+
+
+// Label of tiles. The first TILENO labels are used by the smaller boards.
+const char* const State::m_label[] = {
     "  ", " 1", " 2", " 3", " 4",
     " 5", " 6", " 7", " 8", " 9",
     "10", "11", "12", "13", "14",
@@ -72,96 +54,55 @@ bool State::operator<(const State& s) const
 //
 void State::Print(FILE* out) const
 {
-    fprintf(out,
-        "   %s %s %s %s %s\n"
-        "   %s %s %s %s %s\n"
-        "   %s %s %s %s %s\n"
-        "   %s %s %s %s %s\n"
-        "   %s %s %s %s %s",
-        Lab( 0), Lab( 1), Lab( 2), Lab( 3), Lab( 4),
-        Lab( 5), Lab( 6), Lab( 7), Lab( 8), Lab( 9),
-        Lab(10), Lab(11), Lab(12), Lab(13), Lab(14),
-        Lab(15), Lab(16), Lab(17), Lab(18), Lab(19),
-        Lab(20), Lab(21), Lab(22), Lab(23), Lab(24));
+    for(uint i = 0; i < TILENO; i++)
+    {
+        const char* sep = (i % WIDTH == 0) ? "   " : " ";
+        fprintf(out, "%s%s", sep, Lab(i));
+
+        if(i % WIDTH == WIDTH - 1 && i + 1 < TILENO)
+            fprintf(out, "\n");
+    }
 }
 
 //
 // Reads the state from the file.
+// The file is parsed by InstanceReader, hence the first instance stored in the file is taken.
 //
 void State::Read( const std::string& path )
 {
-    std::ifstream in( path, std::ios::in );
-    if( !in )
+    InstanceReader in( path );
+
+    if( !in.Next( *this ) )
     {
-        const std::string msg = "Cannot open file. Path = " + path;
+        const std::string msg = "Unexpexted end of file. Path = " + path;
         throw std::invalid_argument( msg );
     }
+}
 
-    int idx = 0;
-    std::string line;
-
-    while( true )
+//
+// Returns "true" if the GOAL state is reachable from this state.
+// The state is solvable if and only if the parity of the permutation of all squares
+// (SPACE included) is equal to the parity of the Manhattan distance of SPACE from its goal position.
+//
+bool State::IsSolvable() const
+{
+    uint inversions = 0;
+    for(uint i = 0; i < TILENO; i++)
     {
-        std::getline( in, line );
-
-        if( in.eof() )
+        for(uint j = i + 1; j < TILENO; j++)
         {
-            const std::string msg = "Unexpexted end of file. Path = " + path;
-            throw std::invalid_argument( msg );
+            // SPACE is treated as the tile with the largest number
+            const uint a = m_tab[i] ? m_tab[i] : TILENO;
+            const uint b = m_tab[j] ? m_tab[j] : TILENO;
+            if(a > b)
+                inversions++;
         }
-
-        if( line.empty() ) // Skip empty line
-        {
-            continue;
-        }
-
-        if( std::all_of(line.begin(), line.end(), isspace) ) // Skip line with only whitespaces
-        {
-            continue;
-        }
-
-        if( line[0] == '#' ) // If this line a comment
-        {
-            continue;
-        }
-
-
-        int val;
-        std::stringstream ss( line );
-
-        if( ss.eof() )
-        {
-            const std::string msg = "Unexpexted end of file. Path = " + path;
-            throw std::invalid_argument( msg );
-        }
-
-        if( ss.fail() )
-        {
-            std::string msg = "Error during reading file.\n";
-            msg += "Path = " + path;
-            msg += "Line = " + line;
-            throw std::invalid_argument( msg );
-        }
-
-        for( uint x = 0; x < WIDTH; x++ )
-        {
-            ss >> val;
-            if( val < 0 || val > 24 )
-            {
-                std::string msg = "Not allowed value in file with state.\n";
-                msg += "Path = " + path + "\n";
-                msg += "Line = " + line;
-                throw std::invalid_argument( msg );
-            }
-
-            m_tab[ idx++ ] = static_cast< char >( val );
-        }
-
-        if( idx >= 25 )
-            break;
-
     }
 
+    const uint sp = SpaceIdx();
+    const uint dist = (WIDTH - 1 - sp % WIDTH) + (WIDTH - 1 - sp / WIDTH);
+
+    return (inversions % 2) == (dist % 2);
 }
 
 //
@@ -23,6 +23,10 @@
 //   16 17 18 19 20
 //   21 22 23 24 25
 //
+// 5. The width of the board is defined at compile time by macro PUZZLE_WIDTH
+//    (CMake option of the same name). By default the board is 5x5.
+//    For example, PUZZLE_WIDTH=4 builds the solver of 15-puzzle game.
+//
 
 #include <cstring>
 #include <cstdio>
@@ -31,15 +35,21 @@
 #include <array>
 #include <cstdint>
 
+#ifndef PUZZLE_WIDTH
+#define PUZZLE_WIDTH 5
+#endif
+
 class State
 {
 public:
     // Width of the squared board
-    inline static constexpr unsigned int WIDTH = 5;
+    inline static constexpr unsigned int WIDTH = PUZZLE_WIDTH;
 
     // Number of tiles on the board
     inline static constexpr unsigned int TILENO = WIDTH * WIDTH;
 
+    static_assert( WIDTH >= 3 && WIDTH <= 5, "Supported boards are 3x3, 4x4 and 5x5" );
+
 
 public:
     State( );
@@ -50,12 +60,15 @@ public:
 
     char SpaceIdx( ) const;
     bool IsSpace( uint8_t idx ) const;
+    bool IsSolvable( ) const;
     
     void Swap(char oldPos, char newPos);
 
     char X( uint8_t idx ) const;
     char Y( uint8_t idx ) const;
 
+    char Tile( uint8_t idx ) const;
+
     void Print(FILE* out) const;
     void PrintDiff(const State& next) const;
 
@@ -69,17 +82,38 @@ private:
     // char m_tab[TILENO];
     std::array< char, TILENO> m_tab;
 
+private:
+    static constexpr std::array< char, TILENO > GoalCoor( bool x );
+
 private:
     // X-coordinates of the GOAL state
-    static const char m_coorX[State::TILENO];
+    static const std::array< char, TILENO > m_coorX;
 
     // Y-coordinates of the GOAL state
-    static const char m_coorY[State::TILENO];
+    static const std::array< char, TILENO > m_coorY;
 
-    // Names of tiles on the board
-    static const char* const m_label[TILENO];
+    // Names of tiles on the board (the largest board is 5x5)
+    static const char* const m_label[];
 };
 
+//
+// Returns X-coordinates (if "x" is true) or Y-coordinates of tiles in the GOAL state.
+// Tile "t" is located on position "t - 1", SPACE is located on the last position.
+//
+constexpr std::array< char, State::TILENO > State::GoalCoor( bool x )
+{
+    std::array< char, TILENO > coor{};
+    for( unsigned int t = 0; t < TILENO; t++ )
+    {
+        const unsigned int pos = ( t + TILENO - 1 ) % TILENO;
+        coor[ t ] = static_cast< char >( x ? pos % WIDTH : pos / WIDTH );
+    }
+    return coor;
+}
+
+inline const std::array< char, State::TILENO > State::m_coorX = State::GoalCoor( true );
+inline const std::array< char, State::TILENO > State::m_coorY = State::GoalCoor( false );
+
 //
 // Returns "true", if on position "idx" is SPACE
 //
@@ -103,6 +137,16 @@ void State::Swap(char oldPos, char newPos)
 }
 
 
+//
+// Returns the tile located on position "idx". SPACE is denoted by 0.
+//
+inline
+char State::Tile( uint8_t idx ) const
+{
+    assert( idx < TILENO );
+    return m_tab[ idx ];
+}
+
 //
 // Returns label of i-th tile.
 //
@@ -0,0 +1,191 @@
+#include "Trace.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+
+// Magic number of trace file
+const char MAGIC[ 4 ] = { 'S', 'P', 'T', '1' };
+
+// Header of trace file
+struct Header
+{
+    char m_magic[ 4 ];
+    uint8_t m_width;
+    uint8_t m_reserved0[ 3 ];
+    uint32_t m_recordSize;
+    uint32_t m_reserved1;
+    uint64_t m_count;
+    uint64_t m_reserved2;
+};
+
+static_assert( sizeof( Header ) == sizeof( TraceRecord ), "The header must occupy one record" );
+
+}
+
+// ---------------------------------------------------------------------------------
+//   T R A C E   W R I T E R
+// ---------------------------------------------------------------------------------
+
+//
+// Constructor. Creates the file "path".
+//
+TraceWriter::TraceWriter( const std::string& path )
+    : m_path( path )
+    , m_fd( -1 )
+    , m_window( nullptr )
+    , m_offset( 0 )
+    , m_pos( nullptr )
+    , m_end( nullptr )
+    , m_count( 0 )
+{
+    m_fd = open( m_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 );
+    if( m_fd < 0 )
+        Error( "Cannot open file." );
+
+    Map();
+
+    // The header occupies the first record of the first window
+    Header* h = reinterpret_cast< Header* >( m_window );
+    memset( h, 0, sizeof( Header ) );
+    memcpy( h->m_magic, MAGIC, sizeof( MAGIC ) );
+    h->m_width = State::WIDTH;
+    h->m_recordSize = sizeof( TraceRecord );
+    m_pos++;
+}
+
+//
+// Destructor. The file is closed, if function Close was not called.
+//
+TraceWriter::~TraceWriter( )
+{
+    try
+    {
+        Close();
+    }
+    catch( const std::invalid_argument& )
+    {
+        // Destructor must not throw
+    }
+}
+
+//
+// Unmaps the current window, extends the file and maps the next window
+//
+void TraceWriter::Map( )
+{
+    if( m_window )
+    {
+        munmap( m_window, WINDOW_SIZE );
+        m_window = nullptr;
+        m_offset += WINDOW_SIZE;
+    }
+
+    if( ftruncate( m_fd, m_offset + WINDOW_SIZE ) != 0 )
+        Error( "Cannot extend file." );
+
+    void* p = mmap( nullptr, WINDOW_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, m_offset );
+    if( p == MAP_FAILED )
+        Error( "Cannot map file." );
+
+    m_window = static_cast< char* >( p );
+    m_pos = reinterpret_cast< TraceRecord* >( m_window );
+    m_end = m_pos + WINDOW_SIZE / sizeof( TraceRecord );
+}
+
+//
+// Writes the number of records, truncates the file to its real size and closes it
+//
+void TraceWriter::Close( )
+{
+    if( m_fd < 0 )
+        return;
+
+    if( m_window )
+        munmap( m_window, WINDOW_SIZE );
+    m_window = nullptr;
+    m_pos = m_end = nullptr;
+
+    const int fd = m_fd;
+    m_fd = -1;
+
+    const off_t size = ( m_count + 1 ) * sizeof( TraceRecord );
+    const bool ok =
+        pwrite( fd, &m_count, sizeof( m_count ), offsetof( Header, m_count ) ) == sizeof( m_count ) &&
+        ftruncate( fd, size ) == 0;
+
+    if( close( fd ) != 0 || !ok )
+        Error( "Cannot write file." );
+}
+
+//
+// Throws the exception with message "what"
+//
+void TraceWriter::Error( const char* what ) const
+{
+    throw std::invalid_argument( std::string( what ) + "\nPath = " + m_path );
+}
+
+// ---------------------------------------------------------------------------------
+//   T R A C E   R E A D E R
+// ---------------------------------------------------------------------------------
+
+//
+// Constructor. Maps the file "path" into memory.
+//
+TraceReader::TraceReader( const std::string& path )
+    : m_path( path )
+    , m_data( nullptr )
+    , m_size( 0 )
+    , m_record( nullptr )
+    , m_count( 0 )
+{
+    const int fd = open( m_path.c_str(), O_RDONLY );
+    if( fd < 0 )
+        throw std::invalid_argument( "Cannot open file.\nPath = " + m_path );
+
+    struct stat st;
+    if( fstat( fd, &st ) != 0 || size_t( st.st_size ) < sizeof( Header ) )
+    {
+        close( fd );
+        throw std::invalid_argument( "File is not a trace.\nPath = " + m_path );
+    }
+
+    m_size = st.st_size;
+    void* p = mmap( nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if( p == MAP_FAILED )
+        throw std::invalid_argument( "Cannot map file.\nPath = " + m_path );
+    m_data = p;
+
+    const Header* h = static_cast< const Header* >( m_data );
+    std::string error;
+    if( memcmp( h->m_magic, MAGIC, sizeof( MAGIC ) ) != 0 || h->m_recordSize != sizeof( TraceRecord ) )
+        error = "File is not a trace.";
+    else if( h->m_width != State::WIDTH )
+        error = "Width of the board in file is different from State::WIDTH.";
+    else if( m_size != ( h->m_count + 1 ) * sizeof( TraceRecord ) )
+        error = "Trace file is truncated or not closed.";
+
+    if( !error.empty() )
+    {
+        munmap( m_data, m_size );
+        throw std::invalid_argument( error + "\nPath = " + m_path );
+    }
+
+    m_record = static_cast< const TraceRecord* >( m_data ) + 1;
+    m_count = h->m_count;
+}
+
+//
+// Destructor
+//
+TraceReader::~TraceReader( )
+{
+    munmap( m_data, m_size );
+}
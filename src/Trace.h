@@ -0,0 +1,156 @@
+#ifndef ASTAR_TRACE_H
+#define ASTAR_TRACE_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Binary trace of expansions. The solver appends one record for each expanded node,
+//    in the order of selection from the open set.
+//
+// 2. The file starts with the header of 32 bytes:
+//       4 bytes - magic "SPT1"
+//       1 byte  - width of the board (State::WIDTH)
+//       3 bytes - reserved, zeros
+//       4 bytes - size of the record (32)
+//       4 bytes - reserved, zeros
+//       8 bytes - number of records
+//       8 bytes - reserved, zeros
+//    The header is followed by the records (see TraceRecord). The numbers are stored
+//    in the byte order of the machine, since the file is mapped into memory.
+//
+// 3. The record holds the packed state, the hash of the parent state (see PackedState::Hash),
+//    "g", "h" and the size of the open set after the removal of the node.
+//    The start node of each search has "g" equal to zero and the parent hash equal to zero.
+//    Hence, the trace of many searches can be split. The parent is not stored as the index
+//    of record, since the solver does not number the nodes. The reader finds
+//    the parent record by the hash.
+//
+// 4. TraceWriter writes the file through the memory mapped window of WINDOW_SIZE bytes.
+//    When the window is full, the file is extended and the next window is mapped.
+//    Hence, appending the record costs packing of two states and a few stores.
+//    Function Close truncates the file to its real size and writes the number of records.
+//
+// 5. TraceReader maps the whole file into memory.
+//
+// 6. In case of I/O error or malformed file, the exception std::invalid_argument is thrown.
+//
+
+#include "State.h"
+#include "PackedState.h"
+#include "Cost.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+// Single record of trace
+struct TraceRecord
+{
+    PackedState m_state;
+
+    // Hash of the parent state, zero for the start node
+    uint64_t m_parent;
+
+    int16_t m_g;
+    int16_t m_h;
+
+    // Size of the open set after the removal of the node
+    uint32_t m_openNo;
+
+    Cost F( ) const { return Cost( m_g ) + Cost( m_h ); }
+    bool IsStart( ) const { return m_g == 0 && m_parent == 0; }
+};
+
+static_assert( sizeof( TraceRecord ) == 32, "TraceRecord must have 32 bytes" );
+
+//
+// ---------------------------------------------------------------------------------
+//   T R A C E   W R I T E R
+// ---------------------------------------------------------------------------------
+//
+class TraceWriter
+{
+public:
+    explicit TraceWriter( const std::string& path );
+    ~TraceWriter( );
+
+    TraceWriter( const TraceWriter& ) = delete;
+    TraceWriter& operator=( const TraceWriter& ) = delete;
+
+    void Append( const State& s, const State* parent, Cost g, Cost h, size_t openNo );
+    void Close( );
+
+    uint64_t Size( ) const { return m_count; }
+
+private:
+    void Map( );
+    [[noreturn]] void Error( const char* what ) const;
+
+private:
+    // Size of the mapped window, multiple of the page size and the record size
+    inline static constexpr size_t WINDOW_SIZE = 64 << 20;
+
+    const std::string m_path;
+    int m_fd;
+
+    // Mapped window and its offset in the file
+    char* m_window;
+    size_t m_offset;
+
+    // Free part of the window
+    TraceRecord* m_pos;
+    TraceRecord* m_end;
+
+    // Number of records
+    uint64_t m_count;
+};
+
+//
+// Appends the record of expanded node "s".
+// "parent" - parent state, NULL for the start node
+// "openNo" - size of the open set after the removal of "s"
+//
+inline
+void TraceWriter::Append( const State& s, const State* parent, Cost g, Cost h, size_t openNo )
+{
+    if( m_pos == m_end )
+        Map();
+
+    TraceRecord* r = m_pos++;
+    r->m_state = PackedState( s );
+    r->m_parent = parent ? PackedState( *parent ).Hash() : 0;
+    r->m_g = static_cast< int16_t >( g );
+    r->m_h = static_cast< int16_t >( h );
+    r->m_openNo = static_cast< uint32_t >( openNo );
+    m_count++;
+}
+
+//
+// ---------------------------------------------------------------------------------
+//   T R A C E   R E A D E R
+// ---------------------------------------------------------------------------------
+//
+class TraceReader
+{
+public:
+    explicit TraceReader( const std::string& path );
+    ~TraceReader( );
+
+    TraceReader( const TraceReader& ) = delete;
+    TraceReader& operator=( const TraceReader& ) = delete;
+
+    size_t Size( ) const { return m_count; }
+    const TraceRecord& operator[]( size_t i ) const { return m_record[ i ]; }
+
+private:
+    const std::string m_path;
+
+    // Mapped file
+    void* m_data;
+    size_t m_size;
+
+    const TraceRecord* m_record;
+    size_t m_count;
+};
+
+#endif
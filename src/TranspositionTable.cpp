@@ -0,0 +1,69 @@
+#include "TranspositionTable.h"
+#include <cstdint>
+#include <stdexcept>
+
+//
+// Constructor
+// "bytes" - memory budget of the table
+//
+TranspositionTable::TranspositionTable( size_t bytes )
+    : m_bucket( nullptr )
+    , m_mask( 0 )
+    , m_stamp( 0 )
+    , m_first( 1 )
+    , m_usedNo( 0 )
+{
+    if( bytes < BUCKET_BYTES )
+        throw std::invalid_argument( "Memory budget of transposition table is too small" );
+
+    // The largest power of two of buckets within the budget.
+    // One more bucket is allocated for the alignment.
+    size_t bucketNo = 1;
+    while( 2 * bucketNo * BUCKET_BYTES <= bytes )
+        bucketNo *= 2;
+
+    m_mask = bucketNo - 1;
+    m_entry.assign( ( bucketNo + 1 ) * WAY_NO, Entry{} );
+
+    const uintptr_t addr = reinterpret_cast< uintptr_t >( m_entry.data() );
+    const uintptr_t aligned = ( addr + BUCKET_BYTES - 1 ) & ~uintptr_t( BUCKET_BYTES - 1 );
+    m_bucket = m_entry.data() + ( aligned - addr ) / sizeof( Entry );
+}
+
+//
+// Begins the new search. The entries of the previous searches are ignored.
+//
+void TranspositionTable::Begin( )
+{
+    NextIteration();
+    m_first = m_stamp;
+}
+
+//
+// Begins the next iteration of the search
+//
+void TranspositionTable::NextIteration( )
+{
+    if( m_stamp == std::numeric_limits< uint32_t >::max() )
+    {
+        // The numbers of iterations are exhausted, the table is cleared
+        m_entry.assign( m_entry.size(), Entry{} );
+        m_stamp = 0;
+        m_first = 1;
+        m_usedNo = 0;
+    }
+    m_stamp++;
+}
+
+//
+// Returns the memory occupied by the table
+//
+MemoryUsage TranspositionTable::Memory( ) const
+{
+    MemoryUsage m;
+
+    m.m_used = m_usedNo * sizeof( Entry );
+    m.m_reserved = m_entry.capacity() * sizeof( Entry );
+    m.m_load = m_entry.empty() ? 0 : double( m_usedNo ) / ( ( m_mask + 1 ) * WAY_NO );
+    return m;
+}
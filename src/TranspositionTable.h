@@ -0,0 +1,230 @@
+#ifndef ASTAR_TRANSPOSITIONTABLE_H
+#define ASTAR_TRANSPOSITIONTABLE_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Fixed-size, lossy transposition table of the depth-first search (see IDAstar).
+//    The size is given by the memory budget and the table never grows.
+//
+// 2. The key is the 64-bit hash of the state and the state of FSM pruning the moves
+//    (see MoveFsm.h), since the subtree searched below the state depends on both of them.
+//    The hash of the state is Zobrist hash, i.e. XOR of the random numbers of each tile
+//    and its position (function Hash). It is updated by two XORs for each move (function Move).
+//    The keys are not verified, the probability of the false hit is negligible.
+//
+// 3. Each entry keeps the smallest "g" of the state searched in the iteration and
+//    the backed-up heuristic, i.e. the smallest "f" exceeding the bound found below the state
+//    minus "g". The backed-up heuristic is admissible for the subtree, hence it raises
+//    the heuristic of the state in the next iterations.
+//
+// 4. The table is divided into the buckets of WAY_NO entries (one cache line of 64 bytes).
+//    The new entry replaces the entry from the previous search or iteration, otherwise
+//    the entry with the largest "g", whose subtree is the smallest.
+//
+// 5. Each entry is stamped by the number of iteration. The numbers are never reused,
+//    hence the table is not cleared between the searches.
+//
+
+#include "Cost.h"
+#include "MemoryUsage.h"
+#include "State.h"
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+class TranspositionTable
+{
+public:
+    // Entry of the table
+    struct Entry
+    {
+        // Hash of the state and the state of FSM
+        uint64_t m_key;
+
+        // Number of iteration, zero for the empty entry
+        uint32_t m_stamp;
+
+        // The smallest "g" of the state searched in the iteration
+        int16_t m_g;
+
+        // Backed-up heuristic, DEAD_END if there is no path to the GOAL below the state
+        int16_t m_h;
+    };
+
+    // Number of entries in the bucket
+    inline static constexpr unsigned int WAY_NO = 4;
+
+    // Bytes of the bucket
+    inline static constexpr size_t BUCKET_BYTES = WAY_NO * sizeof( Entry );
+
+    // Backed-up heuristic of the state without the path to the GOAL
+    inline static constexpr int16_t DEAD_END = std::numeric_limits< int16_t >::max();
+
+public:
+    explicit TranspositionTable( size_t bytes );
+
+    void Begin( );
+    void NextIteration( );
+
+    const Entry* Find( uint64_t key ) const;
+    void Prefetch( uint64_t key ) const;
+    void Store( uint64_t key, Cost g, Cost h );
+
+    // Returns "true" if entry "e" was stored in the current iteration
+    bool IsCurrent( const Entry& e ) const { return e.m_stamp == m_stamp; }
+
+    MemoryUsage Memory( ) const;
+
+    static uint64_t Hash( const State& s );
+    static uint64_t Move( uint64_t hash, char tile, uint8_t from, uint8_t to );
+    static uint64_t Key( uint64_t hash, int32_t fsm );
+
+    static_assert( BUCKET_BYTES == 64, "The bucket must fill the cache line" );
+
+private:
+    static constexpr std::array< std::array< uint64_t, State::TILENO >, State::TILENO > MakeZobrist( );
+
+private:
+    // Random numbers indexed by the tile and its position, zero for SPACE
+    static const std::array< std::array< uint64_t, State::TILENO >, State::TILENO > m_zobrist;
+
+    // Entries, the buckets begin at m_bucket aligned to the cache line
+    std::vector< Entry > m_entry;
+    Entry* m_bucket;
+
+    // Mask of the index of bucket, the number of buckets is the power of two
+    size_t m_mask;
+
+    // Number of the current iteration
+    uint32_t m_stamp;
+
+    // Number of the first iteration of the current search. The older entries are ignored.
+    uint32_t m_first;
+
+    // Number of occupied entries
+    size_t m_usedNo;
+};
+
+//
+// Returns the table of random numbers generated by splitmix64
+//
+constexpr std::array< std::array< uint64_t, State::TILENO >, State::TILENO > TranspositionTable::MakeZobrist( )
+{
+    std::array< std::array< uint64_t, State::TILENO >, State::TILENO > tab{};
+    uint64_t x = 0x2545f4914f6cdd1dULL;
+
+    for( unsigned int tile = 1; tile < State::TILENO; tile++ )
+    {
+        for( unsigned int pos = 0; pos < State::TILENO; pos++ )
+        {
+            x += 0x9e3779b97f4a7c15ULL;
+            uint64_t z = x;
+            z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+            z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebULL;
+            tab[ tile ][ pos ] = z ^ ( z >> 31 );
+        }
+    }
+    return tab;
+}
+
+inline const std::array< std::array< uint64_t, State::TILENO >, State::TILENO > TranspositionTable::m_zobrist = TranspositionTable::MakeZobrist( );
+
+//
+// Returns Zobrist hash of state "s"
+//
+inline
+uint64_t TranspositionTable::Hash( const State& s )
+{
+    uint64_t h = 0;
+    for( uint8_t i = 0; i < State::TILENO; i++ )
+        h ^= m_zobrist[ static_cast< unsigned char >( s.Tile( i ) ) ][ i ];
+    return h;
+}
+
+//
+// Returns the hash of the state after moving "tile" from position "from" to position "to"
+//
+inline
+uint64_t TranspositionTable::Move( uint64_t hash, char tile, uint8_t from, uint8_t to )
+{
+    const auto& z = m_zobrist[ static_cast< unsigned char >( tile ) ];
+    return hash ^ z[ from ] ^ z[ to ];
+}
+
+//
+// Returns the key of the state with "hash" and the state "fsm" of FSM
+//
+inline
+uint64_t TranspositionTable::Key( uint64_t hash, int32_t fsm )
+{
+    uint64_t k = hash ^ ( static_cast< uint64_t >( fsm ) * 0x9e3779b97f4a7c15ULL );
+    return k ^ ( k >> 32 );
+}
+
+//
+// Returns the entry of "key" stored in the current search, or NULL if there is no such entry
+//
+inline
+const TranspositionTable::Entry* TranspositionTable::Find( uint64_t key ) const
+{
+    const Entry* b = &m_bucket[ ( key & m_mask ) * WAY_NO ];
+    for( unsigned int i = 0; i < WAY_NO; i++ )
+    {
+        if( b[ i ].m_key == key && b[ i ].m_stamp >= m_first )
+            return &b[ i ];
+    }
+    return nullptr;
+}
+
+//
+// Loads the bucket of "key" into the cache, before it is needed by functions Find and Store
+//
+inline
+void TranspositionTable::Prefetch( uint64_t key ) const
+{
+    __builtin_prefetch( &m_bucket[ ( key & m_mask ) * WAY_NO ] );
+}
+
+//
+// Stores "key" with "g" and the backed-up heuristic "h" in the current iteration
+//
+inline
+void TranspositionTable::Store( uint64_t key, Cost g, Cost h )
+{
+    Entry* b = &m_bucket[ ( key & m_mask ) * WAY_NO ];
+    Entry* victim = nullptr;
+
+    for( unsigned int i = 0; i < WAY_NO; i++ )
+    {
+        Entry& e = b[ i ];
+        if( e.m_key == key && e.m_stamp >= m_first )
+        {
+            victim = &e;
+            break;
+        }
+
+        if( e.m_stamp != m_stamp )
+        {
+            // Empty, or stored in the previous search or iteration
+            if( !victim || victim->m_stamp == m_stamp || e.m_stamp < victim->m_stamp )
+                victim = &e;
+        }
+        else if( !victim || ( victim->m_stamp == m_stamp && e.m_g > victim->m_g ) )
+        {
+            victim = &e;
+        }
+    }
+
+    if( victim->m_stamp == 0 )
+        m_usedNo++;
+
+    victim->m_key = key;
+    victim->m_stamp = m_stamp;
+    victim->m_g = static_cast< int16_t >( g );
+    victim->m_h = ( h >= DEAD_END ) ? DEAD_END : static_cast< int16_t >( h );
+}
+
+#endif
@@ -15,10 +15,59 @@
 //     Graph - represents weighted graph of states
 //     CS    - represents Closed-set
 //     OS    - represents Open-set
+//    The available sets are ClosedSet, ClosedSetHash, OpenSet, OpenSetHash and OpenSetBucket.
 //
 // 3. Function Astat::Find finds the shortest path between the start state
 //    and the end (target) state of weighted graph.
 //
+// 4. The search can be limited by the number of expanded nodes, the wall time,
+//    or stopped by other thread (see class Limits).
+//
+// 5. The search can be performed incrementally. Function Start initializes the search,
+//    and each call of function Step expands at most the given number of nodes.
+//    Hence, many searches can be interleaved on one thread.
+//    The optional callback receives the progress every given number of expansions.
+//
+// 6. Weighted A* is obtained by setting the weight W > 1 of heuristic (f = g + W * h).
+//    Then, the cost of found solution is at most W times the optimal cost.
+//
+// 7. The metrics of the search (see class Metrics) are collected, unless they are disabled
+//    by function SetMetricsEnabled. The flag is read once per expansion.
+//    They are reset by function Start and available by function GetMetrics.
+//
+// 8. The statistics of each f-layer (see class LayerStats) are collected as well.
+//    They are available by function GetLayers.
+//
+// 9. The memory of the data structures (see class MemoryStats) is sampled every
+//    MEMORY_PERIOD expansions and at the end of each step. It is available by function
+//    GetMemory. The used bytes and the peak of reserved bytes are reported by the progress as well.
+//    The limit of memory (Limits::m_maxBytes) is compared with the reserved bytes,
+//    when the memory is sampled.
+//
+// 10. Optionally, each expansion is appended to the binary trace (see class TraceWriter).
+//
+// 11. Optionally, the time of each phase of the search is measured by the profiler
+//    (see class Profiler). Without the profiler the phases are not measured.
+//
+// 12. AL* (A* with lookahead) is obtained by setting the depth K > 0 of lookahead.
+//    Under each expanded node the depth-first search is performed, bounded by the depth K
+//    and by "f" of the expanded node. The nodes with the same "f" are expanded by this search,
+//    without the closed set and the open set. Only the leaves of the lookahead, i.e. the nodes
+//    with greater "f" or on depth K, are inserted into the open set. The nodes of the lookahead
+//    are allocated only if they are the ancestors of the inserted leaves (for the path).
+//    They are neither traced nor put into the closed set, hence they may be explored again.
+//    The depth K = 1 is equivalent to A*.
+//
+// 13. All optimal solutions are enumerated, if it is enabled by function SetAllOptimal.
+//    Each parent, which reaches the node with the same "g" as the node's parent, is recorded
+//    as the additional edge of the directed acyclic graph (DAG) of the optimal paths.
+//    The edges are dropped, when the cheaper path to the node is found. The goal is closed,
+//    but not expanded, and the search continues until all nodes with "f" not greater than
+//    the optimal cost are expanded. Function OptimalNo returns the number of optimal solutions,
+//    counted over DAG, and function ForEachOptimal passes them one by one to the visitor.
+//    The memory is proportional to DAG, not to the number of solutions.
+//    It requires the weight W = 1 and no lookahead.
+//
 
 #include "pathnode.h"
 #include "closedset.h"
@@ -26,13 +75,25 @@
 
 #include "closedsethash.h"
 #include "opensethash.h"
+#include "opensetbucket.h"
 
 #include "memmgr.h"
 #include "Cost.h"
 #include "Graph.h"
+#include "Limits.h"
+#include "SearchProgress.h"
+#include "Metrics.h"
+#include "Profiler.h"
+#include "LayerStats.h"
+#include "MemoryStats.h"
+#include "Trace.h"
 #include <list>
 #include <iostream>
 #include <optional>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
 
 template<
     template <typename S> class CS = ClosedSetHash,
@@ -43,15 +104,74 @@ public:
     explicit Astar(unsigned int chunkSize = 10000);
 
     std::optional<std::vector<State>> Find(Graph& graph, const State& beg);
+    std::optional<std::vector<State>> Find(Graph& graph, const State& beg, Limits limits);
+
+    void Start(Graph& graph, const State& beg);
+    void Release(void);
+    SearchProgress Step(size_t maxExpansions);
+    SearchProgress Progress() const;
+    std::optional<std::vector<State>> Path() const;
+
+    using Callback = std::function<void(const SearchProgress&)>;
+    void SetCallback(Callback callback, size_t period);
+
+    void SetWeight(Cost weight) { m_weight = weight; }
+    Cost Weight(void) const { return m_weight; }
+
+    void SetLookahead(unsigned int depth);
+    unsigned int Lookahead(void) const { return m_lookahead; }
+
+    void SetAllOptimal(bool all) { m_allOptimal = all; }
+    bool AllOptimal(void) const { return m_allOptimal; }
+
+    using PathVisitor = std::function<bool(const std::vector<State>&)>;
+    uint64_t OptimalNo(void) const;
+    void ForEachOptimal(const PathVisitor& visit) const;
 
     size_t ClosedNo(void) const { return m_cs.Size(); }
     size_t OpenNo  (void) const { return m_os.Size(); }
+    size_t ExpandedNo(void) const { return m_expandedNo; }
+
+    // Returns "true" if the last search was stopped by the limits
+    bool LimitReached(void) const { return m_limitReached; }
+
+    // Metrics of the current search
+    const Metrics& GetMetrics(void) const { return m_metrics; }
+    void SetMetricsEnabled(bool enabled) { m_metrics.SetEnabled(enabled); }
+
+    // Statistics of f-layers of the current search
+    const LayerStats& GetLayers(void) const { return m_layers; }
 
-    void PrintStats() const;
+    // Memory of the data structures of the current search
+    const MemoryStats& GetMemory(void) const { return m_memory; }
+
+    // Number of expansions between the samples of memory
+    static constexpr size_t MEMORY_PERIOD = 1 << 14;
+
+    // Number of nodes explored by the lookahead between the checks of the time and the cancellation
+    static constexpr size_t LOOKAHEAD_PERIOD = 1 << 10;
+
+    // Sets the profiler of the search phases. NULL disables the profiling.
+    void SetProfiler(Profiler* profiler) { m_profiler = profiler; }
+
+    // Sets the trace of expansions. NULL disables the trace.
+    void SetTrace(TraceWriter* trace) { m_trace = trace; }
 
 private:
+    SearchProgress Run(size_t maxExpansions, const Limits* limits);
     void ChildLoop(Graph& graph, PathNode<State>* x);
-    std::vector<State> CreatePath(const PathNode<State>* target);
+    void AddChild(Graph& graph, PathNode<State>* node, const State& y, Cost g, Cost h);
+    PathNode<State>* LookaheadDfs(Graph& graph, Cost bound, unsigned int depth, int prevSpace);
+    PathNode<State>* Materialize(unsigned int depth);
+    void Found(PathNode<State>* target);
+    void AddParent(const PathNode<State>* node, PathNode<State>* parent);
+    void Parents(const PathNode<State>* node, std::vector<const PathNode<State>*>& parents) const;
+    void Lap(Profiler::Phase phase);
+    void SwitchMetrics(void);
+    void Count(Metrics::Counter c, uint64_t n = 1);
+    void Record(Metrics::Histogram h, uint64_t value);
+    void SampleMemory(void);
+    std::vector<State> CreatePath(const PathNode<State>* target) const;
 
 private:
     // Closed set
@@ -66,15 +186,85 @@ private:
     // Cost from analyzed node to generated children. Auxiliary buffer.
     std::vector<Cost> m_cost;
 
-    // Heuristic from analyzed node to generated children. Auxiliary buffer.
-    std::vector<Cost> m_heur;
-
     // Memory menager
     MemMgr< PathNode<State> > m_mem;
 
-#ifdef ASTAR_STATISTICS
-    size_t m_stats_loopNo;
-#endif
+    // Graph of the current search
+    Graph* m_graph;
+
+    // Goal node, if the solution is found
+    PathNode<State>* m_target;
+
+    // State of the current search
+    SearchProgress::Status m_status;
+
+    // Number of expanded nodes in the current search
+    size_t m_expandedNo;
+
+    // "true" if the last search was stopped by the limits
+    bool m_limitReached;
+
+    // Start time of the current search
+    Limits m_clock;
+
+    // Limits of the running search, NULL if they are not checked (see Run)
+    const Limits* m_limits;
+
+    // Progress callback and the number of expansions between calls
+    Callback m_callback;
+    size_t m_period;
+
+    // Weight of heuristic
+    Cost m_weight;
+
+    // Depth of lookahead, zero disables the lookahead
+    unsigned int m_lookahead;
+
+    // "true" if all optimal solutions are enumerated
+    bool m_allOptimal;
+
+    // Additional edge of DAG of the optimal paths: the parent and the index of the next edge
+    // of the same node (NO_EDGE ends the list)
+    struct Edge
+    {
+        PathNode<State>* m_parent;
+        size_t m_next;
+    };
+    static constexpr size_t NO_EDGE = std::numeric_limits<size_t>::max();
+
+    // Additional edges and the index of the first edge of each node having them
+    std::vector<Edge> m_edge;
+    std::unordered_map<const PathNode<State>*, size_t> m_firstEdge;
+
+    // Lookahead buffers indexed by depth: the states on the current path of the depth-first search,
+    // their costs, heuristics and nodes (NULL if not allocated yet), and the generated children.
+    std::vector<State> m_laState;
+    std::vector<Cost> m_laG;
+    std::vector<Cost> m_laH;
+    std::vector<PathNode<State>*> m_laNode;
+    std::vector< std::vector<State> > m_laChild;
+    std::vector< std::vector<Cost> > m_laCost;
+
+    // Number of nodes explored by the lookahead, it times the checks of the limits
+    size_t m_laNo;
+
+    // Metrics of the current search
+    Metrics m_metrics;
+
+    // Metrics are collected, the flag of m_metrics read by the last expansion
+    bool m_collect;
+
+    // Statistics of f-layers of the current search
+    LayerStats m_layers;
+
+    // Memory of the data structures of the current search
+    MemoryStats m_memory;
+
+    // Profiler of the search phases, it may be NULL
+    Profiler* m_profiler;
+
+    // Trace of expansions, it may be NULL
+    TraceWriter* m_trace;
 };
 
 //
@@ -82,8 +272,25 @@ private:
 // "chunkSize" - number of elements allocated when increased, in memory allocator
 //
 template<template <typename S> class CS, template <typename S> class OS>
-Astar<CS, OS>::Astar(unsigned int chunkSize) : m_mem(chunkSize)
+Astar<CS, OS>::Astar(unsigned int chunkSize)
+    : m_mem(chunkSize)
+    , m_graph(nullptr)
+    , m_target(nullptr)
+    , m_status(SearchProgress::NOT_FOUND)
+    , m_expandedNo(0)
+    , m_limitReached(false)
+    , m_limits(nullptr)
+    , m_period(0)
+    , m_weight(1)
+    , m_lookahead(0)
+    , m_allOptimal(false)
+    , m_laNo(0)
+    , m_collect(true)
+    , m_profiler(nullptr)
+    , m_trace(nullptr)
 {
+    m_cs.SetMetrics(&m_metrics);
+    m_os.SetMetrics(&m_metrics);
 }
 
 //
@@ -95,89 +302,692 @@ Astar<CS, OS>::Astar(unsigned int chunkSize) : m_mem(chunkSize)
 //
 template<template <typename S> class CS, template <typename S> class OS>
 std::optional<std::vector<State>> Astar<CS, OS>::Find(Graph& graph, const State& beg)
+{
+    return Find(graph, beg, Limits{});
+}
+
+//
+// Finds the solution within the "limits".
+// If the limits are exceeded, the empty value is returned and LimitReached() returns "true".
+//
+template<template <typename S> class CS, template <typename S> class OS>
+std::optional<std::vector<State>> Astar<CS, OS>::Find(Graph& graph, const State& beg, Limits limits)
+{
+    limits.Start();
+    Start(graph, beg);
+    Run(std::numeric_limits<size_t>::max(), &limits);
+    return Path();
+}
+
+//
+// Initializes the incremental search from state "beg".
+// The object "graph" must exist until the search is finished.
+//
+template<template <typename S> class CS, template <typename S> class OS>
+void Astar<CS, OS>::Start(Graph& graph, const State& beg)
 {
 PathNode<State>* p;
 
-#ifdef ASTAR_STATISTICS
-    m_stats_loopNo = 0;
-#endif
+    m_graph = &graph;
+    m_target = nullptr;
+    m_status = SearchProgress::RUNNING;
+    m_expandedNo = 0;
+    m_limitReached = false;
+    m_clock.Start();
+    m_metrics.Reset();
+    SwitchMetrics();
+    m_layers.Reset();
+    m_memory.Reset();
 
     m_cs.Erase();
     m_os.Erase();
     m_mem.Erase();
+    m_edge.clear();
+    m_firstEdge.clear();
+
+    // The paths completed by the perimeter are not enumerated
+    if(m_allOptimal && graph.GetPerimeter())
+        throw std::invalid_argument("Enumeration of all optimal solutions does not support the perimeter");
 
     m_child.resize(Graph::MAX_CHILD_NO);
     m_cost.resize(Graph::MAX_CHILD_NO);
-    m_heur.resize(Graph::MAX_CHILD_NO);
 
-    const Cost h = graph.CalcH(beg);
+    const Cost h = m_weight * graph.CalcH(beg);
     p = m_mem.New();
     p->Set(beg, NULL, 0, h);
     m_os.Add(p);
 
-    while(!m_os.IsEmpty())
+    SampleMemory();
+}
+
+//
+// Deletes the nodes of the last search and gives back their memory, except the first chunk.
+// The path of the last search is not available any more.
+//
+template<template <typename S> class CS, template <typename S> class OS>
+void Astar<CS, OS>::Release(void)
+{
+    m_cs.Erase();
+    m_os.Erase();
+    m_mem.Release();
+    std::vector<Edge>().swap(m_edge);
+    m_firstEdge = std::unordered_map<const PathNode<State>*, size_t>();
+    m_target = nullptr;
+}
+
+//
+// Continues the search started by function Start.
+// At most "maxExpansions" nodes are expanded.
+//
+template<template <typename S> class CS, template <typename S> class OS>
+SearchProgress Astar<CS, OS>::Step(size_t maxExpansions)
+{
+    return Run(maxExpansions, nullptr);
+}
+
+//
+// Main loop of the search. At most "maxExpansions" nodes are expanded.
+// If "limits" is not NULL, the search is stopped when the limits are exceeded.
+//
+template<template <typename S> class CS, template <typename S> class OS>
+SearchProgress Astar<CS, OS>::Run(size_t maxExpansions, const Limits* limits)
+{
+PathNode<State>* p;
+
+    assert(m_graph);
+    Graph& graph = *m_graph;
+
+    m_limits = limits;
+    m_layers.Resume();
+    if(m_profiler)
+        m_profiler->Mark();
+
+    for(size_t n = 0; n < maxExpansions && m_status == SearchProgress::RUNNING; n++)
     {
-#ifdef ASTAR_STATISTICS
-        m_stats_loopNo++;
-#endif
+        // With all optimal solutions, the search is finished, when "f" exceeds the cost of the goal
+        if(m_os.IsEmpty() || (m_target && m_os.Best()->F() > m_target->m_g))
+        {
+            m_status = m_target ? SearchProgress::FOUND : SearchProgress::NOT_FOUND;
+            break;
+        }
 
         // the node in openset having the lowest f_score value
         p = m_os.Best();
-        if(graph.IsGoal(p->m_state))
+        if(graph.IsSolved(p->m_state))
         {
-            return CreatePath(p);
+            if(!m_allOptimal)
+            {
+                Found(p);
+                break;
+            }
+
+            // The goal is closed without the expansion, its other parents are recorded later
+            m_os.RemoveBest();
+            m_cs.Add(p);
+            if(!m_target)
+            {
+                Found(p);
+                m_status = SearchProgress::RUNNING;
+            }
+            continue;
         }
+
+        if(limits && limits->Exceeded(m_expandedNo))
+        {
+            m_limitReached = true;
+            m_status = SearchProgress::LIMIT;
+            break;
+        }
+
         m_os.RemoveBest();
+        Lap(Profiler::SELECT);
+
+        if(m_trace)
+        {
+            m_trace->Append(p->m_state, p->m_parent ? &p->m_parent->m_state : nullptr, p->m_g, p->m_h, m_os.Size());
+        }
+
         m_cs.Add(p);
+        Lap(Profiler::CLOSE);
+
+        SwitchMetrics();
+        m_expandedNo++;
+        Count(Metrics::EXPANDED);
+        m_layers.Expand(p->F());
 
         ChildLoop(graph, p);
+        if(m_status != SearchProgress::RUNNING)
+            break;
+
+        if(m_expandedNo % MEMORY_PERIOD == 0)
+        {
+            SampleMemory();
+            if(limits && limits->m_maxBytes > 0 && m_memory.Reserved() > limits->m_maxBytes)
+            {
+                m_limitReached = true;
+                m_status = SearchProgress::LIMIT;
+                break;
+            }
+        }
+
+        if(m_callback && m_expandedNo % m_period == 0)
+        {
+            m_callback(Progress());
+        }
+    }
+
+    m_limits = nullptr;
+    m_layers.Pause();
+    SampleMemory();
+
+    const SearchProgress progress = Progress();
+    if(m_callback && progress.IsFinished())
+    {
+        m_callback(progress);
     }
+    return progress;
+}
+
+//
+// Returns the progress of the current search
+//
+template<template <typename S> class CS, template <typename S> class OS>
+SearchProgress Astar<CS, OS>::Progress() const
+{
+    SearchProgress progress;
+
+    progress.m_status = m_status;
+    progress.m_minF = m_target ? m_target->F() : (m_os.IsEmpty() ? 0 : m_os.Best()->F());
+    progress.m_openNo = m_os.Size();
+    progress.m_closedNo = m_cs.Size();
+    progress.m_expandedNo = m_expandedNo;
+    progress.m_seconds = m_clock.Elapsed();
+    progress.m_memoryUsed = m_memory.Used();
+    progress.m_memoryPeak = m_memory.PeakReserved();
+
+    return progress;
+}
+
+//
+// Returns the solution, if it was found by the current search
+//
+template<template <typename S> class CS, template <typename S> class OS>
+std::optional<std::vector<State>> Astar<CS, OS>::Path() const
+{
+    if(m_status != SearchProgress::FOUND)
+        return {};
 
-    return {};
+    std::vector<State> path = CreatePath(m_target);
+    m_graph->Complete(path);
+    return path;
 }
 
 //
-// Loop over all children of "node"
+// Sets the progress callback. It is called every "period" expansions,
+// and when the search is finished. Empty "callback" disables the calls.
+//
+template<template <typename S> class CS, template <typename S> class OS>
+void Astar<CS, OS>::SetCallback(Callback callback, size_t period)
+{
+    m_callback = callback;
+    m_period = (period > 0) ? period : 1;
+}
+
+//
+// Loop over all children of "node".
+// With the lookahead, the children are explored by the depth-first search (see LookaheadDfs).
 //
 template<template <typename S> class CS, template <typename S> class OS>
 void Astar<CS, OS>::ChildLoop(Graph& graph, PathNode<State>* node)
+{
+    assert(node);
+
+    if(m_lookahead > 0)
+    {
+        m_laState[0] = node->m_state;
+        m_laG[0] = node->m_g;
+        m_laH[0] = node->m_h;
+        m_laNode[0] = node;
+
+        // The goal found by the lookahead has "f" equal to "f" of the expanded node, hence it is optimal
+        const int prevSpace = node->m_parent ? node->m_parent->m_state.SpaceIdx() : -1;
+        PathNode<State>* target = LookaheadDfs(graph, node->F(), 0, prevSpace);
+        if(target)
+            Found(target);
+        return;
+    }
+
+    const size_t childNo = graph.GetMoves(node->m_state, m_child, m_cost);
+    Lap(Profiler::MOVES);
+
+    Count(Metrics::GENERATED, childNo);
+    Record(Metrics::BRANCHING, childNo);
+    m_layers.Generate(childNo);
+
+    for(size_t i = 0; i < childNo; i++)
+    {
+        AddChild(graph, node, m_child[i], node->m_g + m_cost[i], -1);
+    }
+}
+
+//
+// Adds child "y" of "node" reached with cost "g" to the open set, unless it is known already.
+// "h" - heuristic of "y", or negative if it is not evaluated yet
+//
+template<template <typename S> class CS, template <typename S> class OS>
+void Astar<CS, OS>::AddChild(Graph& graph, PathNode<State>* node, const State& y, Cost g, Cost h)
 {
 PathNode<State> *p;
 
-    assert(node);
+    p = m_cs.Search(y);
+    Lap(Profiler::CLOSED_LOOKUP);
+    if(p)
+    {
+        // Closed nodes are not reopened. With consistent heuristic
+        // the cheaper path to the closed node is never found.
+        Count(Metrics::DUPLICATE_CLOSED);
+        m_layers.Duplicate();
+        if(g < p->m_g)
+            Count(Metrics::REOPENED);
+        else if(m_allOptimal && g == p->m_g)
+            AddParent(p, node);
+        return;
+    }
+
+    p = m_os.Search(y);
+    Lap(Profiler::OPEN_LOOKUP);
+
+    if(p == NULL)
+    {
+        // The heuristic is evaluated only for new nodes
+        if(h < 0)
+        {
+            h = m_weight * graph.CalcH(y);
+            Lap(Profiler::HEURISTIC);
+        }
+
+        p = m_mem.New();
+        p->Set(y, node, g, h);
+        Lap(Profiler::ALLOC);
 
-    const size_t childNo = graph.GetChildren(node->m_state, m_child, m_cost, m_heur);
+        m_os.Add(p);
+        Lap(Profiler::OPEN_INSERT);
+    }
+    else if(g < p->m_g)
+    {
+        // Object pointed by "p" was changed, hence OPEN SET must be updated
+        m_os.Update(p, node, g);
+        Count(Metrics::OPEN_UPDATE);
+        Lap(Profiler::OPEN_UPDATE);
+
+        // The previous parents are not optimal
+        if(m_allOptimal)
+            m_firstEdge.erase(p);
+    }
+    else
+    {
+        if(m_allOptimal && g == p->m_g)
+            AddParent(p, node);
+        Count(Metrics::DUPLICATE_OPEN);
+        m_layers.Duplicate();
+    }
+}
 
+//
+// Depth-first lookahead from the state m_laState[depth]. The children with "f" not greater
+// than "bound" are explored further, up to the depth m_lookahead. The other children
+// (the leaves of the lookahead) are added to the open set.
+// "prevSpace" - position of SPACE in the parent state, the move returning to it is not generated
+// Returns the goal node, if the goal is found by the lookahead, otherwise returns NULL.
+// The time and the cancellation are checked every LOOKAHEAD_PERIOD explored nodes, since
+// the lookahead may run long within single expansion. When they stop the search, the status
+// is set to LIMIT and NULL is returned.
+//
+template<template <typename S> class CS, template <typename S> class OS>
+PathNode<State>* Astar<CS, OS>::LookaheadDfs(Graph& graph, Cost bound, unsigned int depth, int prevSpace)
+{
+    const State& x = m_laState[depth];
+    const int space = x.SpaceIdx();
+
+    std::vector<State>& child = m_laChild[depth];
+    std::vector<Cost>& cost = m_laCost[depth];
+    const size_t childNo = graph.GetMoves(x, child, cost);
+    Lap(Profiler::MOVES);
+
+    size_t generatedNo = 0;
     for(size_t i = 0; i < childNo; i++)
     {
-        const State &y = m_child[i];
-        if(m_cs.Search(y))
+        if(Graph::Move(space, i) == prevSpace)
+            continue;
+        generatedNo++;
+
+        const State& y = child[i];
+        const Cost g = m_laG[depth] + cost[i];
+        const Cost h = m_weight * graph.CalcH(y);
+        Lap(Profiler::HEURISTIC);
+
+        if(g + h > bound || depth + 1 == m_lookahead)
+        {
+            AddChild(graph, Materialize(depth), y, g, h);
+            continue;
+        }
+
+        // The child with the same "f" is explored without the open set
+        m_laState[depth + 1] = y;
+        m_laG[depth + 1] = g;
+        m_laH[depth + 1] = h;
+        m_laNode[depth + 1] = nullptr;
+
+        // The state within the perimeter has the exact heuristic, hence the path completed
+        // by the perimeter has the cost "bound" as well
+        if(graph.IsSolved(y))
+        {
+            Count(Metrics::GENERATED, generatedNo);
+            return Materialize(depth + 1);
+        }
+
+        if(m_limits && ++m_laNo % LOOKAHEAD_PERIOD == 0 && m_limits->Interrupted())
+        {
+            m_limitReached = true;
+            m_status = SearchProgress::LIMIT;
+            Count(Metrics::GENERATED, generatedNo);
+            return nullptr;
+        }
+
+        Count(Metrics::LOOKAHEAD);
+        PathNode<State>* target = LookaheadDfs(graph, bound, depth + 1, space);
+        if(target || m_status != SearchProgress::RUNNING)
+        {
+            Count(Metrics::GENERATED, generatedNo);
+            return target;
+        }
+    }
+
+    Count(Metrics::GENERATED, generatedNo);
+    if(depth == 0)
+    {
+        Record(Metrics::BRANCHING, generatedNo);
+        m_layers.Generate(generatedNo);
+    }
+    return nullptr;
+}
+
+//
+// Allocates the nodes of the lookahead path up to "depth", which are not allocated yet.
+// Returns the node on "depth".
+//
+template<template <typename S> class CS, template <typename S> class OS>
+PathNode<State>* Astar<CS, OS>::Materialize(unsigned int depth)
+{
+    for(unsigned int d = 1; d <= depth; d++)
+    {
+        if(m_laNode[d] == nullptr)
+        {
+            PathNode<State>* p = m_mem.New();
+            p->Set(m_laState[d], m_laNode[d - 1], m_laG[d], m_laH[d]);
+            m_laNode[d] = p;
+        }
+    }
+    return m_laNode[depth];
+}
+
+//
+// Finishes the search, "target" is the goal node
+//
+template<template <typename S> class CS, template <typename S> class OS>
+void Astar<CS, OS>::Found(PathNode<State>* target)
+{
+    m_target = target;
+    m_status = SearchProgress::FOUND;
+
+    // Heuristic along the solution path, for the report of heuristic error
+    std::vector<Cost> heur;
+    for(const PathNode<State>* q = target; q; q = q->m_parent)
+        heur.push_back(q->m_h / m_weight);
+    m_layers.SetSolution(heur);
+}
+
+//
+// Records "parent" as the additional optimal parent of "node"
+//
+template<template <typename S> class CS, template <typename S> class OS>
+void Astar<CS, OS>::AddParent(const PathNode<State>* node, PathNode<State>* parent)
+{
+    auto it = m_firstEdge.find(node);
+    const size_t next = (it != m_firstEdge.end()) ? it->second : NO_EDGE;
+
+    m_edge.push_back(Edge{parent, next});
+    m_firstEdge[node] = m_edge.size() - 1;
+}
+
+//
+// Returns all optimal parents of "node" in "parents"
+//
+template<template <typename S> class CS, template <typename S> class OS>
+void Astar<CS, OS>::Parents(const PathNode<State>* node, std::vector<const PathNode<State>*>& parents) const
+{
+    parents.clear();
+    if(!node->m_parent)
+        return;
+
+    parents.push_back(node->m_parent);
+    auto it = m_firstEdge.find(node);
+    for(size_t e = (it != m_firstEdge.end()) ? it->second : NO_EDGE; e != NO_EDGE; e = m_edge[e].m_next)
+        parents.push_back(m_edge[e].m_parent);
+}
+
+//
+// Returns the number of optimal solutions found by the current search with all optimal solutions.
+// The number is counted over DAG of the optimal paths, it is saturated at the maximum of uint64_t.
+//
+template<template <typename S> class CS, template <typename S> class OS>
+uint64_t Astar<CS, OS>::OptimalNo(void) const
+{
+    if(m_status != SearchProgress::FOUND)
+        return 0;
+    if(!m_allOptimal)
+        return 1;
+
+    // Number of paths from the start to each node, computed in the post-order of the depth-first search
+    std::unordered_map<const PathNode<State>*, uint64_t> count;
+    std::vector<const PathNode<State>*> stack = {m_target};
+    std::vector<const PathNode<State>*> parents;
+
+    while(!stack.empty())
+    {
+        const PathNode<State>* x = stack.back();
+        if(count.count(x))
+        {
+            stack.pop_back();
             continue;
+        }
 
-        const Cost g = node->m_g + m_cost[i];
+        Parents(x, parents);
+        bool ready = true;
+        uint64_t n = parents.empty() ? 1 : 0;
+        for(const PathNode<State>* q : parents)
+        {
+            auto it = count.find(q);
+            if(it == count.end())
+            {
+                stack.push_back(q);
+                ready = false;
+            }
+            else if(ready)
+            {
+                n = (n + it->second < n) ? std::numeric_limits<uint64_t>::max() : n + it->second;
+            }
+        }
 
-        p = m_os.Search(y);
+        if(ready)
+        {
+            count[x] = n;
+            stack.pop_back();
+        }
+    }
+    return count[m_target];
+}
 
-        if(p == NULL)
+//
+// Passes the optimal solutions found by the current search to "visit", one by one.
+// The enumeration is stopped, when "visit" returns "false".
+// Without all optimal solutions, only the found solution is passed.
+//
+template<template <typename S> class CS, template <typename S> class OS>
+void Astar<CS, OS>::ForEachOptimal(const PathVisitor& visit) const
+{
+    if(m_status != SearchProgress::FOUND)
+        return;
+    if(!m_allOptimal)
+    {
+        visit(CreatePath(m_target));
+        return;
+    }
+
+    // Depth-first search from the goal over the parents. Each level holds the node,
+    // its parents and the index of the next parent to visit.
+    struct Level
+    {
+        const PathNode<State>* m_node;
+        std::vector<const PathNode<State>*> m_parents;
+        size_t m_next;
+    };
+
+    std::vector<Level> stack(1);
+    stack[0].m_node = m_target;
+    stack[0].m_next = 0;
+    Parents(m_target, stack[0].m_parents);
+
+    std::vector<State> path;
+    while(!stack.empty())
+    {
+        Level& top = stack.back();
+        if(top.m_parents.empty())
         {
-            p = m_mem.New();
-            p->Set(y, node, g, m_heur[i]);
-            m_os.Add(p);
+            // The start is reached, the path is the reversed stack
+            path.clear();
+            for(auto it = stack.rbegin(); it != stack.rend(); ++it)
+                path.push_back(it->m_node->m_state);
+            if(!visit(path))
+                return;
+            stack.pop_back();
+            continue;
         }
-        else if(g < p->m_g)
+
+        if(top.m_next == top.m_parents.size())
         {
-            // Object pointed by "p" was changed, hence OPEN SET must be updated
-            m_os.Update(p, node, g);
+            stack.pop_back();
+            continue;
         }
 
+        const PathNode<State>* q = top.m_parents[top.m_next++];
+        stack.emplace_back();
+        stack.back().m_node = q;
+        stack.back().m_next = 0;
+        Parents(q, stack.back().m_parents);
     }
 }
 
+//
+// Sets the depth of lookahead. Zero disables the lookahead.
+//
+template<template <typename S> class CS, template <typename S> class OS>
+void Astar<CS, OS>::SetLookahead(unsigned int depth)
+{
+    m_lookahead = depth;
+
+    m_laState.resize(depth + 1);
+    m_laG.resize(depth + 1);
+    m_laH.resize(depth + 1);
+    m_laNode.resize(depth + 1);
+    m_laChild.assign(depth + 1, std::vector<State>(Graph::MAX_CHILD_NO));
+    m_laCost.assign(depth + 1, std::vector<Cost>(Graph::MAX_CHILD_NO));
+}
+
+//
+// Reads the flag of the metrics, the closed set and the open set get the metrics only if it is set
+//
+template<template <typename S> class CS, template <typename S> class OS>
+inline
+void Astar<CS, OS>::SwitchMetrics(void)
+{
+    const bool collect = m_metrics.IsEnabled();
+    if(collect == m_collect)
+        return;
+
+    m_collect = collect;
+    m_cs.SetMetrics(collect ? &m_metrics : nullptr);
+    m_os.SetMetrics(collect ? &m_metrics : nullptr);
+}
+
+//
+// Increases counter "c" of the metrics by "n", if they are collected
+//
+template<template <typename S> class CS, template <typename S> class OS>
+inline
+void Astar<CS, OS>::Count(Metrics::Counter c, uint64_t n)
+{
+    if(m_collect)
+        m_metrics.Add(c, n);
+}
+
+//
+// Adds "value" to histogram "h" of the metrics, if they are collected
+//
+template<template <typename S> class CS, template <typename S> class OS>
+inline
+void Astar<CS, OS>::Record(Metrics::Histogram h, uint64_t value)
+{
+    if(m_collect)
+        m_metrics.Record(h, value);
+}
+
+//
+// The time since the previous phase is attributed to "phase", if the profiler is set
+//
+template<template <typename S> class CS, template <typename S> class OS>
+inline
+void Astar<CS, OS>::Lap(Profiler::Phase phase)
+{
+    if(m_profiler)
+        m_profiler->Lap(phase);
+}
+
+//
+// Records the memory of the data structures
+//
+template<template <typename S> class CS, template <typename S> class OS>
+void Astar<CS, OS>::SampleMemory(void)
+{
+MemoryUsage part[MemoryStats::PART_NO];
+
+    part[MemoryStats::NODES] = m_mem.Memory();
+    part[MemoryStats::CLOSED_SET] = m_cs.Memory();
+    part[MemoryStats::OPEN_SET] = m_os.Memory();
+
+    MemoryUsage& buf = part[MemoryStats::BUFFERS];
+    buf.m_used = m_child.size() * sizeof(State) + m_cost.size() * sizeof(Cost);
+    buf.m_reserved = m_child.capacity() * sizeof(State) + m_cost.capacity() * sizeof(Cost);
+
+    // Lookahead buffers
+    const size_t levelBytes = sizeof(State) + 2 * sizeof(Cost) + sizeof(PathNode<State>*) +
+                              Graph::MAX_CHILD_NO * (sizeof(State) + sizeof(Cost));
+    buf.m_used += m_laState.size() * levelBytes;
+    buf.m_reserved += m_laState.size() * levelBytes;
+
+    // Additional edges of DAG of the optimal paths
+    const size_t mapBytes = m_firstEdge.size() * (sizeof(const PathNode<State>*) + sizeof(size_t) + sizeof(void*));
+    buf.m_used += m_edge.size() * sizeof(Edge) + mapBytes;
+    buf.m_reserved += m_edge.capacity() * sizeof(Edge) + mapBytes + m_firstEdge.bucket_count() * sizeof(void*);
+
+    m_memory.Record(m_expandedNo, m_clock.Elapsed(), part);
+}
+
 //
 // Creates the path being the result of A-Star algorithm
 //
 template<template <typename S> class CS, template <typename S> class OS>
-std::vector<State> Astar<CS, OS>::CreatePath(const PathNode<State>* node)
+std::vector<State> Astar<CS, OS>::CreatePath(const PathNode<State>* node) const
 {
 std::list<State> tmp; // Temporary list for storing states in proper order
 
@@ -201,25 +1011,4 @@ std::list<State> tmp; // Temporary list for storing states in proper order
     return path;
 }
 
-//
-// Writes statistics to log file
-//
-template<template <typename S> class CS, template <typename S> class OS>
-void Astar<CS, OS>::PrintStats() const
-{
-#ifdef ASTAR_STATISTICS
-    std::cout << "\nSTATISTICS:\n";
-    
-    std::cout << "  Astar::LoopNo = " << m_stats_loopNo << "\n\n";
-
-    m_os.PrintStats();
-    std::cout << "\n";
-
-    m_cs.PrintStats();
-    std::cout << "\n";
-#else
-    // fprintf(out, "Astar. No statistics available!\n");
-#endif
-}
-
 #endif
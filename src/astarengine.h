@@ -0,0 +1,112 @@
+#ifndef ASTAR_ASTARENGINE_H
+#define ASTAR_ASTARENGINE_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Adapter of template class Astar to the interface Engine.
+//
+// 2. Template parameters are the same as for class Astar:
+//     CS    - represents Closed-set
+//     OS    - represents Open-set
+//
+// 3. For the weight of heuristic greater then one, it is Weighted A*,
+//    which finds bounded (not necessarily optimal) solutions.
+//
+// 4. For the depth of lookahead greater than zero, it is AL* (A* with lookahead).
+//
+// 5. All optimal solutions are enumerated only by A* (the weight is one and there is no lookahead).
+//
+
+#include "Engine.h"
+#include "astar.h"
+#include <memory>
+
+template<
+    template <typename S> class CS = ClosedSetHash,
+    template <typename S> class OS = OpenSetHash>
+class AstarEngine : public Engine
+{
+public:
+    explicit AstarEngine(Cost weight = 1, unsigned int lookahead = 0);
+
+    std::string Name() const override;
+    bool IsOptimal() const override { return m_astar->Weight() == 1; }
+
+    std::optional<std::vector<State>> Solve(Graph& graph, const State& beg, const Limits& limits) override;
+
+    size_t ExpandedNo() const override { return m_astar->ExpandedNo(); }
+    bool LimitReached() const override { return m_astar->LimitReached(); }
+    const Metrics* GetMetrics() const override { return &m_astar->GetMetrics(); }
+    void SetMetricsEnabled(bool enabled) override { m_astar->SetMetricsEnabled(enabled); }
+    const LayerStats* GetLayers() const override { return &m_astar->GetLayers(); }
+    const MemoryStats* GetMemory() const override { return &m_astar->GetMemory(); }
+
+    void SetProfiler(Profiler* profiler) override { m_astar->SetProfiler(profiler); }
+    void SetTrace(TraceWriter* trace) override { m_astar->SetTrace(trace); }
+    void SetCallback(Callback callback, size_t period) override { m_astar->SetCallback(callback, period); }
+
+    bool SetAllOptimal(bool all) override;
+    uint64_t OptimalNo() const override { return m_astar->OptimalNo(); }
+    void ForEachOptimal(const PathVisitor& visit) const override { m_astar->ForEachOptimal(visit); }
+
+    void Release() override { m_astar->Release(); }
+
+    Astar<CS, OS>& Solver() { return *m_astar; }
+
+private:
+    // Solver is allocated on the heap, since it is large
+    std::unique_ptr< Astar<CS, OS> > m_astar;
+};
+
+//
+// Constructor
+// "weight"    - weight of heuristic
+// "lookahead" - depth of lookahead, zero disables it
+//
+template<template <typename S> class CS, template <typename S> class OS>
+AstarEngine<CS, OS>::AstarEngine(Cost weight, unsigned int lookahead)
+    : m_astar(std::make_unique< Astar<CS, OS> >())
+{
+    m_astar->SetWeight(weight);
+    m_astar->SetLookahead(lookahead);
+}
+
+//
+// Returns name of the engine
+//
+template<template <typename S> class CS, template <typename S> class OS>
+std::string AstarEngine<CS, OS>::Name() const
+{
+    if(!IsOptimal())
+        return "wastar-" + std::to_string(m_astar->Weight());
+    if(m_astar->Lookahead() > 0)
+        return "alstar-" + std::to_string(m_astar->Lookahead());
+    return "astar";
+}
+
+//
+// Enables the enumeration of all optimal solutions.
+// Returns "false" for Weighted A* and AL*, which do not support it.
+//
+template<template <typename S> class CS, template <typename S> class OS>
+bool AstarEngine<CS, OS>::SetAllOptimal(bool all)
+{
+    if(all && (!IsOptimal() || m_astar->Lookahead() > 0))
+        return false;
+
+    m_astar->SetAllOptimal(all);
+    return true;
+}
+
+//
+// Finds the solution
+//
+template<template <typename S> class CS, template <typename S> class OS>
+std::optional<std::vector<State>> AstarEngine<CS, OS>::Solve(Graph& graph, const State& beg, const Limits& limits)
+{
+    return m_astar->Find(graph, beg, limits);
+}
+
+#endif
@@ -38,8 +38,8 @@
 //    It adds pointer "p" to CLOSED SET. Memory for object pointed by "p" 
 //    must be allocated by "new" operator by calling function.
 //
-// 2. bool Search(const S& state) const
-//    It returns "true", if "state" is in CLOSED SET. Otherwise it returns "false".
+// 2. PathNode<S>* Search(const S& state) const
+//    It returns the node holding "state", if "state" is in CLOSED SET. Otherwise it returns NULL.
 //
 // 3. void Erase(void)
 //    It deletes all objects pointed by pointers stored in CLOSED SET and clears all pointers stored in CLOSED SET.
@@ -49,13 +49,17 @@
 // 4. size_t Size() const
 //    It returns the number of elements in CLOSED SET.
 //
-// 5. void PrintStats(FILE* out) const
-//    It prints calling statistic to file "out". The statistic is only available,
-//    when preprocessor macro "ASTAR_STATISTICS" is defined.
+// 5. void SetMetrics(Metrics* metrics)
+//    It sets the object collecting the metrics (see class Metrics). NULL disables the collection.
+//
+// 6. MemoryUsage Memory() const
+//    It returns the estimated memory occupied by the nodes of std::set (see MemoryUsage.h).
 //
 
 
 #include "pathnode.h"
+#include "Metrics.h"
+#include "MemoryUsage.h"
 #include <cassert>
 #include <set>
 #include <cstddef>
@@ -96,23 +100,17 @@ public:
     ~ClosedSet(void);
 
     void Add(PathNode<S>* p);
-    bool Search(const S& state) const;
+    PathNode<S>* Search(const S& state) const;
 
     void Erase(void);
     size_t Size() const;
+    MemoryUsage Memory() const;
 
-    void PrintStats() const;
+    void SetMetrics(Metrics*) { }
 
 private:
     // Container storing pointers to "PathNode<S>"
     std::set< PathNode<S>*, LessN<S> > m_set;
-
-#ifdef ASTAR_STATISTICS
-    mutable size_t m_stats_erase;  // Number of calls for function Erase
-    mutable size_t m_stats_add;    // Number of calls for function Add
-    mutable size_t m_stats_search; // Number of calls for function Search
-    mutable size_t m_stats_size;   // Number of calls for function Size
-#endif
 };
 
 //
@@ -122,12 +120,6 @@ template<typename S>
 inline
 ClosedSet<S>::ClosedSet(void)
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_erase = 0;
-    m_stats_add = 0;
-    m_stats_search = 0;
-    m_stats_size = 0;
-#endif
 }
 
 //
@@ -148,10 +140,6 @@ ClosedSet<S>::~ClosedSet(void)
 template<typename S>
 void ClosedSet<S>::Erase(void)
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_erase++;
-#endif
-
 // std::set< PathNode<S>*, LessN<S> >::iterator it = m_set.begin();
 //
 //  for(; it != m_set.end(); ++it)
@@ -167,25 +155,18 @@ template<typename S>
 inline
 void ClosedSet<S>::Add(PathNode<S>* p)
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_add++;
-#endif
-
     assert(p);
     m_set.insert(p);
 }
 
 //
-// Returns "true" if "state" is in CLOSED SET
+// If "state" is in CLOSED SET, returns pointer to "PathNode" holding "state".
+// Otherwise returns NULL
 //
 template<typename S>
 inline
-bool ClosedSet<S>::Search(const S& state) const
+PathNode<S>* ClosedSet<S>::Search(const S& state) const
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_search++;
-#endif
-
 // This is a temporary object required for comparison.
 // This object is only used by funtion:
 //     bool LessN<S>::operator(const PathNode<S>* const, const PathNode<S>* const) const
@@ -193,7 +174,10 @@ bool ClosedSet<S>::Search(const S& state) const
 // This object can be treated as a wrapper for "state" object.
 PathNode<S> tmp(state, NULL, 0, 0);
 
-    return (m_set.count(&tmp) > 0);
+    typename std::set< PathNode<S>*, LessN<S> >::const_iterator it = m_set.find(&tmp);
+    if(it != m_set.end())
+        return *it;
+    return NULL;
 }
 
 //
@@ -203,28 +187,21 @@ template<typename S>
 inline
 size_t ClosedSet<S>::Size() const
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_size++;
-#endif
-
     return m_set.size();
 }
 
 //
-// Prints statistics to file "out"
+// Returns the estimated memory occupied by the nodes of std::set
 //
 template<typename S>
-void ClosedSet<S>::PrintStats() const
+inline
+MemoryUsage ClosedSet<S>::Memory() const
 {
-#ifdef ASTAR_STATISTICS
-    std::cout << "  ClosedSet::Search.... = " << m_stats_search << "\n";
-    std::cout << "  ClosedSet::Add....... = " << m_stats_add << "\n";
-    std::cout << "  ClosedSet::Erase..... = " << m_stats_erase << "\n";
-    std::cout << "  ClosedSet::Size...... = " << m_stats_size << "\n";
-#else
-    // fprintf(out, "ClosedSet. No statistics available!\n");
-#endif
-}
+MemoryUsage m;
 
+    m.m_used = m_set.size() * MemoryUsage::TreeNodeBytes< PathNode<S>* >();
+    m.m_reserved = m.m_used;
+    return m;
+}
 
 #endif
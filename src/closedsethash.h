@@ -21,10 +21,12 @@
 //
 // 5. OPEN SET holds only pointers to GRAPH STATE.
 //
+// 6. Function Search returns the node holding the state, hence the cost
+//    of the closed node can be compared with the cost of the new path.
+//
 
 #include "hashset.h"
-#include <cstdio>
-#include <iostream>
+#include "Metrics.h"
 
 template<typename S>
 class ClosedSetHash
@@ -33,25 +35,17 @@ public:
     ClosedSetHash(void);
 
     void Add(PathNode<S>* p);
-    bool Search(const S& state) const;
+    PathNode<S>* Search(const S& state) const;
 
     void Erase(void);
     size_t Size() const;
+    MemoryUsage Memory() const { return m_set.Memory(); }
 
-    void PrintStats() const;
+    void SetMetrics(Metrics* metrics) { m_set.SetMetrics(metrics); }
 
 private:
     // Container storing pointers to "PathNode<S>"
     HashSet<S> m_set;
-
-#ifdef ASTAR_STATISTICS
-    mutable size_t m_stats_erase;     // Number of calls for function Erase
-    mutable size_t m_stats_add;       // Number of calls for function Add
-    mutable size_t m_stats_search;    // Number of calls for function Search
-    mutable size_t m_stats_size;      // Number of calls for function Size
-    mutable size_t m_stats_collision; // Number of collisions in hash table
-#endif
-
 };
 
 //
@@ -61,13 +55,6 @@ template<typename S>
 inline
 ClosedSetHash<S>::ClosedSetHash(void) : m_set(10000000)
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_erase = 0;
-    m_stats_add = 0;
-    m_stats_search = 0;
-    m_stats_size = 0;
-    m_stats_collision = 0;
-#endif
 }
 
 //
@@ -77,10 +64,6 @@ ClosedSetHash<S>::ClosedSetHash(void) : m_set(10000000)
 template<typename S>
 void ClosedSetHash<S>::Erase(void)
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_erase++;
-#endif
-
     m_set.Clear();
 }
 
@@ -91,32 +74,19 @@ template<typename S>
 inline
 void ClosedSetHash<S>::Add(PathNode<S>* p)
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_add++;
-#endif
-
     assert(p);
-
-#ifdef ASTAR_STATISTICS
-    m_stats_collision += m_set.Insert(p);
-#else
     m_set.Insert(p);
-#endif
-    
 }
 
 //
-// Returns "true" if "state" is in CLOSED SET
+// If "state" is in CLOSED SET, returns pointer to "PathNode" holding "state".
+// Otherwise returns NULL
 //
 template<typename S>
 inline
-bool ClosedSetHash<S>::Search(const S& state) const
+PathNode<S>* ClosedSetHash<S>::Search(const S& state) const
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_search++;
-#endif
-
-    return (m_set.Find(state) != NULL);
+    return m_set.Find(state);
 }
 
 //
@@ -126,29 +96,8 @@ template<typename S>
 inline
 size_t ClosedSetHash<S>::Size() const
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_size++;
-#endif
-
     return m_set.Count();
 }
 
-//
-// Prints statistics to file "out"
-//
-template<typename S>
-void ClosedSetHash<S>::PrintStats() const
-{
-#ifdef ASTAR_STATISTICS
-    std::cout << "  ClosedSetHash::Search....... = " << m_stats_search << "\n";
-    std::cout << "  ClosedSetHash::Add.......... = " << m_stats_add << "\n";
-    std::cout << "  ClosedSetHash::Erase........ = " << m_stats_erase << "\n";
-    std::cout << "  ClosedSetHash::Size......... = " << m_stats_size << "\n";
-    std::cout << "  ClosedSetHash::Collisions... = " << m_stats_collision << "\n";
-#else
-    // fprintf(out, "ClosedSetSTL. No statistics available!\n");
-#endif
-}
-
 
 #endif
@@ -0,0 +1,230 @@
+//
+// This program converts the files with instances and solutions
+// between the text and the binary representation.
+//
+// Usage:
+//    sliding-convert instances-to-bin  IN OUT
+//    sliding-convert instances-to-text IN OUT
+//    sliding-convert solutions-to-bin  IN OUT
+//    sliding-convert solutions-to-text IN OUT
+//
+// Text representation of instances is accepted by InstanceReader.
+//
+// Text representation of solution is a single line:
+//    <tiles of initial state> : <optimal|bounded> : <moved tiles>
+// for example
+//    1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 21 22 0 23 24 : optimal : 23 24
+//
+// "-" denotes standard input or standard output.
+//
+
+#include "InstanceReader.h"
+#include "BinaryFormat.h"
+#include "Solution.h"
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+
+//
+// Text file opened for writing. The buffer is set only for the opened file, not for standard output.
+//
+class TextOut
+{
+public:
+    explicit TextOut( const std::string& path )
+        : m_file( path == "-" ? stdout : fopen( path.c_str(), "w" ) )
+        , m_buffer( 1 << 20 )
+    {
+        if( !m_file )
+            throw std::invalid_argument( "Cannot open file. Path = " + path );
+        if( m_file != stdout )
+            setvbuf( m_file, m_buffer.data(), _IOFBF, m_buffer.size() );
+    }
+
+    ~TextOut( )
+    {
+        if( m_file != stdout )
+            fclose( m_file );
+        else
+            fflush( m_file );
+    }
+
+    void Put( const std::string& line )
+    {
+        fputs( line.c_str(), m_file );
+        fputc( '\n', m_file );
+    }
+
+private:
+    FILE* m_file;
+    std::vector< char > m_buffer;
+};
+
+//
+// Returns tiles of "s" separated by spaces
+//
+std::string ToText( const State& s )
+{
+    std::string txt;
+    for( uint8_t i = 0; i < State::TILENO; i++ )
+    {
+        if( i > 0 )
+            txt += ' ';
+        txt += std::to_string( static_cast< int >( s.Tile( i ) ) );
+    }
+    return txt;
+}
+
+//
+// Parses the tiles of the initial state. Returns the rest of "line".
+//
+const char* ParseState( const char* line, State& s )
+{
+    std::array< char, State::TILENO > tab;
+    uint32_t seen = 0;
+
+    for( uint i = 0; i < State::TILENO; i++ )
+    {
+        char* end;
+        const long t = strtol( line, &end, 10 );
+        if( end == line || t < 0 || t >= static_cast< long >( State::TILENO ) || ( seen & ( 1u << t ) ) )
+            throw std::invalid_argument( "Not allowed initial state in solution." );
+
+        seen |= 1u << t;
+        tab[ i ] = static_cast< char >( t );
+        line = end;
+    }
+
+    s = State{ tab };
+    if( !s.IsSolvable() )
+        throw std::invalid_argument( "The state is not solvable." );
+
+    return line;
+}
+
+//
+// Skips spaces and the separator ':'
+//
+const char* SkipSeparator( const char* p )
+{
+    while( *p == ' ' || *p == '\t' )
+        p++;
+
+    if( *p != ':' )
+        throw std::invalid_argument( "Missing separator ':' in solution." );
+
+    return p + 1;
+}
+
+void InstancesToBin( const std::string& in, const std::string& out )
+{
+    BinaryWriter writer( out, BinaryFile::INSTANCES );
+    InstanceReader reader( in );
+    reader.ForEach( [&writer]( const State& s ) { writer.Write( s ); } );
+}
+
+void InstancesToText( const std::string& in, const std::string& out )
+{
+    TextOut writer( out );
+    BinaryReader reader( in );
+    reader.ForEach( [&writer]( const State& s ) { writer.Put( ToText( s ) ); } );
+}
+
+void SolutionsToBin( const std::string& in, const std::string& out )
+{
+    FILE* f = ( in == "-" ) ? stdin : fopen( in.c_str(), "r" );
+    if( !f )
+        throw std::invalid_argument( "Cannot open file. Path = " + in );
+
+    BinaryWriter writer( out, BinaryFile::SOLUTIONS );
+
+    char* line = nullptr;
+    size_t size = 0;
+    while( getline( &line, &size, f ) > 0 )
+    {
+        const char* p = line;
+        while( *p == ' ' || *p == '\t' )
+            p++;
+
+        if( *p == '#' || *p == '\n' || *p == '\r' || *p == '\0' ) // Comment or empty line
+            continue;
+
+        State beg;
+        p = SkipSeparator( ParseState( p, beg ) );
+
+        while( *p == ' ' || *p == '\t' )
+            p++;
+
+        bool optimal;
+        if( strncmp( p, "optimal", 7 ) == 0 )
+            optimal = true;
+        else if( strncmp( p, "bounded", 7 ) == 0 )
+            optimal = false;
+        else
+            throw std::invalid_argument( "Expected 'optimal' or 'bounded' in solution." );
+
+        p = SkipSeparator( p + 7 );
+        writer.Write( beg, Solution::FromText( beg, p, optimal ) );
+    }
+
+    free( line );
+    if( f != stdin )
+        fclose( f );
+}
+
+void SolutionsToText( const std::string& in, const std::string& out )
+{
+    TextOut writer( out );
+    BinaryReader reader( in );
+
+    State beg;
+    Solution sol;
+    while( reader.Next( beg, sol ) )
+    {
+        const char* kind = sol.IsOptimal() ? " : optimal : " : " : bounded : ";
+        writer.Put( ToText( beg ) + kind + sol.ToText( beg ) );
+    }
+}
+
+}
+
+int main( int argc, char** argv )
+{
+    if( argc != 4 )
+    {
+        std::cerr << "Usage: " << argv[ 0 ] << " instances-to-bin|instances-to-text|solutions-to-bin|solutions-to-text IN OUT\n";
+        return 2;
+    }
+
+    const std::string mode = argv[ 1 ];
+
+    try
+    {
+        if( mode == "instances-to-bin" )
+            InstancesToBin( argv[ 2 ], argv[ 3 ] );
+        else if( mode == "instances-to-text" )
+            InstancesToText( argv[ 2 ], argv[ 3 ] );
+        else if( mode == "solutions-to-bin" )
+            SolutionsToBin( argv[ 2 ], argv[ 3 ] );
+        else if( mode == "solutions-to-text" )
+            SolutionsToText( argv[ 2 ], argv[ 3 ] );
+        else
+        {
+            std::cerr << "Unknown mode: " << mode << "\n";
+            return 2;
+        }
+    }
+    catch( const std::invalid_argument& e )
+    {
+        std::cerr << "ERROR: " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
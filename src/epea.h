@@ -0,0 +1,316 @@
+#ifndef ASTAR_EPEA_H
+#define ASTAR_EPEA_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Represents EPEA* (Enhanced Partial Expansion A-STAR) algorithm as a template class.
+//
+// 2. Template parameters are the same as for class Astar:
+//     CS    - represents Closed-set
+//     OS    - represents Open-set
+//
+// 3. A* inserts all children of the expanded node into the open set, although most of them
+//    have "f" greater than the cost of the solution and they are never expanded (surplus nodes).
+//    EPEA* stores the value "F" of each node. Initially it is "f = g + h". When the node
+//    is selected, only the children with "f" equal to "F" are generated. Then the node is put
+//    back into the open set with "F" equal to the next larger "f" of its children.
+//    If there is no such child, the node is closed.
+//
+// 4. The change of "f" for each move is known before the child is generated. For Manhattan
+//    metric it is "1 + Graph::DeltaH", i.e. the cost of the move and the change of the distance
+//    of the moved tile, taken from the table indexed by the moved tile, the position of SPACE
+//    and the move. Hence, the children, which are not needed, are neither generated,
+//    nor evaluated, nor searched in the closed and open sets.
+//    Only the incremental heuristic is supported (see Graph::IsIncremental), otherwise
+//    the exception std::invalid_argument is thrown. For other heuristics (or with the perimeter,
+//    see Perimeter.h) each partial expansion would generate and evaluate all children again.
+//
+// 5. The stored value "F" is kept in PathNode as "m_h = F - g", hence the open sets of A*
+//    are used without changes. The heuristic of the selected node is evaluated again.
+//
+// 6. With consistent heuristic the solution is optimal, since the nodes are selected
+//    in the same order of "f" as by A*.
+//
+// 7. The metrics are collected. The partially expanded nodes put back into the open set
+//    are counted as Metrics::REQUEUED.
+//
+
+#include "Engine.h"
+#include "pathnode.h"
+#include "closedsethash.h"
+#include "opensethash.h"
+#include "opensetbucket.h"
+#include "memmgr.h"
+#include "Cost.h"
+#include "Graph.h"
+#include "Limits.h"
+#include "Metrics.h"
+#include "MemoryUsage.h"
+#include <list>
+#include <memory>
+#include <optional>
+#include <limits>
+#include <stdexcept>
+
+template<
+    template <typename S> class CS = ClosedSetHash,
+    template <typename S> class OS = OpenSetHash>
+class Epea : public Engine
+{
+public:
+    explicit Epea(unsigned int chunkSize = 10000);
+
+    std::string Name() const override { return "epea"; }
+    bool IsOptimal() const override { return true; }
+
+    std::optional<std::vector<State>> Solve(Graph& graph, const State& beg, const Limits& limits) override;
+
+    size_t ExpandedNo() const override { return m_expandedNo; }
+    bool LimitReached() const override { return m_limitReached; }
+    const Metrics* GetMetrics() const override { return &m_metrics; }
+
+    void Release() override;
+
+    // Number of nodes allocated by the last call of Solve
+    size_t NodeNo(void) const { return m_mem.Memory().m_used / sizeof(PathNode<State>); }
+
+    // Number of expansions between the checks of memory limit
+    static constexpr size_t MEMORY_PERIOD = 1 << 14;
+
+private:
+    Cost Expand(Graph& graph, PathNode<State>* node);
+    void AddChild(PathNode<State>* node, const State& y, Cost h);
+    size_t Reserved(void) const;
+    std::vector<State> CreatePath(const PathNode<State>* node) const;
+
+private:
+    // Returned by function Expand, if all children are generated
+    inline static constexpr Cost NONE = std::numeric_limits<Cost>::max();
+
+    // Closed set
+    CS<State> m_cs;
+
+    // Open set
+    OS<State> m_os;
+
+    // Memory menager
+    MemMgr< PathNode<State> > m_mem;
+
+    // Number of expanded nodes (including partial expansions) in the last search
+    size_t m_expandedNo;
+
+    // "true" if the last search was stopped by the limits
+    bool m_limitReached;
+
+    // Metrics of the last search
+    Metrics m_metrics;
+};
+
+//
+// Constructor
+// "chunkSize" - number of elements allocated when increased, in memory allocator
+//
+template<template <typename S> class CS, template <typename S> class OS>
+Epea<CS, OS>::Epea(unsigned int chunkSize)
+    : m_mem(chunkSize)
+    , m_expandedNo(0)
+    , m_limitReached(false)
+{
+    m_cs.SetMetrics(&m_metrics);
+    m_os.SetMetrics(&m_metrics);
+}
+
+//
+// Deletes the nodes of the last search and gives back their memory, except the first chunk
+//
+template<template <typename S> class CS, template <typename S> class OS>
+void Epea<CS, OS>::Release()
+{
+    m_cs.Erase();
+    m_os.Erase();
+    m_mem.Release();
+}
+
+//
+// Finds the solution. Returns the empty value, if the limits are exceeded.
+//
+template<template <typename S> class CS, template <typename S> class OS>
+std::optional<std::vector<State>> Epea<CS, OS>::Solve(Graph& graph, const State& beg, const Limits& limits)
+{
+PathNode<State>* p;
+Limits lim = limits;
+
+    if(!graph.IsIncremental())
+        throw std::invalid_argument("EPEA* supports only heuristic manhattan without perimeter");
+
+    lim.Start();
+    m_expandedNo = 0;
+    m_limitReached = false;
+    m_metrics.Reset();
+
+    m_cs.Erase();
+    m_os.Erase();
+    m_mem.Erase();
+
+    p = m_mem.New();
+    p->Set(beg, NULL, 0, graph.CalcH(beg));
+    m_os.Add(p);
+
+    while(!m_os.IsEmpty())
+    {
+        // The node in open set having the lowest stored value "F"
+        p = m_os.Best();
+        if(graph.IsSolved(p->m_state))
+        {
+            std::vector<State> path = CreatePath(p);
+            graph.Complete(path);
+            return path;
+        }
+
+        if(lim.Exceeded(m_expandedNo) ||
+           (lim.m_maxBytes > 0 && m_expandedNo % MEMORY_PERIOD == 0 && Reserved() > lim.m_maxBytes))
+        {
+            m_limitReached = true;
+            return {};
+        }
+
+        m_os.RemoveBest();
+        m_expandedNo++;
+        m_metrics.Add(Metrics::EXPANDED);
+
+        const Cost next = Expand(graph, p);
+        if(next == NONE)
+        {
+            m_cs.Add(p);
+        }
+        else
+        {
+            // The node is put back with the next larger "f" of its children
+            p->m_h = next - p->m_g;
+            m_os.Add(p);
+            m_metrics.Add(Metrics::REQUEUED);
+        }
+    }
+
+    return {};
+}
+
+//
+// Generates the children of "node" with "f" equal to the stored value "F" of the node.
+// Returns the smallest "f" of the children greater than "F", or NONE if there is no such child.
+//
+template<template <typename S> class CS, template <typename S> class OS>
+Cost Epea<CS, OS>::Expand(Graph& graph, PathNode<State>* node)
+{
+    const State& x = node->m_state;
+    const Cost F = node->F();
+
+    // The heuristic of the node is computed, since the stored "h" of the requeued node is raised
+    const Cost h = graph.CalcH(x);
+
+    const uint8_t sp = static_cast<uint8_t>(x.SpaceIdx());
+    const char movesNo = Graph::MovesNo(sp);
+
+    Cost next = NONE;
+    size_t childNo = 0;
+
+    for(uint8_t j = 0; j < movesNo; j++)
+    {
+        const uint8_t from = static_cast<uint8_t>(Graph::Move(sp, j));
+
+        // The child is generated only if it is needed
+        const Cost hy = h + Graph::DeltaH(x.Tile(from), sp, j);
+
+        // The cost of each move is equal to one
+        const Cost f = node->m_g + 1 + hy;
+        if(f > F)
+        {
+            next = std::min(next, f);
+            continue;
+        }
+
+        // The children with lower "f" were generated by the previous expansions of the node
+        if(f < F)
+            continue;
+
+        State y = x;
+        y.Swap(sp, from);
+        AddChild(node, y, hy);
+        childNo++;
+    }
+
+    m_metrics.Add(Metrics::GENERATED, childNo);
+    m_metrics.Record(Metrics::BRANCHING, childNo);
+
+    return next;
+}
+
+//
+// Adds child "y" of "node" with heuristic "h" to the open set, unless it is known already
+//
+template<template <typename S> class CS, template <typename S> class OS>
+void Epea<CS, OS>::AddChild(PathNode<State>* node, const State& y, Cost h)
+{
+PathNode<State>* p;
+
+    const Cost g = node->m_g + 1;
+
+    p = m_cs.Search(y);
+    if(p)
+    {
+        // Closed nodes are not reopened, the heuristic is consistent
+        m_metrics.Add(Metrics::DUPLICATE_CLOSED);
+        if(g < p->m_g)
+            m_metrics.Add(Metrics::REOPENED);
+        return;
+    }
+
+    p = m_os.Search(y);
+    if(p == NULL)
+    {
+        p = m_mem.New();
+        p->Set(y, node, g, h);
+        m_os.Add(p);
+    }
+    else if(g < p->m_g)
+    {
+        // The node is not expanded yet, since with consistent heuristic
+        // the node is selected first with the optimal "g"
+        m_os.Update(p, node, g);
+        m_metrics.Add(Metrics::OPEN_UPDATE);
+    }
+    else
+    {
+        m_metrics.Add(Metrics::DUPLICATE_OPEN);
+    }
+}
+
+//
+// Returns the bytes reserved by the data structures of the search
+//
+template<template <typename S> class CS, template <typename S> class OS>
+size_t Epea<CS, OS>::Reserved(void) const
+{
+    return m_mem.Memory().m_reserved + m_cs.Memory().m_reserved + m_os.Memory().m_reserved;
+}
+
+//
+// Creates the path from the start state to "node"
+//
+template<template <typename S> class CS, template <typename S> class OS>
+std::vector<State> Epea<CS, OS>::CreatePath(const PathNode<State>* node) const
+{
+std::list<State> tmp; // Temporary list for storing states in proper order
+
+    while(node)
+    {
+        tmp.push_front(node->m_state);
+        node = node->m_parent;
+    }
+
+    return std::vector<State>(tmp.begin(), tmp.end());
+}
+
+#endif
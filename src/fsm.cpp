@@ -0,0 +1,90 @@
+//
+// This program builds the finite state machine pruning the duplicate sequences of moves
+// (see MoveFsmBuilder.h) and writes its table of transitions as C++ header.
+//
+// Usage:
+//    sliding-fsm [--length L] [OUT]
+//
+//    --length L - maximal length of enumerated sequences (default 12)
+//    OUT        - output file, "-" denotes standard output (default)
+//
+// The statistics are printed to standard error: the number of duplicates and states,
+// and the number of sequences of each length accepted by the FSM with the ratio
+// to the previous length (the branching factor on the unbounded board).
+//
+// Example:
+//    sliding-fsm --length 12 src/MoveFsmTable.h
+//
+
+#include "MoveFsmBuilder.h"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+
+void Usage( const char* name )
+{
+    std::cerr << "Usage: " << name << " [--length L] [OUT]\n";
+}
+
+}
+
+int main( int argc, char** argv )
+{
+    unsigned int length = 12;
+    std::string out = "-";
+
+    for( int i = 1; i < argc; i++ )
+    {
+        const std::string arg = argv[ i ];
+        if( arg == "--length" && i + 1 < argc )
+            length = static_cast< unsigned int >( atoi( argv[ ++i ] ) );
+        else if( arg.size() > 1 && arg[ 0 ] == '-' && arg[ 1 ] == '-' )
+        {
+            Usage( argv[ 0 ] );
+            return 2;
+        }
+        else
+            out = arg;
+    }
+
+    try
+    {
+        MoveFsmBuilder builder( length );
+        builder.Build();
+
+        std::cerr << "Duplicates: " << builder.DuplicateNo() << "\n"
+                  << "States:     " << builder.StateNo() << "\n"
+                  << "Length  Sequences  Branching\n";
+
+        const std::vector< uint64_t > accepted = builder.AcceptedNo( 2 * length );
+        for( size_t len = 1; len < accepted.size(); len++ )
+        {
+            std::cerr << len << "  " << accepted[ len ] << "  "
+                      << static_cast< double >( accepted[ len ] ) / accepted[ len - 1 ] << "\n";
+        }
+
+        if( out == "-" )
+        {
+            builder.Write( std::cout );
+        }
+        else
+        {
+            std::ofstream file( out );
+            if( !file )
+                throw std::invalid_argument( "Cannot open file. Path = " + out );
+            builder.Write( file );
+        }
+    }
+    catch( const std::invalid_argument& e )
+    {
+        std::cerr << "ERROR: " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
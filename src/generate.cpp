@@ -0,0 +1,195 @@
+//
+// This program generates random solvable instances.
+//
+// Usage:
+//    sliding-generate [--seed N] [--count N] [--walk K] [--binary] [OUT]
+//
+//    --seed N   - 64-bit seed, the same seed gives the same instances (default 1)
+//    --count N  - number of instances (default 1)
+//    --walk K   - instances are obtained by K random moves from the GOAL state,
+//                 otherwise the uniformly random permutations are generated
+//
+//    The numbers are non-negative integers, the seed may be hexadecimal ("0x" prefix).
+//    The invalid number is rejected with the usage.
+//    --binary   - the binary file with instances is written (see BinaryFormat.h),
+//                 otherwise the text file accepted by InstanceReader is written
+//    OUT        - output file, "-" denotes standard output (default)
+//
+// Example:
+//    sliding-generate --seed 7 --count 1000 --walk 40 walk40.txt
+//
+
+#include "Generator.h"
+#include "BinaryFormat.h"
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+
+//
+// Writes instances as text. Each instance is written in a single line.
+// The lines are formatted by hand, since printf is too slow for millions of instances.
+// The lines are collected in the own buffer, which is written by single fwrite, hence
+// the buffer of the stream (standard output as well) is not replaced.
+//
+class TextWriter
+{
+public:
+    explicit TextWriter( const std::string& path )
+        : m_file( path == "-" ? stdout : fopen( path.c_str(), "w" ) )
+        , m_buffer( 1 << 20 )
+        , m_size( 0 )
+    {
+        if( !m_file )
+            throw std::invalid_argument( "Cannot open file. Path = " + path );
+    }
+
+    ~TextWriter( )
+    {
+        Flush();
+        if( m_file != stdout )
+            fclose( m_file );
+        else
+            fflush( m_file );
+    }
+
+    void Write( const State& s )
+    {
+        // At most 2 digits and the separator per tile
+        if( m_size + 3 * State::TILENO > m_buffer.size() )
+            Flush();
+
+        char* const line = m_buffer.data() + m_size;
+        char* p = line;
+
+        for( uint8_t i = 0; i < State::TILENO; i++ )
+        {
+            const int t = s.Tile( i );
+            if( t >= 10 )
+                *p++ = static_cast< char >( '0' + t / 10 );
+            *p++ = static_cast< char >( '0' + t % 10 );
+            *p++ = ' ';
+        }
+        p[ -1 ] = '\n';
+
+        m_size += p - line;
+    }
+
+private:
+    void Flush( )
+    {
+        fwrite( m_buffer.data(), 1, m_size, m_file );
+        m_size = 0;
+    }
+
+private:
+    FILE* m_file;
+    std::vector< char > m_buffer;
+
+    // Number of bytes in the buffer
+    size_t m_size;
+};
+
+void Usage( const char* name )
+{
+    std::cerr << "Usage: " << name << " [--seed N] [--count N] [--walk K] [--binary] [OUT]\n";
+}
+
+//
+// Parses the non-negative integer "text" not greater than "max" in base "base" to "val".
+// Returns "false", if the text is not such number.
+//
+bool Parse( const char* text, int base, uint64_t max, uint64_t& val )
+{
+    if( !isdigit( static_cast< unsigned char >( text[ 0 ] ) ) )
+        return false;
+
+    char* end = nullptr;
+    errno = 0;
+    const unsigned long long v = strtoull( text, &end, base );
+    if( errno == ERANGE || *end != '\0' || v > max )
+        return false;
+
+    val = v;
+    return true;
+}
+
+}
+
+int main( int argc, char** argv )
+{
+    uint64_t seed = 1;
+    uint64_t count = 1;
+    uint64_t walk = 0;
+    bool permutation = true;
+    bool binary = false;
+    std::string out = "-";
+
+    for( int i = 1; i < argc; i++ )
+    {
+        const std::string arg = argv[ i ];
+        bool ok = true;
+        if( arg == "--seed" && i + 1 < argc )
+            ok = Parse( argv[ ++i ], 0, UINT64_MAX, seed );
+        else if( arg == "--count" && i + 1 < argc )
+            ok = Parse( argv[ ++i ], 10, UINT64_MAX, count );
+        else if( arg == "--walk" && i + 1 < argc )
+        {
+            ok = Parse( argv[ ++i ], 10, UINT_MAX, walk );
+            permutation = false;
+        }
+        else if( arg == "--binary" )
+            binary = true;
+        else if( arg.size() > 1 && arg[ 0 ] == '-' && arg[ 1 ] == '-' )
+        {
+            Usage( argv[ 0 ] );
+            return 2;
+        }
+        else
+            out = arg;
+
+        if( !ok )
+        {
+            std::cerr << "ERROR: Invalid value of option " << arg << ": " << argv[ i ] << "\n";
+            Usage( argv[ 0 ] );
+            return 2;
+        }
+    }
+
+    Generator gen( seed );
+
+    auto next = [&gen, walk, permutation]( ) {
+        return permutation ? gen.Permutation() : gen.Walk( static_cast< unsigned int >( walk ) );
+    };
+
+    try
+    {
+        if( binary )
+        {
+            BinaryWriter writer( out, BinaryFile::INSTANCES );
+            for( uint64_t i = 0; i < count; i++ )
+                writer.Write( next() );
+        }
+        else
+        {
+            TextWriter writer( out );
+            for( uint64_t i = 0; i < count; i++ )
+                writer.Write( next() );
+        }
+    }
+    catch( const std::invalid_argument& e )
+    {
+        std::cerr << "ERROR: " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
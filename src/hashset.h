@@ -17,8 +17,16 @@
 //
 // 3. This is linear hash-table with dynamic expansion.
 //
+// 4. If the metrics are set (function SetMetrics), the number of insertions, searches,
+//    removals, expansions and the lengths of probe sequences are counted.
+//
+// 5. Function Memory returns the bytes of the occupied slots, the bytes of the table
+//    and the load factor.
+//
 
 #include "pathnode.h"
+#include "Metrics.h"
+#include "MemoryUsage.h"
 #include <vector>
 #include <cassert>
 
@@ -40,6 +48,10 @@ public:
 
     unsigned int Count(void) const;
 
+    MemoryUsage Memory(void) const;
+
+    void SetMetrics(Metrics* metrics) { m_metrics = metrics; }
+
 private:
     void Next(unsigned int& idx) const;
 
@@ -56,6 +68,9 @@ private:
 
     // Number of elements in array
     unsigned int m_cnt;
+
+    // Collected metrics, NULL if not collected
+    Metrics* m_metrics;
 };
 
 
@@ -64,7 +79,7 @@ private:
 // initSize - initialize size of array
 //
 template <typename S>
-HashSet<S>::HashSet(unsigned int initSize) : m_cnt(0)
+HashSet<S>::HashSet(unsigned int initSize) : m_cnt(0), m_metrics(nullptr)
 {
     Malloc(initSize);
 }
@@ -78,6 +93,20 @@ unsigned int HashSet<S>::Count(void) const
     return m_cnt;
 }
 
+//
+// Returns the memory occupied by the table
+//
+template <typename S>
+MemoryUsage HashSet<S>::Memory(void) const
+{
+MemoryUsage m;
+
+    m.m_used = m_cnt * sizeof(PathNode<S>*);
+    m.m_reserved = m_tab.capacity() * sizeof(PathNode<S>*);
+    m.m_load = m_tab.empty() ? 0 : double(m_cnt) / m_tab.size();
+    return m;
+}
+
 //
 // Inserts object pointed by "p" into the set.
 // It is allowed to insert one object pointed by "p" only.
@@ -102,6 +131,13 @@ unsigned int i, coll = 0;
     m_tab[i] = p;
     m_cnt++;
 
+    if(m_metrics)
+    {
+        m_metrics->Add(Metrics::HASH_INSERT);
+        m_metrics->Add(Metrics::HASH_PROBE, coll);
+        m_metrics->Record(Metrics::PROBE_LENGTH, coll);
+    }
+
     // Is the size of hash table sufficiently large
     if(m_cnt >= m_tab.size() / 2)
         Expand();
@@ -127,17 +163,24 @@ bool HashSet<S>::Find(PathNode<S>* p) const
 template <typename S>
 PathNode<S>* HashSet<S>::Find(const S& s) const
 {
-unsigned int i;
+unsigned int i, coll = 0;
 
     i = Hash(s);
     // Check possible colisions
-    while(m_tab[i] != NULL)
+    while(m_tab[i] != NULL && !(s == m_tab[i]->m_state))
     {
-        if(s == m_tab[i]->m_state)
-            return m_tab[i];
+        coll++;
         Next(i);
     }
-    return NULL;
+
+    if(m_metrics)
+    {
+        m_metrics->Add(Metrics::HASH_FIND);
+        m_metrics->Add(Metrics::HASH_PROBE, coll);
+        m_metrics->Record(Metrics::PROBE_LENGTH, coll);
+    }
+
+    return m_tab[i];
 }
 
 //
@@ -161,6 +204,9 @@ unsigned int i, j, d;
     }
     m_tab[i] = NULL;
     m_cnt--;
+
+    if(m_metrics)
+        m_metrics->Add(Metrics::HASH_ERASE);
         
 
     // Clean up 
@@ -196,11 +242,15 @@ PathNode<S> *p = Find(s);
     Erase(p);
 }
 
+//
+// Removes all elements from hash table. The size of the table is not changed.
+//
 template <typename S>
 void HashSet<S>::Clear(void)
 {
     for(size_t i = 0; i < m_tab.size(); i++)
         m_tab[i] = NULL;
+    m_cnt = 0;
 }
 
 
@@ -228,7 +278,9 @@ void HashSet<S>::Expand(void)
 std::vector< PathNode<S>* > tmp = m_tab;
 const unsigned int oldSize = m_tab.size();
 
-    printf("\n***EXPANDING-BEGIN (size=%d)***\n", oldSize); fflush(stdout);
+    // Reinsertions are not counted as insertions
+    Metrics* metrics = m_metrics;
+    m_metrics = nullptr;
 
     m_cnt = 0;
     Malloc(oldSize + 1);
@@ -237,7 +289,10 @@ const unsigned int oldSize = m_tab.size();
         if(tmp[i] != NULL)
             Insert(tmp[i]);
     }
-    printf("\n***EXPANDING-END***\n"); fflush(stdout);
+
+    m_metrics = metrics;
+    if(m_metrics)
+        m_metrics->Add(Metrics::HASH_RESIZE);
 }
 
 //
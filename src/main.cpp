@@ -5,80 +5,535 @@
 //
 // This program solves Sliding puzzle for the board of size 5x5, i.e. puzzle 24 game.
 //
-    
 
-// This macro must be defined before including "astar.h"
-// #define ASTAR_STATISTICS
 
-#include "astar.h"
 #include "Graph.h"
 #include "Examples.h"
+#include "InstanceReader.h"
+#include "BinaryFormat.h"
+#include "Solution.h"
+#include "Server.h"
+#include "Portfolio.h"
+#include "EngineRegistry.h"
+#include "Options.h"
+#include "LayerStats.h"
+#include "MemoryStats.h"
+#include "Profiler.h"
+#include "Trace.h"
 #include <iostream>
+#include <stdexcept>
+#include <memory>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <cstdio>
+#include <unistd.h>
 
 
 void Intro();
-void RunAstar( const State& beg );
+int Solve( const Options& opt );
+std::unique_ptr< Engine > CreateEngine( const Options& opt );
+void Begin( const State& beg );
+void Report( const Options& opt, const Engine& engine, const State& beg, const std::optional< std::vector< State > >& path,
+             double seconds, Profiler* profiler, BinaryWriter* out );
+void ReportOptimal( const Options& opt, const Engine& engine, const State& beg, const std::string& tiles );
+int Serve( const std::string& path, unsigned int workerNo );
+int RunPortfolio( const Options& opt );
+std::unique_ptr< Perimeter > BuildPerimeter( const Options& opt );
 
-int main(int /*argc*/, char** /*argv*/)
+//
+// Passes all instances from file "path" to "solve".
+// If "path" is NULL, the built-in examples are used.
+//
+template< typename F >
+void ForEachInstance( const char* path, F solve )
+{
+    if( path && BinaryFile::IsBinary( path ) )
+    {
+        BinaryReader in( path );
+        in.ForEach( solve );
+    }
+    else if( path )
+    {
+        InstanceReader in( path );
+        in.ForEach( solve );
+    }
+    else
+    {
+        Examples examples;
+        for(const State& s : examples)
+        {
+            solve( s );
+        }
+    }
+}
+
+//
+// Usage:
+//    sliding-puzzle [OPTIONS] [PATH [OUT]]
+//                              - solves all instances stored in file PATH ("-" for standard input),
+//                                or the built-in examples without PATH.
+//                                File PATH is either the text file or the binary file with instances.
+//                                The solutions are written to the binary file OUT as well.
+//                                The engine, the heuristic, the number of threads, the limits
+//                                and the output are selected by OPTIONS (see Options.h).
+//    sliding-puzzle --serve SOCKET [WORKERS]
+//                              - runs the solver service on Unix domain socket SOCKET (see Server.h)
+//    sliding-puzzle --portfolio SECONDS [OPTIONS] [PATH]
+//                              - races several engines on each instance (see Portfolio.h)
+//                                with the heuristic, the perimeter and the limits of OPTIONS
+//    sliding-puzzle --list-engines
+//                              - prints the engines available at run time (see EngineRegistry.h)
+//
+int main(int argc, char** argv)
+{
+    Options opt;
+    try
+    {
+        opt = Options::Parse( argc, argv );
+
+        // The engine is validated before any output
+        EngineRegistry::Params params;
+        const EngineRegistry::Entry& entry = EngineRegistry::Find( opt.m_engine, opt.m_closed, opt.m_open, params );
+        EngineRegistry::CheckHeuristic( entry, opt.m_engine, opt.m_heuristic, opt.m_perimeter > 0 );
+    }
+    catch( const std::invalid_argument& e )
+    {
+        std::cerr << "ERROR: " << e.what() << "\n\n";
+        Options::Usage( std::cerr, argv[ 0 ] );
+        return 2;
+    }
+
+    switch( opt.m_mode )
+    {
+    case Options::SERVE:
+        return Serve( opt.m_socket, opt.m_threadNo );
+    case Options::PORTFOLIO:
+        return RunPortfolio( opt );
+    case Options::LIST:
+        EngineRegistry::Print( std::cout );
+        return 0;
+    case Options::HELP:
+        Options::Usage( std::cout, argv[ 0 ] );
+        return 0;
+    case Options::SOLVE:
+        break;
+    }
+
+    return Solve( opt );
+}
+
+
+//
+// Solves the instances by the engine selected in "opt"
+//
+int Solve( const Options& opt )
+{
+    const bool text = ( opt.m_format == Options::TEXT );
+    if( text && !opt.m_quiet )
+    {
+        Intro( );
+    }
+
+    const char* input = opt.m_input.empty() ? nullptr : opt.m_input.c_str();
+
+    try
+    {
+        std::unique_ptr< BinaryWriter > out;
+        if( !opt.m_output.empty() )
+        {
+            out = std::make_unique< BinaryWriter >( opt.m_output, BinaryFile::SOLUTIONS );
+        }
+
+        // The perimeter is built once and shared by all graphs
+        const std::unique_ptr< Perimeter > perimeter = BuildPerimeter( opt );
+
+        if( opt.m_threadNo == 1 )
+        {
+            // Solver is created once, since its hash tables are large
+            std::unique_ptr< Engine > engine = CreateEngine( opt );
+            Graph graph( opt.m_heuristic );
+            graph.SetPerimeter( perimeter.get() );
+
+            std::unique_ptr< Profiler > profiler;
+            if( opt.m_profile )
+            {
+                profiler = std::make_unique< Profiler >();
+                engine->SetProfiler( profiler.get() );
+            }
+
+            std::unique_ptr< TraceWriter > trace;
+            if( !opt.m_trace.empty() )
+            {
+                trace = std::make_unique< TraceWriter >( opt.m_trace );
+                engine->SetTrace( trace.get() );
+            }
+
+            // Live progress of long searches is shown on the terminal
+            if( isatty( STDERR_FILENO ) )
+            {
+                engine->SetCallback( []( const SearchProgress& p )
+                {
+                    fprintf( stderr, "\r   f = %d, open = %zu, closed = %zu, expanded = %zu, memory = %.0f MiB, time = %.1f s%s",
+                        p.m_minF, p.m_openNo, p.m_closedNo, p.m_expandedNo, p.m_memoryUsed / 1048576.0, p.m_seconds, p.IsFinished() ? "\n" : "" );
+                }, 200000 );
+            }
+
+            ForEachInstance( input, [&]( const State& beg )
+            {
+                if( profiler )
+                {
+                    profiler->Reset();
+                }
+
+                if( text && !opt.m_quiet )
+                {
+                    Begin( beg );
+                }
+
+                Limits limits = opt.m_limits;
+                limits.Start();
+                const std::optional< std::vector< State > > path = engine->Solve( graph, beg, limits );
+                Report( opt, *engine, beg, path, limits.Elapsed(), profiler.get(), out.get() );
+            } );
+
+            if( trace )
+            {
+                engine->SetTrace( nullptr );
+                trace->Close();
+            }
+            return 0;
+        }
+
+        // The instances are shared by the workers, each worker owns its engine.
+        // The reports are printed in the order of completion.
+        std::vector< State > instances;
+        ForEachInstance( input, [&instances]( const State& beg ) { instances.push_back( beg ); } );
+
+        std::atomic< size_t > next{ 0 };
+        std::mutex mutex;
+        std::vector< std::thread > workers;
+
+        // The first error of the workers, the remaining workers stop
+        std::string error;
+
+        // Solves the instances taken from the shared counter
+        auto work = [&]
+        {
+            std::unique_ptr< Engine > engine = CreateEngine( opt );
+            Graph graph( opt.m_heuristic );
+            graph.SetPerimeter( perimeter.get() );
+
+            std::unique_ptr< Profiler > profiler;
+            if( opt.m_profile )
+            {
+                profiler = std::make_unique< Profiler >();
+                engine->SetProfiler( profiler.get() );
+            }
+
+            for( size_t i = next++; i < instances.size(); i = next++ )
+            {
+                if( profiler )
+                {
+                    profiler->Reset();
+                }
+
+                Limits limits = opt.m_limits;
+                limits.Start();
+                const std::optional< std::vector< State > > path = engine->Solve( graph, instances[ i ], limits );
+                const double seconds = limits.Elapsed();
+
+                std::lock_guard< std::mutex > lock( mutex );
+                if( text && !opt.m_quiet )
+                {
+                    Begin( instances[ i ] );
+                }
+                Report( opt, *engine, instances[ i ], path, seconds, profiler.get(), out.get() );
+            }
+        };
+
+        for( unsigned int w = 0; w < opt.m_threadNo; w++ )
+        {
+            workers.emplace_back( [&]
+            {
+                try
+                {
+                    work();
+                }
+                catch( const std::invalid_argument& e )
+                {
+                    std::lock_guard< std::mutex > lock( mutex );
+                    if( error.empty() )
+                    {
+                        error = e.what();
+                    }
+                    next = instances.size();
+                }
+            } );
+        }
+
+        for( std::thread& t : workers )
+        {
+            t.join();
+        }
+
+        if( !error.empty() )
+        {
+            throw std::invalid_argument( error );
+        }
+    }
+    catch( const std::invalid_argument& e )
+    {
+        std::cerr << "\nERROR: " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
+
+
+// Set by signal handler, when the service must be stopped
+static std::atomic< bool > g_stop{ false };
+
+extern "C" void OnSignal( int )
+{
+    g_stop.store( true );
+}
+
+int Serve( const std::string& path, unsigned int workerNo )
+{
+    try
+    {
+        Server server( path, workerNo );
+
+        signal( SIGINT, OnSignal );
+        signal( SIGTERM, OnSignal );
+
+        std::cout << "Listening on " << path << " with " << workerNo << " worker(s)" << std::endl;
+        server.Run( g_stop );
+    }
+    catch( const std::invalid_argument& e )
+    {
+        std::cerr << "ERROR: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+
+//
+// Builds the perimeter selected in "opt", NULL if it is not used
+//
+std::unique_ptr< Perimeter > BuildPerimeter( const Options& opt )
+{
+    if( opt.m_perimeter == 0 )
+        return nullptr;
+
+    Limits clock;
+    clock.Start();
+    std::unique_ptr< Perimeter > perimeter = std::make_unique< Perimeter >( opt.m_perimeter, opt.m_perimeterMargin, opt.m_threadNo );
+    if( !opt.m_quiet )
+    {
+        fprintf( stderr, "Perimeter: depth = %u, states = %zu, front = %zu, memory = %.1f MiB, time = %.2f s\n",
+            perimeter->Depth(), perimeter->StateNo(), perimeter->FrontNo(),
+            perimeter->Memory().m_reserved / 1048576.0, clock.Elapsed() );
+    }
+    return perimeter;
+}
+
+
+//
+// Solves the instances by the portfolio of engines.
+// The deadline of each instance is the smaller of the time of the portfolio and option "--time".
+//
+int RunPortfolio( const Options& opt )
 {
     Intro( );
 
-    Examples examples;
+    Portfolio portfolio;
+    for( const char* name : { "astar", "idastar", "wastar-2" } )
+    {
+        // The metrics are not reported by the portfolio
+        std::unique_ptr< Engine > engine = EngineRegistry::Create( name );
+        engine->SetMetricsEnabled( false );
+        portfolio.Add( name, std::move( engine ) );
+    }
 
-    for(const State& s : examples)
+    Limits limits = opt.m_limits;
+    if( limits.m_maxSeconds == 0 || ( opt.m_deadline > 0 && opt.m_deadline < limits.m_maxSeconds ) )
+        limits.m_maxSeconds = opt.m_deadline;
+
+    const char* path = opt.m_input.empty() ? nullptr : opt.m_input.c_str();
+
+    try
     {
-        RunAstar( s );
+        const std::unique_ptr< Perimeter > perimeter = BuildPerimeter( opt );
+        portfolio.SetHeuristic( opt.m_heuristic, perimeter.get() );
+
+        ForEachInstance( path, [&portfolio, &limits]( const State& beg )
+        {
+            std::cout << "SELECTED-BEGIN-STATE:\n";
+            beg.Print(stdout);
+            std::cout << "\nComputing..." << std::flush;
+
+            const Portfolio::Result res = portfolio.Solve( beg, limits );
+            if( !res.m_path.has_value() )
+            {
+                std::cout << "Path NOT found for START state:\n";
+                return;
+            }
+
+            const Solution sol = Solution::FromPath( res.m_path.value(), res.m_optimal );
+            std::cout << "Ok (" << res.m_winner << ", " << res.m_seconds << " s)\n";
+            std::cout << ( res.m_optimal ? "SOLUTION (" : "BOUNDED-SOLUTION (" ) << sol.Length() << "): " << sol.ToText( beg ) << "\n";
+        } );
     }
-    
+    catch( const std::invalid_argument& e )
+    {
+        std::cerr << "\nERROR: " << e.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "\n";
+    portfolio.PrintStats( std::cout );
     return 0;
 }
 
 
-void RunAstar( const State& beg )
+//
+// Creates the engine selected in "opt"
+//
+std::unique_ptr< Engine > CreateEngine( const Options& opt )
 {
-    Astar as;
-    Graph graph;
+    std::unique_ptr< Engine > engine = EngineRegistry::Create( opt.m_engine, opt.m_closed, opt.m_open );
+    if( opt.m_allOptimal && !engine->SetAllOptimal( true ) )
+    {
+        throw std::invalid_argument( "Engine " + opt.m_engine + " does not enumerate all optimal solutions" );
+    }
+    if( !opt.m_workDir.empty() )
+        engine->SetWorkDir( opt.m_workDir );
 
+    // The metrics are collected only if they are reported
+    engine->SetMetricsEnabled( opt.m_metrics );
+    return engine;
+}
+
+//
+// Prints the begin state, before the search starts
+//
+void Begin( const State& beg )
+{
     std::cout << "SELECTED-BEGIN-STATE:\n";
     beg.Print(stdout);
     std::cout << "\nComputing..." << std::flush;
+}
 
-    const std::optional<std::vector<State>> path = as.Find(graph, beg);
-    if(!path.has_value())
+//
+// Prints the result of the search in the format selected in "opt".
+// The solution is written to "out" as well.
+//
+void Report( const Options& opt, const Engine& engine, const State& beg, const std::optional< std::vector< State > >& path,
+             double seconds, Profiler* profiler, BinaryWriter* out )
+{
+    const char* status = path.has_value() ? ( engine.IsOptimal() ? "optimal" : "bounded" )
+                                          : ( engine.LimitReached() ? "limit" : "not-found" );
+
+    Solution sol;
+    if( path.has_value() )
     {
-        std::cout << "Path NOT found for START state:\n";
-        return;
+        sol = Solution::FromPath( path.value(), engine.IsOptimal() );
     }
-    std::cout << "Ok\n";
-
-#ifdef ASTAR_STATISTICS
-    as.PrintStats();
-    std::cout << "\nFINAL-NUMBER-OF-STATES:\n";
-    std::cout << "   Closed-set... = " << as.ClosedNo() << "\n";
-    std::cout << "   Open-set..... = " << as.OpenNo() << "\n\n";
 
-    std::cout << "NUMBER-OF-STATES-IN-FOUND-PATH = " << ( path.value().size() - 1 ) << "\n\n";
-#endif
+    // Tiles separated by spaces, and by commas in JSON format
+    const char* sep = ( opt.m_format == Options::JSON ) ? ", " : " ";
+    std::string tiles;
+    for( uint8_t k = 0; k < State::TILENO; k++ )
+    {
+        tiles += ( k ? sep : "" ) + std::to_string( static_cast< int >( beg.Tile( k ) ) );
+    }
 
-    const size_t stateNo = path.value().size();
-    std::cout << "SOLUTION (" << stateNo - 1 << "): ";
-    for(size_t i = 0; i < stateNo - 1; i++)
+    if( opt.m_format == Options::LINE )
     {
-        path.value()[i + 1].PrintDiff(path.value()[i]);
+        printf( "%s : %s %zu %zu %.6f : %s\n", tiles.c_str(), status, sol.Length(), engine.ExpandedNo(), seconds,
+            sol.ToText( beg ).c_str() );
+
+        if( opt.m_allOptimal && path.has_value() )
+        {
+            ReportOptimal( opt, engine, beg, tiles );
+        }
     }
+    else if( opt.m_format == Options::JSON )
+    {
+        printf( "{\"tiles\": [%s], \"engine\": \"%s\", \"heuristic\": \"%s\", \"status\": \"%s\", "
+                "\"length\": %zu, \"expanded\": %zu, \"seconds\": %.6f, \"moves\": \"%s\"",
+            tiles.c_str(), engine.Name().c_str(), Graph::Name( opt.m_heuristic ), status,
+            sol.Length(), engine.ExpandedNo(), seconds, sol.ToText( beg ).c_str() );
 
-    std::cout << "\n";
+        if( opt.m_metrics && engine.GetMetrics() )
+        {
+            printf( ", \"metrics\": %s", engine.GetMetrics()->ToJson().c_str() );
+        }
 
-    constexpr bool show_states{ false };
-    if constexpr(show_states)
+        if( opt.m_memory && engine.GetMemory() )
+        {
+            printf( ", \"memory\": %s", engine.GetMemory()->ToJson().c_str() );
+        }
+
+        if( opt.m_allOptimal && path.has_value() )
+        {
+            ReportOptimal( opt, engine, beg, tiles );
+        }
+        printf( "}\n" );
+    }
+    else
     {
-        for(size_t i = 0; i < path.value().size(); i++)
+        if( opt.m_quiet )
+        {
+            std::cout << tiles << " : ";
+        }
+        std::cout << ( path.has_value() ? "Ok\n" : "Path NOT found for START state:\n" );
+
+        // The layers of the unsuccessful search show the predicted cost of the next layers
+        if( opt.m_layers && engine.GetLayers() )
+        {
+            engine.GetLayers()->Print( std::cout );
+        }
+
+        if( opt.m_memory && engine.GetMemory() )
         {
-            path.value()[i].Print(stdout);
-            std::cout << "\n\n";
+            engine.GetMemory()->Print( std::cout );
+        }
+
+        if( path.has_value() )
+        {
+            if( opt.m_metrics && engine.GetMetrics() )
+            {
+                std::cout << "METRICS: " << engine.GetMetrics()->ToJson() << "\n";
+            }
+
+            if( profiler )
+            {
+                profiler->Print( std::cout );
+            }
+
+            std::cout << ( sol.IsOptimal() ? "SOLUTION (" : "BOUNDED-SOLUTION (" ) << sol.Length() << "): " << sol.ToText( beg ) << "\n";
+
+            if( opt.m_allOptimal )
+            {
+                ReportOptimal( opt, engine, beg, tiles );
+            }
         }
     }
+    std::cout << std::flush;
 
+    if( out && path.has_value() )
+    {
+        out->Write( beg, sol );
+    }
 }
 
 
@@ -97,3 +552,54 @@ void Intro()
     std::cout << "===============================================================================\n\n";
 }
 
+//
+// Prints the number of all optimal solutions and at most opt.m_optimalPrintNo of them.
+// The solutions are printed, when they are enumerated by the engine, they are not stored.
+//
+void ReportOptimal( const Options& opt, const Engine& engine, const State& beg, const std::string& tiles )
+{
+    const unsigned long long optimalNo = engine.OptimalNo();
+    size_t printedNo = 0;
+
+    if( opt.m_format == Options::LINE )
+    {
+        printf( "%s : all-optimal %llu\n", tiles.c_str(), optimalNo );
+    }
+    else if( opt.m_format == Options::JSON )
+    {
+        printf( ", \"optimal_no\": %llu, \"optimal_moves\": [", optimalNo );
+    }
+    else
+    {
+        std::cout << "OPTIMAL-SOLUTIONS (" << optimalNo << "):\n";
+    }
+
+    engine.ForEachOptimal( [&]( const std::vector< State >& path )
+    {
+        if( printedNo == opt.m_optimalPrintNo )
+        {
+            return false;
+        }
+
+        const std::string moves = Solution::FromPath( path, true ).ToText( beg );
+        if( opt.m_format == Options::LINE )
+        {
+            printf( "%s : optimal-path %zu : %s\n", tiles.c_str(), printedNo + 1, moves.c_str() );
+        }
+        else if( opt.m_format == Options::JSON )
+        {
+            printf( "%s\"%s\"", printedNo ? ", " : "", moves.c_str() );
+        }
+        else
+        {
+            std::cout << "   " << moves << "\n";
+        }
+        printedNo++;
+        return true;
+    } );
+
+    if( opt.m_format == Options::JSON )
+    {
+        printf( "]" );
+    }
+}
@@ -21,10 +21,18 @@
 //
 // 5. The size of the chunk is a parameter of memory menager constructor.
 //
-// 6. Initially there are 100 chunks.
+// 6. Initially there is one chunk.
+//
+// 7. Function Erase does not release the chunks. They are reused by the next search,
+//    hence the long-running solver does not allocate memory for each search.
+//    Function Release gives the memory back to the system.
+//
+// 8. Function Memory returns the bytes of allocated objects and the bytes of all chunks.
 //
 
+#include "MemoryUsage.h"
 #include <cassert>
+#include <vector>
 
 template<typename T>
 class MemMgr
@@ -35,6 +43,9 @@ public:
 
     T* New(void);
     void Erase(void);
+    void Release(void);
+
+    MemoryUsage Memory(void) const;
 
 private:
     // Size of the m_chunkSize, i.e. size of the array pointed by element of m_tab
@@ -60,7 +71,7 @@ MemMgr<T>::MemMgr( unsigned int chunkSize )
     : m_chunkSize( chunkSize )
     , m_chunk( 0 )
     , m_row( 0 )
-    , m_tab( 100 )
+    , m_tab( 1 )
 {
     m_tab[ 0 ] = new T[ chunkSize ];
 }
@@ -85,24 +96,37 @@ T* MemMgr<T>::New(void)
 
     if(m_row == m_chunkSize)
     {
-        // Create new m_chunkSize
-        T* p = new T[m_chunkSize];
-        assert(p);
-        m_tab.push_back(p);
-
         // Jump to begin of the next chunk
         m_chunk++;
         m_row = 0;
+
+        if(m_chunk == m_tab.size())
+        {
+            // Create new chunk
+            T* p = new T[m_chunkSize];
+            assert(p);
+            m_tab.push_back(p);
+        }
     }
 
     return &(m_tab[m_chunk][m_row]);
 }
 
 //
-// Deletes all objects. Afer calling this function there is not allocated memory.
+// Deletes all objects. The allocated chunks are kept for reusing.
 //
 template<typename T>
 void MemMgr<T>::Erase(void)
+{
+    m_chunk = 0;
+    m_row = 0;
+}
+
+//
+// Deletes all objects. Afer calling this function only the first chunk is allocated.
+//
+template<typename T>
+void MemMgr<T>::Release(void)
 {
     // Index "i" starts from (1) ONE!!!
     for(unsigned int i = 1; i < m_tab.size(); i++)
@@ -113,4 +137,18 @@ void MemMgr<T>::Erase(void)
     m_row = 0;
 }
 
+//
+// Returns the memory occupied by the objects and by the chunks
+//
+template<typename T>
+MemoryUsage MemMgr<T>::Memory(void) const
+{
+MemoryUsage m;
+
+    // The first object of the first chunk is never returned by New
+    m.m_used = (size_t(m_chunk) * m_chunkSize + m_row) * sizeof(T);
+    m.m_reserved = m_tab.size() * size_t(m_chunkSize) * sizeof(T) + m_tab.capacity() * sizeof(T*);
+    return m;
+}
+
 #endif
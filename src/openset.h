@@ -67,12 +67,16 @@
 //    After calling this function, the OPEN SET is empty.
 //    This function is called by destructor as well.
 //
-//  9. void PrintStats(FILE* out) const
-//     It prints calling statistic to file "out". The statistic is only available,
-//     when preprocessor macro "ASTAR_STATISTICS" is defined.
+//  9. void SetMetrics(Metrics* metrics)
+//     It sets the object collecting the metrics (see class Metrics). NULL disables the collection.
+//
+// 10. MemoryUsage Memory(void) const
+//     It returns the estimated memory occupied by the nodes of std::set and std::map (see MemoryUsage.h).
 
 
 #include "pathnode.h"
+#include "Metrics.h"
+#include "MemoryUsage.h"
 #include <cassert>
 #include <set>
 #include <map>
@@ -137,7 +141,6 @@ public:
 template<typename S>
 class OpenSet
 {
-    using Cost = typename S::Cost;
 public:
     OpenSet(void);
     ~OpenSet(void);
@@ -152,10 +155,11 @@ public:
 
     bool IsEmpty(void) const;
     size_t Size(void) const;
+    MemoryUsage Memory(void) const;
 
     void Erase(void);
 
-    void PrintStats() const;
+    void SetMetrics(Metrics*) { }
 
 private:
     // Array storing data, needed by priority queue
@@ -167,17 +171,6 @@ private:
 
     // Comparing function object used by priority queue for ordering
     // const GreaterN<S> m_cmp;
-
-#ifdef ASTAR_STATISTICS
-    mutable size_t m_stats_add;
-    mutable size_t m_stats_best;
-    mutable size_t m_stats_removeBest;
-    mutable size_t m_stats_search;
-    mutable size_t m_stats_erase;
-    mutable size_t m_stats_isEmpty;
-    mutable size_t m_stats_update;
-    mutable size_t m_stats_size;
-#endif
 };
 
 //
@@ -187,16 +180,6 @@ template<typename S>
 inline
 OpenSet<S>::OpenSet(void)
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_add = 0;
-    m_stats_best = 0;
-    m_stats_removeBest = 0;
-    m_stats_search = 0;
-    m_stats_erase = 0;
-    m_stats_isEmpty = 0;
-    m_stats_update = 0;
-    m_stats_size = 0;
-#endif
 }
 
 //
@@ -215,10 +198,6 @@ OpenSet<S>::~OpenSet(void)
 template<typename S>
 void OpenSet<S>::Erase(void)
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_erase++;
-#endif
-
 // std::set< PathNode<S>*, LessF<S> >::iterator it = m_set.begin();
 //
 //  for(; it != m_set.end(); ++it)
@@ -236,10 +215,6 @@ template<typename S>
 inline
 bool OpenSet<S>::IsEmpty(void) const
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_isEmpty++;
-#endif
-
     return m_set.empty();
 }
 
@@ -250,10 +225,6 @@ template<typename S>
 inline
 void OpenSet<S>::Add(PathNode<S>* p)
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_add++;
-#endif
-
     assert(p);
     // Duplications are not allowed. Pointer "p" must not be in OPEN SET
     assert(m_set.count(p) == 0); 
@@ -272,10 +243,6 @@ template<typename S>
 inline
 PathNode<S>* OpenSet<S>::Best(void) const
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_best++;
-#endif
-
     // Return the pointer to "the best" node
     return *(m_set.begin());
 }
@@ -287,10 +254,6 @@ template<typename S>
 inline
 void OpenSet<S>::RemoveBest(void)
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_removeBest++;
-#endif
-
     // OPEN SET must not be empty
     assert(!m_set.empty());
 
@@ -317,10 +280,6 @@ template<typename S>
 inline
 PathNode<S>* OpenSet<S>::Search(const S& state) const
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_search++;
-#endif
-
     S* p = const_cast<S*>(&state);
     typename std::map< S*, PathNode<S>*, LessS<S> >::const_iterator it = m_aux.find(p);
     if(it != m_aux.end())
@@ -336,10 +295,6 @@ template<typename S>
 inline
 void OpenSet<S>::Update(PathNode<S>* p, PathNode<S>* newParent, Cost newG)
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_update++;
-#endif
-
     // Erase pointer "p" from OPEN SET
     m_set.erase(m_set.find(p));
 
@@ -364,30 +319,22 @@ template<typename S>
 inline
 size_t OpenSet<S>::Size(void) const
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_size++;
-#endif
-
     return m_set.size();
 }
 
-
+//
+// Returns the estimated memory occupied by the nodes of std::set and std::map
+//
 template<typename S>
-void OpenSet<S>::PrintStats() const
+inline
+MemoryUsage OpenSet<S>::Memory(void) const
 {
-#ifdef ASTAR_STATISTICS
-    std::cout << "  OpenSet::Search.... = " << m_stats_search << "\n";
-    std::cout << "  OpenSet::Add....... = " << m_stats_add << "\n";
-    std::cout << "  OpenSet::Best...... = " << m_stats_best << "\n";
-    std::cout << "  OpenSet::RemoveBest = " << m_stats_removeBest << "\n";
-    std::cout << "  OpenSet::IsEmpty... = " << m_stats_isEmpty << "\n";
-    std::cout << "  OpenSet::Update.... = " << m_stats_update << "\n";
-    std::cout << "  OpenSet::Erase..... = " << m_stats_erase << "\n";
-    std::cout << "  OpenSet::Size...... = " << m_stats_size << "\n";
-#else
-    // fprintf(out, "OpenSet. No statistics available!\n");
-#endif
+MemoryUsage m;
 
+    m.m_used = m_set.size() * MemoryUsage::TreeNodeBytes< PathNode<S>* >() +
+        m_aux.size() * MemoryUsage::TreeNodeBytes< std::pair< S* const, PathNode<S>* > >();
+    m.m_reserved = m.m_used;
+    return m;
 }
 
 #endif
@@ -0,0 +1,271 @@
+#ifndef ASTAR_OPENSETBUCKET_H
+#define ASTAR_OPENSETBUCKET_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. This is OPEN SET for A* algorithm.
+//
+// 2. It is template class, where template parameter "S" represents GRAPH STATE.
+//
+// 3. The costs are small integers, hence the priority queue is the two-level array
+//    of buckets indexed by "f" and "h". The node with the lowest "f" is selected,
+//    and among them the node with the lowest "h" (as in LessF).
+//    Within the bucket the last added node is selected (LIFO).
+//    Hence, Add and RemoveBest take constant time, instead of logarithmic time of std::set.
+//
+// 4. Function Update does not remove the node from its old bucket. The node is added
+//    to the new bucket and the old entry becomes stale. The stale entry is recognized
+//    (the bucket does not match the current "f" and "h" of node) and dropped,
+//    when its bucket is reached. The cost of node only decreases, hence the stale entry
+//    is always in the bucket of higher "f".
+//
+// 5. In order to speed-up searching auxiliary structure based on class HashSet is created.
+//
+// 6. Function Erase keeps the memory of buckets, hence it is reused by the next search.
+//
+// 7. The costs must not be negative.
+//
+
+#include "Cost.h"
+#include "pathnode.h"
+#include "hashset.h"
+#include "MemoryUsage.h"
+#include <cassert>
+#include <vector>
+
+
+template<typename S>
+class OpenSetBucket
+{
+public:
+    OpenSetBucket(void);
+
+    void Add(PathNode<S>* t);
+    void RemoveBest(void);
+    void Update(PathNode<S>* p, PathNode<S>* newParent, Cost newG);
+
+
+    PathNode<S>* Best(void) const;
+    PathNode<S>* Search(const S& state) const;
+
+    bool IsEmpty(void) const;
+    size_t Size(void) const;
+    MemoryUsage Memory(void) const;
+
+    void Erase(void);
+
+    void SetMetrics(Metrics* metrics) { m_aux.SetMetrics(metrics); }
+
+private:
+    void Push(PathNode<S>* p);
+    void Settle(void);
+
+private:
+    using Bucket = std::vector< PathNode<S>* >;
+
+    // Buckets of nodes, m_bucket[f][h]
+    std::vector< std::vector<Bucket> > m_bucket;
+
+    // Auxiliary data to speed up searching for state.
+    HashSet<S> m_aux;
+
+    // The first bucket, which can hold the valid node. All buckets before it are empty,
+    // or hold only stale entries.
+    size_t m_minF;
+    size_t m_minH;
+};
+
+
+//
+// Default constructor
+//
+template<typename S>
+inline
+OpenSetBucket<S>::OpenSetBucket(void)
+    : m_aux(10000000)
+    , m_minF(0)
+    , m_minH(0)
+{
+}
+
+//
+// Erase all elements from set. The memory of buckets is kept.
+//
+template<typename S>
+void OpenSetBucket<S>::Erase(void)
+{
+    for(std::vector<Bucket>& row : m_bucket)
+    {
+        for(Bucket& b : row)
+            b.clear();
+    }
+    m_aux.Clear();
+
+    m_minF = m_bucket.size();
+    m_minH = 0;
+}
+
+//
+// Returns "true" if OPEN SET os empty
+//
+template<typename S>
+inline
+bool OpenSetBucket<S>::IsEmpty(void) const
+{
+    return m_aux.Count() == 0;
+}
+
+//
+// Adds new element represented by pointer to OPEN SET
+//
+template<typename S>
+inline
+void OpenSetBucket<S>::Add(PathNode<S>* p)
+{
+    assert(p);
+
+    m_aux.Insert(p);
+    Push(p);
+    Settle();
+}
+
+//
+// Returns element with the smallest value "F" in OPEN SET
+//
+template<typename S>
+inline
+PathNode<S>* OpenSetBucket<S>::Best(void) const
+{
+    assert(!IsEmpty());
+    return m_bucket[m_minF][m_minH].back();
+}
+
+//
+// Removes the best element from OPEN SET
+//
+template<typename S>
+inline
+void OpenSetBucket<S>::RemoveBest(void)
+{
+    // OPEN SET must not be empty
+    assert(!IsEmpty());
+
+    Bucket& b = m_bucket[m_minF][m_minH];
+    m_aux.Erase(b.back()->m_state);
+    b.pop_back();
+
+    Settle();
+}
+
+//
+// If state is in OPEN SET, returns pointer to "PathNode" defined by "state".
+// Otherwise returns NULL
+//
+template<typename S>
+inline
+PathNode<S>* OpenSetBucket<S>::Search(const S& state) const
+{
+    return m_aux.Find(state);
+}
+
+//
+// Update OPEN SET, since the cost of object pointed by "p" is decreased.
+// The old entry of "p" becomes stale.
+//
+template<typename S>
+inline
+void OpenSetBucket<S>::Update(PathNode<S>* p, PathNode<S>* newParent, Cost newG)
+{
+    assert(newG < p->m_g);
+
+    p->m_g = newG;
+    p->m_parent = newParent;
+
+    // Auxiliary set "m_aux" need not be modyfied
+    Push(p);
+    Settle();
+}
+
+//
+// Returns number of elements in OPEN SET
+//
+template<typename S>
+inline
+size_t OpenSetBucket<S>::Size(void) const
+{
+    return m_aux.Count();
+}
+
+//
+// Adds "p" to the bucket of its "f" and "h"
+//
+template<typename S>
+inline
+void OpenSetBucket<S>::Push(PathNode<S>* p)
+{
+    assert(p->F() >= 0 && p->m_h >= 0);
+
+    const size_t f = p->F();
+    const size_t h = p->m_h;
+
+    if(f >= m_bucket.size())
+        m_bucket.resize(f + 1);
+
+    std::vector<Bucket>& row = m_bucket[f];
+    if(h >= row.size())
+        row.resize(h + 1);
+
+    row[h].push_back(p);
+
+    if(f < m_minF || (f == m_minF && h < m_minH))
+    {
+        m_minF = f;
+        m_minH = h;
+    }
+}
+
+//
+// Moves to the first bucket holding the valid node. The stale entries on the way are dropped.
+//
+template<typename S>
+void OpenSetBucket<S>::Settle(void)
+{
+    for(; m_minF < m_bucket.size(); m_minF++, m_minH = 0)
+    {
+        std::vector<Bucket>& row = m_bucket[m_minF];
+        for(; m_minH < row.size(); m_minH++)
+        {
+            Bucket& b = row[m_minH];
+            while(!b.empty() && (size_t(b.back()->F()) != m_minF || size_t(b.back()->m_h) != m_minH))
+                b.pop_back();
+
+            if(!b.empty())
+                return;
+        }
+    }
+}
+
+//
+// Returns the memory occupied by the buckets and the auxiliary hash table
+//
+template<typename S>
+MemoryUsage OpenSetBucket<S>::Memory(void) const
+{
+    MemoryUsage m = m_aux.Memory();
+
+    m.m_reserved += m_bucket.capacity() * sizeof(std::vector<Bucket>);
+    for(const std::vector<Bucket>& row : m_bucket)
+    {
+        m.m_reserved += row.capacity() * sizeof(Bucket);
+        for(const Bucket& b : row)
+        {
+            m.m_used += b.size() * sizeof(PathNode<S>*);
+            m.m_reserved += b.capacity() * sizeof(PathNode<S>*);
+        }
+    }
+    return m;
+}
+
+#endif
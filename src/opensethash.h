@@ -23,10 +23,14 @@
 //
 // 6. OPEN SET holds only pointers to GRAPH STATE.
 //
+// 7. Function Memory returns the estimated memory of std::set nodes and the memory
+//    of the auxiliary hash table. The load factor is the load factor of the hash table.
+//
 
 #include "Cost.h"
 #include "pathnode.h"
 #include "hashset.h"
+#include "openset.h"
 #include <set>
 
 
@@ -46,10 +50,11 @@ public:
 
     bool IsEmpty(void) const;
     size_t Size(void) const;
+    MemoryUsage Memory(void) const;
 
     void Erase(void);
 
-    void PrintStats() const;
+    void SetMetrics(Metrics* metrics) { m_aux.SetMetrics(metrics); }
 
 private:
     // Array storing data, needed by priority queue
@@ -57,18 +62,6 @@ private:
 
     // Auxiliary data to speed up searching for state.
     HashSet<S> m_aux;
-
-#ifdef ASTAR_STATISTICS
-    mutable size_t m_stats_add;
-    mutable size_t m_stats_best;
-    mutable size_t m_stats_removeBest;
-    mutable size_t m_stats_search;
-    mutable size_t m_stats_erase;
-    mutable size_t m_stats_isEmpty;
-    mutable size_t m_stats_update;
-    mutable size_t m_stats_size;
-    mutable size_t m_stats_collision; // Number of collisions in hash table
-#endif
 };
 
 
@@ -79,17 +72,6 @@ template<typename S>
 inline
 OpenSetHash<S>::OpenSetHash(void) : m_aux(10000000)
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_add = 0;
-    m_stats_best = 0;
-    m_stats_removeBest = 0;
-    m_stats_search = 0;
-    m_stats_erase = 0;
-    m_stats_isEmpty = 0;
-    m_stats_update = 0;
-    m_stats_size = 0;
-    m_stats_collision = 0;
-#endif
 }
 
 //
@@ -98,10 +80,6 @@ OpenSetHash<S>::OpenSetHash(void) : m_aux(10000000)
 template<typename S>
 void OpenSetHash<S>::Erase(void)
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_erase++;
-#endif
-
     m_set.clear();
     m_aux.Clear();
 }
@@ -113,10 +91,6 @@ template<typename S>
 inline
 bool OpenSetHash<S>::IsEmpty(void) const
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_isEmpty++;
-#endif
-
     return m_set.empty();
 }
 
@@ -127,21 +101,13 @@ template<typename S>
 inline
 void OpenSetHash<S>::Add(PathNode<S>* p)
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_add++;
-#endif
-
     assert(p);
     // Duplications are not allowed. Pointer "p" must not be in OPEN SET
     assert(m_set.count(p) == 0); 
 
     m_set.insert(p);
 
-#ifdef ASTAR_STATISTICS
-    m_stats_collision += m_aux.Insert(p);
-#else
     m_aux.Insert(p);
-#endif
 
     // Check the synchronization after operation
     assert(m_aux.Count() == m_set.size());
@@ -154,10 +120,6 @@ template<typename S>
 inline
 PathNode<S>* OpenSetHash<S>::Best(void) const
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_best++;
-#endif
-
     // Return the pointer to "the best" node
     return *(m_set.begin());
 }
@@ -169,10 +131,6 @@ template<typename S>
 inline
 void OpenSetHash<S>::RemoveBest(void)
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_removeBest++;
-#endif
-
     // OPEN SET must not be empty
     assert(!m_set.empty());
 
@@ -198,10 +156,6 @@ template<typename S>
 inline
 PathNode<S>* OpenSetHash<S>::Search(const S& state) const
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_search++;
-#endif
-
     return m_aux.Find(state);
 }
 
@@ -212,10 +166,6 @@ template<typename S>
 inline
 void OpenSetHash<S>::Update(PathNode<S>* p, PathNode<S>* newParent, Cost newG)
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_update++;
-#endif
-
     // Erase pointer "p" from OPEN SET
     m_set.erase(m_set.find(p));
 
@@ -239,32 +189,22 @@ template<typename S>
 inline
 size_t OpenSetHash<S>::Size(void) const
 {
-#ifdef ASTAR_STATISTICS
-    m_stats_size++;
-#endif
-
     return m_set.size();
 }
 
-
+//
+// Returns the memory occupied by the priority queue and the auxiliary hash table
+//
 template<typename S>
-void OpenSetHash<S>::PrintStats() const
+inline
+MemoryUsage OpenSetHash<S>::Memory(void) const
 {
-#ifdef ASTAR_STATISTICS
-    std::cout << "  OpenSetHash::Search.... = " << m_stats_search << "\n";
-    std::cout << "  OpenSetHash::Add....... = " << m_stats_add << "\n";
-    std::cout << "  OpenSetHash::Best...... = " << m_stats_best << "\n";
-    std::cout << "  OpenSetHash::RemoveBest = " << m_stats_removeBest << "\n";
-    std::cout << "  OpenSetHash::IsEmpty... = " << m_stats_isEmpty << "\n";
-    std::cout << "  OpenSetHash::Update.... = " << m_stats_update << "\n";
-    std::cout << "  OpenSetHash::Erase..... = " << m_stats_erase << "\n";
-    std::cout << "  OpenSetHash::Size...... = " << m_stats_size << "\n";
-    std::cout << "  OpenSetHash::Collision. = " << m_stats_collision << "\n";
-#else
-    // fprintf(out, "OpenSetSTL. No statistics available!\n");
-#endif
+    MemoryUsage m = m_aux.Memory();
 
+    const size_t queue = m_set.size() * MemoryUsage::TreeNodeBytes< PathNode<S>* >();
+    m.m_used += queue;
+    m.m_reserved += queue;
+    return m;
 }
 
-
 #endif
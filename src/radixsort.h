@@ -0,0 +1,81 @@
+#ifndef ASTAR_RADIXSORT_H
+#define ASTAR_RADIXSORT_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. LSD radix sort of the array of elements by the integer key of the element.
+//
+// 2. Each pass sorts by DIGIT_BITS bits of the key, from the least significant bits.
+//    The histograms of all passes are counted by a single pass over the array.
+//    The pass, in which all keys have the same digit, is skipped.
+//
+// 3. Each pass reads the array and writes the auxiliary buffer sequentially
+//    (2^DIGIT_BITS output streams), hence there are no random accesses to the large tables.
+//    The key is computed when it is needed, it is not stored.
+//
+// 4. The short arrays are sorted by std::sort.
+//
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Number of bits of the key sorted by single pass
+inline constexpr unsigned int RADIX_DIGIT_BITS = 11;
+
+// Arrays shorter than this are sorted by std::sort
+inline constexpr size_t RADIX_MIN_SIZE = 4096;
+
+//
+// Sorts "a" by the key returned by "key", which is lower than 2^keyBits.
+// "tmp" is the auxiliary buffer, it is resized to the size of "a".
+//
+template< typename T, typename K >
+void RadixSort( std::vector< T >& a, std::vector< T >& tmp, K key, unsigned int keyBits )
+{
+    constexpr size_t RADIX = size_t( 1 ) << RADIX_DIGIT_BITS;
+    constexpr uint64_t MASK = RADIX - 1;
+
+    if( a.size() < RADIX_MIN_SIZE )
+    {
+        std::sort( a.begin(), a.end(), [&key]( const T& x, const T& y ) { return key( x ) < key( y ); } );
+        return;
+    }
+
+    const unsigned int passNo = ( keyBits + RADIX_DIGIT_BITS - 1 ) / RADIX_DIGIT_BITS;
+    std::vector< size_t > count( passNo * RADIX, 0 );
+    for( const T& x : a )
+    {
+        const uint64_t k = key( x );
+        for( unsigned int p = 0; p < passNo; p++ )
+            count[ p * RADIX + ( ( k >> ( p * RADIX_DIGIT_BITS ) ) & MASK ) ]++;
+    }
+
+    tmp.resize( a.size() );
+    for( unsigned int p = 0; p < passNo; p++ )
+    {
+        const unsigned int shift = p * RADIX_DIGIT_BITS;
+        size_t* c = &count[ p * RADIX ];
+
+        // All keys have the same digit
+        if( c[ ( key( a[ 0 ] ) >> shift ) & MASK ] == a.size() )
+            continue;
+
+        size_t sum = 0;
+        for( size_t d = 0; d < RADIX; d++ )
+        {
+            const size_t n = c[ d ];
+            c[ d ] = sum;
+            sum += n;
+        }
+
+        for( const T& x : a )
+            tmp[ c[ ( key( x ) >> shift ) & MASK ]++ ] = x;
+        a.swap( tmp );
+    }
+}
+
+#endif
@@ -0,0 +1,184 @@
+//
+// This program summarizes the binary traces of expansions written by
+// "sliding-puzzle --trace PATH" (see Trace.h).
+//
+// Usage:
+//    sliding-trace [--dump N] TRACE
+//
+// For each search in the trace the following values are reported:
+//    - the number of expansions and the maximal size of the open set,
+//    - the states expanded more than once (reopenings),
+//    - the selections with lower "f" than the previous one (the heuristic is not consistent),
+//    - the ties, i.e. selections with the same "f" as the previous one, the ties with higher "h"
+//      than the previous one, and the ties continuing from the previous node (its child is selected),
+//    - the parents, which are not found among the previous expansions,
+//    - the number of expansions for each value of "f".
+//
+// With option "--dump" the first N records are printed as well:
+//    index, f, g, h, size of open set, index of parent record, tiles.
+//
+
+#include "Trace.h"
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+
+// Summary of single search
+struct Summary
+{
+    size_t m_expandedNo = 0;
+    size_t m_maxOpenNo = 0;
+    size_t m_reexpandedNo = 0;
+    size_t m_fDecreaseNo = 0;
+    size_t m_tieNo = 0;
+    size_t m_tieHigherHNo = 0;
+    size_t m_tieChildNo = 0;
+    size_t m_orphanNo = 0;
+
+    // Number of expansions for each "f"
+    std::map< Cost, size_t > m_layer;
+};
+
+//
+// Prints the summary of search "id"
+//
+void Print( size_t id, const Summary& s )
+{
+    printf( "SEARCH %zu\n", id );
+    printf( "   expanded              %12zu\n", s.m_expandedNo );
+    printf( "   max open set          %12zu\n", s.m_maxOpenNo );
+    printf( "   re-expanded states    %12zu\n", s.m_reexpandedNo );
+    printf( "   decreases of f        %12zu\n", s.m_fDecreaseNo );
+    printf( "   ties (same f)         %12zu  (%.1f%%)\n", s.m_tieNo, s.m_expandedNo ? 100.0 * s.m_tieNo / s.m_expandedNo : 0.0 );
+    printf( "      with higher h      %12zu\n", s.m_tieHigherHNo );
+    printf( "      child of previous  %12zu  (%.1f%%)\n", s.m_tieChildNo, s.m_tieNo ? 100.0 * s.m_tieChildNo / s.m_tieNo : 0.0 );
+    printf( "   unknown parents       %12zu\n", s.m_orphanNo );
+
+    printf( "   %6s %12s\n", "f", "expanded" );
+    for( const auto& [ f, n ] : s.m_layer )
+        printf( "   %6d %12zu\n", f, n );
+}
+
+//
+// Prints record "i"
+//
+void Dump( size_t i, const TraceRecord& r, long parent )
+{
+    printf( "%8zu f=%d g=%d h=%d open=%u parent=%ld :", i, r.F(), r.m_g, r.m_h, r.m_openNo, parent );
+
+    const State s = r.m_state.Unpack();
+    for( uint8_t k = 0; k < State::TILENO; k++ )
+        printf( " %d", int( s.Tile( k ) ) );
+    printf( "\n" );
+}
+
+void Usage( const char* name )
+{
+    fprintf( stderr, "Usage: %s [--dump N] TRACE\n", name );
+}
+
+}
+
+int main( int argc, char** argv )
+{
+    size_t dumpNo = 0;
+    std::string input;
+
+    for( int i = 1; i < argc; i++ )
+    {
+        const std::string arg = argv[ i ];
+        if( arg == "--dump" && i + 1 < argc )
+            dumpNo = strtoull( argv[ ++i ], nullptr, 10 );
+        else if( input.empty() && arg.compare( 0, 2, "--" ) != 0 )
+            input = arg;
+        else
+        {
+            Usage( argv[ 0 ] );
+            return 2;
+        }
+    }
+
+    if( input.empty() )
+    {
+        Usage( argv[ 0 ] );
+        return 2;
+    }
+
+    try
+    {
+        const TraceReader trace( input );
+        printf( "TRACE %s, BOARD %ux%u, RECORDS %zu\n", input.c_str(), State::WIDTH, State::WIDTH, trace.Size() );
+
+        // Index of the last expansion of each state (by hash) in the current search
+        std::unordered_map< uint64_t, size_t > index;
+        Summary s;
+        size_t searchNo = 0;
+
+        for( size_t i = 0; i < trace.Size(); i++ )
+        {
+            const TraceRecord& r = trace[ i ];
+
+            if( r.IsStart() )
+            {
+                if( s.m_expandedNo > 0 )
+                    Print( searchNo++, s );
+                s = Summary();
+                index.clear();
+            }
+
+            // Parent
+            long parent = -1;
+            if( !r.IsStart() )
+            {
+                auto it = index.find( r.m_parent );
+                if( it != index.end() )
+                    parent = long( it->second );
+                else
+                    s.m_orphanNo++;
+            }
+
+            // Order of selection
+            if( s.m_expandedNo > 0 )
+            {
+                const TraceRecord& prev = trace[ i - 1 ];
+                if( r.F() < prev.F() )
+                    s.m_fDecreaseNo++;
+                else if( r.F() == prev.F() )
+                {
+                    s.m_tieNo++;
+                    s.m_tieHigherHNo += ( r.m_h > prev.m_h );
+                    s.m_tieChildNo += ( parent == long( i - 1 ) );
+                }
+            }
+
+            if( !index.emplace( r.m_state.Hash(), i ).second )
+            {
+                s.m_reexpandedNo++;
+                index[ r.m_state.Hash() ] = i;
+            }
+
+            s.m_expandedNo++;
+            s.m_maxOpenNo = std::max< size_t >( s.m_maxOpenNo, r.m_openNo );
+            s.m_layer[ r.F() ]++;
+
+            if( i < dumpNo )
+                Dump( i, r, parent );
+        }
+
+        if( s.m_expandedNo > 0 )
+            Print( searchNo, s );
+    }
+    catch( const std::invalid_argument& e )
+    {
+        fprintf( stderr, "\nERROR: %s\n", e.what() );
+        return 1;
+    }
+
+    return 0;
+}
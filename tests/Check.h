@@ -0,0 +1,65 @@
+#ifndef ASTAR_CHECK_H
+#define ASTAR_CHECK_H
+
+//
+// ---------------------------------------------------------------------------------
+//      D E S C R I P T I O N
+// ---------------------------------------------------------------------------------
+// 1. Minimal support of the tests run by ctest. Each test is the program, which returns
+//    the non-zero exit code, if any check fails.
+//
+// 2. Function Check prints the failed check to standard error and counts it.
+//    Function Result returns the exit code of the test.
+//
+// 3. Function Throws checks, that the function throws the exception std::invalid_argument,
+//    which is the error of this repository.
+//
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+// Number of failed checks of the test
+inline unsigned int g_failedNo = 0;
+
+//
+// Counts the failed check and prints its description "what"
+//
+inline void Check( bool ok, const std::string& what )
+{
+    if( ok )
+        return;
+
+    g_failedNo++;
+    fprintf( stderr, "FAILED: %s\n", what.c_str() );
+}
+
+//
+// Checks, that function "f" throws std::invalid_argument
+//
+template< typename F >
+void Throws( F f, const std::string& what )
+{
+    bool thrown = false;
+    try
+    {
+        f();
+    }
+    catch( const std::invalid_argument& )
+    {
+        thrown = true;
+    }
+    Check( thrown, what + " does not throw" );
+}
+
+//
+// Returns the exit code of the test
+//
+inline int Result( )
+{
+    if( g_failedNo == 0 )
+        printf( "All checks passed\n" );
+    return g_failedNo == 0 ? 0 : 1;
+}
+
+#endif
@@ -0,0 +1,113 @@
+//
+// Test of the enumeration of all optimal solutions (see Engine.h): for each engine supporting it,
+//    the number of optimal solutions of the built-in examples is the same as the number counted
+//    by the exhaustive depth-first search, and the enumerated solutions are distinct legal paths
+//    of the optimal length.
+//
+
+#include "Check.h"
+#include "EngineRegistry.h"
+#include "Examples.h"
+#include "Graph.h"
+#include "Limits.h"
+#include "Solution.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// Maximal number of the enumerated solutions checked one by one
+constexpr uint64_t MAX_CHECKED = 20000;
+
+//
+// Returns the number of paths from "x" of "depth" moves to the GOAL state, which are
+// not longer than "bound". The move back to the previous position "prev" is skipped,
+// since the optimal path does not contain it.
+//
+uint64_t CountPaths( const Graph& graph, const State& x, int prev, Cost depth, Cost bound )
+{
+    if( depth + graph.Manhattan( x ) > bound )
+        return 0;
+    if( depth == bound )
+        return graph.IsGoal( x ) ? 1 : 0;
+
+    uint64_t n = 0;
+    for( const Solution::Move m : { Solution::UP, Solution::DOWN, Solution::LEFT, Solution::RIGHT } )
+    {
+        State y = x;
+        if( Solution::Apply( y, m ) && y.SpaceIdx() != prev )
+            n += CountPaths( graph, y, x.SpaceIdx(), depth + 1, bound );
+    }
+    return n;
+}
+
+//
+// Enumerates the optimal solutions of the examples by engine "name" with policies "closed" and "open"
+//
+void TestEngine( const std::string& name, const std::string& closed, const std::string& open )
+{
+    std::unique_ptr< Engine > engine = EngineRegistry::Create( name, closed, open );
+    if( !engine->SetAllOptimal( true ) )
+        return;
+
+    const std::string what = name + " " + closed + " " + open;
+    printf( "%s\n", what.c_str() );
+    fflush( stdout );
+
+    const Examples examples;
+    for( size_t i = 0; i < examples.size(); i++ )
+    {
+        const std::string ex = what + ", example " + std::to_string( i + 1 );
+        const State& beg = examples[ i ];
+
+        Graph graph;
+        const std::optional< std::vector< State > > path = engine->Solve( graph, beg, Limits() );
+        if( !path )
+        {
+            Check( false, "path not found, " + ex );
+            continue;
+        }
+
+        const Cost length = static_cast< Cost >( path->size() - 1 );
+        const uint64_t exp = CountPaths( graph, beg, -1, 0, length );
+        Check( engine->OptimalNo() == exp, "number of optimal solutions " + std::to_string( engine->OptimalNo() )
+                                           + " instead of " + std::to_string( exp ) + ", " + ex );
+
+        // The moves of the enumerated solutions, which must be distinct
+        std::set< std::vector< uint8_t > > seen;
+        engine->ForEachOptimal( [ & ]( const std::vector< State >& p )
+        {
+            const Solution sol = Solution::FromPath( p, true );
+            Check( p.front() == beg && graph.IsGoal( p.back() ), "solution does not join the states, " + ex );
+            Check( sol.ToPath( beg ) == p, "illegal move in solution, " + ex );
+            Check( sol.Length() == static_cast< size_t >( length ), "solution is not optimal, " + ex );
+            Check( seen.insert( sol.Bytes() ).second, "solution is repeated, " + ex );
+            return seen.size() < MAX_CHECKED;
+        } );
+        Check( seen.size() == std::min( exp, MAX_CHECKED ), "number of enumerated solutions, " + ex );
+    }
+}
+
+}
+
+int main( )
+{
+    try
+    {
+        for( const EngineRegistry::Entry& e : EngineRegistry::Entries() )
+            TestEngine( e.m_algorithm, e.m_closed ? e.m_closed : "hash", e.m_open ? e.m_open : "hash" );
+    }
+    catch( const std::exception& e )
+    {
+        Check( false, std::string( "exception: " ) + e.what() );
+    }
+
+    return Result();
+}
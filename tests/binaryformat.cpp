@@ -0,0 +1,161 @@
+//
+// Test of the binary files of instances and solutions (see BinaryFormat.h):
+//    the instances and the solutions written by BinaryWriter are read back by BinaryReader,
+//    the file with the not solvable state is rejected.
+//
+// Usage:
+//    test-binaryformat DIR
+//
+//    DIR - directory of the temporary files
+//
+
+#include "BinaryFormat.h"
+#include "Check.h"
+#include "Examples.h"
+#include "Solution.h"
+#include "State.h"
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+//
+// Returns the solution of "length" random moves from "beg"
+//
+Solution RandomSolution( const State& beg, size_t length, std::mt19937& rng )
+{
+    Solution sol;
+    State s = beg;
+    while( sol.Length() < length )
+    {
+        const Solution::Move m = static_cast< Solution::Move >( rng() % 4 );
+        if( Solution::Apply( s, m ) )
+            sol.Push( m );
+    }
+    sol.SetOptimal( length % 2 == 0 );
+    return sol;
+}
+
+//
+// Writes and reads the instances
+//
+void TestInstances( const std::string& path )
+{
+    const Examples examples;
+    {
+        BinaryWriter out( path, BinaryFile::INSTANCES );
+        for( const State& s : examples )
+            out.Write( s );
+    }
+
+    Check( BinaryFile::IsBinary( path ), "binary file of instances is not recognized" );
+
+    BinaryReader in( path );
+    Check( in.GetKind() == BinaryFile::INSTANCES, "kind of file of instances" );
+
+    std::vector< State > read;
+    in.ForEach( [ & ]( const State& s ) { read.push_back( s ); } );
+    Check( read == static_cast< const std::vector< State >& >( examples ), "instances differ" );
+}
+
+//
+// Writes and reads the solutions of various lengths, including the empty solution
+//
+void TestSolutions( const std::string& path )
+{
+    const Examples examples;
+    std::mt19937 rng( 1 );
+
+    std::vector< Solution > solutions;
+    {
+        BinaryWriter out( path, BinaryFile::SOLUTIONS );
+        size_t length = 0;
+        for( const State& s : examples )
+        {
+            for( size_t i = 0; i < 4; i++, length += 7 )
+            {
+                solutions.push_back( RandomSolution( s, length, rng ) );
+                out.Write( s, solutions.back() );
+            }
+        }
+    }
+
+    BinaryReader in( path );
+    Check( in.GetKind() == BinaryFile::SOLUTIONS, "kind of file of solutions" );
+
+    State beg;
+    Solution sol;
+    size_t n = 0;
+    while( in.Next( beg, sol ) )
+    {
+        if( n == solutions.size() )
+        {
+            Check( false, "too many solutions" );
+            break;
+        }
+
+        const Solution& exp = solutions[ n ];
+        Check( beg == examples[ n / 4 ], "initial state of solution " + std::to_string( n ) );
+        Check( sol.Length() == exp.Length() && sol.IsOptimal() == exp.IsOptimal(),
+               "length or optimality of solution " + std::to_string( n ) );
+        Check( sol.ToPath( beg ) == exp.ToPath( beg ), "moves of solution " + std::to_string( n ) );
+        n++;
+    }
+    Check( n == solutions.size(), "number of solutions" );
+}
+
+//
+// The not solvable state is rejected by the reader
+//
+void TestNotSolvable( const std::string& path )
+{
+    State s = Examples().Get( 0 );
+
+    // The swap of two tiles changes the parity of the permutation
+    uint8_t a = 0;
+    while( s.IsSpace( a ) )
+        a++;
+    uint8_t b = a + 1;
+    while( s.IsSpace( b ) )
+        b++;
+    s.Swap( a, b );
+    Check( !s.IsSolvable(), "state with swapped tiles is solvable" );
+
+    {
+        BinaryWriter out( path, BinaryFile::INSTANCES );
+        out.Write( s );
+    }
+
+    Throws( [ & ]( ) {
+        BinaryReader in( path );
+        State x;
+        while( in.Next( x ) )
+            ;
+    }, "reading of not solvable state" );
+}
+
+}
+
+int main( int argc, char** argv )
+{
+    const std::string dir = ( argc > 1 ) ? argv[ 1 ] : ".";
+
+    try
+    {
+        TestInstances( dir + "/test-instances.bin" );
+        TestSolutions( dir + "/test-solutions.bin" );
+        TestNotSolvable( dir + "/test-not-solvable.bin" );
+    }
+    catch( const std::exception& e )
+    {
+        Check( false, std::string( "exception: " ) + e.what() );
+    }
+
+    for( const char* name : { "/test-instances.bin", "/test-solutions.bin", "/test-not-solvable.bin" } )
+        remove( ( dir + name ).c_str() );
+
+    return Result();
+}
@@ -0,0 +1,108 @@
+//
+// Test of the engines of the registry (see EngineRegistry.h): each engine solves the built-in
+//    examples with both heuristics. The path must be made of legal moves from the initial state
+//    to the GOAL state. The optimal engines must return the known optimal length,
+//    the other engines must not return the shorter path. The engines requiring the incremental
+//    heuristic must reject the linear conflicts.
+//
+
+#include "Check.h"
+#include "EngineRegistry.h"
+#include "Examples.h"
+#include "Graph.h"
+#include "Limits.h"
+#include "Solution.h"
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// Optimal lengths of the built-in examples of each width of the board
+#if PUZZLE_WIDTH == 5
+const size_t OPTIMAL_LENGTH[] = { 15, 30, 38, 48, 44 };
+#elif PUZZLE_WIDTH == 4
+const size_t OPTIMAL_LENGTH[] = { 10, 18, 28, 26, 36 };
+#else
+const size_t OPTIMAL_LENGTH[] = { 8, 12, 16, 20, 18 };
+#endif
+
+//
+// Solves the examples by engine "name" with policies "closed" and "open" and heuristic "heuristic"
+//
+void TestEngine( const std::string& name, const std::string& closed, const std::string& open, Graph::Heuristic heuristic )
+{
+    const std::string what = name + " " + closed + " " + open + " " + Graph::Name( heuristic );
+    printf( "%s\n", what.c_str() );
+    fflush( stdout );
+
+    // The engine is reused by all examples, as by the driver
+    std::unique_ptr< Engine > engine = EngineRegistry::Create( name, closed, open );
+
+    const Examples examples;
+    for( size_t i = 0; i < examples.size(); i++ )
+    {
+        const std::string ex = what + ", example " + std::to_string( i + 1 );
+        const State& beg = examples[ i ];
+
+        Graph graph( heuristic );
+        const std::optional< std::vector< State > > path = engine->Solve( graph, beg, Limits() );
+        if( !path )
+        {
+            Check( false, "path not found, " + ex );
+            continue;
+        }
+
+        const size_t length = path->size() - 1;
+        Check( path->front() == beg, "path does not start at the initial state, " + ex );
+        Check( graph.IsGoal( path->back() ), "path does not end at the GOAL state, " + ex );
+        Check( Solution::FromPath( *path, false ).ToPath( beg ) == *path, "illegal move in path, " + ex );
+
+        if( engine->IsOptimal() )
+            Check( length == OPTIMAL_LENGTH[ i ], "length " + std::to_string( length ) + " is not optimal, " + ex );
+        else
+            Check( length >= OPTIMAL_LENGTH[ i ], "length " + std::to_string( length ) + " is below optimal, " + ex );
+    }
+}
+
+}
+
+int main( )
+{
+    // The engines with parameters, "extastar-1" sorts several runs of each bucket
+    const char* const parametrized[] = { "wastar-2", "alstar-1", "alstar-8", "idastar-tt-1", "idastar-basic-tt-1", "extastar-1" };
+
+    try
+    {
+        for( const Graph::Heuristic heuristic : { Graph::MANHATTAN, Graph::LINEAR_CONFLICT } )
+        {
+            for( const EngineRegistry::Entry& e : EngineRegistry::Entries() )
+            {
+                const std::string closed = e.m_closed ? e.m_closed : "hash";
+                const std::string open = e.m_open ? e.m_open : "hash";
+                if( !e.m_incremental || heuristic == Graph::MANHATTAN )
+                {
+                    TestEngine( e.m_algorithm, closed, open, heuristic );
+                    continue;
+                }
+
+                Throws( [ & ]( ) { EngineRegistry::CheckHeuristic( e, e.m_algorithm, heuristic, false ); },
+                        std::string( "registry check of heuristic of " ) + e.m_algorithm );
+                Throws( [ & ]( ) { Graph graph( heuristic ); EngineRegistry::Create( e.m_algorithm, closed, open )->Solve( graph, Examples()[ 0 ], Limits() ); },
+                        std::string( "search with not incremental heuristic by " ) + e.m_algorithm );
+            }
+
+            for( const char* name : parametrized )
+                TestEngine( name, "hash", "hash", heuristic );
+        }
+    }
+    catch( const std::exception& e )
+    {
+        Check( false, std::string( "exception: " ) + e.what() );
+    }
+
+    return Result();
+}
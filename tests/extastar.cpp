@@ -0,0 +1,150 @@
+//
+// Test of the checkpoints of the external-memory A* (see ExternalAstar.h):
+//    - the search stopped by the limits is resumed by the new engine (as after the restart)
+//      and it expands fewer nodes than the whole search,
+//    - the incomplete state at the end of the open file (the killed search) is truncated,
+//    - the stopped search is not resumed with other heuristic or perimeter,
+//    - the files are removed, when the search is finished.
+//
+// Usage:
+//    test-extastar DIR
+//
+//    DIR - directory, in which the work directory of the test is created
+//
+
+#include "Check.h"
+#include "Examples.h"
+#include "ExternalAstar.h"
+#include "Graph.h"
+#include "Limits.h"
+#include "Perimeter.h"
+#include <cstdio>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+
+// Sorted chunk of 1 MiB, hence the buckets are sorted in several runs
+constexpr size_t SORT_BYTES = size_t( 1 ) << 20;
+
+// Result of the search
+struct Run
+{
+    size_t m_length = 0;
+    size_t m_expandedNo = 0;
+    bool m_limitReached = false;
+};
+
+//
+// Solves "beg" by the new engine with work directory "dir", "heuristic" and "perimeter".
+// The search is stopped after "maxExpanded" expanded nodes, unless it is zero.
+//
+Run Solve( const std::string& dir, const State& beg, Graph::Heuristic heuristic, const Perimeter* perimeter, size_t maxExpanded )
+{
+    ExternalAstar engine( SORT_BYTES );
+    engine.SetWorkDir( dir );
+
+    Graph graph( heuristic );
+    graph.SetPerimeter( perimeter );
+
+    Limits limits;
+    limits.m_maxExpanded = maxExpanded;
+
+    Run run;
+    const std::optional< std::vector< State > > path = engine.Solve( graph, beg, limits );
+    run.m_length = path ? path->size() - 1 : 0;
+    run.m_expandedNo = engine.ExpandedNo();
+    run.m_limitReached = engine.LimitReached();
+    return run;
+}
+
+//
+// Returns the number of files in "dir" with extension "ext", or of all files for the empty "ext"
+//
+size_t FileNo( const std::string& dir, const std::string& ext = "" )
+{
+    size_t n = 0;
+    for( const fs::directory_entry& e : fs::directory_iterator( dir ) )
+        n += ( ext.empty() || e.path().extension() == ext ) ? 1 : 0;
+    return n;
+}
+
+//
+// Tests the checkpoints of the search from "beg" in directory "dir"
+//
+void TestCheckpoint( const std::string& dir, const State& beg, const Perimeter& perimeter )
+{
+    // The whole search
+    const Run full = Solve( dir, beg, Graph::MANHATTAN, nullptr, 0 );
+    Check( full.m_length > 0 && !full.m_limitReached, "whole search" );
+    Check( FileNo( dir ) == 0, "files are kept after the whole search" );
+
+    // The stopped search is resumed by the new engine
+    const Run stopped = Solve( dir, beg, Graph::MANHATTAN, nullptr, full.m_expandedNo / 2 );
+    Check( stopped.m_length == 0 && stopped.m_limitReached, "search is not stopped by the limits" );
+    Check( FileNo( dir, ".checkpoint" ) == 1 && FileNo( dir, ".open" ) > 0, "files of the stopped search are not kept" );
+
+    const Run resumed = Solve( dir, beg, Graph::MANHATTAN, nullptr, 0 );
+    Check( resumed.m_length == full.m_length, "length of the resumed search" );
+    Check( resumed.m_expandedNo < full.m_expandedNo, "resumed search expands all nodes again" );
+    Check( FileNo( dir ) == 0, "files are kept after the resumed search" );
+
+    // The incomplete state at the end of the open file of the killed search
+    Solve( dir, beg, Graph::MANHATTAN, nullptr, full.m_expandedNo / 2 );
+    for( const fs::directory_entry& e : fs::directory_iterator( dir ) )
+    {
+        if( e.path().extension() != ".open" )
+            continue;
+        FILE* file = fopen( e.path().string().c_str(), "ab" );
+        fputs( "part", file );
+        fclose( file );
+    }
+    const Run killed = Solve( dir, beg, Graph::MANHATTAN, nullptr, 0 );
+    Check( killed.m_length == full.m_length, "length of the search resumed after the kill" );
+    Check( killed.m_expandedNo < full.m_expandedNo, "search resumed after the kill expands all nodes again" );
+
+    // Other heuristic starts again
+    const Run conflict = Solve( dir, beg, Graph::LINEAR_CONFLICT, nullptr, 0 );
+    Solve( dir, beg, Graph::MANHATTAN, nullptr, full.m_expandedNo / 2 );
+    const Run restarted = Solve( dir, beg, Graph::LINEAR_CONFLICT, nullptr, 0 );
+    Check( restarted.m_length == full.m_length, "length of the search with other heuristic" );
+    Check( restarted.m_expandedNo == conflict.m_expandedNo, "search with other heuristic is resumed" );
+
+    // Other perimeter starts again
+    const Run inside = Solve( dir, beg, Graph::MANHATTAN, &perimeter, 0 );
+    Solve( dir, beg, Graph::MANHATTAN, nullptr, full.m_expandedNo / 2 );
+    const Run again = Solve( dir, beg, Graph::MANHATTAN, &perimeter, 0 );
+    Check( again.m_length == full.m_length, "length of the search with other perimeter" );
+    Check( again.m_expandedNo == inside.m_expandedNo, "search with other perimeter is resumed" );
+    Check( FileNo( dir ) == 0, "files are kept after the search with other perimeter" );
+}
+
+}
+
+int main( int argc, char** argv )
+{
+    const std::string dir = std::string( ( argc > 1 ) ? argv[ 1 ] : "." ) + "/extastar-work";
+
+    try
+    {
+        fs::remove_all( dir );
+        fs::create_directories( dir );
+
+        const Perimeter perimeter( 6 );
+        const Examples examples;
+        TestCheckpoint( dir, examples[ 3 ], perimeter );
+
+        fs::remove_all( dir );
+    }
+    catch( const std::exception& e )
+    {
+        Check( false, std::string( "exception: " ) + e.what() );
+    }
+
+    return Result();
+}
@@ -0,0 +1,21 @@
+#
+# Test of the table of the FSM move pruning (see MoveFsmBuilder.h): the table generated
+# by sliding-fsm must be the same as the committed src/MoveFsmTable.h.
+#
+# Usage:
+#    cmake -DFSM=PATH -DTABLE=PATH -DOUT=PATH -P fsmtable.cmake
+#
+#    FSM   - program sliding-fsm
+#    TABLE - committed table
+#    OUT   - generated table
+#
+
+execute_process( COMMAND ${FSM} --length 12 ${OUT} RESULT_VARIABLE rc ERROR_QUIET )
+if( NOT rc EQUAL 0 )
+    message( FATAL_ERROR "sliding-fsm failed: ${rc}" )
+endif()
+
+execute_process( COMMAND ${CMAKE_COMMAND} -E compare_files ${OUT} ${TABLE} RESULT_VARIABLE rc )
+if( NOT rc EQUAL 0 )
+    message( FATAL_ERROR "Generated table ${OUT} differs from ${TABLE}, regenerate it by: sliding-fsm --length 12 ${TABLE}" )
+endif()
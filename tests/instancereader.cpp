@@ -0,0 +1,136 @@
+//
+// Test of the reader of the instances (see InstanceReader.h):
+//    - the valid instances are read with the comments and the boards written in several lines,
+//    - the tile out of range, the duplicated tile, the not solvable state (wrong parity),
+//      the not allowed character and the incomplete instance are rejected.
+//
+// Usage:
+//    test-instancereader DIR
+//
+//    DIR - directory of the temporary files
+//
+
+#include "Check.h"
+#include "Examples.h"
+#include "Graph.h"
+#include "InstanceReader.h"
+#include "State.h"
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+//
+// Returns the tiles of "s"
+//
+std::vector< int > Tiles( const State& s )
+{
+    std::vector< int > tiles;
+    for( uint8_t i = 0; i < State::TILENO; i++ )
+        tiles.push_back( s.Tile( i ) );
+    return tiles;
+}
+
+//
+// Returns the tiles as the text of one line, the line is broken after each "width" tiles
+//
+std::string Text( const std::vector< int >& tiles, size_t width = State::TILENO )
+{
+    std::string text;
+    for( size_t i = 0; i < tiles.size(); i++ )
+        text += std::to_string( tiles[ i ] ) + ( ( i + 1 ) % width == 0 ? "\n" : " " );
+    return text;
+}
+
+//
+// Writes "text" into file "path"
+//
+void Write( const std::string& path, const std::string& text )
+{
+    FILE* out = fopen( path.c_str(), "w" );
+    if( !out )
+    {
+        Check( false, "cannot create file " + path );
+        return;
+    }
+    fputs( text.c_str(), out );
+    fclose( out );
+}
+
+//
+// Reads the file with the examples, with one board written in several lines
+//
+void TestValid( const std::string& path )
+{
+    const Examples examples;
+    std::string text = "# Examples\n";
+    for( size_t i = 0; i < examples.size(); i++ )
+        text += Text( Tiles( examples[ i ] ), i == 0 ? State::WIDTH : State::TILENO );
+    text += "# The end\n";
+    Write( path, text );
+
+    InstanceReader in( path );
+    std::vector< State > read;
+    const size_t n = in.ForEach( [ & ]( const State& s ) { read.push_back( s ); } );
+    Check( n == examples.size() && read.size() == examples.size(), "number of the read instances" );
+    Check( read == static_cast< const std::vector< State >& >( examples ), "read instances differ" );
+}
+
+//
+// Checks, that the file with "text" is rejected
+//
+void TestInvalid( const std::string& path, const std::string& text, const std::string& what )
+{
+    Write( path, text );
+    Throws( [ & ]( ) { InstanceReader in( path ); State s; in.Next( s ); }, what );
+}
+
+}
+
+int main( int argc, char* argv[] )
+{
+    if( argc != 2 )
+    {
+        fprintf( stderr, "Usage: %s DIR\n", argv[ 0 ] );
+        return 2;
+    }
+
+    const std::string path = std::string( argv[ 1 ] ) + "/instancereader.txt";
+
+    try
+    {
+        TestValid( path );
+
+        const std::vector< int > goal = Tiles( Graph::Goal() );
+
+        std::vector< int > range = goal;
+        range[ 0 ] = State::TILENO;
+        TestInvalid( path, Text( range ), "tile out of range" );
+
+        std::vector< int > duplicated = goal;
+        duplicated[ 1 ] = duplicated[ 0 ];
+        TestInvalid( path, Text( duplicated ), "duplicated tile" );
+
+        // The swap of two tiles changes the parity of the permutation
+        std::vector< int > parity = goal;
+        std::swap( parity[ 0 ], parity[ 1 ] );
+        TestInvalid( path, Text( parity ), "wrong parity" );
+
+        std::vector< int > incomplete = goal;
+        incomplete.pop_back();
+        TestInvalid( path, Text( incomplete ), "incomplete instance" );
+
+        TestInvalid( path, "1 x\n", "not allowed character" );
+
+        remove( path.c_str() );
+    }
+    catch( const std::exception& e )
+    {
+        Check( false, std::string( "exception: " ) + e.what() );
+    }
+
+    return Result();
+}
@@ -0,0 +1,132 @@
+//
+// Test of the perimeter search (see Perimeter.h):
+//    - the distances of the states on the optimal paths of the built-in examples are exact
+//      within the perimeter and the states outside it are not found,
+//    - the perimeter built by several threads holds the same states,
+//    - the path ending at the front is completed to the optimal path,
+//    - the engines stopping at the perimeter return the optimal paths,
+//      EPEA* requiring the incremental heuristic rejects the perimeter.
+//
+
+#include "Check.h"
+#include "EngineRegistry.h"
+#include "Examples.h"
+#include "Graph.h"
+#include "Limits.h"
+#include "Perimeter.h"
+#include "Solution.h"
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// Depth of the perimeter of the test
+constexpr unsigned int DEPTH = 10;
+
+//
+// Checks, that "path" is made of legal moves from "beg" to the GOAL state and it has "length" moves
+//
+void CheckPath( const std::vector< State >& path, const State& beg, size_t length, const std::string& what )
+{
+    Check( !path.empty() && path.front() == beg, "path does not start at the initial state, " + what );
+    Check( !path.empty() && path.back() == Graph::Goal(), "path does not end at the GOAL state, " + what );
+    Check( Solution::FromPath( path, false ).ToPath( beg ) == path, "illegal move in path, " + what );
+    Check( path.size() == length + 1, "length " + std::to_string( path.size() - 1 ) + " is not optimal, " + what );
+}
+
+//
+// Checks the distances of the states of the optimal path "path" and the completion of its part
+//
+void TestDistances( const Perimeter& perimeter, const std::vector< State >& path, const std::string& what )
+{
+    const size_t length = path.size() - 1;
+    for( size_t i = 0; i <= length; i++ )
+    {
+        // Each part of the optimal path is optimal, hence the distance is the rest of the path
+        const size_t rest = length - i;
+        const int exp = ( rest <= DEPTH ) ? static_cast< int >( rest ) : -1;
+        Check( perimeter.Distance( path[ i ] ) == exp, "distance of state " + std::to_string( i ) + ", " + what );
+    }
+
+    if( length < DEPTH )
+        return;
+
+    // The path ending at the front
+    std::vector< State > part( path.begin(), path.end() - DEPTH );
+    perimeter.Complete( part );
+    CheckPath( part, path.front(), length, "completion, " + what );
+}
+
+//
+// Solves "beg" by engine "name" with "perimeter" and checks, that the path has "length" moves
+//
+void TestEngine( const std::string& name, const Perimeter& perimeter, Graph::Heuristic heuristic,
+                 const State& beg, size_t length, const std::string& what )
+{
+    std::unique_ptr< Engine > engine = EngineRegistry::Create( name );
+    Graph graph( heuristic );
+    graph.SetPerimeter( &perimeter );
+
+    const std::string ex = name + " " + Graph::Name( heuristic ) + ", " + what;
+    const std::optional< std::vector< State > > path = engine->Solve( graph, beg, Limits() );
+    if( !path )
+        Check( false, "path not found, " + ex );
+    else
+        CheckPath( *path, beg, length, ex );
+}
+
+}
+
+int main( )
+{
+    const char* const engines[] = { "astar", "alstar-8", "idastar", "idastar-tt", "bfhs", "extastar" };
+
+    try
+    {
+        const Perimeter perimeter( DEPTH );
+        const Perimeter margin( DEPTH, 4 );
+        const Perimeter parallel( DEPTH, Perimeter::DEFAULT_MARGIN, 3 );
+        Check( perimeter.Distance( Graph::Goal() ) == 0, "distance of the GOAL state" );
+        Check( parallel.StateNo() == perimeter.StateNo(), "number of states of the perimeter built by 3 threads" );
+
+        Throws( [ & ]( ) { Graph graph; graph.SetPerimeter( &perimeter ); EngineRegistry::Create( "epea" )->Solve( graph, Examples()[ 0 ], Limits() ); },
+                "search with perimeter by epea" );
+
+        const Examples examples;
+        for( size_t i = 0; i < examples.size(); i++ )
+        {
+            const std::string what = "example " + std::to_string( i + 1 );
+            const State& beg = examples[ i ];
+
+            // The optimal path without perimeter
+            Graph graph;
+            const std::optional< std::vector< State > > path = EngineRegistry::Create( "astar" )->Solve( graph, beg, Limits() );
+            if( !path )
+            {
+                Check( false, "path not found, " + what );
+                continue;
+            }
+
+            const size_t length = path->size() - 1;
+            TestDistances( perimeter, *path, what );
+            TestDistances( parallel, *path, "3 threads, " + what );
+
+            for( const Graph::Heuristic heuristic : { Graph::MANHATTAN, Graph::LINEAR_CONFLICT } )
+            {
+                for( const char* name : engines )
+                    TestEngine( name, perimeter, heuristic, beg, length, what );
+                TestEngine( "idastar", margin, heuristic, beg, length, "margin 4, " + what );
+            }
+        }
+    }
+    catch( const std::exception& e )
+    {
+        Check( false, std::string( "exception: " ) + e.what() );
+    }
+
+    return Result();
+}
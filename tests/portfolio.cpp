@@ -0,0 +1,112 @@
+//
+// Test of the portfolio of engines (see Portfolio.h): the race of A*, IDA* and WA* on the built-in
+//    examples returns the proven-optimal solution of the same length as found by A* alone,
+//    with both heuristics and with the perimeter. The portfolio of the bounded engine only
+//    returns the bounded solution. The statistics count all runs and wins.
+//
+
+#include "Check.h"
+#include "EngineRegistry.h"
+#include "Examples.h"
+#include "Graph.h"
+#include "Limits.h"
+#include "Perimeter.h"
+#include "Portfolio.h"
+#include "Solution.h"
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+//
+// Returns the portfolio of engines "names"
+//
+template< typename N >
+std::unique_ptr< Portfolio > Create( const N& names )
+{
+    std::unique_ptr< Portfolio > portfolio = std::make_unique< Portfolio >();
+    for( const char* name : names )
+        portfolio->Add( name, EngineRegistry::Create( name ) );
+    return portfolio;
+}
+
+//
+// Solves the examples by "portfolio" and compares the solutions with A* using "heuristic"
+//
+void TestPortfolio( Portfolio& portfolio, Graph::Heuristic heuristic, const Perimeter* perimeter,
+                    bool optimal, const std::string& what )
+{
+    printf( "%s\n", what.c_str() );
+    fflush( stdout );
+
+    portfolio.SetHeuristic( heuristic, perimeter );
+    std::unique_ptr< Engine > single = EngineRegistry::Create( "astar" );
+
+    const Examples examples;
+    for( size_t i = 0; i < examples.size(); i++ )
+    {
+        const std::string ex = what + ", example " + std::to_string( i + 1 );
+        const State& beg = examples[ i ];
+
+        Graph graph( heuristic );
+        const std::optional< std::vector< State > > exp = single->Solve( graph, beg, Limits() );
+        const Portfolio::Result res = portfolio.Solve( beg, Limits() );
+        if( !exp || !res.m_path )
+        {
+            Check( false, "path not found, " + ex );
+            continue;
+        }
+
+        const std::vector< State >& path = *res.m_path;
+        Check( path.front() == beg && graph.IsGoal( path.back() ), "path does not join the states, " + ex );
+        Check( Solution::FromPath( path, false ).ToPath( beg ) == path, "illegal move in path, " + ex );
+        Check( res.m_optimal == optimal, "optimality of the solution of " + res.m_winner + ", " + ex );
+
+        if( optimal )
+            Check( path.size() == exp->size(), "length differs from A*, winner " + res.m_winner + ", " + ex );
+        else
+            Check( path.size() >= exp->size(), "length is below optimal, " + ex );
+    }
+
+    size_t winNo = 0;
+    for( const Portfolio::Stats& s : portfolio.GetStats() )
+    {
+        Check( s.m_runNo == examples.size(), "number of runs of " + s.m_name + ", " + what );
+        winNo += s.m_winNo;
+    }
+    Check( winNo == examples.size(), "number of wins, " + what );
+}
+
+}
+
+int main( )
+{
+    const char* const engines[] = { "astar", "idastar", "wastar-2" };
+    const char* const bounded[] = { "wastar-2" };
+
+    try
+    {
+        for( const Graph::Heuristic heuristic : { Graph::MANHATTAN, Graph::LINEAR_CONFLICT } )
+        {
+            const std::unique_ptr< Portfolio > portfolio = Create( engines );
+            TestPortfolio( *portfolio, heuristic, nullptr, true, std::string( "portfolio " ) + Graph::Name( heuristic ) );
+        }
+
+        const Perimeter perimeter( 10 );
+        const std::unique_ptr< Portfolio > withPerimeter = Create( engines );
+        TestPortfolio( *withPerimeter, Graph::MANHATTAN, &perimeter, true, "portfolio with perimeter" );
+
+        const std::unique_ptr< Portfolio > weighted = Create( bounded );
+        TestPortfolio( *weighted, Graph::MANHATTAN, nullptr, false, "portfolio of wastar-2" );
+    }
+    catch( const std::exception& e )
+    {
+        Check( false, std::string( "exception: " ) + e.what() );
+    }
+
+    return Result();
+}
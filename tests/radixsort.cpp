@@ -0,0 +1,76 @@
+//
+// Test of the radix sort (see radixsort.h): the arrays of random keys of various sizes
+//    and numbers of bits are sorted the same as by std::sort. The short arrays (sorted
+//    by std::sort), the arrays of equal keys (all passes are skipped) and the keys
+//    of 64 bits (the last pass is partial) are included.
+//
+
+#include "Check.h"
+#include "radixsort.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// Element with the key and its position in the input, which tells the equal keys apart
+struct Item
+{
+    uint64_t m_key;
+    uint32_t m_pos;
+};
+
+//
+// Sorts "n" random keys of "keyBits" bits by the radix sort and compares the result
+// with std::sort
+//
+void TestSort( size_t n, unsigned int keyBits, std::mt19937_64& rng )
+{
+    const uint64_t mask = ( keyBits == 64 ) ? ~uint64_t( 0 ) : ( uint64_t( 1 ) << keyBits ) - 1;
+
+    std::vector< Item > a( n );
+    for( size_t i = 0; i < n; i++ )
+        a[ i ] = { rng() & mask, static_cast< uint32_t >( i ) };
+
+    std::vector< Item > exp = a;
+    std::vector< Item > tmp;
+    RadixSort( a, tmp, []( const Item& x ) { return x.m_key; }, keyBits );
+
+    const std::string what = "n = " + std::to_string( n ) + ", bits = " + std::to_string( keyBits );
+    Check( a.size() == n, "size changed, " + what );
+    Check( std::is_sorted( a.begin(), a.end(), []( const Item& x, const Item& y ) { return x.m_key < y.m_key; } ),
+           "keys are not sorted, " + what );
+
+    // The order of equal keys is not specified, the positions are compared as the second key
+    const auto less = []( const Item& x, const Item& y ) {
+        return x.m_key < y.m_key || ( x.m_key == y.m_key && x.m_pos < y.m_pos );
+    };
+    std::sort( exp.begin(), exp.end(), less );
+    std::sort( a.begin(), a.end(), less );
+
+    bool same = true;
+    for( size_t i = 0; i < n && same; i++ )
+        same = ( a[ i ].m_key == exp[ i ].m_key && a[ i ].m_pos == exp[ i ].m_pos );
+    Check( same, "elements differ from std::sort, " + what );
+}
+
+}
+
+int main( )
+{
+    std::mt19937_64 rng( 1 );
+
+    const size_t sizes[] = { 0, 1, 2, 100, RADIX_MIN_SIZE - 1, RADIX_MIN_SIZE, 10000, 300000 };
+    const unsigned int bits[] = { 0, 1, 7, RADIX_DIGIT_BITS, RADIX_DIGIT_BITS + 1, 32, 44, 64 };
+
+    for( const size_t n : sizes )
+    {
+        for( const unsigned int b : bits )
+            TestSort( n, b, rng );
+    }
+
+    return Result();
+}
@@ -0,0 +1,91 @@
+//
+// Test of the incremental search of A* (see astar.h): the built-in examples are solved
+//    by the repeated calls of function Step, which expand few nodes each. The status,
+//    the expanded nodes, the cost and the path must be the same as found by function Find.
+//    The progress callback must see the growing number of expanded nodes and the end.
+//
+
+#include "Check.h"
+#include "Examples.h"
+#include "Graph.h"
+#include "SearchProgress.h"
+#include "astar.h"
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+//
+// Solves "beg" by steps of "stepSize" expansions and compares it with function Find
+//
+void TestSteps( const State& beg, size_t stepSize, const std::string& what )
+{
+    Graph graph;
+
+    Astar<> whole;
+    const std::optional< std::vector< State > > exp = whole.Find( graph, beg );
+    Check( exp.has_value(), "path not found by Find, " + what );
+
+    // The callback is called after each expansion, for the period 1
+    Astar<> astar;
+    size_t callbackNo = 0;
+    SearchProgress last;
+    astar.SetCallback( [ & ]( const SearchProgress& p )
+    {
+        Check( p.m_expandedNo >= last.m_expandedNo, "expanded nodes decrease in callback, " + what );
+        last = p;
+        callbackNo++;
+    }, 1 );
+
+    astar.Start( graph, beg );
+
+    SearchProgress p;
+    size_t stepNo = 0;
+    size_t prevExpanded = 0;
+    do
+    {
+        p = astar.Step( stepSize );
+        stepNo++;
+        Check( p.m_expandedNo - prevExpanded <= stepSize, "step expands too many nodes, " + what );
+        prevExpanded = p.m_expandedNo;
+    }
+    while( !p.IsFinished() && stepNo <= whole.ExpandedNo() + 1 );
+
+    Check( p.m_status == SearchProgress::FOUND, "status of the search by steps, " + what );
+    Check( p.m_expandedNo == whole.ExpandedNo() && astar.ExpandedNo() == whole.ExpandedNo(),
+           "expanded nodes differ from Find, " + what );
+    Check( stepSize > 1 || stepNo >= whole.ExpandedNo(), "search by single expansions takes too few steps, " + what );
+
+    const std::optional< std::vector< State > > path = astar.Path();
+    Check( path.has_value() && exp.has_value() && path->size() == exp->size(), "cost differs from Find, " + what );
+    Check( path == exp, "path differs from Find, " + what );
+
+    Check( callbackNo > 0 && last.IsFinished() && last.m_status == SearchProgress::FOUND,
+           "callback does not see the end of the search, " + what );
+}
+
+}
+
+int main( )
+{
+    try
+    {
+        const Examples examples;
+        for( size_t i = 0; i < examples.size(); i++ )
+        {
+            for( const size_t stepSize : { 1, 7, 1000 } )
+            {
+                TestSteps( examples[ i ], stepSize,
+                           "example " + std::to_string( i + 1 ) + ", step " + std::to_string( stepSize ) );
+            }
+        }
+    }
+    catch( const std::exception& e )
+    {
+        Check( false, std::string( "exception: " ) + e.what() );
+    }
+
+    return Result();
+}
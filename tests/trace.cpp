@@ -0,0 +1,153 @@
+//
+// Test of the binary trace of expansions (see Trace.h):
+//    - the records appended by TraceWriter are read back by TraceReader unchanged,
+//    - the trace of A* solving the built-in examples has one record for each expansion,
+//      each search starts with the initial state, the parent of each other record is expanded
+//      earlier in the same search, "g" is one more than "g" of the parent and "f" does not decrease,
+//    - the file, which is not the trace, is rejected.
+//
+// Usage:
+//    test-trace DIR
+//
+//    DIR - directory of the temporary files
+//
+
+#include "Check.h"
+#include "Examples.h"
+#include "Graph.h"
+#include "Trace.h"
+#include "astar.h"
+#include <cstdio>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+//
+// Appends the records of the examples and reads them back
+//
+void TestRecords( const std::string& path )
+{
+    const Examples examples;
+    {
+        TraceWriter out( path );
+        for( size_t i = 0; i < examples.size(); i++ )
+        {
+            const State* parent = ( i == 0 ) ? nullptr : &examples[ i - 1 ];
+            out.Append( examples[ i ], parent, Cost( i ), Cost( 2 * i + 1 ), 10 * i );
+        }
+        Check( out.Size() == examples.size(), "number of the written records" );
+        out.Close();
+    }
+
+    const TraceReader in( path );
+    Check( in.Size() == examples.size(), "number of the read records" );
+    for( size_t i = 0; i < in.Size() && i < examples.size(); i++ )
+    {
+        const TraceRecord& r = in[ i ];
+        const std::string what = ", record " + std::to_string( i );
+        const uint64_t parent = ( i == 0 ) ? 0 : PackedState( examples[ i - 1 ] ).Hash();
+
+        Check( r.m_state.Unpack() == examples[ i ], "state differs" + what );
+        Check( r.m_parent == parent, "parent differs" + what );
+        Check( r.m_g == int16_t( i ) && r.m_h == int16_t( 2 * i + 1 ), "g or h differs" + what );
+        Check( r.m_openNo == 10 * i, "size of open set differs" + what );
+        Check( r.IsStart() == ( i == 0 ), "start of search" + what );
+    }
+}
+
+//
+// Solves the examples by A* with the trace and checks the expansions in the trace
+//
+void TestSearch( const std::string& path )
+{
+    const Examples examples;
+    Graph graph;
+    size_t expandedNo = 0;
+    {
+        TraceWriter out( path );
+        Astar<> astar;
+        astar.SetTrace( &out );
+        for( const State& beg : examples )
+        {
+            const std::optional< std::vector< State > > found = astar.Find( graph, beg );
+            Check( found.has_value(), "path not found" );
+            expandedNo += astar.ExpandedNo();
+        }
+        out.Close();
+    }
+
+    const TraceReader in( path );
+    Check( in.Size() == expandedNo, "number of records " + std::to_string( in.Size() )
+                                    + " instead of " + std::to_string( expandedNo ) );
+
+    // Index of the expansion of each state (by hash) in the current search
+    std::unordered_map< uint64_t, size_t > index;
+    size_t searchNo = 0;
+    for( size_t i = 0; i < in.Size(); i++ )
+    {
+        const TraceRecord& r = in[ i ];
+        const State s = r.m_state.Unpack();
+        const std::string what = ", record " + std::to_string( i );
+
+        Check( r.m_h == graph.Manhattan( s ), "h differs" + what );
+        if( r.IsStart() )
+        {
+            Check( searchNo < examples.size() && s == examples[ searchNo ], "initial state of search differs" + what );
+            searchNo++;
+            index.clear();
+        }
+        else
+        {
+            const auto it = index.find( r.m_parent );
+            Check( it != index.end(), "parent is not expanded" + what );
+            if( it != index.end() )
+                Check( r.m_g == in[ it->second ].m_g + 1, "g differs from g of parent" + what );
+            Check( r.F() >= in[ i - 1 ].F(), "f decreases" + what );
+        }
+
+        Check( index.emplace( r.m_state.Hash(), i ).second, "state is expanded again" + what );
+    }
+    Check( searchNo == examples.size(), "number of searches" );
+}
+
+}
+
+int main( int argc, char* argv[] )
+{
+    if( argc != 2 )
+    {
+        fprintf( stderr, "Usage: %s DIR\n", argv[ 0 ] );
+        return 2;
+    }
+
+    const std::string path = std::string( argv[ 1 ] ) + "/trace.bin";
+
+    try
+    {
+        TestRecords( path );
+        TestSearch( path );
+
+        // The text file is not the trace
+        const std::string text = std::string( argv[ 1 ] ) + "/trace.txt";
+        FILE* out = fopen( text.c_str(), "w" );
+        if( out )
+        {
+            fputs( "This is not the trace of expansions.\n", out );
+            fclose( out );
+        }
+        Throws( [ & ]( ) { TraceReader in( text ); }, "text file read as trace" );
+
+        remove( path.c_str() );
+        remove( text.c_str() );
+    }
+    catch( const std::exception& e )
+    {
+        Check( false, std::string( "exception: " ) + e.what() );
+    }
+
+    return Result();
+}
@@ -0,0 +1,54 @@
+#
+# Test of the summary of the trace (see trace.cpp): the trace written by sliding-puzzle
+# solving the built-in examples by A* is summarized by sliding-trace. The summary must
+# have one search for each example, the expansions of the searches must sum up to
+# the number of records, each parent must be found and "f" must not decrease.
+#
+# Usage:
+#    cmake -DSOLVER=PATH -DSUMMARY=PATH -DOUT=PATH -P tracesummary.cmake
+#
+#    SOLVER  - program sliding-puzzle
+#    SUMMARY - program sliding-trace
+#    OUT     - trace
+#
+
+set( EXAMPLE_NO 5 )
+
+execute_process( COMMAND ${SOLVER} --trace ${OUT} RESULT_VARIABLE rc OUTPUT_QUIET ERROR_QUIET )
+if( NOT rc EQUAL 0 )
+    message( FATAL_ERROR "sliding-puzzle failed: ${rc}" )
+endif()
+
+execute_process( COMMAND ${SUMMARY} ${OUT} RESULT_VARIABLE rc OUTPUT_VARIABLE summary )
+if( NOT rc EQUAL 0 )
+    message( FATAL_ERROR "sliding-trace failed: ${rc}" )
+endif()
+
+string( REGEX MATCH "RECORDS ([0-9]+)" records "${summary}" )
+set( records ${CMAKE_MATCH_1} )
+
+string( REGEX MATCHALL "SEARCH [0-9]+" searches "${summary}" )
+list( LENGTH searches searchNo )
+if( NOT searchNo EQUAL EXAMPLE_NO )
+    message( FATAL_ERROR "Summary has ${searchNo} searches instead of ${EXAMPLE_NO}:\n${summary}" )
+endif()
+
+set( sum 0 )
+string( REGEX MATCHALL "\n   expanded +[0-9]+" expanded "${summary}" )
+foreach( line ${expanded} )
+    string( REGEX MATCH "[0-9]+" n "${line}" )
+    math( EXPR sum "${sum} + ${n}" )
+endforeach()
+if( NOT sum EQUAL records )
+    message( FATAL_ERROR "Expansions of searches sum up to ${sum} instead of ${records} records:\n${summary}" )
+endif()
+
+foreach( field "unknown parents" "decreases of f" )
+    string( REGEX MATCHALL "${field} +0\n" zeros "${summary}" )
+    list( LENGTH zeros zeroNo )
+    if( NOT zeroNo EQUAL EXAMPLE_NO )
+        message( FATAL_ERROR "Field \"${field}\" is not zero in all searches:\n${summary}" )
+    endif()
+endforeach()
+
+file( REMOVE ${OUT} )